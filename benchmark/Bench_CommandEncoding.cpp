@@ -0,0 +1,211 @@
+/*
+ * Bench_CommandEncoding.cpp
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "Benchmark.h"
+#include <iostream>
+
+
+// Number of encoded commands per sample.
+static const std::uint64_t g_numCommands = 10000;
+
+static LLGL::Shader* CreateShader(LLGL::RenderSystem& renderer, LLGL::ShaderType type, const char* source)
+{
+    LLGL::ShaderDescriptor shaderDesc;
+    {
+        shaderDesc.type         = type;
+        shaderDesc.source       = source;
+        shaderDesc.sourceType   = LLGL::ShaderSourceType::CodeString;
+    }
+    auto shader = renderer.CreateShader(shaderDesc);
+
+    if (shader->HasErrors())
+        std::cerr << shader->QueryInfoLog() << std::endl;
+
+    return shader;
+}
+
+void RunCommandEncodingBenchmarks(BenchmarkRunner& runner, LLGL::RenderSystem& renderer, LLGL::RenderContext& context)
+{
+    /* Create vertex and index buffer with a degenerate triangle, so draw calls do not generate any fragments */
+    LLGL::VertexFormat vertexFormat;
+    vertexFormat.AppendAttribute({ "position", LLGL::Format::RG32Float });
+
+    const float vertices[] = { 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f };
+
+    LLGL::BufferDescriptor vertexBufferDesc;
+    {
+        vertexBufferDesc.type                   = LLGL::BufferType::Vertex;
+        vertexBufferDesc.size                   = sizeof(vertices);
+        vertexBufferDesc.vertexBuffer.format    = vertexFormat;
+    }
+    auto vertexBuffer = renderer.CreateBuffer(vertexBufferDesc, vertices);
+
+    const std::uint32_t indices[] = { 0, 1, 2 };
+
+    LLGL::BufferDescriptor indexBufferDesc;
+    {
+        indexBufferDesc.type                = LLGL::BufferType::Index;
+        indexBufferDesc.size                = sizeof(indices);
+        indexBufferDesc.indexBuffer.format  = LLGL::IndexFormat(LLGL::DataType::UInt32);
+    }
+    auto indexBuffer = renderer.CreateBuffer(indexBufferDesc, indices);
+
+    /* Create constant buffer, pipeline layout, and resource heap */
+    const float color[4] = { 1.0f, 1.0f, 1.0f, 1.0f };
+
+    LLGL::BufferDescriptor constantBufferDesc;
+    {
+        constantBufferDesc.type = LLGL::BufferType::Constant;
+        constantBufferDesc.size = sizeof(color);
+    }
+    auto constantBuffer = renderer.CreateBuffer(constantBufferDesc, color);
+
+    LLGL::PipelineLayoutDescriptor layoutDesc;
+    {
+        layoutDesc.bindings = { LLGL::BindingDescriptor{ LLGL::ResourceType::ConstantBuffer, LLGL::StageFlags::FragmentStage, 0 } };
+    }
+    auto pipelineLayout = renderer.CreatePipelineLayout(layoutDesc);
+
+    LLGL::ResourceHeapDescriptor resourceHeapDesc;
+    {
+        resourceHeapDesc.pipelineLayout = pipelineLayout;
+        resourceHeapDesc.resourceViews  = { constantBuffer };
+    }
+    auto resourceHeap = renderer.CreateResourceHeap(resourceHeapDesc);
+
+    /* Create shader program and graphics pipeline */
+    auto vertShader = CreateShader(
+        renderer,
+        LLGL::ShaderType::Vertex,
+        "#version 140\n"
+        "in vec2 position;\n"
+        "void main() {\n"
+        "    gl_Position = vec4(position, 0.0, 1.0);\n"
+        "}\n"
+    );
+
+    auto fragShader = CreateShader(
+        renderer,
+        LLGL::ShaderType::Fragment,
+        "#version 140\n"
+        "layout(std140) uniform Settings {\n"
+        "    vec4 color;\n"
+        "};\n"
+        "out vec4 fragColor;\n"
+        "void main() {\n"
+        "    fragColor = color;\n"
+        "}\n"
+    );
+
+    LLGL::ShaderProgramDescriptor shaderProgramDesc;
+    {
+        shaderProgramDesc.vertexFormats     = { vertexFormat };
+        shaderProgramDesc.vertexShader      = vertShader;
+        shaderProgramDesc.fragmentShader    = fragShader;
+    }
+    auto shaderProgram = renderer.CreateShaderProgram(shaderProgramDesc);
+
+    if (shaderProgram->HasErrors())
+    {
+        runner.Skip("CommandEncoding.*", shaderProgram->QueryInfoLog());
+        return;
+    }
+
+    LLGL::GraphicsPipelineDescriptor pipelineDesc;
+    {
+        pipelineDesc.shaderProgram  = shaderProgram;
+        pipelineDesc.pipelineLayout = pipelineLayout;
+    }
+    auto pipeline = renderer.CreateGraphicsPipeline(pipelineDesc);
+
+    /* Create command buffer and start recording, so each sample only measures the encoding itself */
+    auto commandQueue   = renderer.GetCommandQueue();
+    auto commands       = renderer.CreateCommandBuffer();
+
+    auto BeginCommands = [&]()
+    {
+        commands->Begin();
+        commands->BeginRenderPass(context);
+        commands->SetGraphicsPipeline(*pipeline);
+        commands->SetVertexBuffer(*vertexBuffer);
+        commands->SetIndexBuffer(*indexBuffer);
+        commands->SetGraphicsResourceHeap(*resourceHeap);
+    };
+
+    auto EndCommands = [&]()
+    {
+        commands->EndRenderPass();
+        commands->End();
+    };
+
+    /* Flush the recorded commands between samples (not measured) */
+    auto FlushCommands = [&]()
+    {
+        EndCommands();
+        commandQueue->Submit(*commands);
+        commandQueue->WaitIdle();
+        BeginCommands();
+    };
+
+    BeginCommands();
+    {
+        const LLGL::Viewport viewport { 0.0f, 0.0f, 640.0f, 480.0f };
+
+        runner.Run(
+            "CommandEncoding.SetVertexBuffer", g_numCommands,
+            [&](std::uint64_t n) { for (std::uint64_t i = 0; i < n; ++i) { commands->SetVertexBuffer(*vertexBuffer); } },
+            FlushCommands
+        );
+        runner.Run(
+            "CommandEncoding.SetIndexBuffer", g_numCommands,
+            [&](std::uint64_t n) { for (std::uint64_t i = 0; i < n; ++i) { commands->SetIndexBuffer(*indexBuffer); } },
+            FlushCommands
+        );
+        runner.Run(
+            "CommandEncoding.SetGraphicsPipeline", g_numCommands,
+            [&](std::uint64_t n) { for (std::uint64_t i = 0; i < n; ++i) { commands->SetGraphicsPipeline(*pipeline); } },
+            FlushCommands
+        );
+        runner.Run(
+            "CommandEncoding.SetGraphicsResourceHeap", g_numCommands,
+            [&](std::uint64_t n) { for (std::uint64_t i = 0; i < n; ++i) { commands->SetGraphicsResourceHeap(*resourceHeap); } },
+            FlushCommands
+        );
+        runner.Run(
+            "CommandEncoding.SetViewport", g_numCommands,
+            [&](std::uint64_t n) { for (std::uint64_t i = 0; i < n; ++i) { commands->SetViewport(viewport); } },
+            FlushCommands
+        );
+        runner.Run(
+            "CommandEncoding.Draw", g_numCommands,
+            [&](std::uint64_t n) { for (std::uint64_t i = 0; i < n; ++i) { commands->Draw(3, 0); } },
+            FlushCommands
+        );
+        runner.Run(
+            "CommandEncoding.DrawIndexed", g_numCommands,
+            [&](std::uint64_t n) { for (std::uint64_t i = 0; i < n; ++i) { commands->DrawIndexed(3, 0); } },
+            FlushCommands
+        );
+    }
+    EndCommands();
+
+    /* Release resources */
+    renderer.Release(*commands);
+    renderer.Release(*pipeline);
+    renderer.Release(*shaderProgram);
+    renderer.Release(*vertShader);
+    renderer.Release(*fragShader);
+    renderer.Release(*resourceHeap);
+    renderer.Release(*pipelineLayout);
+    renderer.Release(*constantBuffer);
+    renderer.Release(*indexBuffer);
+    renderer.Release(*vertexBuffer);
+}
+
+
+
+// ================================================================================
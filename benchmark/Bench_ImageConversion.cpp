@@ -0,0 +1,66 @@
+/*
+ * Bench_ImageConversion.cpp
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "Benchmark.h"
+#include <vector>
+
+
+// Image extent that is converted in each operation.
+static const std::uint32_t g_imageSize = 256;
+
+struct ImageConversionPair
+{
+    const char*         name;
+    LLGL::ImageFormat   srcFormat;
+    LLGL::DataType      srcDataType;
+    LLGL::ImageFormat   dstFormat;
+    LLGL::DataType      dstDataType;
+};
+
+static void RunImageConversion(BenchmarkRunner& runner, const ImageConversionPair& pair, std::size_t threadCount, const std::string& suffix)
+{
+    const std::uint32_t numPixels = g_imageSize * g_imageSize;
+
+    /* Allocate zero-initialized source and destination images */
+    std::vector<char> srcImage(LLGL::ImageDataSize(pair.srcFormat, pair.srcDataType, numPixels), 0);
+    std::vector<char> dstImage(LLGL::ImageDataSize(pair.dstFormat, pair.dstDataType, numPixels), 0);
+
+    LLGL::SrcImageDescriptor srcImageDesc { pair.srcFormat, pair.srcDataType, srcImage.data(), srcImage.size() };
+    LLGL::DstImageDescriptor dstImageDesc { pair.dstFormat, pair.dstDataType, dstImage.data(), dstImage.size() };
+
+    runner.Run(
+        std::string("ImageConversion.") + pair.name + suffix, 1,
+        [&](std::uint64_t n)
+        {
+            for (std::uint64_t i = 0; i < n; ++i)
+                LLGL::ConvertImageBuffer(srcImageDesc, dstImageDesc, threadCount);
+        }
+    );
+}
+
+void RunImageConversionBenchmarks(BenchmarkRunner& runner)
+{
+    const ImageConversionPair pairs[] =
+    {
+        { "RGBA8UInt_BGRA8UInt",     LLGL::ImageFormat::RGBA, LLGL::DataType::UInt8,   LLGL::ImageFormat::BGRA, LLGL::DataType::UInt8   },
+        { "RGB8UInt_RGBA8UInt",      LLGL::ImageFormat::RGB,  LLGL::DataType::UInt8,   LLGL::ImageFormat::RGBA, LLGL::DataType::UInt8   },
+        { "RGBA8UInt_RGBA32Float",   LLGL::ImageFormat::RGBA, LLGL::DataType::UInt8,   LLGL::ImageFormat::RGBA, LLGL::DataType::Float32 },
+        { "RGB32Float_RGBA8UInt",    LLGL::ImageFormat::RGB,  LLGL::DataType::Float32, LLGL::ImageFormat::RGBA, LLGL::DataType::UInt8   },
+        { "RGBA16Float_RGBA32Float", LLGL::ImageFormat::RGBA, LLGL::DataType::Float16, LLGL::ImageFormat::RGBA, LLGL::DataType::Float32 },
+        { "R16UInt_RGBA8UInt",       LLGL::ImageFormat::R,    LLGL::DataType::UInt16,  LLGL::ImageFormat::RGBA, LLGL::DataType::UInt8   },
+    };
+
+    for (const auto& pair : pairs)
+    {
+        RunImageConversion(runner, pair, 0, "");
+        RunImageConversion(runner, pair, LLGL::Constants::maxThreadCount, ".MT");
+    }
+}
+
+
+
+// ================================================================================
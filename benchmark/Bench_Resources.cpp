@@ -0,0 +1,94 @@
+/*
+ * Bench_Resources.cpp
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "Benchmark.h"
+
+
+// Number of created and released resources per sample.
+static const std::uint64_t g_numResources = 500;
+
+void RunResourceBenchmarks(BenchmarkRunner& runner, LLGL::RenderSystem& renderer)
+{
+    /* Buffer churn: create and release small constant buffers */
+    LLGL::BufferDescriptor bufferDesc;
+    {
+        bufferDesc.type = LLGL::BufferType::Constant;
+        bufferDesc.size = 256;
+    }
+
+    runner.Run(
+        "Resources.BufferCreateRelease", g_numResources,
+        [&](std::uint64_t n)
+        {
+            for (std::uint64_t i = 0; i < n; ++i)
+            {
+                auto buffer = renderer.CreateBuffer(bufferDesc);
+                renderer.Release(*buffer);
+            }
+        }
+    );
+
+    /* Texture churn: create and release small 2D textures */
+    LLGL::TextureDescriptor textureDesc;
+    {
+        textureDesc.type    = LLGL::TextureType::Texture2D;
+        textureDesc.format  = LLGL::Format::RGBA8UNorm;
+        textureDesc.extent  = { 64, 64, 1 };
+    }
+
+    runner.Run(
+        "Resources.TextureCreateRelease", g_numResources,
+        [&](std::uint64_t n)
+        {
+            for (std::uint64_t i = 0; i < n; ++i)
+            {
+                auto texture = renderer.CreateTexture(textureDesc);
+                renderer.Release(*texture);
+            }
+        }
+    );
+
+    /* Resource heap churn: create and release heaps with a constant buffer and a texture */
+    auto constantBuffer = renderer.CreateBuffer(bufferDesc);
+    auto texture        = renderer.CreateTexture(textureDesc);
+
+    LLGL::PipelineLayoutDescriptor layoutDesc;
+    {
+        layoutDesc.bindings =
+        {
+            LLGL::BindingDescriptor{ LLGL::ResourceType::ConstantBuffer, LLGL::StageFlags::VertexStage,   0 },
+            LLGL::BindingDescriptor{ LLGL::ResourceType::Texture,        LLGL::StageFlags::FragmentStage, 1 },
+        };
+    }
+    auto pipelineLayout = renderer.CreatePipelineLayout(layoutDesc);
+
+    LLGL::ResourceHeapDescriptor resourceHeapDesc;
+    {
+        resourceHeapDesc.pipelineLayout = pipelineLayout;
+        resourceHeapDesc.resourceViews  = { constantBuffer, texture };
+    }
+
+    runner.Run(
+        "Resources.ResourceHeapCreateRelease", g_numResources,
+        [&](std::uint64_t n)
+        {
+            for (std::uint64_t i = 0; i < n; ++i)
+            {
+                auto resourceHeap = renderer.CreateResourceHeap(resourceHeapDesc);
+                renderer.Release(*resourceHeap);
+            }
+        }
+    );
+
+    renderer.Release(*pipelineLayout);
+    renderer.Release(*texture);
+    renderer.Release(*constantBuffer);
+}
+
+
+
+// ================================================================================
@@ -0,0 +1,102 @@
+/*
+ * Bench_Shader.cpp
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "Benchmark.h"
+#include <fstream>
+#include <iterator>
+#include <vector>
+
+#ifdef LLGL_ENABLE_UTILITY
+#   include <LLGL/Utility.h>
+#endif
+
+
+// Number of operations per sample.
+static const std::uint64_t g_numOperations = 1000;
+
+// Number of created and released shader modules per sample.
+static const std::uint64_t g_numShaderModules = 100;
+
+static std::vector<char> ReadFileContent(const char* filename)
+{
+    std::ifstream file { filename, std::ios_base::binary };
+    if (!file.good())
+        return {};
+    return std::vector<char> { std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>() };
+}
+
+void RunShaderBenchmarks(BenchmarkRunner& runner)
+{
+    /* Benchmark parsing of pipeline layout signatures */
+    #ifdef LLGL_ENABLE_UTILITY
+
+    runner.Run(
+        "Shader.PipelineLayoutSignature", g_numOperations,
+        [](std::uint64_t n)
+        {
+            for (std::uint64_t i = 0; i < n; ++i)
+            {
+                auto layoutDesc = LLGL::PipelineLayoutDesc(
+                    "cbuffer(0):frag:vert,"
+                    "texture(1,2):frag,"
+                    "sampler(3):frag,"
+                );
+                (void)layoutDesc;
+            }
+        }
+    );
+
+    #else
+
+    runner.Skip("Shader.PipelineLayoutSignature", "LLGL was built without LLGL_ENABLE_UTILITY");
+
+    #endif // /LLGL_ENABLE_UTILITY
+}
+
+void RunShaderModuleBenchmarks(BenchmarkRunner& runner, LLGL::RenderSystem& renderer)
+{
+    /* Benchmark loading of SPIR-V modules, which includes their reflection if LLGL was built with LLGL_ENABLE_SPIRV_REFLECT */
+    if (renderer.GetRendererID() != LLGL::RendererID::Vulkan)
+    {
+        runner.Skip("Shader.SPIRVModuleCreateRelease", "renderer does not support SPIR-V modules");
+        return;
+    }
+
+    auto byteCode = ReadFileContent("Triangle.vert.spv");
+    if (byteCode.empty())
+        byteCode = ReadFileContent("../test/Triangle.vert.spv");
+
+    if (byteCode.empty())
+    {
+        runner.Skip("Shader.SPIRVModuleCreateRelease", "failed to read SPIR-V module: Triangle.vert.spv");
+        return;
+    }
+
+    LLGL::ShaderDescriptor shaderDesc;
+    {
+        shaderDesc.type         = LLGL::ShaderType::Vertex;
+        shaderDesc.source       = byteCode.data();
+        shaderDesc.sourceSize   = byteCode.size();
+        shaderDesc.sourceType   = LLGL::ShaderSourceType::BinaryBuffer;
+    }
+
+    runner.Run(
+        "Shader.SPIRVModuleCreateRelease", g_numShaderModules,
+        [&](std::uint64_t n)
+        {
+            for (std::uint64_t i = 0; i < n; ++i)
+            {
+                auto shader = renderer.CreateShader(shaderDesc);
+                renderer.Release(*shader);
+            }
+        }
+    );
+}
+
+
+
+// ================================================================================
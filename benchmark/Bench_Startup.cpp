@@ -0,0 +1,57 @@
+/*
+ * Bench_Startup.cpp
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "Benchmark.h"
+#include <memory>
+
+
+static void RunStartup(BenchmarkRunner& runner, const std::string& name, bool lazyExtensionLoading)
+{
+    LLGL::OpenGLRendererConfiguration config;
+    {
+        config.enableLazyExtensionLoading = lazyExtensionLoading;
+    }
+
+    LLGL::RenderSystemDescriptor rendererDesc;
+    {
+        rendererDesc.moduleName         = "OpenGL";
+        rendererDesc.rendererConfig     = &config;
+        rendererDesc.rendererConfigSize = sizeof(config);
+    }
+
+    LLGL::RenderContextDescriptor contextDesc;
+    {
+        contextDesc.videoMode.resolution = { 640, 480 };
+    }
+
+    /*
+    Each operation loads the renderer module and creates the first render context, which loads all GL extensions.
+    The module is unloaded afterwards, so the extensions are loaded again in the next operation.
+    */
+    runner.Run(
+        name, 1,
+        [&](std::uint64_t n)
+        {
+            for (std::uint64_t i = 0; i < n; ++i)
+            {
+                auto renderer = LLGL::RenderSystem::Load(rendererDesc);
+                renderer->CreateRenderContext(contextDesc);
+                LLGL::RenderSystem::Unload(std::move(renderer));
+            }
+        }
+    );
+}
+
+void RunStartupBenchmarks(BenchmarkRunner& runner)
+{
+    RunStartup(runner, "Startup.EagerExtensionLoading", false);
+    RunStartup(runner, "Startup.LazyExtensionLoading", true);
+}
+
+
+
+// ================================================================================
@@ -0,0 +1,219 @@
+/*
+ * Benchmark.cpp
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "Benchmark.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+
+
+/*
+ * Internal functions
+ */
+
+static void WriteJSONString(std::ostream& s, const std::string& str)
+{
+    s << '\"';
+    for (auto c : str)
+    {
+        switch (c)
+        {
+            case '\"':  s << "\\\""; break;
+            case '\\':  s << "\\\\"; break;
+            case '\n':  s << "\\n";  break;
+            case '\r':  s << "\\r";  break;
+            case '\t':  s << "\\t";  break;
+            default:
+                if (static_cast<unsigned char>(c) >= 0x20)
+                    s << c;
+                break;
+        }
+    }
+    s << '\"';
+}
+
+static void ComputeStatistics(std::vector<double>& sampleNs, BenchmarkResult& result)
+{
+    std::sort(sampleNs.begin(), sampleNs.end());
+
+    /* Determine minimum and median */
+    auto n = sampleNs.size();
+    result.minNs    = sampleNs.front();
+    result.medianNs = (n % 2 == 0 ? (sampleNs[n/2 - 1] + sampleNs[n/2]) * 0.5 : sampleNs[n/2]);
+
+    /* Determine mean and standard deviation */
+    double sum = 0.0;
+    for (auto t : sampleNs)
+        sum += t;
+    result.meanNs = sum / static_cast<double>(n);
+
+    double variance = 0.0;
+    for (auto t : sampleNs)
+        variance += (t - result.meanNs) * (t - result.meanNs);
+    result.stddevNs = std::sqrt(variance / static_cast<double>(n));
+}
+
+
+/*
+ * BenchmarkRunner class
+ */
+
+BenchmarkRunner::BenchmarkRunner(const BenchmarkConfig& config) :
+    config_ { config }
+{
+    if (config_.numSamples == 0)
+        config_.numSamples = 1;
+}
+
+void BenchmarkRunner::SetGroup(const std::string& group)
+{
+    group_ = group;
+}
+
+void BenchmarkRunner::Run(const std::string& name, std::uint64_t numOperations, const OperationFunc& operationFunc, const ResetFunc& resetFunc)
+{
+    if (IsFiltered(name))
+        return;
+
+    BenchmarkResult result;
+    {
+        result.name         = name;
+        result.group        = group_;
+        result.operations   = numOperations;
+        result.samples      = config_.numSamples;
+    }
+
+    try
+    {
+        /* Run warm-up samples to fill caches and let the driver allocate its internal memory */
+        for (std::uint32_t i = 0; i < config_.numWarmups; ++i)
+        {
+            operationFunc(numOperations);
+            if (resetFunc)
+                resetFunc();
+        }
+
+        /* Measure samples */
+        std::vector<double> sampleNs;
+        sampleNs.reserve(config_.numSamples);
+
+        for (std::uint32_t i = 0; i < config_.numSamples; ++i)
+        {
+            auto startTime = std::chrono::steady_clock::now();
+            {
+                operationFunc(numOperations);
+            }
+            auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - startTime);
+
+            sampleNs.push_back(static_cast<double>(duration.count()) / static_cast<double>(std::max(numOperations, std::uint64_t(1))));
+
+            if (resetFunc)
+                resetFunc();
+        }
+
+        ComputeStatistics(sampleNs, result);
+
+        std::cerr << group_ << '/' << name << ": " << result.medianNs << " ns" << std::endl;
+    }
+    catch (const std::exception& e)
+    {
+        result.skipReason = e.what();
+        std::cerr << group_ << '/' << name << ": skipped (" << e.what() << ")" << std::endl;
+    }
+
+    results_.push_back(result);
+}
+
+void BenchmarkRunner::Skip(const std::string& name, const std::string& reason)
+{
+    if (IsFiltered(name))
+        return;
+
+    BenchmarkResult result;
+    {
+        result.name         = name;
+        result.group        = group_;
+        result.skipReason   = reason;
+    }
+    results_.push_back(result);
+
+    std::cerr << group_ << '/' << name << ": skipped (" << reason << ")" << std::endl;
+}
+
+void BenchmarkRunner::AddContext(const std::string& key, const std::string& value)
+{
+    context_.push_back({ key, value });
+}
+
+void BenchmarkRunner::WriteJSON(std::ostream& s) const
+{
+    s << "{\n";
+
+    /* Write context entries */
+    s << "  \"context\": {\n";
+    for (std::size_t i = 0; i < context_.size(); ++i)
+    {
+        s << "    ";
+        WriteJSONString(s, context_[i].first);
+        s << ": ";
+        WriteJSONString(s, context_[i].second);
+        s << (i + 1 < context_.size() ? ",\n" : "\n");
+    }
+    s << "  },\n";
+
+    /* Write benchmark results */
+    s << "  \"benchmarks\": [\n";
+    for (std::size_t i = 0; i < results_.size(); ++i)
+    {
+        const auto& result = results_[i];
+
+        s << "    {\n";
+        s << "      \"name\": ";
+        WriteJSONString(s, result.group + "/" + result.name);
+        s << ",\n";
+        s << "      \"group\": ";
+        WriteJSONString(s, result.group);
+        s << ",\n";
+
+        if (result.skipReason.empty())
+        {
+            s << "      \"operations\": " << result.operations << ",\n";
+            s << "      \"samples\": " << result.samples << ",\n";
+            s << "      \"time_unit\": \"ns\",\n";
+            s << "      \"min\": " << result.minNs << ",\n";
+            s << "      \"median\": " << result.medianNs << ",\n";
+            s << "      \"mean\": " << result.meanNs << ",\n";
+            s << "      \"stddev\": " << result.stddevNs << "\n";
+        }
+        else
+        {
+            s << "      \"skipped\": ";
+            WriteJSONString(s, result.skipReason);
+            s << "\n";
+        }
+
+        s << (i + 1 < results_.size() ? "    },\n" : "    }\n");
+    }
+    s << "  ]\n";
+
+    s << "}\n";
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+bool BenchmarkRunner::IsFiltered(const std::string& name) const
+{
+    return (!config_.filter.empty() && (group_ + "/" + name).find(config_.filter) == std::string::npos);
+}
+
+
+
+// ================================================================================
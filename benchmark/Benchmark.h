@@ -0,0 +1,114 @@
+/*
+ * Benchmark.h
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_BENCHMARK_H
+#define LLGL_BENCHMARK_H
+
+
+#include <LLGL/LLGL.h>
+#include <functional>
+#include <ostream>
+#include <string>
+#include <vector>
+#include <cstdint>
+
+
+// Benchmark configuration.
+struct BenchmarkConfig
+{
+    std::uint32_t   numSamples  = 15;   // Number of measured samples per benchmark.
+    std::uint32_t   numWarmups  = 2;    // Number of unmeasured samples before the measurement.
+    std::string     filter;             // Only benchmarks whose name contain this string are run.
+};
+
+// Benchmark result of a single benchmark.
+struct BenchmarkResult
+{
+    std::string     name;
+    std::string     group;
+    std::uint64_t   operations  = 0;    // Number of operations per sample.
+    std::uint32_t   samples     = 0;
+    double          minNs       = 0.0;  // Minimal time (in nanoseconds) per operation.
+    double          medianNs    = 0.0;  // Median time (in nanoseconds) per operation.
+    double          meanNs      = 0.0;  // Mean time (in nanoseconds) per operation.
+    double          stddevNs    = 0.0;  // Standard deviation (in nanoseconds) per operation.
+    std::string     skipReason;         // Non-empty if the benchmark has been skipped.
+};
+
+// Benchmark runner that measures and collects the results of all benchmarks.
+class BenchmarkRunner
+{
+
+    public:
+
+        // Function that executes the specified number of operations.
+        using OperationFunc = std::function<void(std::uint64_t numOperations)>;
+
+        // Function that is called after each sample outside of the measurement (e.g. to flush the command queue).
+        using ResetFunc = std::function<void()>;
+
+        BenchmarkRunner(const BenchmarkConfig& config);
+
+        // Sets the current benchmark group, e.g. "OpenGL" or "CPU".
+        void SetGroup(const std::string& group);
+
+        // Measures the specified benchmark function, which executes 'numOperations' operations per sample.
+        void Run(const std::string& name, std::uint64_t numOperations, const OperationFunc& operationFunc, const ResetFunc& resetFunc = nullptr);
+
+        // Records the specified benchmark as skipped.
+        void Skip(const std::string& name, const std::string& reason);
+
+        // Adds a context entry that is written to the JSON output (e.g. renderer name and device).
+        void AddContext(const std::string& key, const std::string& value);
+
+        // Writes all results as JSON document to the specified output stream.
+        void WriteJSON(std::ostream& s) const;
+
+        // Returns the list of all benchmark results.
+        inline const std::vector<BenchmarkResult>& GetResults() const
+        {
+            return results_;
+        }
+
+    private:
+
+        bool IsFiltered(const std::string& name) const;
+
+        BenchmarkConfig                                     config_;
+        std::string                                         group_;
+        std::vector<BenchmarkResult>                        results_;
+        std::vector<std::pair<std::string, std::string>>    context_;
+
+};
+
+
+/* ----- Benchmark suites ----- */
+
+// Runs the command encoding benchmarks with the specified render system.
+void RunCommandEncodingBenchmarks(BenchmarkRunner& runner, LLGL::RenderSystem& renderer, LLGL::RenderContext& context);
+
+// Runs the resource heap, buffer, and texture churn benchmarks with the specified render system.
+void RunResourceBenchmarks(BenchmarkRunner& runner, LLGL::RenderSystem& renderer);
+
+// Runs the OpenGL startup benchmarks with eager and lazy extension loading.
+void RunStartupBenchmarks(BenchmarkRunner& runner);
+
+// Runs the image conversion benchmarks (CPU only).
+void RunImageConversionBenchmarks(BenchmarkRunner& runner);
+
+// Runs the pipeline layout signature benchmarks (CPU only).
+void RunShaderBenchmarks(BenchmarkRunner& runner);
+
+// Runs the SPIR-V shader module benchmarks with the specified render system (skipped for renderers other than Vulkan).
+void RunShaderModuleBenchmarks(BenchmarkRunner& runner, LLGL::RenderSystem& renderer);
+
+
+#endif
+
+
+
+// ================================================================================
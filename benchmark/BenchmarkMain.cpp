@@ -0,0 +1,126 @@
+/*
+ * BenchmarkMain.cpp
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "Benchmark.h"
+#include <iostream>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+#include <cstdlib>
+
+
+/*
+Usage: LLGL_Benchmarks [RENDERER ...] [--output FILE] [--filter NAME] [--samples N]
+Example: LIBGL_ALWAYS_SOFTWARE=1 LLGL_Benchmarks OpenGL --output results.json
+*/
+
+static void RunRendererBenchmarks(BenchmarkRunner& runner, const std::string& rendererModule)
+{
+    runner.SetGroup(rendererModule);
+
+    std::unique_ptr<LLGL::RenderSystem> renderer;
+    LLGL::RenderContext* context = nullptr;
+
+    try
+    {
+        /* Load renderer without debug layer, so only the backend itself is measured */
+        renderer = LLGL::RenderSystem::Load(rendererModule);
+
+        LLGL::RenderContextDescriptor contextDesc;
+        {
+            contextDesc.videoMode.resolution = { 640, 480 };
+        }
+        context = renderer->CreateRenderContext(contextDesc);
+    }
+    catch (const std::exception& e)
+    {
+        runner.Skip("*", e.what());
+        return;
+    }
+
+    /* Store renderer information in the context of the JSON output */
+    const auto& info = renderer->GetRendererInfo();
+    runner.AddContext(rendererModule + ".renderer", info.rendererName);
+    runner.AddContext(rendererModule + ".device", info.deviceName);
+    runner.AddContext(rendererModule + ".vendor", info.vendorName);
+
+    RunCommandEncodingBenchmarks(runner, *renderer, *context);
+    RunResourceBenchmarks(runner, *renderer);
+    RunShaderModuleBenchmarks(runner, *renderer);
+
+    LLGL::RenderSystem::Unload(std::move(renderer));
+}
+
+int main(int argc, char* argv[])
+{
+    BenchmarkConfig             config;
+    std::vector<std::string>    rendererModules;
+    std::string                 outputFilename;
+
+    /* Parse command line arguments */
+    for (int i = 1; i < argc; ++i)
+    {
+        std::string arg = argv[i];
+        if (arg == "--output" && i + 1 < argc)
+            outputFilename = argv[++i];
+        else if (arg == "--filter" && i + 1 < argc)
+            config.filter = argv[++i];
+        else if (arg == "--samples" && i + 1 < argc)
+            config.numSamples = static_cast<std::uint32_t>(std::atoi(argv[++i]));
+        else
+            rendererModules.push_back(arg);
+    }
+
+    if (rendererModules.empty())
+        rendererModules.push_back("OpenGL");
+
+    bool hasOpenGL = false;
+    for (const auto& module : rendererModules)
+    {
+        if (module == "OpenGL")
+            hasOpenGL = true;
+    }
+
+    BenchmarkRunner runner { config };
+
+    /* Run CPU only benchmarks */
+    runner.SetGroup("CPU");
+    RunImageConversionBenchmarks(runner);
+    RunShaderBenchmarks(runner);
+
+    /* Run benchmarks for each renderer */
+    for (const auto& module : rendererModules)
+        RunRendererBenchmarks(runner, module);
+
+    /* Run startup benchmarks after all other renderer benchmarks, since they load and unload the module several times */
+    if (hasOpenGL)
+    {
+        runner.SetGroup("OpenGL");
+        RunStartupBenchmarks(runner);
+    }
+
+    /* Write results as JSON document */
+    if (outputFilename.empty())
+        runner.WriteJSON(std::cout);
+    else
+    {
+        std::ofstream file { outputFilename };
+        if (!file.good())
+        {
+            std::cerr << "failed to open output file: " << outputFilename << std::endl;
+            return EXIT_FAILURE;
+        }
+        runner.WriteJSON(file);
+    }
+
+    return 0;
+}
+
+
+
+// ================================================================================
@@ -0,0 +1,88 @@
+/*
+ * AsyncReadback.h
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_ASYNC_READBACK_H
+#define LLGL_ASYNC_READBACK_H
+
+
+#include "RenderSystemChild.h"
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+/**
+\brief Asynchronous readback interface to read resource data from the GPU without stalling the pipeline.
+\remarks The copy operation into the readback memory is recorded when the readback is created,
+and it is synchronized with a fence, so the CPU can poll the readback or wait for it before the data is mapped.
+\code
+// Request texture data of the first MIP-map level
+auto myReadback = myRenderSystem->ReadTextureAsync(*myTexture, 0);
+
+// Render next frames ...
+
+// Access texture data as soon as it is available
+if (myReadback->Poll())
+{
+    auto myData = myReadback->Map();
+    // Process data ...
+    myReadback->Unmap();
+    myRenderSystem->Release(*myReadback);
+}
+\endcode
+\see RenderSystem::ReadTextureAsync
+\see RenderSystem::ReadBufferAsync
+*/
+class LLGL_EXPORT AsyncReadback : public RenderSystemChild
+{
+
+    public:
+
+        /**
+        \brief Returns true if the readback data is available, i.e. Map can be called without blocking the CPU.
+        \remarks This function does not block the CPU.
+        */
+        virtual bool Poll() = 0;
+
+        /**
+        \brief Blocks the CPU execution until the readback data is available.
+        \param[in] timeout Specifies the waiting timeout (in nanoseconds).
+        \return True if the readback data is available, or false if the readback has a timeout or the device is lost.
+        */
+        virtual bool Wait(std::uint64_t timeout) = 0;
+
+        /**
+        \brief Maps the readback memory into CPU memory space. This blocks the CPU execution until the readback data is available.
+        \return Pointer to the readback data. This is not a copy of the data, but a direct mapping of the readback memory.
+        \remarks The pointer is only valid until Unmap is called.
+        \see GetSize
+        \see Unmap
+        */
+        virtual const void* Map() = 0;
+
+        //! Unmaps the readback memory from CPU memory space.
+        virtual void Unmap() = 0;
+
+        /**
+        \brief Returns the size (in bytes) of the readback data.
+        \remarks Texture data is tightly packed in the hardware format of the texture, i.e. without any row or layer padding.
+        */
+        virtual std::uint64_t GetSize() const = 0;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -99,6 +99,25 @@ struct BufferFlags
         \see RenderSystem::WriteBuffer
         */
         DynamicUsage        = (1 << 2),
+
+        /**
+        \brief Buffer is created as sparse resource, i.e. its memory is not allocated at creation time but committed in pages.
+        \remarks The content of pages that are not committed is undefined, and the initial data of the buffer is ignored.
+        Sparse buffers can not be mapped into CPU memory space.
+        \note Only supported with: OpenGL, Vulkan.
+        \see RenderingFeatures::hasSparseBuffers
+        \see RenderingLimits::sparsePageSize
+        \see CommandQueue::UpdateTileMappings(Buffer&, std::uint32_t, const BufferTileMapping*)
+        */
+        Sparse              = (1 << 3),
+
+        /**
+        \brief Buffer can be used as render condition, i.e. it contains predicate values for conditional rendering.
+        \note Only supported with: Vulkan, Direct3D 12.
+        \see RenderingFeatures::hasRenderConditionBuffers
+        \see CommandBuffer::BeginRenderCondition(Buffer&, std::uint64_t, const RenderConditionMode)
+        */
+        RenderCondition     = (1 << 4),
     };
 };
 
@@ -16,6 +16,8 @@
 
 #include "Buffer.h"
 #include "BufferArray.h"
+#include "Texture.h"
+#include "SamplerFlags.h"
 #include "ResourceHeap.h"
 #include "PipelineLayoutFlags.h"
 
@@ -95,12 +97,57 @@ class LLGL_EXPORT CommandBuffer : public RenderSystemChild
         */
         virtual void CopyBuffer(Buffer& dstBuffer, std::uint64_t dstOffset, Buffer& srcBuffer, std::uint64_t srcOffset, std::uint64_t size) = 0;
 
-        #if 0
-        virtual void FillBuffer(Buffer& buffer, [...]) = 0;
-        virtual void FillTexture(Texture& texture, [...]) = 0;
-        virtual void CopyTexture(Texture& dstTexture, Texture& srcTexture, [...]) = 0;
-        virtual void BlitTexture(Texture& dstTexture, Texture& srcTexture, [...], Filter filter) = 0;
-        #endif
+        /**
+        \brief Encodes a buffer fill command for the specified buffer region.
+        \param[in] dstBuffer Specifies the destination buffer whose data is to be filled.
+        \param[in] dstOffset Specifies the destination offset (in bytes) at which the buffer is to be filled. This must be a multiple of 4.
+        \param[in] value Specifies the 32-bit value with which the buffer region is to be filled.
+        \param[in] fillSize Specifies the size (in bytes) of the buffer region to fill. This must be a multiple of 4.
+        This offset plus the size (i.e. <code>dstOffset + fillSize</code>) must be less than or equal to the size of the destination buffer.
+        \remarks Backends without a native buffer fill command (i.e. Direct3D and Metal with a non-uniform byte pattern) update the buffer region with an intermediate buffer instead.
+        \note This must not be called during a render pass.
+        */
+        virtual void FillBuffer(Buffer& dstBuffer, std::uint64_t dstOffset, std::uint32_t value, std::uint64_t fillSize) = 0;
+
+        /**
+        \brief Encodes a texture copy command for the specified texture region.
+        \param[in] dstTexture Specifies the destination texture whose data is to be updated.
+        \param[in] dstLocation Specifies the destination MIP-map level and offset at which the destination texture is to be updated.
+        \param[in] srcTexture Specifies the source texture whose data is to be read from.
+        \param[in] srcRegion Specifies the source MIP-map level and region which is to be copied.
+        The extent of this region also determines the extent of the destination region.
+        \remarks Both textures must have the same format (or at least formats of the same size) and the same number of samples.
+        For array textures, the array layers are specified by the Z component of the offset and the depth component of the extent (for 1D-array textures it's the Y component and the height component).
+        \note This must not be called during a render pass.
+        \see TextureRegion
+        \see TextureLocation
+        */
+        virtual void CopyTexture(
+            Texture&                dstTexture,
+            const TextureLocation&  dstLocation,
+            Texture&                srcTexture,
+            const TextureRegion&    srcRegion
+        ) = 0;
+
+        /**
+        \brief Encodes a texture blit command, which copies the source region into the destination region with scaling and format conversion.
+        \param[in] dstTexture Specifies the destination texture whose data is to be updated.
+        \param[in] dstRegion Specifies the destination MIP-map level and region which is to be updated.
+        \param[in] srcTexture Specifies the source texture whose data is to be read from.
+        \param[in] srcRegion Specifies the source MIP-map level and region which is to be read from.
+        \param[in] filter Specifies the filter that is applied if the extents of the source and destination regions differ. By default SamplerFilter::Linear.
+        \remarks The number of array layers (i.e. the depth component for array textures) must be equal for both regions.
+        \note Direct3D and Metal only support blits where the extents of both regions are equal, i.e. without scaling.
+        \note This must not be called during a render pass.
+        \see CopyTexture
+        */
+        virtual void BlitTexture(
+            Texture&                dstTexture,
+            const TextureRegion&    dstRegion,
+            Texture&                srcTexture,
+            const TextureRegion&    srcRegion,
+            const SamplerFilter     filter      = SamplerFilter::Linear
+        ) = 0;
 
         #if 0 // TODO: enable this
         /**
@@ -328,19 +375,55 @@ class LLGL_EXPORT CommandBuffer : public RenderSystemChild
         \brief Binds the specified resource heap to the graphics pipeline.
         \param[in] resourceHeap Specifies the resource heap that contains all shader resources that will be bound to the shader pipeline.
         \param[in] firstSet Specifies the set number of the first layout descriptor.
+        \param[in] numDynamicOffsets Specifies the number of dynamic offsets. This must be equal to the number of bindings with the BindingFlags::DynamicOffset flag.
+        \param[in] dynamicOffsets Pointer to an array of byte offsets, one for each binding with the BindingFlags::DynamicOffset flag,
+        in the same order as these bindings appear in the pipeline layout.
+        Each offset must be a multiple of RenderingLimits::minConstantBufferOffsetAlignment. This can be null if 'numDynamicOffsets' is 0.
         \remarks This may invalidate the previously bound resource heap for both the graphics and compute pipeline.
         \note Parameter 'firstSet' is only supported with: Vulkan.
+        \see BindingFlags::DynamicOffset
         */
-        virtual void SetGraphicsResourceHeap(ResourceHeap& resourceHeap, std::uint32_t firstSet = 0) = 0;
+        virtual void SetGraphicsResourceHeap(
+            ResourceHeap&           resourceHeap,
+            std::uint32_t           firstSet            = 0,
+            std::uint32_t           numDynamicOffsets   = 0,
+            const std::uint32_t*    dynamicOffsets      = nullptr
+        ) = 0;
 
         /**
         \brief Binds the specified resource heap to the compute pipeline.
         \param[in] resourceHeap Specifies the resource heap that contains all shader resources that will be bound to the shader pipeline.
         \param[in] firstSet Specifies the set number of the first layout descriptor.
+        \param[in] numDynamicOffsets Specifies the number of dynamic offsets. This must be equal to the number of bindings with the BindingFlags::DynamicOffset flag.
+        \param[in] dynamicOffsets Pointer to an array of byte offsets, one for each binding with the BindingFlags::DynamicOffset flag.
         \remarks This may invalidate the previously bound resource heap for both the graphics and compute pipeline.
         \note Parameter 'firstSet' is only supported with: Vulkan.
+        \see SetGraphicsResourceHeap
+        */
+        virtual void SetComputeResourceHeap(
+            ResourceHeap&           resourceHeap,
+            std::uint32_t           firstSet            = 0,
+            std::uint32_t           numDynamicOffsets   = 0,
+            const std::uint32_t*    dynamicOffsets      = nullptr
+        ) = 0;
+
+        /* ----- Inline Constants ----- */
+
+        /**
+        \brief Writes the specified data into the inline constants of the currently bound pipeline layout.
+        \param[in] stageFlags Specifies the shader stages whose inline constants are updated. This can be a bitwise OR combination of the StageFlags bitmasks.
+        \param[in] offset Specifies the offset (in bytes) within the address space of all inline constant ranges. This must be a multiple of 4.
+        \param[in] data Raw pointer to the data that is to be written.
+        \param[in] dataSize Specifies the size (in bytes) of the data. This must be a multiple of 4.
+        \remarks This is the fastest way to update small amounts of data for each draw call or dispatch (e.g. a world matrix),
+        because no buffer needs to be updated and no resource heap needs to be bound.
+        A graphics or compute pipeline with a pipeline layout that contains the respective ranges must be bound before this function is called.
+        \remarks The content of the inline constants is retained until it is overwritten or a different pipeline layout is bound.
+        \note For Vulkan, 'stageFlags' must contain all shader stages of the ranges that overlap with the specified data.
+        \see PipelineLayoutDescriptor::inlineConstants
+        \see RenderingLimits::maxInlineConstantsSize
         */
-        virtual void SetComputeResourceHeap(ResourceHeap& resourceHeap, std::uint32_t firstSet = 0) = 0;
+        virtual void SetInlineConstants(long stageFlags, std::uint32_t offset, const void* data, std::uint32_t dataSize) = 0;
 
         /* ----- Render Passes ----- */
 
@@ -475,6 +558,33 @@ class LLGL_EXPORT CommandBuffer : public RenderSystemChild
         */
         virtual bool QueryPipelineStatisticsResult(Query& query, QueryPipelineStatistics& result) = 0;
 
+        /**
+        \brief Writes the results of the specified query objects into a buffer without reading them back to the CPU.
+        \param[in] numQueries Specifies the number of query objects.
+        \param[in] queries Pointer to an array of query objects whose results are to be written.
+        None of these query objects must have been created with the QueryType::PipelineStatistics type.
+        \param[in] dstBuffer Specifies the destination buffer the results are written to.
+        \param[in] dstOffset Specifies the offset (in bytes) of the first result within the destination buffer. This must be a multiple of 8.
+        \remarks Each result is written as 64-bit unsigned integer, i.e. the result of <code>queries[i]</code> is written at <code>dstOffset + i*8</code>.
+        The GPU waits until all results are available. This function must be called outside of a render pass.
+        The results can be used as render condition (if RenderingFeatures::hasRenderConditionBuffers is true), e.g. to implement occlusion culling with many queries:
+        \code
+        // Write occlusion query results of all proxy geometries
+        myCmdBuffer->CopyQueryResults(numProxies, myOcclusionQueries, *myPredicateBuffer, 0);
+        // Draw each object only if its proxy geometry was visible
+        for (std::uint32_t i = 0; i < numProxies; ++i) {
+            myCmdBuffer->BeginRenderCondition(*myPredicateBuffer, i*8, LLGL::RenderConditionMode::NoWait);
+            // draw actual object ...
+            myCmdBuffer->EndRenderCondition();
+        }
+        \endcode
+        \note Only supported with: OpenGL, Vulkan.
+        With OpenGL, the results can only be read from the buffer (e.g. by shaders), since OpenGL does not support render conditions from buffers.
+        \see RenderingFeatures::hasQueryResultBuffers
+        \see BeginRenderCondition(Buffer&, std::uint64_t, const RenderConditionMode)
+        */
+        virtual void CopyQueryResults(std::uint32_t numQueries, Query* const * queries, Buffer& dstBuffer, std::uint64_t dstOffset) = 0;
+
         /**
         \brief Begins conditional rendering with the specified query object.
         \param[in] query Specifies the query object which is to be used as render condition.
@@ -495,6 +605,21 @@ class LLGL_EXPORT CommandBuffer : public RenderSystemChild
         */
         virtual void BeginRenderCondition(Query& query, const RenderConditionMode mode) = 0;
 
+        /**
+        \brief Begins conditional rendering with a predicate value that is read from the specified buffer.
+        \param[in] buffer Specifies the buffer that contains the predicate value.
+        This buffer must have been created with the BufferFlags::RenderCondition flag.
+        \param[in] offset Specifies the offset (in bytes) of the predicate value within the buffer. This must be a multiple of 8.
+        \param[in] mode Specifies the mode of the render condition. Since the predicate value is read by the GPU,
+        only the inversion of the mode is considered, i.e. whether it is one of the <code>...Inverted</code> entries.
+        \remarks The predicate value is a 64-bit unsigned integer, as written by CopyQueryResults.
+        All drawing commands until the next call to EndRenderCondition are discarded if this value is zero, or non-zero if the condition is inverted.
+        \note Only supported with: Vulkan, Direct3D 12. For Vulkan, only the lower 32 bits of the predicate value are considered.
+        \see RenderingFeatures::hasRenderConditionBuffers
+        \see CopyQueryResults
+        */
+        virtual void BeginRenderCondition(Buffer& buffer, std::uint64_t offset, const RenderConditionMode mode) = 0;
+
         /**
         \brief Ends the current render condition.
         \see BeginRenderCondition
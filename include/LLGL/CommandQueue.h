@@ -10,6 +10,7 @@
 
 
 #include "RenderSystemChild.h"
+#include "CommandQueueFlags.h"
 #include <cstdint>
 
 
@@ -19,6 +20,8 @@ namespace LLGL
 
 class CommandBuffer;
 class Fence;
+class Buffer;
+class Texture;
 
 /**
 \brief Command queue interface.
@@ -49,13 +52,32 @@ class LLGL_EXPORT CommandQueue : public RenderSystemChild
         */
         virtual void Submit(CommandBuffer& commandBuffer) = 0;
 
-        #if 0
         /**
-        \briefs Submits all command buffers in the specified array to the command queue at once.
+        \brief Submits all command buffers in the specified array to the command queue at once.
+        \param[in] numCommandBuffers Specifies the number of command buffers in the array.
+        \param[in] commandBuffers Pointer to an array of command buffers. This must not contain null pointers.
+        \remarks The command buffers are submitted as a single batch. By default, this function submits each command buffer individually.
         \see Submit(CommandBuffer&)
+        \see Submit(const SubmitDescriptor&)
         */
         virtual void Submit(std::uint32_t numCommandBuffers, CommandBuffer* const * commandBuffers);
-        #endif
+
+        /**
+        \brief Submits several batches of command buffers to the command queue at once.
+        \param[in] desc Specifies the batches of command buffers and the dependencies between them.
+        \remarks By default, this function submits the batches in order, one after another.
+        Renderers that execute each command buffer in submission order satisfy the dependencies between batches implicitly.
+        \code
+        LLGL::SubmitDescriptor submitDesc;
+        submitDesc.batches.resize(2);
+        submitDesc.batches[0].commandBuffers = { myShadowMapCmdBuffer0, myShadowMapCmdBuffer1 };
+        submitDesc.batches[1].commandBuffers = { mySceneCmdBuffer };
+        submitDesc.batches[1].waitBatches    = { 0 };
+        myCmdQueue->Submit(submitDesc);
+        \endcode
+        \see SubmitDescriptor
+        */
+        virtual void Submit(const SubmitDescriptor& desc);
 
         /* ----- Fences ----- */
 
@@ -84,6 +106,34 @@ class LLGL_EXPORT CommandQueue : public RenderSystemChild
         */
         virtual void WaitIdle() = 0;
 
+        /* ----- Sparse Resources ----- */
+
+        /**
+        \brief Commits or decommits memory pages of the specified sparse buffer.
+        \param[in] buffer Specifies the buffer whose pages are to be updated. This must have been created with the BufferFlags::Sparse flag.
+        \param[in] numMappings Specifies the number of tile mappings.
+        \param[in] mappings Pointer to an array of tile mappings.
+        \remarks Pages that are decommitted must no longer be accessed by any command buffer that has been submitted before.
+        The content of newly committed pages is undefined.
+        By default, this function throws an exception, since sparse resources are only supported by some renderers.
+        \see RenderingFeatures::hasSparseBuffers
+        \see BufferTileMapping
+        */
+        virtual void UpdateTileMappings(Buffer& buffer, std::uint32_t numMappings, const BufferTileMapping* mappings);
+
+        /**
+        \brief Commits or decommits memory tiles of the specified sparse texture.
+        \param[in] texture Specifies the texture whose tiles are to be updated. This must have been created with the TextureFlags::Sparse flag.
+        \param[in] numMappings Specifies the number of tile mappings.
+        \param[in] mappings Pointer to an array of tile mappings.
+        \remarks Tiles that are decommitted must no longer be accessed by any command buffer that has been submitted before.
+        The content of newly committed tiles is undefined.
+        By default, this function throws an exception, since sparse resources are only supported by some renderers.
+        \see RenderingFeatures::hasSparseTextures
+        \see TextureTileMapping
+        */
+        virtual void UpdateTileMappings(Texture& texture, std::uint32_t numMappings, const TextureTileMapping* mappings);
+
     protected:
 
         CommandQueue() = default;
@@ -0,0 +1,98 @@
+/*
+ * CommandQueueFlags.h
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_COMMAND_QUEUE_FLAGS_H
+#define LLGL_COMMAND_QUEUE_FLAGS_H
+
+
+#include "TextureFlags.h"
+#include <vector>
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+class CommandBuffer;
+
+/* ----- Structures ----- */
+
+/**
+\brief Batch of command buffers for a command queue submission.
+\see SubmitDescriptor::batches
+*/
+struct SubmitBatchDescriptor
+{
+    //! Command buffers of this batch. They are submitted in the order of this array.
+    std::vector<CommandBuffer*> commandBuffers;
+
+    /**
+    \brief Indices of the previous batches this batch must wait for, before its command buffers start execution.
+    \remarks Each index must refer to a batch that precedes this batch within the same submit descriptor.
+    Batches without such dependencies might overlap their execution on the GPU with previous batches.
+    \see SubmitDescriptor::batches
+    */
+    std::vector<std::uint32_t>  waitBatches;
+};
+
+/**
+\brief Command queue submission descriptor structure.
+\remarks All batches of this descriptor are submitted to the command queue at once,
+which is considerably cheaper than submitting each command buffer individually (e.g. for Vulkan).
+\see CommandQueue::Submit(const SubmitDescriptor&)
+*/
+struct SubmitDescriptor
+{
+    //! Batches of command buffers in submission order.
+    std::vector<SubmitBatchDescriptor> batches;
+};
+
+/**
+\brief Memory page mapping of a sparse buffer.
+\see CommandQueue::UpdateTileMappings(Buffer&, std::uint32_t, const BufferTileMapping*)
+\see BufferFlags::Sparse
+*/
+struct BufferTileMapping
+{
+    //! Offset (in bytes) of the first page. This must be a multiple of RenderingLimits::sparsePageSize. By default 0.
+    std::uint64_t   offset  = 0;
+
+    //! Size (in bytes) of all pages. This must be a multiple of RenderingLimits::sparsePageSize. By default 0.
+    std::uint64_t   size    = 0;
+
+    //! Specifies whether the memory pages are committed (true) or decommitted (false). By default true.
+    bool            commit  = true;
+};
+
+/**
+\brief Memory tile mapping of a sparse texture.
+\see CommandQueue::UpdateTileMappings(Texture&, std::uint32_t, const TextureTileMapping*)
+\see TextureFlags::Sparse
+*/
+struct TextureTileMapping
+{
+    /**
+    \brief Texture region of the tiles. Array layers are specified in the same manner as for TextureRegion.
+    \remarks The offset and extent must be a multiple of the tile extent (see Texture::QuerySparseTileExtent),
+    except for the extent at the border of a MIP-map level.
+    */
+    TextureRegion   region;
+
+    //! Specifies whether the memory tiles are committed (true) or decommitted (false). By default true.
+    bool            commit  = true;
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -119,6 +119,16 @@ enum class Format
     BC1RGBA,            //!< Compressed color format: RGBA S3TC DXT1 with 8 bytes per 4x4 block.
     BC2RGBA,            //!< Compressed color format: RGBA S3TC DXT3 with 16 bytes per 4x4 block.
     BC3RGBA,            //!< Compressed color format: RGBA S3TC DXT5 with 16 bytes per 4x4 block.
+    BC4RUNorm,          //!< Compressed color format: red normalized unsigned integer component (RGTC1) with 8 bytes per 4x4 block.
+    BC4RSNorm,          //!< Compressed color format: red normalized signed integer component (RGTC1) with 8 bytes per 4x4 block.
+    BC5RGUNorm,         //!< Compressed color format: red, green normalized unsigned integer components (RGTC2) with 16 bytes per 4x4 block.
+    BC5RGSNorm,         //!< Compressed color format: red, green normalized signed integer components (RGTC2) with 16 bytes per 4x4 block.
+    BC6HRGBUFloat,      //!< Compressed color format: red, green, blue unsigned floating point components (BPTC) with 16 bytes per 4x4 block.
+    BC6HRGBSFloat,      //!< Compressed color format: red, green, blue signed floating point components (BPTC) with 16 bytes per 4x4 block.
+    BC7RGBAUNorm,       //!< Compressed color format: red, green, blue, alpha normalized unsigned integer components (BPTC) with 16 bytes per 4x4 block.
+    ETC2RGB8UNorm,      //!< Compressed color format: red, green, blue ETC2 with 8 bytes per 4x4 block. \note Only supported with: OpenGL, Vulkan.
+    ETC2RGB8A1UNorm,    //!< Compressed color format: red, green, blue ETC2 with 1-bit punch-through alpha and 8 bytes per 4x4 block. \note Only supported with: OpenGL, Vulkan.
+    ETC2RGBA8UNorm,     //!< Compressed color format: red, green, blue ETC2 and alpha EAC with 16 bytes per 4x4 block. \note Only supported with: OpenGL, Vulkan.
 };
 
 /**
@@ -167,7 +177,7 @@ LLGL_EXPORT bool SplitFormat(const Format format, DataType& dataType, std::uint3
 
 /**
 \brief Returns true if the specified hardware format is a compressed format,
-i.e. either Format::BC1RGB, Format::BC1RGBA, Format::BC2RGBA, or Format::BC3RGBA.
+i.e. any of the block compressed formats from Format::BC1RGB to Format::ETC2RGBA8UNorm.
 \see Format
 */
 LLGL_EXPORT bool IsCompressedFormat(const Format format);
@@ -13,6 +13,7 @@ namespace LLGL
 {
 
 
+class AsyncReadback;
 class Buffer;
 class BufferArray;
 class Canvas;
@@ -59,6 +60,8 @@ struct GraphicsPipelineDescriptor;
 struct ImageInitialization;
 struct MultiSamplingDescriptor;
 struct OpenGLDependentStateDescriptor;
+struct OpenGLRendererConfiguration;
+struct PipelineCacheStatistics;
 struct PipelineLayoutDescriptor;
 struct ProfileOpenGLDescriptor;
 struct QueryDescriptor;
@@ -75,6 +78,7 @@ struct RenderSystemDescriptor;
 struct RenderTargetDescriptor;
 struct ResourceHeapDescriptor;
 struct ResourceViewDescriptor;
+struct SamplerCacheStatistics;
 struct SamplerDescriptor;
 struct Scissor;
 struct ShaderDescriptor;
@@ -86,6 +90,7 @@ struct StencilFaceDescriptor;
 struct StreamOutputAttribute;
 struct StreamOutputFormat;
 struct TextureDescriptor;
+struct TextureLocation;
 struct TextureRegion;
 struct VertexAttribute;
 struct VertexFormat;
@@ -0,0 +1,239 @@
+/*
+ * GeometryPool.h
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_GEOMETRY_POOL_H
+#define LLGL_GEOMETRY_POOL_H
+
+
+#include "Export.h"
+#include "NonCopyable.h"
+#include "Constants.h"
+#include "BufferFlags.h"
+#include <map>
+#include <vector>
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+class RenderSystem;
+class CommandBuffer;
+class Buffer;
+
+/**
+\brief Handle of a geometry allocation within a GeometryPool.
+\see GeometryPool::Alloc
+*/
+using GeometryHandle = std::uint32_t;
+
+/**
+\brief Geometry pool descriptor structure.
+\see GeometryPool::GeometryPool
+*/
+struct GeometryPoolDescriptor
+{
+    /**
+    \brief Size (in bytes) of each vertex buffer that is created by the pool. By default 16 MB.
+    \remarks Geometry that does not fit into a buffer of this size is allocated in a dedicated buffer.
+    */
+    std::uint64_t   vertexBufferSize    = 16 * 1024 * 1024;
+
+    //! Size (in bytes) of each index buffer that is created by the pool. By default 4 MB.
+    std::uint64_t   indexBufferSize     = 4 * 1024 * 1024;
+};
+
+/**
+\brief Range of a geometry allocation within the buffers of a GeometryPool.
+\remarks The indices of the geometry are relative to its first vertex,
+so 'firstIndex' and 'vertexOffset' can be passed directly to CommandBuffer::DrawIndexed.
+\see GeometryPool::GetRange
+\see CommandBuffer::DrawIndexed(std::uint32_t, std::uint32_t, std::int32_t)
+*/
+struct GeometryRange
+{
+    //! Vertex buffer that contains the vertices of the geometry.
+    Buffer*         vertexBuffer    = nullptr;
+
+    //! Index buffer that contains the indices of the geometry, or null if the geometry has no indices.
+    Buffer*         indexBuffer     = nullptr;
+
+    //! Number of vertices of the geometry.
+    std::uint32_t   numVertices     = 0;
+
+    //! Number of indices of the geometry.
+    std::uint32_t   numIndices      = 0;
+
+    //! Index of the first index of the geometry within the index buffer.
+    std::uint32_t   firstIndex      = 0;
+
+    //! Index of the first vertex of the geometry within the vertex buffer. This is the base vertex that is added to each index.
+    std::int32_t    vertexOffset    = 0;
+};
+
+/**
+\brief Utility class to suballocate the vertices and indices of many small meshes from a few large buffers.
+
+This class is not required for any interaction with the render system.
+It creates one set of vertex buffers for each distinct vertex format, and one set of index buffers for each index format,
+so all meshes with the same formats share the same buffers, and switching between them does not require any buffer binding.
+\code
+// Allocate geometry of a mesh and draw it
+LLGL::GeometryPool myGeometryPool { *myRenderSystem };
+auto myMesh = myGeometryPool.Alloc(myVertexFormat, numVertices, vertices, LLGL::DataType::UInt16, numIndices, indices);
+const auto& myRange = myGeometryPool.GetRange(myMesh);
+myCmdBuffer->SetVertexBuffer(*myRange.vertexBuffer);
+myCmdBuffer->SetIndexBuffer(*myRange.indexBuffer);
+myCmdBuffer->DrawIndexed(myRange.numIndices, myRange.firstIndex, myRange.vertexOffset);
+\endcode
+\see RenderSystem::CreateBuffer
+*/
+class LLGL_EXPORT GeometryPool : public NonCopyable
+{
+
+    public:
+
+        /**
+        \brief Initializes the geometry pool. No buffer is created until the first allocation.
+        \param[in] renderSystem Specifies the render system that is used to create, write, and release the buffers.
+        The render system must stay alive as long as this geometry pool.
+        \param[in] desc Specifies the sizes of the buffers that are created by the pool.
+        */
+        GeometryPool(RenderSystem& renderSystem, const GeometryPoolDescriptor& desc = {});
+
+        //! Releases all buffers of this pool.
+        ~GeometryPool();
+
+        /**
+        \brief Allocates a range of vertices and indices, and writes the specified data into it.
+        \param[in] vertexFormat Specifies the vertex format. The stride of this format must not be zero.
+        \param[in] numVertices Specifies the number of vertices. This must be greater than zero.
+        \param[in] vertices Optional pointer to the vertex data. This must be either null or point to <code>numVertices * vertexFormat.stride</code> bytes.
+        \param[in] indexFormat Specifies the index format.
+        \param[in] numIndices Specifies the number of indices. If this is zero, no index buffer is used for this geometry.
+        \param[in] indices Optional pointer to the index data. This must be either null or point to <code>numIndices * indexFormat.GetFormatSize()</code> bytes.
+        The indices must be relative to the first vertex of this geometry (see GeometryRange::vertexOffset).
+        \return Handle of the new allocation, or Constants::invalidGeometryHandle if the number of vertices or the vertex stride is zero.
+        \see GetRange
+        */
+        GeometryHandle Alloc(
+            const VertexFormat& vertexFormat,
+            std::uint32_t       numVertices,
+            const void*         vertices,
+            const IndexFormat&  indexFormat = IndexFormat(DataType::UInt32),
+            std::uint32_t       numIndices  = 0,
+            const void*         indices     = nullptr
+        );
+
+        /**
+        \brief Frees the range of the specified geometry allocation, so it can be reused by subsequent allocations.
+        \remarks The range must no longer be referenced by any command buffer that has not been completed yet.
+        */
+        void Free(GeometryHandle handle);
+
+        /**
+        \brief Returns the current range of the specified geometry allocation.
+        \remarks The range of an allocation may change with each call to Defragment, so it should be queried again afterwards.
+        \throws std::out_of_range If the handle does not refer to a live allocation.
+        */
+        const GeometryRange& GetRange(GeometryHandle handle) const;
+
+        /**
+        \brief Records commands to move all live allocations into as few buffers as possible.
+        \param[in] commandBuffer Specifies the command buffer that records the copy commands.
+        This must be between a call to CommandBuffer::Begin and CommandBuffer::End, and outside of a render pass.
+        \return True if any allocation was moved, in which case all ranges must be queried again with GetRange.
+        \remarks The previous buffers are retired and must be released with ReleaseRetiredBuffers, after the command buffer has been completed on the GPU.
+        \see CommandBuffer::CopyBuffer
+        \see ReleaseRetiredBuffers
+        */
+        bool Defragment(CommandBuffer& commandBuffer);
+
+        /**
+        \brief Releases all buffers that have been retired by a previous call to Defragment.
+        \remarks Only call this after the command buffer that was passed to Defragment has been completed on the GPU, e.g. after CommandQueue::WaitIdle.
+        */
+        void ReleaseRetiredBuffers();
+
+        /**
+        \brief Returns the fraction of unused space within all buffers of this pool, in the range [0, 1].
+        \remarks This can be used to decide when to call Defragment.
+        */
+        float GetFragmentation() const;
+
+    private:
+
+        // Buffer with a free list of element ranges (in units of vertices or indices), keyed by the first element of each free range.
+        struct Page
+        {
+            Buffer*                                     buffer          = nullptr;
+            std::uint32_t                               capacity        = 0;
+            std::uint32_t                               numUsed         = 0;
+            std::map<std::uint32_t, std::uint32_t>      freeRanges;
+        };
+
+        // Set of buffers that share the same vertex or index format.
+        struct Heap
+        {
+            BufferDescriptor                            bufferDesc;
+            std::uint32_t                               stride          = 0;
+            std::uint32_t                               pageCapacity    = 0;
+            std::vector<Page>                           pages;
+        };
+
+        // Element range of an allocation within a page of a heap.
+        struct Block
+        {
+            std::size_t                                 heap            = 0;
+            std::size_t                                 page            = 0;
+            std::uint32_t                               first           = 0;
+            std::uint32_t                               count           = 0;
+        };
+
+        struct Allocation
+        {
+            GeometryRange                               range;
+            Block                                       vertexBlock;
+            Block                                       indexBlock;
+            bool                                        live            = false;
+        };
+
+        std::size_t FindOrCreateVertexHeap(const VertexFormat& vertexFormat);
+        std::size_t FindOrCreateIndexHeap(const IndexFormat& indexFormat);
+
+        Block AllocBlock(std::vector<Heap>& heaps, std::size_t heapIndex, std::uint32_t count);
+        void FreeBlock(std::vector<Heap>& heaps, const Block& block);
+
+        Page CreatePage(const Heap& heap, std::uint32_t capacity);
+
+        bool DefragmentHeaps(CommandBuffer& commandBuffer, std::vector<Heap>& heaps, bool vertexHeaps);
+
+        void UpdateRange(Allocation& alloc);
+
+        RenderSystem&                                   renderSystem_;
+        GeometryPoolDescriptor                          desc_;
+
+        std::vector<Heap>                               vertexHeaps_;
+        std::vector<Heap>                               indexHeaps_;
+
+        std::vector<Allocation>                         allocs_;
+        std::vector<GeometryHandle>                     freeHandles_;
+
+        std::vector<Buffer*>                            retiredBuffers_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -223,11 +223,12 @@ If this is less than 2, no multi-threading is used. If this is 'Constants::maxTh
 the maximal count of threads the system supports will be used (e.g. 4 on a quad-core processor). By default 0.
 \return Byte buffer with the converted image data or null if no conversion is necessary.
 This can be casted to the respective target data type (e.g. <code>unsigned char</code>, <code>int</code>, <code>float</code> etc.).
-\note Compressed images and depth-stencil images cannot be converted.
+\note Compressed images and depth-stencil images cannot be converted. Use DecompressImageBuffer to convert block-compressed images.
 \throw std::invalid_argument If a compressed image format is specified either as source or destination.
 \throw std::invalid_argument If a depth-stencil format is specified either as source or destination.
 \throw std::invalid_argument If the source buffer size is not a multiple of the source data type size times the image format size.
 \throw std::invalid_argument If the source buffer is a null pointer.
+\see DecompressImageBuffer
 \see Constants::maxThreadCount
 \see ByteBuffer
 \see DataTypeSize
@@ -240,6 +241,37 @@ LLGL_EXPORT ByteBuffer ConvertImageBuffer(
     std::size_t                 threadCount = 0
 );
 
+/**
+\brief Decompresses the block-compressed source image and converts it into the specified image format and data type.
+\param[in] compressedFormat Specifies the hardware format of the compressed source image. This must be one of the formats from Format::BC1RGB to Format::BC7RGBAUNorm.
+\param[in] srcImageDesc Specifies the source image descriptor. Its image format must be a compressed format (see IsCompressedFormat).
+\param[in] extent Specifies the extent (in texels) of the source image. The depth specifies the number of 2D slices, e.g. the number of array layers,
+where each slice is stored as separate rows of 4x4 blocks.
+\param[in] dstFormat Specifies the destination image format.
+\param[in] dstDataType Specifies the destination image data type.
+\param[in] threadCount Specifies the number of threads to use for decompression and conversion. See ConvertImageBuffer for details. By default 0.
+\return Byte buffer with the decompressed image data.
+\remarks The blocks are decompressed into ImageFormat::RGBA with DataType::UInt8 for normalized unsigned formats,
+DataType::Int8 for normalized signed formats (BC4 and BC5), and DataType::Float32 for BC6H.
+If another destination format or data type is specified, the decompressed image is converted with ConvertImageBuffer afterwards.
+This can be used to read back compressed textures or to upload compressed images to render systems that do not support the respective format.
+\throw std::invalid_argument If the compressed format is not a BC1 to BC7 format.
+\throw std::invalid_argument If the source image format is not a compressed format.
+\throw std::invalid_argument If the source buffer is smaller than the size of all 4x4 blocks of the image.
+\throw std::invalid_argument If the source buffer is a null pointer.
+\throw std::invalid_argument If a compressed or depth-stencil format is specified as destination.
+\see ConvertImageBuffer
+\see Constants::maxThreadCount
+*/
+LLGL_EXPORT ByteBuffer DecompressImageBuffer(
+    const Format                compressedFormat,
+    const SrcImageDescriptor&   srcImageDesc,
+    const Extent3D&             extent,
+    ImageFormat                 dstFormat,
+    DataType                    dstDataType,
+    std::size_t                 threadCount = 0
+);
+
 /**
 \brief Generates an image buffer with the specified fill data for each pixel.
 \param[in] format Specifies the image format of each pixel in the output image.
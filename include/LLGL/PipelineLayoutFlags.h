@@ -20,6 +20,30 @@ namespace LLGL
 {
 
 
+/* ----- Enumerations ----- */
+
+/**
+\brief Binding flags enumeration.
+\see BindingDescriptor::flags
+*/
+struct BindingFlags
+{
+    enum
+    {
+        /**
+        \brief Specifies that a constant buffer is bound with a dynamic offset each time its resource heap is bound.
+        \remarks This can be used to sub-allocate the constants of many draw calls from a single large constant buffer,
+        without creating a resource heap or updating a buffer for each draw call.
+        The size of the buffer range that is visible to the shader is specified by ResourceViewDescriptor::bufferRange.
+        \remarks This flag is only allowed for bindings of type ResourceType::ConstantBuffer with an array size of 1.
+        \see CommandBuffer::SetGraphicsResourceHeap
+        \see CommandBuffer::SetComputeResourceHeap
+        */
+        DynamicOffset = (1 << 0),
+    };
+};
+
+
 /* ----- Structures ----- */
 
 /**
@@ -61,6 +85,57 @@ struct BindingDescriptor
     \note For Vulkan, this number specifies the size of an array of resources (e.g. an array of uniform buffers).
     */
     std::uint32_t   arraySize   = 1;
+
+    /**
+    \brief Specifies optional binding flags. By default 0.
+    \remarks This can be a bitwise OR combination of the BindingFlags bitmasks.
+    \see BindingFlags
+    */
+    long            flags       = 0;
+};
+
+/**
+\brief Layout structure for a range of inline constants of the pipeline layout descriptor.
+\remarks Inline constants are small blocks of data that are written directly into the command buffer (see CommandBuffer::SetInlineConstants),
+i.e. they do not require a constant buffer or resource heap to be updated for each draw call.
+All ranges of a pipeline layout share the same address space (in bytes) and must not overlap for the same shader stages.
+\remarks For Vulkan, inline constants are mapped to push constant ranges and for Direct3D 12 they are mapped to root constants.
+For all other renderers, each range is emulated with a constant buffer that is bound to the specified slot.
+\see PipelineLayoutDescriptor::inlineConstants
+\see RenderingLimits::maxInlineConstantsSize
+*/
+struct InlineConstantsDescriptor
+{
+    InlineConstantsDescriptor() = default;
+    InlineConstantsDescriptor(const InlineConstantsDescriptor&) = default;
+
+    //! Constructors with all attributes.
+    inline InlineConstantsDescriptor(long stageFlags, std::uint32_t slot, std::uint32_t offset, std::uint32_t size) :
+        stageFlags { stageFlags },
+        slot       { slot       },
+        offset     { offset     },
+        size       { size       }
+    {
+    }
+
+    /**
+    \brief Specifies which shader stages can access this range of inline constants. By default 0.
+    \remarks This can be a bitwise OR combination of the StageFlags bitmasks.
+    \see StageFlags
+    */
+    long            stageFlags  = 0;
+
+    /**
+    \brief Specifies the zero-based constant buffer slot the inline constants are bound to. By default 0.
+    \note This is ignored for Vulkan, where push constants are not bound to any slot.
+    */
+    std::uint32_t   slot        = 0;
+
+    //! Specifies the offset (in bytes) of this range. This must be a multiple of 4. By default 0.
+    std::uint32_t   offset      = 0;
+
+    //! Specifies the size (in bytes) of this range. This must be a multiple of 4. By default 0.
+    std::uint32_t   size        = 0;
 };
 
 /**
@@ -69,7 +144,8 @@ struct BindingDescriptor
 */
 struct PipelineLayoutDescriptor
 {
-    std::vector<BindingDescriptor> bindings; //!< List of layout resource bindings.
+    std::vector<BindingDescriptor>          bindings;           //!< List of layout resource bindings.
+    std::vector<InlineConstantsDescriptor>  inlineConstants;    //!< List of inline constant ranges. \see CommandBuffer::SetInlineConstants
 };
 
 
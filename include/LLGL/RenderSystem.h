@@ -33,6 +33,7 @@
 #include "ComputePipeline.h"
 #include "Query.h"
 #include "Fence.h"
+#include "AsyncReadback.h"
 
 #include <string>
 #include <memory>
@@ -44,6 +45,8 @@ namespace LLGL
 {
 
 
+class TransientResourcePool;
+
 /**
 \brief Render system interface.
 \remarks This is the main interface for the entire renderer.
@@ -102,6 +105,8 @@ class LLGL_EXPORT RenderSystem : public NonCopyable
         */
         static void Unload(std::unique_ptr<RenderSystem>&& renderSystem);
 
+        ~RenderSystem();
+
         /**
         \brief Rendering API identification number.
         \remarks This can be a value of the RendererID entries.
@@ -358,13 +363,24 @@ class LLGL_EXPORT RenderSystem : public NonCopyable
         /**
         \brief Creates a new Sampler object.
         \throws std::runtime_error If the renderer does not support Sampler objects (e.g. if OpenGL 3.1 or lower is used).
+        \remarks If a sampler with an equal descriptor has already been created, that shared sampler is returned instead,
+        unless SamplerDescriptor::shared is false.
         \see GetRenderingCaps
+        \see GetSamplerCacheStatistics
         */
         virtual Sampler* CreateSampler(const SamplerDescriptor& desc) = 0;
 
         //! Releases the specified Sampler object. After this call, the specified object must no longer be used.
         virtual void Release(Sampler& sampler) = 0;
 
+        /**
+        \brief Returns the statistics of the sampler cache.
+        \remarks Sampler objects are shared between all calls to CreateSampler with equal descriptors.
+        Such a shared sampler is reference counted, i.e. it is only destroyed when it has been released as often as it has been created.
+        \see SamplerCacheStatistics
+        */
+        virtual SamplerCacheStatistics GetSamplerCacheStatistics() const = 0;
+
         /* ----- Resource Heaps ----- */
 
         /**
@@ -460,7 +476,9 @@ class LLGL_EXPORT RenderSystem : public NonCopyable
         \param[in] desc Specifies the graphics pipeline descriptor.
         This will describe the entire pipeline state, i.e. the blending-, rasterizer-, depth-, stencil- and shader states.
         The "shaderProgram" member of the descriptor must never be null!
+        \remarks If a graphics pipeline with an equal descriptor has already been created, that shared pipeline is returned instead.
         \see GraphicsPipelineDescriptor
+        \see GetPipelineCacheStatistics
         */
         virtual GraphicsPipeline* CreateGraphicsPipeline(const GraphicsPipelineDescriptor& desc) = 0;
 
@@ -468,7 +486,9 @@ class LLGL_EXPORT RenderSystem : public NonCopyable
         \brief Creates a new and initialized compute pipeline state object.
         \param[in] desc Specifies the compute pipeline descriptor. This will describe the shader states.
         The "shaderProgram" member of the descriptor must never be null!
+        \remarks If a compute pipeline with an equal descriptor has already been created, that shared pipeline is returned instead.
         \see ComputePipelineDescriptor
+        \see GetPipelineCacheStatistics
         */
         virtual ComputePipeline* CreateComputePipeline(const ComputePipelineDescriptor& desc) = 0;
 
@@ -478,6 +498,14 @@ class LLGL_EXPORT RenderSystem : public NonCopyable
         //! Releases the specified ComputePipeline object. After this call, the specified object must no longer be used.
         virtual void Release(ComputePipeline& computePipeline) = 0;
 
+        /**
+        \brief Returns the statistics of the pipeline state cache.
+        \remarks Pipeline state objects are shared between all calls to CreateGraphicsPipeline and CreateComputePipeline with equal descriptors.
+        Such a shared pipeline is reference counted, i.e. it is only destroyed when it has been released as often as it has been created.
+        \see PipelineCacheStatistics
+        */
+        virtual PipelineCacheStatistics GetPipelineCacheStatistics() const = 0;
+
         /* ----- Queries ----- */
 
         //! Creates a new query.
@@ -498,9 +526,90 @@ class LLGL_EXPORT RenderSystem : public NonCopyable
         //! Releases the specified Fence object. After this call, the specified object must no longer be used.
         virtual void Release(Fence& fence) = 0;
 
+        /* ----- Asynchronous Readbacks ----- */
+
+        /**
+        \brief Requests the image data of the specified texture without blocking the CPU execution.
+        \param[in] texture Specifies the texture object to read from.
+        \param[in] mipLevel Specifies the MIP-level from which to read the texture data, including all array layers.
+        \return Pointer to the new AsyncReadback object, which provides the texture data in the hardware format of the texture.
+        \remarks In contrast to ReadTexture, this function only records the copy operation into a readback buffer and returns immediately.
+        The size of the readback data is determined by the texture format and the extent of the MIP-map level (see Texture::QueryMipExtent).
+        \throws std::runtime_error If the texture format has no suitable image format (see FindSuitableImageFormat) or the renderer does not support asynchronous readbacks.
+        \see ReadTexture
+        \see AsyncReadback
+        \see RenderingFeatures::hasAsyncReadbacks
+        */
+        virtual AsyncReadback* ReadTextureAsync(const Texture& texture, std::uint32_t mipLevel) = 0;
+
+        /**
+        \brief Requests the data of the specified buffer range without blocking the CPU execution.
+        \param[in] buffer Specifies the buffer object to read from.
+        \param[in] offset Specifies the offset (in bytes) of the buffer range to read.
+        \param[in] size Specifies the size (in bytes) of the buffer range to read.
+        \remarks In contrast to MapBuffer, this does not require any CPU access flags for the buffer and returns immediately.
+        \throws std::runtime_error If the renderer does not support asynchronous readbacks.
+        \see MapBuffer
+        \see AsyncReadback
+        \see RenderingFeatures::hasAsyncReadbacks
+        */
+        virtual AsyncReadback* ReadBufferAsync(const Buffer& buffer, std::uint64_t offset, std::uint64_t size) = 0;
+
+        //! Releases the specified AsyncReadback object. After this call, the specified object must no longer be used.
+        virtual void Release(AsyncReadback& readback) = 0;
+
+        /* ----- Transient Resources ----- */
+
+        /**
+        \brief Returns a transient texture, which can be used until the end of the current frame.
+        \param[in] desc Specifies the texture descriptor. Transient textures are always created without initial image data.
+        \remarks Transient textures are meant for intermediate results that are only needed within a frame, e.g. the textures of a post-processing chain.
+        If a transient texture with an equal descriptor is not used in the current frame, that texture is returned instead of creating a new one.
+        The content of a transient texture is undefined. Transient textures must not be released with the Release function,
+        since they are owned by the render system and released automatically when they have not been used for some frames.
+        \see NextTransientFrame
+        \see RecycleTransient(Texture&)
+        */
+        Texture* AcquireTransientTexture(const TextureDescriptor& desc);
+
+        /**
+        \brief Returns a transient render target, which can be used until the end of the current frame.
+        \param[in] desc Specifies the render target descriptor.
+        \remarks This behaves like AcquireTransientTexture. The attachments of a transient render target should only refer to transient textures,
+        because equal descriptors also require equal attachment textures. A transient render target is released automatically when one of its attachment textures is released.
+        \see AcquireTransientTexture
+        */
+        RenderTarget* AcquireTransientRenderTarget(const RenderTargetDescriptor& desc);
+
+        /**
+        \brief Puts the specified transient texture back into the pool before the end of the current frame.
+        \remarks After this call, the texture can be returned by another call to AcquireTransientTexture within the same frame.
+        This can be used to reduce the number of transient textures when their usage does not overlap.
+        \throws std::invalid_argument If the specified texture has not been acquired with AcquireTransientTexture.
+        */
+        void RecycleTransient(Texture& texture);
+
+        /**
+        \brief Puts the specified transient render target back into the pool before the end of the current frame.
+        \throws std::invalid_argument If the specified render target has not been acquired with AcquireTransientRenderTarget.
+        \see RecycleTransient(Texture&)
+        */
+        void RecycleTransient(RenderTarget& renderTarget);
+
+        /**
+        \brief Ends the current frame for all transient resources, i.e. all transient textures and render targets can be acquired again.
+        \param[in] maxUnusedFrames Specifies the number of frames after which unused transient resources are released. By default 3.
+        \remarks This should be called once per frame, after all command buffers of the frame have been submitted.
+        Transient resources whose descriptors are no longer requested (e.g. after the resolution has changed) are released after the specified number of frames.
+        */
+        void NextTransientFrame(std::uint32_t maxUnusedFrames = 3);
+
+        //! Releases all transient textures and render targets. After this call, none of these objects must be used anymore.
+        void PurgeTransientResources();
+
     protected:
 
-        RenderSystem() = default;
+        RenderSystem();
 
         //! Sets the renderer information.
         void SetRendererInfo(const RendererInfo& info);
@@ -529,14 +638,42 @@ class LLGL_EXPORT RenderSystem : public NonCopyable
         //! Validates the specified image data size against the required size (in bytes).
         void AssertImageDataSize(std::size_t dataSize, std::size_t requiredDataSize, const char* info = nullptr);
 
+        /**
+        \brief Decompresses the initial image data of a texture, whose block-compressed format is not supported by this render system.
+        \param[in] textureDesc Specifies the descriptor of the texture that is about to be created.
+        \param[in] imageDesc Specifies the optional initial image data. This may also be null.
+        \param[out] decompressedTextureDesc Specifies the output texture descriptor with the uncompressed format.
+        \param[out] decompressedImageDesc Specifies the output image descriptor, which refers to the decompressed image buffer.
+        \param[out] decompressedImage Specifies the output image buffer. This must be kept alive until the texture has been created.
+        \return True if the texture format is not supported and the texture must be created with the output descriptors instead.
+        \remarks Only the formats from Format::BC1RGB to Format::BC7RGBAUNorm are decompressed,
+        if they are not listed in the RenderingCapabilities::textureFormats of this render system.
+        \see DecompressImageBuffer
+        */
+        bool DecompressUnsupportedTexture(
+            const TextureDescriptor&    textureDesc,
+            const SrcImageDescriptor*   imageDesc,
+            TextureDescriptor&          decompressedTextureDesc,
+            SrcImageDescriptor&         decompressedImageDesc,
+            ByteBuffer&                 decompressedImage
+        );
+
     private:
 
-        int                         rendererID_ = 0;
-        std::string                 name_;
+        // Returns the transient resource pool and creates it on demand.
+        TransientResourcePool& GetTransientResourcePool();
+
+        // Releases the specified transient resources (render targets before textures).
+        void ReleaseTransientResources(const std::vector<Texture*>& textures, const std::vector<RenderTarget*>& renderTargets);
+
+        int                                     rendererID_ = 0;
+        std::string                             name_;
+
+        RendererInfo                            info_;
+        RenderingCapabilities                   caps_;
+        RenderSystemConfiguration               config_;
 
-        RendererInfo                info_;
-        RenderingCapabilities       caps_;
-        RenderSystemConfiguration   config_;
+        std::unique_ptr<TransientResourcePool>  transientResourcePool_;
 
 };
 
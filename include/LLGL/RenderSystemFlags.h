@@ -193,6 +193,38 @@ struct RendererInfo
     std::string shadingLanguageName;    //!< Shading language version (e.g. "GLSL 4.50").
 };
 
+/**
+\brief Pipeline state cache statistics structure.
+\see RenderSystem::GetPipelineCacheStatistics
+*/
+struct PipelineCacheStatistics
+{
+    //! Number of pipeline creations that returned a shared pipeline state object with an equal descriptor.
+    std::uint32_t numHits       = 0;
+
+    //! Number of pipeline creations that created a new pipeline state object.
+    std::uint32_t numMisses     = 0;
+
+    //! Number of pipeline state objects that are currently in the cache.
+    std::uint32_t numPipelines  = 0;
+};
+
+/**
+\brief Sampler cache statistics structure.
+\see RenderSystem::GetSamplerCacheStatistics
+*/
+struct SamplerCacheStatistics
+{
+    //! Number of sampler creations that returned a shared sampler object with an equal descriptor.
+    std::uint32_t numHits       = 0;
+
+    //! Number of sampler creations that created a new sampler object.
+    std::uint32_t numMisses     = 0;
+
+    //! Number of sampler objects that are currently in the cache.
+    std::uint32_t numSamplers   = 0;
+};
+
 /**
 \brief Application descriptor structure.
 \remarks This is currently only used for the Vulkan renderer, when a debug or validation layer is enabled.
@@ -205,6 +237,36 @@ struct ApplicationDescriptor
     std::uint32_t   engineVersion;      //!< Version number of the engine or middleware.
 };
 
+/**
+\brief Structure for an OpenGL renderer specific configuration.
+\see VulkanRendererConfiguration
+*/
+struct OpenGLRendererConfiguration
+{
+    /**
+    \brief Specifies whether resources can be created and written from worker threads. By default false.
+    \remarks If this is true, the functions RenderSystem::CreateBuffer, RenderSystem::CreateTexture, and RenderSystem::WriteTexture
+    can be called from any thread that has no active GL context. For such a thread, the OpenGL render system makes a hidden GL context current,
+    which shares all its GL objects with the first render context. Before these functions return, the upload is synchronized with a fence,
+    so the new resource can be passed to the render thread right away.
+    \note The upload contexts are created lazily, i.e. the first call from a worker thread creates a new context.
+    A render context must be created before any resource can be created from a worker thread.
+    */
+    bool enableUploadContexts = false;
+
+    /**
+    \brief Specifies whether the procedures of OpenGL extensions are loaded on demand. By default false.
+    \remarks If this is true, the available extensions are still determined when the first render context is created,
+    but the procedure addresses are only resolved on their first call. This reduces the startup time of the render system,
+    since only a fraction of the several hundred extension procedures are commonly used by an application.
+    \note Since the procedures of an available extension are no longer verified up front,
+    a procedure that cannot be resolved is reported to the standard error output on its first call and all its calls are ignored.
+    Each call of a lazily loaded procedure is forwarded by a trampoline function, so this trades a small per-call overhead for a faster startup.
+    The extensions are only loaded once per process, so this flag only has an effect for the first render system that creates a render context.
+    */
+    bool enableLazyExtensionLoading = false;
+};
+
 /**
 \brief Structure for a Vulkan renderer specific configuration.
 \remarks The nomenclature here is "Renderer" instead of "RenderSystem" since the configuration is renderer specific
@@ -234,6 +296,21 @@ struct VulkanRendererConfiguration
     */
     bool                        reduceDeviceMemoryFragmentation = false;
 
+    /**
+    \brief Number of frames the CPU can record ahead of the GPU for each render context. By default 2.
+    \remarks Each frame in flight has its own presentation semaphores and fence, so recording the next frame does not wait for the previous one.
+    This value is clamped to the range [1, 3].
+    \see RenderContext::Present
+    */
+    std::uint32_t               numFramesInFlight               = 2;
+
+    /**
+    \brief Specifies whether render contexts shall present to a headless surface instead of a window. By default false.
+    \remarks This requires the \c VK_EXT_headless_surface extension and can be used for offscreen rendering,
+    e.g. to run tests with a software Vulkan driver. The presented images are discarded.
+    */
+    bool                        headlessSurface                 = false;
+
     #if 0//TODO: integrate them into the Vulkan renderer
     /**
     \brief List of enabled Vulkan extensions.
@@ -301,6 +378,7 @@ struct RenderSystemDescriptor
     auto renderer = LLGL::RenderSystem::Load(rendererDesc);
     \endcode
     \see rendererConfigSize
+    \see OpenGLRendererConfiguration
     \see VulkanRendererConfiguration
     */
     const void* rendererConfig      = nullptr;
@@ -432,6 +510,49 @@ struct RenderingFeatures
     \see BlendDescriptor::logicOp
     */
     bool hasLogicOp                     = false;
+
+    /**
+    \brief Specifies whether sparse buffers are supported.
+    \see BufferFlags::Sparse
+    */
+    bool hasSparseBuffers               = false;
+
+    /**
+    \brief Specifies whether sparse textures are supported.
+    \see TextureFlags::Sparse
+    */
+    bool hasSparseTextures              = false;
+
+    /**
+    \brief Specifies whether texture views are supported.
+    \see ResourceViewDescriptor::textureView
+    */
+    bool hasTextureViews                = false;
+
+    /**
+    \brief Specifies whether texture views support component swizzling.
+    \see TextureViewDescriptor::swizzle
+    */
+    bool hasTextureViewSwizzle          = false;
+
+    /**
+    \brief Specifies whether conditional rendering with predicate values from buffers is supported.
+    \see CommandBuffer::BeginRenderCondition(Buffer&, std::uint64_t, const RenderConditionMode)
+    */
+    bool hasRenderConditionBuffers      = false;
+
+    /**
+    \brief Specifies whether query results can be written into buffers on the GPU.
+    \see CommandBuffer::CopyQueryResults
+    */
+    bool hasQueryResultBuffers          = false;
+
+    /**
+    \brief Specifies whether textures and buffers can be read back to the CPU asynchronously.
+    \see RenderSystem::ReadTextureAsync
+    \see RenderSystem::ReadBufferAsync
+    */
+    bool hasAsyncReadbacks              = false;
 };
 
 /**
@@ -535,6 +656,27 @@ struct RenderingLimits
     \see BufferDescriptor::size
     */
     std::uint64_t   maxConstantBufferSize               = 0;
+
+    /**
+    \brief Specifies the minimum alignment (in bytes) for dynamic offsets of constant buffers.
+    \see BindingFlags::DynamicOffset
+    */
+    std::uint32_t   minConstantBufferOffsetAlignment    = 0;
+
+    /**
+    \brief Specifies the maximum size (in bytes) of the address space for all inline constant ranges of a pipeline layout.
+    \remarks This is guaranteed to be at least 128 bytes for all renderers.
+    \see InlineConstantsDescriptor
+    */
+    std::uint32_t   maxInlineConstantsSize              = 0;
+
+    /**
+    \brief Specifies the size (in bytes) of a memory page of sparse buffers. This is 0 if sparse buffers are not supported.
+    \remarks The offset and size of each buffer tile mapping must be a multiple of this value.
+    Texture tile mappings are specified in texels instead (see Texture::QuerySparseTileExtent).
+    \see BufferTileMapping
+    */
+    std::uint32_t   sparsePageSize                      = 0;
 };
 
 /**
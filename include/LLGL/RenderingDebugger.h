@@ -12,6 +12,7 @@
 #include "Export.h"
 #include <map>
 #include <string>
+#include <cstdint>
 
 
 namespace LLGL
@@ -36,6 +37,61 @@ enum class WarningType
 };
 
 
+/**
+\brief Rendering debugger validation sampling descriptor.
+\remarks Sampled validation reduces the overhead of the debug layer, so it can be kept enabled in production builds.
+Cheap checks, such as missing pipeline states or out-of-range draw commands, are always performed,
+but the full validation of a command is only performed for the sampled frames and commands.
+\see RenderingDebugger::SetValidationSampling
+*/
+struct ValidationSamplingDescriptor
+{
+    /**
+    \brief Specifies the frame interval for full validation, i.e. only every N-th frame is fully validated. By default 1.
+    \remarks If this is less than 2, every frame is validated. A new frame begins with each call to RenderContext::Present.
+    */
+    std::uint32_t frameInterval     = 1;
+
+    /**
+    \brief Specifies the command interval for full validation within a validated frame, i.e. only every N-th draw command is fully validated. By default 1.
+    \remarks If this is less than 2, every draw command of a validated frame is validated.
+    */
+    std::uint32_t commandInterval   = 1;
+
+    /**
+    \brief Specifies the time budget (in nanoseconds) for full validation per frame. By default 0.
+    \remarks Once the accumulated validation time of the current frame exceeds this budget, the remaining commands of this frame are not fully validated.
+    If this is 0, the validation time is not limited.
+    */
+    std::uint64_t frameTimeBudget   = 0;
+};
+
+/**
+\brief Rendering debugger validation statistics structure.
+\see RenderingDebugger::GetValidationStatistics
+*/
+struct ValidationStatistics
+{
+    //! Number of frames since the debugger has been created.
+    std::uint64_t numFrames             = 0;
+
+    //! Number of frames that have been sampled for full validation.
+    std::uint64_t numValidatedFrames    = 0;
+
+    //! Number of draw commands that have been recorded.
+    std::uint64_t numCommands           = 0;
+
+    //! Number of draw commands that have been fully validated.
+    std::uint64_t numValidatedCommands  = 0;
+
+    //! Number of error occurrences, including the blocked ones.
+    std::uint64_t numErrors             = 0;
+
+    //! Number of warning occurrences, including the blocked ones.
+    std::uint64_t numWarnings           = 0;
+};
+
+
 /**
 \brief Rendering debugger interface.
 \remarks This can be used to profile the renderer draw calls and buffer updates.
@@ -66,6 +122,37 @@ class LLGL_EXPORT RenderingDebugger
         */
         void PostWarning(const WarningType type, const std::string& message);
 
+        /**
+        \brief Sets the sampling configuration for the validation of the debug layer.
+        \remarks By default, every frame and every command is fully validated.
+        \see ValidationSamplingDescriptor
+        */
+        void SetValidationSampling(const ValidationSamplingDescriptor& samplingDesc);
+
+        //! Returns the sampling configuration for the validation of the debug layer.
+        inline const ValidationSamplingDescriptor& GetValidationSampling() const
+        {
+            return samplingDesc_;
+        }
+
+        /**
+        \brief Returns the validation statistics.
+        \remarks Repeated errors and warnings are aggregated, i.e. they are counted even if their messages have been blocked.
+        */
+        inline const ValidationStatistics& GetValidationStatistics() const
+        {
+            return stats_;
+        }
+
+        /**
+        \brief Returns true if the current frame is sampled for full validation.
+        \see ValidationSamplingDescriptor::frameInterval
+        */
+        inline bool IsFrameValidated() const
+        {
+            return frameValidated_;
+        }
+
     protected:
 
         //! Rendering debugger message class.
@@ -149,11 +236,32 @@ class LLGL_EXPORT RenderingDebugger
         */
         virtual void OnWarning(WarningType type, Message& message);
 
+    private:
+
+        friend class DbgRenderContext;
+        friend class DbgCommandBuffer;
+
+        // Notifies the debugger that a new frame begins. Called by the debug layer on each call to RenderContext::Present.
+        void NextFrame();
+
+        // Returns true if the next command is sampled for full validation. If so, EndValidation must be called after the validation.
+        bool BeginValidation();
+
+        // Ends the validation of the current command and accumulates the validation time of the current frame.
+        void EndValidation();
+
     private:
 
         std::map<std::string, Message>  errors_;
         std::map<std::string, Message>  warnings_;
-        const char*                     source_     = "";
+        const char*                     source_                 = "";
+
+        ValidationSamplingDescriptor    samplingDesc_;
+        ValidationStatistics            stats_;
+        bool                            frameValidated_         = true;
+        std::uint32_t                   commandCounter_         = 0;
+        std::uint64_t                   validationStartTime_    = 0;
+        std::uint64_t                   frameValidationTime_    = 0;
 
 };
 
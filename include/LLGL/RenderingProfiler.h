@@ -85,6 +85,9 @@ class LLGL_EXPORT RenderingProfiler
         Counter writeBuffer;            //!< Counter for buffer writings. \see RenderSystem::WriteBuffer
         Counter mapBuffer;              //!< Counter for buffer mappings. \see RenderSystem::MapBuffer
 
+        Counter samplerCacheHits;       //!< Counter for sampler creations that returned a shared sampler. \see RenderSystem::GetSamplerCacheStatistics
+        Counter samplerCacheMisses;     //!< Counter for sampler creations that created a new sampler. \see RenderSystem::GetSamplerCacheStatistics
+
         Counter setVertexBuffer;        //!< Counter for vertex buffer bindings. \see CommandBuffer::SetVertexBuffer
         Counter setIndexBuffer;         //!< Counter for index buffer bindings. \see CommandBuffer::SetIndexBuffer
         Counter setConstantBuffer;      //!< Counter for constant buffer bindings. \see CommandBuffer::SetConstantBuffer
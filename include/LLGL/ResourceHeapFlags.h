@@ -10,6 +10,7 @@
 
 
 #include "Export.h"
+#include "TextureFlags.h"
 #include <vector>
 
 
@@ -50,10 +51,27 @@ struct ResourceViewDescriptor
     }
 
     //! Pointer to the hardware resoudce.
-    Resource*   resource    = nullptr;
+    Resource*               resource    = nullptr;
+
+    /**
+    \brief Specifies the size (in bytes) of the buffer range that is visible to the shader for a binding with a dynamic offset. By default 0.
+    \remarks This is only used for constant buffers whose binding has the BindingFlags::DynamicOffset flag.
+    The buffer range starts at the dynamic offset that is passed when the resource heap is bound.
+    If this is 0, the buffer range covers the entire buffer, in which case the only valid dynamic offset is 0.
+    \see BindingFlags::DynamicOffset
+    */
+    std::uint64_t           bufferRange = 0;
+
+    /**
+    \brief Optional view of a subresource of a Texture resource.
+    \remarks This is only used if the resource is a Texture and the format of the view is not Format::Undefined.
+    This can be used to bind a subset of MIP-map levels and array layers, or to reinterpret the texture format, without creating a separate texture.
+    \see RenderingFeatures::hasTextureViews
+    */
+    TextureViewDescriptor   textureView;
 
     #if 0//TODO
-    long        flags       = 0;
+    long                    flags       = 0;
     #endif
 };
 
@@ -148,6 +148,13 @@ struct LLGL_EXPORT SamplerDescriptor
     - Opaque white: <code>{1,1,1,1}</code>
     */
     ColorRGBAf          borderColor     = { 0.0f, 0.0f, 0.0f, 0.0f };
+
+    /**
+    \brief Specifies whether the sampler can be shared with other samplers that are created with an equal descriptor. By default true.
+    \remarks If this is false, RenderSystem::CreateSampler always creates a new sampler object that bypasses the sampler cache.
+    \see RenderSystem::GetSamplerCacheStatistics
+    */
+    bool                shared          = true;
 };
 
 
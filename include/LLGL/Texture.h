@@ -61,6 +61,14 @@ class LLGL_EXPORT Texture : public Resource
         */
         virtual Extent3D QueryMipExtent(std::uint32_t mipLevel) const = 0;
 
+        /**
+        \brief Returns the extent (in texels) of a single memory tile of this sparse texture.
+        \return Extent of a single tile, or (0, 0, 0) if this texture has not been created with the TextureFlags::Sparse flag.
+        \remarks Tile mappings of this texture must be aligned to this extent.
+        \see TextureTileMapping
+        */
+        virtual Extent3D QuerySparseTileExtent() const;
+
     protected:
 
         Texture(const TextureType type);
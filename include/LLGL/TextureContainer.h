@@ -0,0 +1,150 @@
+/*
+ * TextureContainer.h
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_TEXTURE_CONTAINER_H
+#define LLGL_TEXTURE_CONTAINER_H
+
+
+#include "Export.h"
+#include "NonCopyable.h"
+#include "TextureFlags.h"
+#include "ImageFlags.h"
+#include <memory>
+#include <string>
+#include <vector>
+
+
+namespace LLGL
+{
+
+
+class RenderSystem;
+class Texture;
+class MappedFile;
+
+/**
+\brief Texture container file format enumeration.
+\see TextureContainer::GetFileFormat
+*/
+enum class TextureContainerFormat
+{
+    DDS,    //!< DirectDraw Surface (DDS) file format, including the DX10 header extension.
+    KTX2,   //!< Khronos Texture 2.0 (KTX2) file format without supercompression.
+};
+
+/**
+\brief Utility class to load pre-processed texture container files, i.e. DDS and KTX2 files.
+
+This class is not required for any interaction with the render system.
+It can be used to upload block compressed textures with their entire MIP-map chain without decoding the image data.
+\remarks The file is memory mapped and each MIP-map level and array layer is exposed as a SrcImageDescriptor that points directly into this mapping.
+Therefore, the container must stay alive as long as any of these image descriptors is in use.
+\code
+// Load DDS file and upload all MIP-map levels into a new texture
+LLGL::TextureContainer myContainer { "MyTexture.dds" };
+auto myTexture = myContainer.CreateTexture(*myRenderSystem);
+\endcode
+\see RenderSystem::CreateTexture
+\see RenderSystem::WriteTexture
+*/
+class LLGL_EXPORT TextureContainer : public NonCopyable
+{
+
+    public:
+
+        /**
+        \brief Maps the specified DDS or KTX2 file into memory and validates its header.
+        \param[in] filename Specifies the file to load. The file format is determined by the file header, not by the file extension.
+        \throws std::runtime_error If the file could not be mapped into memory, or the file header is invalid, or the texture format is not supported.
+        */
+        TextureContainer(const std::string& filename);
+
+        ~TextureContainer();
+
+        /**
+        \brief Returns a source image descriptor for the specified MIP-map level and array layer.
+        \param[in] mipLevel Specifies the MIP-map level. This must be less than the number of MIP-map levels of the texture descriptor.
+        \param[in] arrayLayer Specifies the array layer. For cube textures, this also includes the cube face offset (see TextureDescriptor::arrayLayers).
+        This must be less than the number of array layers of the texture descriptor. By default 0.
+        \remarks The image data is not copied, i.e. the 'data' member points directly into the memory mapped file.
+        For 3D textures, the image descriptor covers all depth slices of the MIP-map level.
+        \throws std::out_of_range If the MIP-map level or array layer is out of range.
+        \see GetTextureRegion
+        */
+        SrcImageDescriptor GetImageDesc(std::uint32_t mipLevel, std::uint32_t arrayLayer = 0) const;
+
+        /**
+        \brief Returns the texture region for the specified MIP-map level and array layer.
+        \remarks This can be used in combination with GetImageDesc to upload a single subresource with RenderSystem::WriteTexture.
+        \throws std::out_of_range If the MIP-map level or array layer is out of range.
+        \see GetImageDesc
+        */
+        TextureRegion GetTextureRegion(std::uint32_t mipLevel, std::uint32_t arrayLayer = 0) const;
+
+        /**
+        \brief Creates a new texture and uploads all MIP-map levels and array layers of this container.
+        \param[in] renderSystem Specifies the render system that is used to create the texture.
+        \param[in] flags Specifies the texture creation flags. By default TextureFlags::SampleUsage.
+        \return Pointer to the new texture. This must be released with RenderSystem::Release.
+        \remarks The base MIP-map level is passed to RenderSystem::CreateTexture for single layered textures,
+        all other subresources are uploaded with RenderSystem::WriteTexture. No intermediate copy of the image data is made,
+        unless the BC format is not supported by the render system, in which case each subresource is decompressed on the CPU.
+        \see DecompressImageBuffer
+        \see RenderSystem::CreateTexture
+        \see RenderSystem::WriteTexture
+        */
+        Texture* CreateTexture(RenderSystem& renderSystem, long flags = TextureFlags::SampleUsage) const;
+
+        /**
+        \brief Returns the texture descriptor that is stored in the container file.
+        \remarks The 'mipLevels' member is always greater than zero, i.e. no MIP-maps are generated if this descriptor is passed to RenderSystem::CreateTexture.
+        */
+        inline const TextureDescriptor& GetTextureDesc() const
+        {
+            return textureDesc_;
+        }
+
+        //! Returns the file format of this container.
+        inline TextureContainerFormat GetFileFormat() const
+        {
+            return fileFormat_;
+        }
+
+    private:
+
+        struct Subresource
+        {
+            std::size_t offset;
+            std::size_t size;
+        };
+
+        void LoadDDS();
+        void LoadKTX2();
+
+        void InitSubresources();
+        void SetSubresource(std::uint32_t mipLevel, std::uint32_t arrayLayer, std::size_t offset, std::size_t size);
+
+        Extent3D GetMipExtent(std::uint32_t mipLevel) const;
+        std::size_t GetMipSize(std::uint32_t mipLevel) const;
+        std::size_t GetSubresourceIndex(std::uint32_t mipLevel, std::uint32_t arrayLayer) const;
+
+        std::unique_ptr<MappedFile> file_;
+        TextureContainerFormat      fileFormat_     = TextureContainerFormat::DDS;
+        TextureDescriptor           textureDesc_;
+        std::vector<Subresource>    subresources_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -36,7 +36,6 @@ enum class TextureType
     Texture2DMSArray,   //!< 2-Dimensional multi-sample array texture.
 };
 
-#if 0//TODO: currently unused
 /**
 \brief Texture component swizzle enumeration.
 \remarks Can be used to change the order of texel components independently of a shader.
@@ -51,7 +50,6 @@ enum class TextureSwizzle
     Blue,   //!< The component is replaced by blue component.
     Alpha   //!< The component is replaced by alpha component.
 };
-#endif
 
 
 /* ----- Flags ----- */
@@ -117,6 +115,26 @@ struct TextureFlags
         */
         FixedSamples        = (1 << 6),
 
+        /**
+        \brief Texture is created as sparse resource, i.e. its memory is not allocated at creation time but committed in tiles.
+        \remarks The content of tiles that are not committed is undefined, and the initial image data of the texture is ignored.
+        This can not be used with multi-sampled textures.
+        \note Only supported with: OpenGL, Vulkan.
+        \see RenderingFeatures::hasSparseTextures
+        \see Texture::QuerySparseTileExtent
+        \see CommandQueue::UpdateTileMappings(Texture&, std::uint32_t, const TextureTileMapping*)
+        */
+        Sparse              = (1 << 7),
+
+        /**
+        \brief Texture views can reinterpret the format of the texture.
+        \remarks This is required for texture views whose format differs from the texture format.
+        It should only be specified when needed, since some renderers (e.g. Vulkan) cannot apply certain hardware optimizations to such textures.
+        This can not be used with depth-stencil formats.
+        \see TextureViewDescriptor::format
+        */
+        MutableFormat       = (1 << 8),
+
         /**
         \brief Default texture flags: (AttachmentUsage | SampleUsage | FixedSamples).
         \see AttachmentUsage
@@ -130,10 +148,10 @@ struct TextureFlags
 
 /* ----- Structures ----- */
 
-#if 0//TODO: currently unused
 /**
 \brief Texture component swizzle structure for red, green, blue, and alpha components.
 \remarks Can be used to change the order of texel components independently of a shader.
+\see TextureViewDescriptor::swizzle
 */
 struct TextureSwizzleRGBA
 {
@@ -142,7 +160,61 @@ struct TextureSwizzleRGBA
     TextureSwizzle b = TextureSwizzle::Blue;    //!< Blue component swizzle. By default TextureSwizzle::Blue.
     TextureSwizzle a = TextureSwizzle::Alpha;   //!< Alpha component swizzle. By default TextureSwizzle::Alpha.
 };
-#endif
+
+/**
+\brief Texture subresource structure to specify a range of MIP-map levels and array layers.
+\see TextureViewDescriptor::subresource
+*/
+struct TextureSubresource
+{
+    /**
+    \brief First array layer of the subresource. By default 0.
+    \remarks For cube textures, each cube face is a separate array layer, i.e. the layer index is <code>arrayLayer * 6 + face</code>.
+    */
+    std::uint32_t baseArrayLayer    = 0;
+
+    //! Number of array layers of the subresource. This must be greater than zero. By default 1.
+    std::uint32_t numArrayLayers    = 1;
+
+    //! First MIP-map level of the subresource. By default 0.
+    std::uint32_t baseMipLevel      = 0;
+
+    //! Number of MIP-map levels of the subresource. This must be greater than zero. By default 1.
+    std::uint32_t numMipLevels      = 1;
+};
+
+/**
+\brief Texture view descriptor structure.
+\remarks A texture view reinterprets a range of MIP-map levels and array layers of a texture without copying its data,
+e.g. to bind a single MIP-map level while downsampling a MIP-map chain, or to bind a single face of a cube texture as 2D texture.
+\see ResourceViewDescriptor::textureView
+\see RenderingFeatures::hasTextureViews
+*/
+struct TextureViewDescriptor
+{
+    /**
+    \brief Texture type of the view. By default TextureType::Texture2D.
+    \remarks This must be compatible with the type of the texture, e.g. a Texture2D view of a TextureCube or a Texture2DArray.
+    */
+    TextureType         type        = TextureType::Texture2D;
+
+    /**
+    \brief Hardware format of the view. By default Format::Undefined.
+    \remarks If this is Format::Undefined, no texture view is used and the entire texture is bound.
+    Otherwise, the format must have the same size per texel as the format of the texture.
+    If the format differs from the format of the texture, the texture must have been created with the TextureFlags::MutableFormat flag.
+    */
+    Format              format      = Format::Undefined;
+
+    //! Range of MIP-map levels and array layers of the view.
+    TextureSubresource  subresource;
+
+    /**
+    \brief Component swizzle of the view. By default the identity mapping.
+    \see RenderingFeatures::hasTextureViewSwizzle
+    */
+    TextureSwizzleRGBA  swizzle;
+};
 
 /**
 \brief Texture descriptor structure.
@@ -241,6 +313,27 @@ struct TextureRegion
     Extent3D        extent      = { 1, 1, 1 };
 };
 
+/**
+\brief Texture location structure.
+\remarks This is used to specify the destination of a texture copy operation.
+The offset follows the same conventions as the offset in the TextureRegion structure.
+\see CommandBuffer::CopyTexture
+\see TextureRegion
+*/
+struct TextureLocation
+{
+    //! MIP-map level for the sub-texture, where 0 is the base texture, and N > 0 is the N-th MIP-map level. By default 0.
+    std::uint32_t   mipLevel    = 0;
+
+    /**
+    \brief Sub-texture offset. By default (0, 0, 0).
+    \remarks For array textures, the Z component specifies the array layer (for 1D-array textures it's the Y component).
+    For cube textures, the Z component specifies the array layer and cube face offset.
+    Negative values of this member are not allowed and result in undefined behavior.
+    */
+    Offset3D        offset      = { 0, 0, 0 };
+};
+
 
 /* ----- Functions ----- */
 
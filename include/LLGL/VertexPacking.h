@@ -0,0 +1,139 @@
+/*
+ * VertexPacking.h
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_VERTEX_PACKING_H
+#define LLGL_VERTEX_PACKING_H
+
+#ifdef LLGL_ENABLE_UTILITY
+
+/*
+THIS HEADER MUST BE EXPLICITLY INCLUDED
+*/
+
+#include "Export.h"
+#include "Format.h"
+#include "VertexFormat.h"
+#include "ImageFlags.h"
+#include <vector>
+#include <string>
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+/**
+\brief Vertex attribute packing rule structure.
+\remarks Each rule specifies the target format for all vertex attributes with the specified name.
+\see PackVertexBuffer
+*/
+struct VertexPackingRule
+{
+    VertexPackingRule() = default;
+    VertexPackingRule(const VertexPackingRule&) = default;
+    VertexPackingRule& operator = (const VertexPackingRule&) = default;
+
+    //! Constructs the packing rule with the specified attribute name and target format.
+    inline VertexPackingRule(const std::string& name, const Format format) :
+        name   { name   },
+        format { format }
+    {
+    }
+
+    //! Name of the vertex attributes this rule applies to (see VertexAttribute::name).
+    std::string name;
+
+    /**
+    \brief Target format of the vertex attributes. By default Format::Undefined.
+    \remarks This must be an uncompressed color format, e.g. Format::RGB16Float for positions,
+    Format::RGBA8SNorm for normals, or Format::RG16UNorm for texture coordinates.
+    Missing components are filled with zero and surplus components are discarded.
+    Normalized formats are clamped to the range [0, 1] for unsigned formats and [-1, 1] for signed formats.
+    If this is Format::Undefined, the attribute keeps its original format.
+    */
+    Format      format  = Format::Undefined;
+};
+
+/**
+\defgroup group_vertex_packing Vertex attribute quantization and packing functions.
+\addtogroup group_vertex_packing
+@{
+*/
+
+/**
+\brief Returns the vertex format with all attribute formats rewritten by the specified packing rules.
+\param[in] srcVertexFormat Specifies the source vertex format.
+\param[in] rules Specifies the packing rules. Attributes that are not referenced by any rule keep their original format.
+\return The rewritten vertex format. All attributes are tightly packed in their original order,
+but each attribute offset as well as the stride are aligned to 4 bytes, which is required by most rendering APIs.
+\throw std::invalid_argument If a rule specifies a compressed or depth-stencil format.
+\see PackVertexBuffer
+*/
+LLGL_EXPORT VertexFormat GetPackedVertexFormat(
+    const VertexFormat&                     srcVertexFormat,
+    const std::vector<VertexPackingRule>&   rules
+);
+
+/**
+\brief Quantizes the source vertices and packs them into a new vertex buffer.
+\param[in] srcVertexFormat Specifies the vertex format of the source vertices.
+\param[in] srcVertices Raw pointer to the source vertices. Each vertex is expected at an offset of <code>srcVertexFormat.stride</code> bytes.
+\param[in] numVertices Specifies the number of vertices.
+\param[in] rules Specifies the packing rules that determine the target format of each vertex attribute.
+\param[out] dstVertexFormat Specifies the output vertex format that describes the packed vertices (see GetPackedVertexFormat).
+\param[in] threadCount Specifies the number of threads to use for conversion.
+If this is less than 2, no multi-threading is used. If this is 'Constants::maxThreadCount',
+the maximal count of threads the system supports will be used (e.g. 4 on a quad-core processor). By default 0.
+\return Byte buffer with the packed vertices. The size of this buffer is <code>dstVertexFormat.stride * numVertices</code> bytes.
+\remarks Example usage:
+\code
+LLGL::VertexFormat packedFormat;
+auto packedVertices = LLGL::PackVertexBuffer(
+    myVertexFormat,
+    myVertices.data(),
+    myVertices.size(),
+    {
+        { "position", LLGL::Format::RGB16Float  },
+        { "normal",   LLGL::Format::RGBA8SNorm  },
+        { "texCoord", LLGL::Format::RG16UNorm   },
+    },
+    packedFormat,
+    LLGL::Constants::maxThreadCount
+);
+\endcode
+\throw std::invalid_argument If a rule specifies a compressed or depth-stencil format.
+\throw std::invalid_argument If a source attribute has a compressed or depth-stencil format.
+\see GetPackedVertexFormat
+\see Constants::maxThreadCount
+*/
+LLGL_EXPORT ByteBuffer PackVertexBuffer(
+    const VertexFormat&                     srcVertexFormat,
+    const void*                             srcVertices,
+    std::size_t                             numVertices,
+    const std::vector<VertexPackingRule>&   rules,
+    VertexFormat&                           dstVertexFormat,
+    std::size_t                             threadCount = 0
+);
+
+/** @} */
+
+
+} // /namespace LLGL
+
+
+#else
+
+#error LLGL was not compiled with LLGL_ENABLE_UTILITY option
+
+#endif
+
+#endif
+
+
+
+// ================================================================================
@@ -0,0 +1,1003 @@
+/*
+ * BCDecompressor.cpp
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "BCDecompressor.h"
+#include "Float16Compressor.h"
+#include <algorithm>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+#include <string.h>
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+/* ----- Internal structures ----- */
+
+// Decompressed texels of a single 4x4 block (in row-major order).
+union BCTexelBlock
+{
+    std::uint8_t    unorm8[16][4];
+    std::int8_t     snorm8[16][4];
+    float           float32[16][4];
+};
+
+// Little-endian bit stream reader for a single 128-bit block (used by BC6H and BC7).
+class BCBitReader
+{
+
+    public:
+
+        BCBitReader(const std::uint8_t* block)
+        {
+            for (int i = 0; i < 8; ++i)
+            {
+                bits_[0] |= (static_cast<std::uint64_t>(block[i    ]) << (i*8));
+                bits_[1] |= (static_cast<std::uint64_t>(block[i + 8]) << (i*8));
+            }
+        }
+
+        // Reads the specified number of bits (at most 32) and returns them with the first bit as least significant bit.
+        std::uint32_t Read(std::uint32_t count)
+        {
+            if (count == 0 || pos_ >= 128)
+                return 0;
+
+            const auto idx      = (pos_ >> 6);
+            const auto shift    = (pos_ & 63);
+
+            auto value = (bits_[idx] >> shift);
+            if (idx == 0 && shift + count > 64)
+                value |= (bits_[1] << (64 - shift));
+
+            pos_ += count;
+
+            return static_cast<std::uint32_t>(value & ((std::uint64_t(1) << count) - 1));
+        }
+
+    private:
+
+        std::uint64_t bits_[2]  = { 0, 0 };
+        std::uint32_t pos_      = 0;
+
+};
+
+
+/* ----- Internal functions ----- */
+
+static std::uint32_t ReadUInt16(const std::uint8_t* data)
+{
+    return (static_cast<std::uint32_t>(data[0]) | (static_cast<std::uint32_t>(data[1]) << 8));
+}
+
+static std::uint32_t ReadUInt32(const std::uint8_t* data)
+{
+    return (ReadUInt16(data) | (ReadUInt16(data + 2) << 16));
+}
+
+static std::uint64_t ReadUInt48(const std::uint8_t* data)
+{
+    return (static_cast<std::uint64_t>(ReadUInt32(data)) | (static_cast<std::uint64_t>(ReadUInt16(data + 4)) << 32));
+}
+
+// Expands the specified R5G6B5 color into an RGBA8 color.
+static void ExpandRGB565(std::uint32_t color, std::uint8_t (&rgba)[4])
+{
+    const auto r = ((color >> 11) & 0x1F);
+    const auto g = ((color >>  5) & 0x3F);
+    const auto b = ((color      ) & 0x1F);
+
+    rgba[0] = static_cast<std::uint8_t>((r << 3) | (r >> 2));
+    rgba[1] = static_cast<std::uint8_t>((g << 2) | (g >> 4));
+    rgba[2] = static_cast<std::uint8_t>((b << 3) | (b >> 2));
+    rgba[3] = 255;
+}
+
+/*
+Decodes the color block of BC1, BC2, and BC3 into the RGBA components of the texels.
+BC2 and BC3 always use the 4-color palette, while BC1 uses the 3-color palette if color0 <= color1.
+*/
+static void DecodeBCColorBlock(const std::uint8_t* block, BCTexelBlock& texels, bool threeColorMode, std::uint8_t transparentAlpha)
+{
+    const auto color0 = ReadUInt16(block);
+    const auto color1 = ReadUInt16(block + 2);
+
+    std::uint8_t palette[4][4];
+    ExpandRGB565(color0, palette[0]);
+    ExpandRGB565(color1, palette[1]);
+
+    if (color0 > color1 || !threeColorMode)
+    {
+        for (int c = 0; c < 3; ++c)
+        {
+            palette[2][c] = static_cast<std::uint8_t>((2*palette[0][c] + palette[1][c] + 1) / 3);
+            palette[3][c] = static_cast<std::uint8_t>((palette[0][c] + 2*palette[1][c] + 1) / 3);
+        }
+        palette[2][3] = 255;
+        palette[3][3] = 255;
+    }
+    else
+    {
+        for (int c = 0; c < 3; ++c)
+        {
+            palette[2][c] = static_cast<std::uint8_t>((palette[0][c] + palette[1][c] + 1) / 2);
+            palette[3][c] = 0;
+        }
+        palette[2][3] = 255;
+        palette[3][3] = transparentAlpha;
+    }
+
+    const auto indices = ReadUInt32(block + 4);
+
+    for (int i = 0; i < 16; ++i)
+        ::memcpy(texels.unorm8[i], palette[(indices >> (i*2)) & 0x3], 4);
+}
+
+// Decodes an unsigned BC4 block (also used for the alpha block of BC3 and each component of BC5) into the specified texel component.
+static void DecodeBCUNormBlock(const std::uint8_t* block, BCTexelBlock& texels, int component)
+{
+    const std::int32_t value0 = block[0];
+    const std::int32_t value1 = block[1];
+
+    std::int32_t palette[8] = { value0, value1 };
+
+    if (value0 > value1)
+    {
+        for (int i = 1; i <= 6; ++i)
+            palette[i + 1] = ((7 - i)*value0 + i*value1 + 3) / 7;
+    }
+    else
+    {
+        for (int i = 1; i <= 4; ++i)
+            palette[i + 1] = ((5 - i)*value0 + i*value1 + 2) / 5;
+        palette[6] = 0;
+        palette[7] = 255;
+    }
+
+    const auto indices = ReadUInt48(block + 2);
+
+    for (int i = 0; i < 16; ++i)
+        texels.unorm8[i][component] = static_cast<std::uint8_t>(palette[(indices >> (i*3)) & 0x7]);
+}
+
+// Divides the specified value with rounding to the nearest integer (also for negative values).
+static std::int32_t DivideRounded(std::int32_t value, std::int32_t divisor)
+{
+    return (value >= 0 ? (value + divisor/2) / divisor : (value - divisor/2) / divisor);
+}
+
+// Decodes a signed BC4 block (also used for each component of BC5) into the specified texel component.
+static void DecodeBCSNormBlock(const std::uint8_t* block, BCTexelBlock& texels, int component)
+{
+    /* Both -128 and -127 map to -1.0 */
+    const std::int32_t value0 = std::max<std::int32_t>(-127, static_cast<std::int8_t>(block[0]));
+    const std::int32_t value1 = std::max<std::int32_t>(-127, static_cast<std::int8_t>(block[1]));
+
+    std::int32_t palette[8] = { value0, value1 };
+
+    if (value0 > value1)
+    {
+        for (int i = 1; i <= 6; ++i)
+            palette[i + 1] = DivideRounded((7 - i)*value0 + i*value1, 7);
+    }
+    else
+    {
+        for (int i = 1; i <= 4; ++i)
+            palette[i + 1] = DivideRounded((5 - i)*value0 + i*value1, 5);
+        palette[6] = -127;
+        palette[7] = 127;
+    }
+
+    const auto indices = ReadUInt48(block + 2);
+
+    for (int i = 0; i < 16; ++i)
+        texels.snorm8[i][component] = static_cast<std::int8_t>(palette[(indices >> (i*3)) & 0x7]);
+}
+
+// Fills the specified component of all texels with a constant value.
+static void FillBCTexelComponent(BCTexelBlock& texels, int component, std::uint8_t value)
+{
+    for (int i = 0; i < 16; ++i)
+        texels.unorm8[i][component] = value;
+}
+
+static void DecodeBC1Block(const std::uint8_t* block, BCTexelBlock& texels, bool hasAlpha)
+{
+    DecodeBCColorBlock(block, texels, true, (hasAlpha ? 0 : 255));
+}
+
+static void DecodeBC2Block(const std::uint8_t* block, BCTexelBlock& texels)
+{
+    DecodeBCColorBlock(block + 8, texels, false, 255);
+
+    /* Decode explicit 4-bit alpha values */
+    for (int i = 0; i < 16; ++i)
+    {
+        const auto alpha = ((block[i/2] >> ((i % 2)*4)) & 0xF);
+        texels.unorm8[i][3] = static_cast<std::uint8_t>(alpha | (alpha << 4));
+    }
+}
+
+static void DecodeBC3Block(const std::uint8_t* block, BCTexelBlock& texels)
+{
+    DecodeBCColorBlock(block + 8, texels, false, 255);
+    DecodeBCUNormBlock(block, texels, 3);
+}
+
+static void DecodeBC4Block(const std::uint8_t* block, BCTexelBlock& texels, bool isSigned)
+{
+    if (isSigned)
+    {
+        DecodeBCSNormBlock(block, texels, 0);
+        FillBCTexelComponent(texels, 1, 0);
+        FillBCTexelComponent(texels, 2, 0);
+        FillBCTexelComponent(texels, 3, 127);
+    }
+    else
+    {
+        DecodeBCUNormBlock(block, texels, 0);
+        FillBCTexelComponent(texels, 1, 0);
+        FillBCTexelComponent(texels, 2, 0);
+        FillBCTexelComponent(texels, 3, 255);
+    }
+}
+
+static void DecodeBC5Block(const std::uint8_t* block, BCTexelBlock& texels, bool isSigned)
+{
+    if (isSigned)
+    {
+        DecodeBCSNormBlock(block, texels, 0);
+        DecodeBCSNormBlock(block + 8, texels, 1);
+        FillBCTexelComponent(texels, 2, 0);
+        FillBCTexelComponent(texels, 3, 127);
+    }
+    else
+    {
+        DecodeBCUNormBlock(block, texels, 0);
+        DecodeBCUNormBlock(block + 8, texels, 1);
+        FillBCTexelComponent(texels, 2, 0);
+        FillBCTexelComponent(texels, 3, 255);
+    }
+}
+
+
+/* ----- BPTC tables (shared by BC6H and BC7) ----- */
+
+// Partition masks for two subsets: bit i specifies the subset of texel i.
+static const std::uint16_t g_bptcPartitions2[64] =
+{
+    0xCCCC, 0x8888, 0xEEEE, 0xECC8, 0xC880, 0xFEEC, 0xFEC8, 0xEC80,
+    0xC800, 0xFFEC, 0xFE80, 0xE800, 0xFFE8, 0xFF00, 0xFFF0, 0xF000,
+    0xF710, 0x008E, 0x7100, 0x08CE, 0x008C, 0x7310, 0x3100, 0x8CCE,
+    0x088C, 0x3110, 0x6666, 0x366C, 0x17E8, 0x0FF0, 0x718E, 0x399C,
+    0xAAAA, 0xF0F0, 0x5A5A, 0x33CC, 0x3C3C, 0x55AA, 0x9696, 0xA55A,
+    0x73CE, 0x13C8, 0x324C, 0x3BDC, 0x6996, 0xC33C, 0x9966, 0x0660,
+    0x0272, 0x04E4, 0x4E40, 0x2720, 0xC936, 0x936C, 0x39C6, 0x639C,
+    0x9336, 0x9CC6, 0x817E, 0xE718, 0xCCF0, 0x0FCC, 0x7744, 0xEE22,
+};
+
+// Partition subsets for three subsets.
+static const std::uint8_t g_bptcPartitions3[64][16] =
+{
+    { 0,0,1,1,0,0,1,1,0,2,2,1,2,2,2,2 }, { 0,0,0,1,0,0,1,1,2,2,1,1,2,2,2,1 }, { 0,0,0,0,2,0,0,1,2,2,1,1,2,2,1,1 }, { 0,2,2,2,0,0,2,2,0,0,1,1,0,1,1,1 },
+    { 0,0,0,0,0,0,0,0,1,1,2,2,1,1,2,2 }, { 0,0,1,1,0,0,1,1,0,0,2,2,0,0,2,2 }, { 0,0,2,2,0,0,2,2,1,1,1,1,1,1,1,1 }, { 0,0,1,1,0,0,1,1,2,2,1,1,2,2,1,1 },
+    { 0,0,0,0,0,0,0,0,1,1,1,1,2,2,2,2 }, { 0,0,0,0,1,1,1,1,1,1,1,1,2,2,2,2 }, { 0,0,0,0,1,1,1,1,2,2,2,2,2,2,2,2 }, { 0,0,1,2,0,0,1,2,0,0,1,2,0,0,1,2 },
+    { 0,1,1,2,0,1,1,2,0,1,1,2,0,1,1,2 }, { 0,1,2,2,0,1,2,2,0,1,2,2,0,1,2,2 }, { 0,0,1,1,0,1,1,2,1,1,2,2,1,2,2,2 }, { 0,0,1,1,2,0,0,1,2,2,0,0,2,2,2,0 },
+    { 0,0,0,1,0,0,1,1,0,1,1,2,1,1,2,2 }, { 0,1,1,1,0,0,1,1,2,0,0,1,2,2,0,0 }, { 0,0,0,0,1,1,2,2,1,1,2,2,1,1,2,2 }, { 0,0,2,2,0,0,2,2,0,0,2,2,1,1,1,1 },
+    { 0,1,1,1,0,1,1,1,0,2,2,2,0,2,2,2 }, { 0,0,0,1,0,0,0,1,2,2,2,1,2,2,2,1 }, { 0,0,0,0,0,0,1,1,0,1,2,2,0,1,2,2 }, { 0,0,0,0,1,1,0,0,2,2,1,0,2,2,1,0 },
+    { 0,1,2,2,0,1,2,2,0,0,1,1,0,0,0,0 }, { 0,0,1,2,0,0,1,2,1,1,2,2,2,2,2,2 }, { 0,1,1,0,1,2,2,1,1,2,2,1,0,1,1,0 }, { 0,0,0,0,0,1,1,0,1,2,2,1,1,2,2,1 },
+    { 0,0,2,2,1,1,0,2,1,1,0,2,0,0,2,2 }, { 0,1,1,0,0,1,1,0,2,0,0,2,2,2,2,2 }, { 0,0,1,1,0,1,2,2,0,1,2,2,0,0,1,1 }, { 0,0,0,0,2,0,0,0,2,2,1,1,2,2,2,1 },
+    { 0,0,0,0,0,0,0,2,1,1,2,2,1,2,2,2 }, { 0,2,2,2,0,0,2,2,0,0,1,2,0,0,1,1 }, { 0,0,1,1,0,0,1,2,0,0,2,2,0,2,2,2 }, { 0,1,2,0,0,1,2,0,0,1,2,0,0,1,2,0 },
+    { 0,0,0,0,1,1,1,1,2,2,2,2,0,0,0,0 }, { 0,1,2,0,1,2,0,1,2,0,1,2,0,1,2,0 }, { 0,1,2,0,2,0,1,2,1,2,0,1,0,1,2,0 }, { 0,0,1,1,2,2,0,0,1,1,2,2,0,0,1,1 },
+    { 0,0,1,1,1,1,2,2,2,2,0,0,0,0,1,1 }, { 0,1,0,1,0,1,0,1,2,2,2,2,2,2,2,2 }, { 0,0,0,0,0,0,0,0,2,1,2,1,2,1,2,1 }, { 0,0,2,2,1,1,2,2,0,0,2,2,1,1,2,2 },
+    { 0,0,2,2,0,0,1,1,0,0,2,2,0,0,1,1 }, { 0,2,2,0,1,2,2,1,0,2,2,0,1,2,2,1 }, { 0,1,0,1,2,2,2,2,2,2,2,2,0,1,0,1 }, { 0,0,0,0,2,1,2,1,2,1,2,1,2,1,2,1 },
+    { 0,1,0,1,0,1,0,1,0,1,0,1,2,2,2,2 }, { 0,2,2,2,0,1,1,1,0,2,2,2,0,1,1,1 }, { 0,0,0,2,1,1,1,2,0,0,0,2,1,1,1,2 }, { 0,0,0,0,2,1,1,2,2,1,1,2,2,1,1,2 },
+    { 0,2,2,2,0,1,1,1,0,1,1,1,0,2,2,2 }, { 0,0,0,2,1,1,1,2,1,1,1,2,0,0,0,2 }, { 0,1,1,0,0,1,1,0,0,1,1,0,2,2,2,2 }, { 0,0,0,0,0,0,0,0,2,1,1,2,2,1,1,2 },
+    { 0,1,1,0,0,1,1,0,2,2,2,2,2,2,2,2 }, { 0,0,2,2,0,0,1,1,0,0,1,1,0,0,2,2 }, { 0,0,2,2,1,1,2,2,1,1,2,2,0,0,2,2 }, { 0,0,0,0,0,0,0,0,0,0,0,0,2,1,1,2 },
+    { 0,0,0,2,0,0,0,1,0,0,0,2,0,0,0,1 }, { 0,2,2,2,1,2,2,2,0,2,2,2,1,2,2,2 }, { 0,1,0,1,2,2,2,2,2,2,2,2,2,2,2,2 }, { 0,1,1,1,2,0,1,1,2,2,0,1,2,2,2,0 },
+};
+
+// Anchor texel indices of the second subset for two subsets.
+static const std::uint8_t g_bptcAnchors2[64] =
+{
+    15,15,15,15,15,15,15,15, 15,15,15,15,15,15,15,15,
+    15, 2, 8, 2, 2, 8, 8,15,  2, 8, 2, 2, 8, 8, 2, 2,
+    15,15, 6, 8, 2, 8,15,15,  2, 8, 2, 2, 2,15,15, 6,
+     6, 2, 6, 8,15,15, 2, 2, 15,15,15,15,15, 2, 2,15,
+};
+
+// Anchor texel indices of the second subset for three subsets.
+static const std::uint8_t g_bptcAnchors3a[64] =
+{
+     3, 3,15,15, 8, 3,15,15,  8, 8, 6, 6, 6, 5, 3, 3,
+     3, 3, 8,15, 3, 3, 6,10,  5, 8, 8, 6, 8, 5,15,15,
+     8,15, 3, 5, 6,10, 8,15, 15, 3,15, 5,15,15,15,15,
+     3,15, 5, 5, 5, 8, 5,10,  5,10, 8,13,15,12, 3, 3,
+};
+
+// Anchor texel indices of the third subset for three subsets.
+static const std::uint8_t g_bptcAnchors3b[64] =
+{
+    15, 8, 8, 3,15,15, 3, 8, 15,15,15,15,15,15,15, 8,
+    15, 8,15, 3,15, 8,15, 8,  3,15, 6,10,15,15,10, 8,
+    15, 3,15,10,10, 8, 9,10,  6,15, 8,15, 3, 6, 6, 8,
+    15, 3,15,15,15,15,15,15, 15,15,15,15, 3,15,15, 8,
+};
+
+// Interpolation weights for 2-, 3-, and 4-bit indices.
+static const std::int32_t g_bptcWeights2[4]  = { 0, 21, 43, 64 };
+static const std::int32_t g_bptcWeights3[8]  = { 0, 9, 18, 27, 37, 46, 55, 64 };
+static const std::int32_t g_bptcWeights4[16] = { 0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64 };
+
+static std::int32_t GetBPTCWeight(std::uint32_t indexBits, std::uint32_t index)
+{
+    switch (indexBits)
+    {
+        case 2:     return g_bptcWeights2[index];
+        case 3:     return g_bptcWeights3[index];
+        default:    return g_bptcWeights4[index];
+    }
+}
+
+static std::int32_t InterpolateBPTC(std::int32_t value0, std::int32_t value1, std::uint32_t indexBits, std::uint32_t index)
+{
+    const auto weight = GetBPTCWeight(indexBits, index);
+    return (((64 - weight)*value0 + weight*value1 + 32) >> 6);
+}
+
+// Returns the subset of the specified texel.
+static std::uint32_t GetBPTCSubset(std::uint32_t numSubsets, std::uint32_t partition, std::uint32_t texel)
+{
+    switch (numSubsets)
+    {
+        case 2:     return ((g_bptcPartitions2[partition] >> texel) & 0x1);
+        case 3:     return g_bptcPartitions3[partition][texel];
+        default:    return 0;
+    }
+}
+
+// Returns true if the specified texel is an anchor texel, whose index has an implicit zero as most significant bit.
+static bool IsBPTCAnchor(std::uint32_t numSubsets, std::uint32_t partition, std::uint32_t texel)
+{
+    if (texel == 0)
+        return true;
+    switch (numSubsets)
+    {
+        case 2:     return (texel == g_bptcAnchors2[partition]);
+        case 3:     return (texel == g_bptcAnchors3a[partition] || texel == g_bptcAnchors3b[partition]);
+        default:    return false;
+    }
+}
+
+
+/* ----- BC6H ----- */
+
+// Endpoint fields of a BC6H block: W, X, Y, Z are the endpoints of which Y and Z are only used with two regions, D is the partition.
+enum BC6HField : std::uint8_t
+{
+    BC6H_RW, BC6H_GW, BC6H_BW,
+    BC6H_RX, BC6H_GX, BC6H_BX,
+    BC6H_RY, BC6H_GY, BC6H_BY,
+    BC6H_RZ, BC6H_GZ, BC6H_BZ,
+    BC6H_D,
+    BC6H_End,
+};
+
+// Range of bits of an endpoint field, which are read from the first to the last bit.
+struct BC6HBitRange
+{
+    std::uint8_t field;
+    std::uint8_t first;
+    std::uint8_t last;
+};
+
+struct BC6HModeInfo
+{
+    std::uint32_t   mode;
+    bool            transformed;
+    std::uint32_t   numRegions;
+    std::uint32_t   endpointBits;
+    std::uint32_t   deltaBits[3];
+    BC6HBitRange    layout[25];
+};
+
+// Bit layouts of all BC6H modes after the mode bits (see "BC6H Format" of the Direct3D 11 specification).
+static const BC6HModeInfo g_bc6hModes[] =
+{
+    {
+        0x00, true, 2, 10, { 5, 5, 5 },
+        {
+            { BC6H_GY, 4, 4 }, { BC6H_BY, 4, 4 }, { BC6H_BZ, 4, 4 }, { BC6H_RW, 0, 9 }, { BC6H_GW, 0, 9 }, { BC6H_BW, 0, 9 },
+            { BC6H_RX, 0, 4 }, { BC6H_GZ, 4, 4 }, { BC6H_GY, 0, 3 }, { BC6H_GX, 0, 4 }, { BC6H_BZ, 0, 0 }, { BC6H_GZ, 0, 3 },
+            { BC6H_BX, 0, 4 }, { BC6H_BZ, 1, 1 }, { BC6H_BY, 0, 3 }, { BC6H_RY, 0, 4 }, { BC6H_BZ, 2, 2 }, { BC6H_RZ, 0, 4 },
+            { BC6H_BZ, 3, 3 }, { BC6H_D, 0, 4 }, { BC6H_End, 0, 0 },
+        }
+    },
+    {
+        0x01, true, 2, 7, { 6, 6, 6 },
+        {
+            { BC6H_GY, 5, 5 }, { BC6H_GZ, 4, 5 }, { BC6H_RW, 0, 6 }, { BC6H_BZ, 0, 1 }, { BC6H_BY, 4, 4 }, { BC6H_GW, 0, 6 },
+            { BC6H_BY, 5, 5 }, { BC6H_BZ, 2, 2 }, { BC6H_GY, 4, 4 }, { BC6H_BW, 0, 6 }, { BC6H_BZ, 3, 3 }, { BC6H_BZ, 5, 5 },
+            { BC6H_BZ, 4, 4 }, { BC6H_RX, 0, 5 }, { BC6H_GY, 0, 3 }, { BC6H_GX, 0, 5 }, { BC6H_GZ, 0, 3 }, { BC6H_BX, 0, 5 },
+            { BC6H_BY, 0, 3 }, { BC6H_RY, 0, 5 }, { BC6H_RZ, 0, 5 }, { BC6H_D, 0, 4 }, { BC6H_End, 0, 0 },
+        }
+    },
+    {
+        0x02, true, 2, 11, { 5, 4, 4 },
+        {
+            { BC6H_RW, 0, 9 }, { BC6H_GW, 0, 9 }, { BC6H_BW, 0, 9 }, { BC6H_RX, 0, 4 }, { BC6H_RW, 10, 10 }, { BC6H_GY, 0, 3 },
+            { BC6H_GX, 0, 3 }, { BC6H_GW, 10, 10 }, { BC6H_BZ, 0, 0 }, { BC6H_GZ, 0, 3 }, { BC6H_BX, 0, 3 }, { BC6H_BW, 10, 10 },
+            { BC6H_BZ, 1, 1 }, { BC6H_BY, 0, 3 }, { BC6H_RY, 0, 4 }, { BC6H_BZ, 2, 2 }, { BC6H_RZ, 0, 4 }, { BC6H_BZ, 3, 3 },
+            { BC6H_D, 0, 4 }, { BC6H_End, 0, 0 },
+        }
+    },
+    {
+        0x06, true, 2, 11, { 4, 5, 4 },
+        {
+            { BC6H_RW, 0, 9 }, { BC6H_GW, 0, 9 }, { BC6H_BW, 0, 9 }, { BC6H_RX, 0, 3 }, { BC6H_RW, 10, 10 }, { BC6H_GZ, 4, 4 },
+            { BC6H_GY, 0, 3 }, { BC6H_GX, 0, 4 }, { BC6H_GW, 10, 10 }, { BC6H_GZ, 0, 3 }, { BC6H_BX, 0, 3 }, { BC6H_BW, 10, 10 },
+            { BC6H_BZ, 1, 1 }, { BC6H_BY, 0, 3 }, { BC6H_RY, 0, 3 }, { BC6H_BZ, 0, 0 }, { BC6H_BZ, 2, 2 }, { BC6H_RZ, 0, 3 },
+            { BC6H_GY, 4, 4 }, { BC6H_BZ, 3, 3 }, { BC6H_D, 0, 4 }, { BC6H_End, 0, 0 },
+        }
+    },
+    {
+        0x0A, true, 2, 11, { 4, 4, 5 },
+        {
+            { BC6H_RW, 0, 9 }, { BC6H_GW, 0, 9 }, { BC6H_BW, 0, 9 }, { BC6H_RX, 0, 3 }, { BC6H_RW, 10, 10 }, { BC6H_BY, 4, 4 },
+            { BC6H_GY, 0, 3 }, { BC6H_GX, 0, 3 }, { BC6H_GW, 10, 10 }, { BC6H_BZ, 0, 0 }, { BC6H_GZ, 0, 3 }, { BC6H_BX, 0, 4 },
+            { BC6H_BW, 10, 10 }, { BC6H_BY, 0, 3 }, { BC6H_RY, 0, 3 }, { BC6H_BZ, 1, 2 }, { BC6H_RZ, 0, 3 }, { BC6H_BZ, 4, 4 },
+            { BC6H_BZ, 3, 3 }, { BC6H_D, 0, 4 }, { BC6H_End, 0, 0 },
+        }
+    },
+    {
+        0x0E, true, 2, 9, { 5, 5, 5 },
+        {
+            { BC6H_RW, 0, 8 }, { BC6H_BY, 4, 4 }, { BC6H_GW, 0, 8 }, { BC6H_GY, 4, 4 }, { BC6H_BW, 0, 8 }, { BC6H_BZ, 4, 4 },
+            { BC6H_RX, 0, 4 }, { BC6H_GZ, 4, 4 }, { BC6H_GY, 0, 3 }, { BC6H_GX, 0, 4 }, { BC6H_BZ, 0, 0 }, { BC6H_GZ, 0, 3 },
+            { BC6H_BX, 0, 4 }, { BC6H_BZ, 1, 1 }, { BC6H_BY, 0, 3 }, { BC6H_RY, 0, 4 }, { BC6H_BZ, 2, 2 }, { BC6H_RZ, 0, 4 },
+            { BC6H_BZ, 3, 3 }, { BC6H_D, 0, 4 }, { BC6H_End, 0, 0 },
+        }
+    },
+    {
+        0x12, true, 2, 8, { 6, 5, 5 },
+        {
+            { BC6H_RW, 0, 7 }, { BC6H_GZ, 4, 4 }, { BC6H_BY, 4, 4 }, { BC6H_GW, 0, 7 }, { BC6H_BZ, 2, 2 }, { BC6H_GY, 4, 4 },
+            { BC6H_BW, 0, 7 }, { BC6H_BZ, 3, 4 }, { BC6H_RX, 0, 5 }, { BC6H_GY, 0, 3 }, { BC6H_GX, 0, 4 }, { BC6H_BZ, 0, 0 },
+            { BC6H_GZ, 0, 3 }, { BC6H_BX, 0, 4 }, { BC6H_BZ, 1, 1 }, { BC6H_BY, 0, 3 }, { BC6H_RY, 0, 5 }, { BC6H_RZ, 0, 5 },
+            { BC6H_D, 0, 4 }, { BC6H_End, 0, 0 },
+        }
+    },
+    {
+        0x16, true, 2, 8, { 5, 6, 5 },
+        {
+            { BC6H_RW, 0, 7 }, { BC6H_BZ, 0, 0 }, { BC6H_BY, 4, 4 }, { BC6H_GW, 0, 7 }, { BC6H_GY, 5, 5 }, { BC6H_GY, 4, 4 },
+            { BC6H_BW, 0, 7 }, { BC6H_GZ, 5, 5 }, { BC6H_BZ, 4, 4 }, { BC6H_RX, 0, 4 }, { BC6H_GZ, 4, 4 }, { BC6H_GY, 0, 3 },
+            { BC6H_GX, 0, 5 }, { BC6H_GZ, 0, 3 }, { BC6H_BX, 0, 4 }, { BC6H_BZ, 1, 1 }, { BC6H_BY, 0, 3 }, { BC6H_RY, 0, 4 },
+            { BC6H_BZ, 2, 2 }, { BC6H_RZ, 0, 4 }, { BC6H_BZ, 3, 3 }, { BC6H_D, 0, 4 }, { BC6H_End, 0, 0 },
+        }
+    },
+    {
+        0x1A, true, 2, 8, { 5, 5, 6 },
+        {
+            { BC6H_RW, 0, 7 }, { BC6H_BZ, 1, 1 }, { BC6H_BY, 4, 4 }, { BC6H_GW, 0, 7 }, { BC6H_BY, 5, 5 }, { BC6H_GY, 4, 4 },
+            { BC6H_BW, 0, 7 }, { BC6H_BZ, 5, 5 }, { BC6H_BZ, 4, 4 }, { BC6H_RX, 0, 4 }, { BC6H_GZ, 4, 4 }, { BC6H_GY, 0, 3 },
+            { BC6H_GX, 0, 4 }, { BC6H_BZ, 0, 0 }, { BC6H_GZ, 0, 3 }, { BC6H_BX, 0, 5 }, { BC6H_BY, 0, 3 }, { BC6H_RY, 0, 4 },
+            { BC6H_BZ, 2, 2 }, { BC6H_RZ, 0, 4 }, { BC6H_BZ, 3, 3 }, { BC6H_D, 0, 4 }, { BC6H_End, 0, 0 },
+        }
+    },
+    {
+        0x1E, false, 2, 6, { 6, 6, 6 },
+        {
+            { BC6H_RW, 0, 5 }, { BC6H_GZ, 4, 4 }, { BC6H_BZ, 0, 1 }, { BC6H_BY, 4, 4 }, { BC6H_GW, 0, 5 }, { BC6H_GY, 5, 5 },
+            { BC6H_BY, 5, 5 }, { BC6H_BZ, 2, 2 }, { BC6H_GY, 4, 4 }, { BC6H_BW, 0, 5 }, { BC6H_GZ, 5, 5 }, { BC6H_BZ, 3, 3 },
+            { BC6H_BZ, 5, 5 }, { BC6H_BZ, 4, 4 }, { BC6H_RX, 0, 5 }, { BC6H_GY, 0, 3 }, { BC6H_GX, 0, 5 }, { BC6H_GZ, 0, 3 },
+            { BC6H_BX, 0, 5 }, { BC6H_BY, 0, 3 }, { BC6H_RY, 0, 5 }, { BC6H_RZ, 0, 5 }, { BC6H_D, 0, 4 }, { BC6H_End, 0, 0 },
+        }
+    },
+    {
+        0x03, false, 1, 10, { 10, 10, 10 },
+        {
+            { BC6H_RW, 0, 9 }, { BC6H_GW, 0, 9 }, { BC6H_BW, 0, 9 }, { BC6H_RX, 0, 9 }, { BC6H_GX, 0, 9 }, { BC6H_BX, 0, 9 },
+            { BC6H_End, 0, 0 },
+        }
+    },
+    {
+        0x07, true, 1, 11, { 9, 9, 9 },
+        {
+            { BC6H_RW, 0, 9 }, { BC6H_GW, 0, 9 }, { BC6H_BW, 0, 9 }, { BC6H_RX, 0, 8 }, { BC6H_RW, 10, 10 }, { BC6H_GX, 0, 8 },
+            { BC6H_GW, 10, 10 }, { BC6H_BX, 0, 8 }, { BC6H_BW, 10, 10 }, { BC6H_End, 0, 0 },
+        }
+    },
+    {
+        0x0B, true, 1, 12, { 8, 8, 8 },
+        {
+            { BC6H_RW, 0, 9 }, { BC6H_GW, 0, 9 }, { BC6H_BW, 0, 9 }, { BC6H_RX, 0, 7 }, { BC6H_RW, 11, 10 }, { BC6H_GX, 0, 7 },
+            { BC6H_GW, 11, 10 }, { BC6H_BX, 0, 7 }, { BC6H_BW, 11, 10 }, { BC6H_End, 0, 0 },
+        }
+    },
+    {
+        0x0F, true, 1, 16, { 4, 4, 4 },
+        {
+            { BC6H_RW, 0, 9 }, { BC6H_GW, 0, 9 }, { BC6H_BW, 0, 9 }, { BC6H_RX, 0, 3 }, { BC6H_RW, 15, 10 }, { BC6H_GX, 0, 3 },
+            { BC6H_GW, 15, 10 }, { BC6H_BX, 0, 3 }, { BC6H_BW, 15, 10 }, { BC6H_End, 0, 0 },
+        }
+    },
+};
+
+static const BC6HModeInfo* FindBC6HMode(std::uint32_t mode)
+{
+    for (const auto& modeInfo : g_bc6hModes)
+    {
+        if (modeInfo.mode == mode)
+            return (&modeInfo);
+    }
+    return nullptr;
+}
+
+static std::int32_t SignExtend(std::int32_t value, std::uint32_t bits)
+{
+    const auto shift = 32 - bits;
+    return static_cast<std::int32_t>(static_cast<std::uint32_t>(value) << shift) >> shift;
+}
+
+// Unquantizes the specified endpoint component to a 16-bit value, which is interpolated before it is converted to a half-float.
+static std::int32_t UnquantizeBC6H(std::int32_t value, std::uint32_t bits, bool isSigned)
+{
+    if (isSigned)
+    {
+        if (bits >= 16)
+            return value;
+
+        const bool negative = (value < 0);
+        if (negative)
+            value = -value;
+
+        std::int32_t result = 0;
+        if (value == 0)
+            result = 0;
+        else if (value >= ((1 << (bits - 1)) - 1))
+            result = 0x7FFF;
+        else
+            result = (((value << 15) + 0x4000) >> (bits - 1));
+
+        return (negative ? -result : result);
+    }
+    else
+    {
+        if (bits >= 15)
+            return value;
+        else if (value == 0)
+            return 0;
+        else if (value == ((1 << bits) - 1))
+            return 0xFFFF;
+        else
+            return (((value << 16) + 0x8000) >> bits);
+    }
+}
+
+// Converts the specified interpolated value to a 32-bit float by scaling it to the half-float range.
+static float FinishUnquantizeBC6H(std::int32_t value, bool isSigned)
+{
+    std::uint16_t bits = 0;
+    if (isSigned)
+    {
+        if (value < 0)
+            bits = static_cast<std::uint16_t>(0x8000 | (((-value) * 31) >> 5));
+        else
+            bits = static_cast<std::uint16_t>((value * 31) >> 5);
+    }
+    else
+        bits = static_cast<std::uint16_t>((value * 31) >> 6);
+    return DecompressFloat16(bits);
+}
+
+static void DecodeBC6HBlock(const std::uint8_t* block, BCTexelBlock& texels, bool isSigned)
+{
+    BCBitReader reader { block };
+
+    /* Read mode with either 2 or 5 bits */
+    auto mode = reader.Read(2);
+    if (mode >= 2)
+        mode |= (reader.Read(3) << 2);
+
+    const auto modeInfo = FindBC6HMode(mode);
+    if (!modeInfo)
+    {
+        /* Reserved modes are decoded as black */
+        for (int i = 0; i < 16; ++i)
+        {
+            texels.float32[i][0] = 0.0f;
+            texels.float32[i][1] = 0.0f;
+            texels.float32[i][2] = 0.0f;
+            texels.float32[i][3] = 1.0f;
+        }
+        return;
+    }
+
+    /* Read endpoint fields */
+    std::int32_t fields[BC6H_End] = {};
+
+    for (auto range = modeInfo->layout; range->field != BC6H_End; ++range)
+    {
+        const int step = (range->first <= range->last ? 1 : -1);
+        for (int bit = range->first;; bit += step)
+        {
+            fields[range->field] |= static_cast<std::int32_t>(reader.Read(1) << bit);
+            if (bit == range->last)
+                break;
+        }
+    }
+
+    /* Reconstruct endpoints (W, X for the first region and Y, Z for the second region) */
+    const auto numEndpoints = modeInfo->numRegions * 2;
+    const auto endpointBits = modeInfo->endpointBits;
+
+    std::int32_t endpoints[4][3];
+
+    for (std::uint32_t c = 0; c < 3; ++c)
+    {
+        for (std::uint32_t e = 0; e < numEndpoints; ++e)
+            endpoints[e][c] = fields[e*3 + c];
+
+        if (isSigned)
+            endpoints[0][c] = SignExtend(endpoints[0][c], endpointBits);
+
+        for (std::uint32_t e = 1; e < numEndpoints; ++e)
+        {
+            if (modeInfo->transformed)
+            {
+                /* Endpoints are stored as signed deltas to the first endpoint */
+                const auto delta = SignExtend(endpoints[e][c], modeInfo->deltaBits[c]);
+                endpoints[e][c] = ((endpoints[0][c] + delta) & ((1 << endpointBits) - 1));
+            }
+            if (isSigned)
+                endpoints[e][c] = SignExtend(endpoints[e][c], endpointBits);
+        }
+
+        for (std::uint32_t e = 0; e < numEndpoints; ++e)
+            endpoints[e][c] = UnquantizeBC6H(endpoints[e][c], endpointBits, isSigned);
+    }
+
+    /* Read indices and interpolate texels */
+    const auto partition    = static_cast<std::uint32_t>(fields[BC6H_D]);
+    const auto indexBits    = (modeInfo->numRegions == 2 ? 3u : 4u);
+
+    for (std::uint32_t i = 0; i < 16; ++i)
+    {
+        const auto region   = GetBPTCSubset(modeInfo->numRegions, partition, i);
+        const auto anchor   = IsBPTCAnchor(modeInfo->numRegions, partition, i);
+        const auto index    = reader.Read(anchor ? indexBits - 1 : indexBits);
+
+        for (std::uint32_t c = 0; c < 3; ++c)
+        {
+            const auto value = InterpolateBPTC(endpoints[region*2][c], endpoints[region*2 + 1][c], indexBits, index);
+            texels.float32[i][c] = FinishUnquantizeBC6H(value, isSigned);
+        }
+        texels.float32[i][3] = 1.0f;
+    }
+}
+
+
+/* ----- BC7 ----- */
+
+struct BC7ModeInfo
+{
+    std::uint32_t numSubsets;
+    std::uint32_t partitionBits;
+    std::uint32_t rotationBits;
+    std::uint32_t indexSelectionBits;
+    std::uint32_t colorBits;
+    std::uint32_t alphaBits;
+    std::uint32_t endpointPBits;
+    std::uint32_t sharedPBits;
+    std::uint32_t indexBits;
+    std::uint32_t index2Bits;
+};
+
+static const BC7ModeInfo g_bc7Modes[8] =
+{
+    { 3, 4, 0, 0, 4, 0, 1, 0, 3, 0 },
+    { 2, 6, 0, 0, 6, 0, 0, 1, 3, 0 },
+    { 3, 6, 0, 0, 5, 0, 0, 0, 2, 0 },
+    { 2, 6, 0, 0, 7, 0, 1, 0, 2, 0 },
+    { 1, 0, 2, 1, 5, 6, 0, 0, 2, 3 },
+    { 1, 0, 2, 0, 7, 8, 0, 0, 2, 2 },
+    { 1, 0, 0, 0, 7, 7, 1, 0, 4, 0 },
+    { 2, 6, 0, 0, 5, 5, 1, 0, 2, 0 },
+};
+
+// Expands the specified endpoint component with the specified number of bits to 8 bits.
+static std::int32_t ExpandBC7Component(std::uint32_t value, std::uint32_t bits)
+{
+    value <<= (8 - bits);
+    return static_cast<std::int32_t>(value | (value >> bits));
+}
+
+static void DecodeBC7Block(const std::uint8_t* block, BCTexelBlock& texels)
+{
+    BCBitReader reader { block };
+
+    /* Mode is specified by the number of leading zero bits */
+    std::uint32_t mode = 0;
+    while (mode < 8 && reader.Read(1) == 0)
+        ++mode;
+
+    if (mode == 8)
+    {
+        /* Reserved mode is decoded as transparent black */
+        ::memset(texels.unorm8, 0, sizeof(texels.unorm8));
+        return;
+    }
+
+    const auto& modeInfo        = g_bc7Modes[mode];
+    const auto  partition       = reader.Read(modeInfo.partitionBits);
+    const auto  rotation        = reader.Read(modeInfo.rotationBits);
+    const auto  indexSelection  = reader.Read(modeInfo.indexSelectionBits);
+    const auto  numEndpoints    = modeInfo.numSubsets * 2;
+
+    /* Read endpoints with all red components first, then green, blue, and alpha */
+    std::uint32_t endpoints[6][4];
+
+    for (std::uint32_t c = 0; c < 3; ++c)
+    {
+        for (std::uint32_t e = 0; e < numEndpoints; ++e)
+            endpoints[e][c] = reader.Read(modeInfo.colorBits);
+    }
+
+    for (std::uint32_t e = 0; e < numEndpoints; ++e)
+        endpoints[e][3] = reader.Read(modeInfo.alphaBits);
+
+    /* Read P-bits, which are appended to all endpoint components as least significant bit */
+    auto colorBits = modeInfo.colorBits;
+    auto alphaBits = modeInfo.alphaBits;
+
+    if (modeInfo.endpointPBits > 0 || modeInfo.sharedPBits > 0)
+    {
+        for (std::uint32_t e = 0; e < numEndpoints; ++e)
+        {
+            std::uint32_t pBit = 0;
+            if (modeInfo.endpointPBits > 0)
+                pBit = reader.Read(1);
+            else if (e % 2 == 0)
+                pBit = reader.Read(1);
+            else
+                pBit = (endpoints[e - 1][0] & 0x1);
+
+            for (std::uint32_t c = 0; c < 4; ++c)
+                endpoints[e][c] = ((endpoints[e][c] << 1) | pBit);
+        }
+
+        ++colorBits;
+        if (alphaBits > 0)
+            ++alphaBits;
+    }
+
+    /* Expand endpoints to 8 bits */
+    std::int32_t colors[6][4];
+
+    for (std::uint32_t e = 0; e < numEndpoints; ++e)
+    {
+        for (std::uint32_t c = 0; c < 3; ++c)
+            colors[e][c] = ExpandBC7Component(endpoints[e][c], colorBits);
+        colors[e][3] = (alphaBits > 0 ? ExpandBC7Component(endpoints[e][3], alphaBits) : 255);
+    }
+
+    /* Read primary and secondary indices */
+    std::uint32_t indices[16], indices2[16];
+
+    for (std::uint32_t i = 0; i < 16; ++i)
+    {
+        const auto anchor = IsBPTCAnchor(modeInfo.numSubsets, partition, i);
+        indices[i] = reader.Read(anchor ? modeInfo.indexBits - 1 : modeInfo.indexBits);
+    }
+
+    if (modeInfo.index2Bits > 0)
+    {
+        for (std::uint32_t i = 0; i < 16; ++i)
+            indices2[i] = reader.Read(i == 0 ? modeInfo.index2Bits - 1 : modeInfo.index2Bits);
+    }
+
+    /* Interpolate texels */
+    for (std::uint32_t i = 0; i < 16; ++i)
+    {
+        const auto  subset  = GetBPTCSubset(modeInfo.numSubsets, partition, i);
+        const auto& color0  = colors[subset*2];
+        const auto& color1  = colors[subset*2 + 1];
+
+        std::int32_t rgba[4];
+
+        if (modeInfo.index2Bits == 0)
+        {
+            for (std::uint32_t c = 0; c < 4; ++c)
+                rgba[c] = InterpolateBPTC(color0[c], color1[c], modeInfo.indexBits, indices[i]);
+        }
+        else
+        {
+            /* Index selection bit swaps the index sets for color and alpha */
+            const auto colorIndexBits   = (indexSelection ? modeInfo.index2Bits : modeInfo.indexBits);
+            const auto colorIndex       = (indexSelection ? indices2[i] : indices[i]);
+            const auto alphaIndexBits   = (indexSelection ? modeInfo.indexBits : modeInfo.index2Bits);
+            const auto alphaIndex       = (indexSelection ? indices[i] : indices2[i]);
+
+            for (std::uint32_t c = 0; c < 3; ++c)
+                rgba[c] = InterpolateBPTC(color0[c], color1[c], colorIndexBits, colorIndex);
+            rgba[3] = InterpolateBPTC(color0[3], color1[3], alphaIndexBits, alphaIndex);
+        }
+
+        /* Rotation swaps the alpha component with one of the color components */
+        if (rotation > 0)
+            std::swap(rgba[3], rgba[rotation - 1]);
+
+        for (std::uint32_t c = 0; c < 4; ++c)
+            texels.unorm8[i][c] = static_cast<std::uint8_t>(rgba[c]);
+    }
+}
+
+
+/* ----- Image decompression ----- */
+
+static void DecodeBCBlock(const Format format, const std::uint8_t* block, BCTexelBlock& texels)
+{
+    switch (format)
+    {
+        case Format::BC1RGB:        DecodeBC1Block(block, texels, false);   break;
+        case Format::BC1RGBA:       DecodeBC1Block(block, texels, true);    break;
+        case Format::BC2RGBA:       DecodeBC2Block(block, texels);          break;
+        case Format::BC3RGBA:       DecodeBC3Block(block, texels);          break;
+        case Format::BC4RUNorm:     DecodeBC4Block(block, texels, false);   break;
+        case Format::BC4RSNorm:     DecodeBC4Block(block, texels, true);    break;
+        case Format::BC5RGUNorm:    DecodeBC5Block(block, texels, false);   break;
+        case Format::BC5RGSNorm:    DecodeBC5Block(block, texels, true);    break;
+        case Format::BC6HRGBUFloat: DecodeBC6HBlock(block, texels, false);  break;
+        case Format::BC6HRGBSFloat: DecodeBC6HBlock(block, texels, true);   break;
+        case Format::BC7RGBAUNorm:  DecodeBC7Block(block, texels);          break;
+        default:                                                            break;
+    }
+}
+
+// Worker thread procedure for the "DecompressBCImage" function
+static void DecompressBCImageWorker(
+    const Format        format,
+    const std::uint8_t* srcData,
+    const Extent3D&     extent,
+    std::uint8_t*       dstData,
+    std::uint32_t       blockRowBegin,
+    std::uint32_t       blockRowEnd)
+{
+    const auto blockSize        = FormatBitSize(format) * 2;
+    const auto texelSize        = FormatBitSize(GetBCDecompressedFormat(format)) / 8;
+    const auto numBlocksX       = (extent.width  + 3) / 4;
+    const auto numBlocksY       = (extent.height + 3) / 4;
+    const auto dstRowStride     = extent.width * texelSize;
+    const auto dstSliceStride   = extent.height * dstRowStride;
+
+    BCTexelBlock texels;
+
+    for (auto blockRow = blockRowBegin; blockRow < blockRowEnd; ++blockRow)
+    {
+        const auto slice    = blockRow / numBlocksY;
+        const auto y        = (blockRow % numBlocksY) * 4;
+        const auto numRows  = std::min(4u, extent.height - y);
+
+        auto src = srcData + static_cast<std::size_t>(blockRow) * numBlocksX * blockSize;
+        auto dst = dstData + static_cast<std::size_t>(slice) * dstSliceStride + static_cast<std::size_t>(y) * dstRowStride;
+
+        for (std::uint32_t blockX = 0; blockX < numBlocksX; ++blockX, src += blockSize)
+        {
+            /* Decode block and copy the texels that are inside the image */
+            DecodeBCBlock(format, src, texels);
+
+            const auto x            = blockX * 4;
+            const auto numColumns   = std::min(4u, extent.width - x);
+            const auto texelBytes   = reinterpret_cast<const std::uint8_t*>(&texels);
+
+            for (std::uint32_t row = 0; row < numRows; ++row)
+            {
+                ::memcpy(
+                    dst + row * dstRowStride + x * texelSize,
+                    texelBytes + row * 4 * texelSize,
+                    numColumns * texelSize
+                );
+            }
+        }
+    }
+}
+
+// Minimal number of block rows each worker thread shall process
+static const std::uint32_t g_threadMinBlockRows = 16;
+
+
+/* ----- Functions ----- */
+
+LLGL_EXPORT Format GetBCDecompressedFormat(const Format format)
+{
+    switch (format)
+    {
+        case Format::BC1RGB:
+        case Format::BC1RGBA:
+        case Format::BC2RGBA:
+        case Format::BC3RGBA:
+        case Format::BC4RUNorm:
+        case Format::BC5RGUNorm:
+        case Format::BC7RGBAUNorm:
+            return Format::RGBA8UNorm;
+
+        case Format::BC4RSNorm:
+        case Format::BC5RGSNorm:
+            return Format::RGBA8SNorm;
+
+        case Format::BC6HRGBUFloat:
+        case Format::BC6HRGBSFloat:
+            return Format::RGBA32Float;
+
+        default:
+            return Format::Undefined;
+    }
+}
+
+LLGL_EXPORT void DecompressBCImage(
+    const Format    format,
+    const void*     srcData,
+    const Extent3D& extent,
+    void*           dstData,
+    std::size_t     threadCount)
+{
+    if (GetBCDecompressedFormat(format) == Format::Undefined)
+        throw std::invalid_argument("cannot decompress image with format that is not a BC1 to BC7 block-compressed format");
+
+    auto src = reinterpret_cast<const std::uint8_t*>(srcData);
+    auto dst = reinterpret_cast<std::uint8_t*>(dstData);
+
+    /* Distribute rows of blocks over worker threads */
+    const auto numBlockRows = ((extent.height + 3) / 4) * extent.depth;
+
+    threadCount = std::min<std::size_t>(threadCount, numBlockRows / g_threadMinBlockRows);
+
+    if (threadCount > 1)
+    {
+        /* Create worker threads */
+        std::vector<std::thread> workers(threadCount);
+
+        auto workSize       = numBlockRows / static_cast<std::uint32_t>(threadCount);
+        auto workSizeRemain = numBlockRows % static_cast<std::uint32_t>(threadCount);
+
+        std::uint32_t offset = 0;
+
+        for (std::size_t i = 0; i < threadCount; ++i)
+        {
+            workers[i] = std::thread(
+                DecompressBCImageWorker,
+                format, src, std::cref(extent), dst,
+                offset, offset + workSize
+            );
+            offset += workSize;
+        }
+
+        /* Execute decompression of remaining work on main thread */
+        if (workSizeRemain > 0)
+            DecompressBCImageWorker(format, src, extent, dst, offset, offset + workSizeRemain);
+
+        /* Join worker threads */
+        for (auto& w : workers)
+            w.join();
+    }
+    else
+    {
+        /* Execute decompression only on main thread */
+        DecompressBCImageWorker(format, src, extent, dst, 0, numBlockRows);
+    }
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,45 @@
+/*
+ * BCDecompressor.h
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_BC_DECOMPRESSOR_H
+#define LLGL_BC_DECOMPRESSOR_H
+
+
+#include <LLGL/Export.h>
+#include <LLGL/Format.h>
+#include <LLGL/Types.h>
+#include <cstddef>
+
+
+namespace LLGL
+{
+
+
+// Returns the uncompressed format the specified block-compressed format (BC1 to BC7) is decompressed into, or Format::Undefined if it cannot be decompressed.
+LLGL_EXPORT Format GetBCDecompressedFormat(const Format format);
+
+/*
+Decompresses all 2D slices of the specified block-compressed image into tightly packed RGBA texels of the format returned by GetBCDecompressedFormat.
+The depth of the extent specifies the number of 2D slices, and each slice must start with a new row of 4x4 blocks.
+*/
+LLGL_EXPORT void DecompressBCImage(
+    const Format    format,
+    const void*     srcData,
+    const Extent3D& extent,
+    void*           dstData,
+    std::size_t     threadCount
+);
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
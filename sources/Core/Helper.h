@@ -174,6 +174,14 @@ std::string ToHex(T value)
     return s.str();
 }
 
+// Appends the raw bytes of the specified value to the key string (only scalar types are allowed to avoid uninitialized padding bytes).
+template <typename T>
+void AppendKey(std::string& key, const T& value)
+{
+    static_assert(std::is_scalar<T>::value, "input parameter of 'LLGL::AppendKey' must be a scalar type");
+    key.append(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
 /*
 \brief Returns the next resource from the specified resource array.
 \param[in,out] numResources Specifies the remaining number of resources in the array.
@@ -15,6 +15,7 @@
 #include "../Core/Helper.h"
 #include "../Core/Assertion.h"
 #include "Float16Compressor.h"
+#include "BCDecompressor.h"
 
 
 namespace LLGL
@@ -637,6 +638,16 @@ static std::tuple<ImageFormat, DataType> FindSuitableImageFormatPrimary(const Fo
         case Format::BC1RGBA:           return T{ ImageFormat::CompressedRGBA, DataType::Int8 };
         case Format::BC2RGBA:           return T{ ImageFormat::CompressedRGBA, DataType::Int16 };
         case Format::BC3RGBA:           return T{ ImageFormat::CompressedRGBA, DataType::Int16 };
+        case Format::BC4RUNorm:         return T{ ImageFormat::CompressedRGB, DataType::Int8 };
+        case Format::BC4RSNorm:         return T{ ImageFormat::CompressedRGB, DataType::Int8 };
+        case Format::BC5RGUNorm:        return T{ ImageFormat::CompressedRGB, DataType::Int16 };
+        case Format::BC5RGSNorm:        return T{ ImageFormat::CompressedRGB, DataType::Int16 };
+        case Format::BC6HRGBUFloat:     return T{ ImageFormat::CompressedRGB, DataType::Int16 };
+        case Format::BC6HRGBSFloat:     return T{ ImageFormat::CompressedRGB, DataType::Int16 };
+        case Format::BC7RGBAUNorm:      return T{ ImageFormat::CompressedRGBA, DataType::Int16 };
+        case Format::ETC2RGB8UNorm:     return T{ ImageFormat::CompressedRGB, DataType::Int8 };
+        case Format::ETC2RGB8A1UNorm:   return T{ ImageFormat::CompressedRGBA, DataType::Int8 };
+        case Format::ETC2RGBA8UNorm:    return T{ ImageFormat::CompressedRGBA, DataType::Int16 };
     }
 
     /* Return an invalid image format */
@@ -813,6 +824,60 @@ LLGL_EXPORT ByteBuffer ConvertImageBuffer(
     return nullptr;
 }
 
+LLGL_EXPORT ByteBuffer DecompressImageBuffer(
+    const Format                compressedFormat,
+    const SrcImageDescriptor&   srcImageDesc,
+    const Extent3D&             extent,
+    ImageFormat                 dstFormat,
+    DataType                    dstDataType,
+    std::size_t                 threadCount)
+{
+    /* Validate input parameters */
+    LLGL_ASSERT_PTR(srcImageDesc.data);
+
+    const auto decompressedFormat = GetBCDecompressedFormat(compressedFormat);
+    if (decompressedFormat == Format::Undefined)
+        throw std::invalid_argument("cannot decompress image with format that is not a BC1 to BC7 block-compressed format");
+    if (!IsCompressedFormat(srcImageDesc.format))
+        throw std::invalid_argument("cannot decompress image with uncompressed source image format");
+    if (IsCompressedFormat(dstFormat) || IsDepthStencilFormat(dstFormat))
+        throw std::invalid_argument("cannot decompress image into compressed or depth-stencil image format");
+
+    const auto numBlocks        = static_cast<std::size_t>((extent.width + 3) / 4) * ((extent.height + 3) / 4) * extent.depth;
+    const auto requiredDataSize = numBlocks * FormatBitSize(compressedFormat) * 2;
+
+    if (srcImageDesc.dataSize < requiredDataSize)
+        throw std::invalid_argument("source image data size is too small for the number of compressed blocks");
+
+    if (threadCount == Constants::maxThreadCount)
+        threadCount = std::thread::hardware_concurrency();
+
+    /* Decompress blocks into RGBA image of the intermediate data type */
+    ImageFormat decompressedImageFormat = ImageFormat::RGBA;
+    DataType    decompressedDataType    = DataType::UInt8;
+    FindSuitableImageFormat(decompressedFormat, decompressedImageFormat, decompressedDataType);
+
+    const auto numTexels        = static_cast<std::size_t>(extent.width) * extent.height * extent.depth;
+    const auto decompressedSize = numTexels * ImageFormatSize(decompressedImageFormat) * DataTypeSize(decompressedDataType);
+
+    auto decompressedImage = MakeUniqueArray<char>(decompressedSize);
+    DecompressBCImage(compressedFormat, srcImageDesc.data, extent, decompressedImage.get(), threadCount);
+
+    /* Convert image into destination format (if necessary) */
+    const SrcImageDescriptor decompressedImageDesc
+    {
+        decompressedImageFormat,
+        decompressedDataType,
+        decompressedImage.get(),
+        decompressedSize
+    };
+
+    if (auto dstImage = ConvertImageBuffer(decompressedImageDesc, dstFormat, dstDataType, threadCount))
+        return dstImage;
+
+    return decompressedImage;
+}
+
 LLGL_EXPORT ByteBuffer GenerateImageBuffer(
     ImageFormat         format,
     DataType            dataType,
@@ -203,6 +203,16 @@ LLGL_EXPORT const char* ToString(const Format t)
         case T::BC1RGBA:            return "BC1 RGBA";
         case T::BC2RGBA:            return "BC2 RGBA";
         case T::BC3RGBA:            return "BC3 RGBA";
+        case T::BC4RUNorm:          return "BC4 RUNorm";
+        case T::BC4RSNorm:          return "BC4 RSNorm";
+        case T::BC5RGUNorm:         return "BC5 RGUNorm";
+        case T::BC5RGSNorm:         return "BC5 RGSNorm";
+        case T::BC6HRGBUFloat:      return "BC6H RGBUFloat";
+        case T::BC6HRGBSFloat:      return "BC6H RGBSFloat";
+        case T::BC7RGBAUNorm:       return "BC7 RGBAUNorm";
+        case T::ETC2RGB8UNorm:      return "ETC2 RGB8UNorm";
+        case T::ETC2RGB8A1UNorm:    return "ETC2 RGB8A1UNorm";
+        case T::ETC2RGBA8UNorm:     return "ETC2 RGBA8UNorm";
     }
 
     return nullptr;
@@ -0,0 +1,595 @@
+/*
+ * TextureContainer.cpp
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include <LLGL/TextureContainer.h>
+#include <LLGL/RenderSystem.h>
+#include "../Platform/MappedFile.h"
+#include "BCDecompressor.h"
+#include <algorithm>
+#include <stdexcept>
+#include <string.h>
+
+
+namespace LLGL
+{
+
+
+/* ----- Internal structures ----- */
+
+// Reads a value from the specified byte offset (container files are stored in little-endian byte order).
+template <typename T>
+static T ReadValue(const char* data, std::size_t offset)
+{
+    T value;
+    ::memcpy(&value, data + offset, sizeof(T));
+    return value;
+}
+
+static std::uint32_t MakeFourCC(char c0, char c1, char c2, char c3)
+{
+    return
+    (
+        (static_cast<std::uint32_t>(static_cast<unsigned char>(c0))      ) |
+        (static_cast<std::uint32_t>(static_cast<unsigned char>(c1)) <<  8) |
+        (static_cast<std::uint32_t>(static_cast<unsigned char>(c2)) << 16) |
+        (static_cast<std::uint32_t>(static_cast<unsigned char>(c3)) << 24)
+    );
+}
+
+// see https://docs.microsoft.com/en-us/windows/desktop/direct3ddds/dds-pixelformat
+struct DDSPixelFormat
+{
+    std::uint32_t size;
+    std::uint32_t flags;
+    std::uint32_t fourCC;
+    std::uint32_t rgbBitCount;
+    std::uint32_t rBitMask;
+    std::uint32_t gBitMask;
+    std::uint32_t bBitMask;
+    std::uint32_t aBitMask;
+};
+
+// see https://docs.microsoft.com/en-us/windows/desktop/direct3ddds/dds-header
+struct DDSHeader
+{
+    std::uint32_t   size;
+    std::uint32_t   flags;
+    std::uint32_t   height;
+    std::uint32_t   width;
+    std::uint32_t   pitchOrLinearSize;
+    std::uint32_t   depth;
+    std::uint32_t   mipMapCount;
+    std::uint32_t   reserved1[11];
+    DDSPixelFormat  pixelFormat;
+    std::uint32_t   caps;
+    std::uint32_t   caps2;
+    std::uint32_t   caps3;
+    std::uint32_t   caps4;
+    std::uint32_t   reserved2;
+};
+
+// see https://docs.microsoft.com/en-us/windows/desktop/direct3ddds/dds-header-dxt10
+struct DDSHeaderDX10
+{
+    std::uint32_t dxgiFormat;
+    std::uint32_t resourceDimension;
+    std::uint32_t miscFlag;
+    std::uint32_t arraySize;
+    std::uint32_t miscFlags2;
+};
+
+static const std::uint32_t g_ddsMagic                   = 0x20534444; // "DDS "
+static const std::uint32_t g_ddsFlagMipMapCount         = 0x00020000;
+static const std::uint32_t g_ddsPixelFormatFourCC       = 0x00000004;
+static const std::uint32_t g_ddsPixelFormatRGB          = 0x00000040;
+static const std::uint32_t g_ddsCaps2Cubemap            = 0x00000200;
+static const std::uint32_t g_ddsCaps2CubemapAllFaces    = 0x0000FC00;
+static const std::uint32_t g_ddsCaps2Volume             = 0x00200000;
+static const std::uint32_t g_ddsDimensionTexture1D      = 2;
+static const std::uint32_t g_ddsDimensionTexture3D      = 4;
+static const std::uint32_t g_ddsMiscFlagTextureCube     = 0x00000004;
+
+// see https://github.khronos.org/KTX-Specification/
+static const unsigned char g_ktx2Identifier[12] = { 0xAB, 0x4B, 0x54, 0x58, 0x20, 0x32, 0x30, 0xBB, 0x0D, 0x0A, 0x1A, 0x0A };
+
+static const std::size_t g_ktx2HeaderSize       = 80;
+static const std::size_t g_ktx2LevelIndexSize   = 24;
+
+// Limits for the values of container file headers, so corrupted files can neither overflow the size computations nor force huge allocations
+static const std::uint32_t g_maxContainerExtent         = (1u << 16);
+static const std::uint32_t g_maxContainerArrayLayers    = 2048 * 6;
+
+// Returns the number of array layers for the specified number of layers and faces, or throws an exception if the limit is exceeded.
+static std::uint32_t GetContainerArrayLayers(std::uint32_t numLayers, std::uint32_t numFaces)
+{
+    if (numFaces == 0 || numLayers > g_maxContainerArrayLayers / numFaces)
+        throw std::runtime_error("number of array layers in texture container file header exceeds limit");
+    return (numLayers * numFaces);
+}
+
+// Maps the legacy DDS pixel format (without DX10 header) to a hardware format.
+static Format DDSPixelFormatToFormat(const DDSPixelFormat& pixelFormat)
+{
+    if ((pixelFormat.flags & g_ddsPixelFormatFourCC) != 0)
+    {
+        const auto fourCC = pixelFormat.fourCC;
+        if (fourCC == MakeFourCC('D', 'X', 'T', '1'))
+            return Format::BC1RGBA;
+        if (fourCC == MakeFourCC('D', 'X', 'T', '3'))
+            return Format::BC2RGBA;
+        if (fourCC == MakeFourCC('D', 'X', 'T', '5'))
+            return Format::BC3RGBA;
+        if (fourCC == MakeFourCC('A', 'T', 'I', '1') || fourCC == MakeFourCC('B', 'C', '4', 'U'))
+            return Format::BC4RUNorm;
+        if (fourCC == MakeFourCC('B', 'C', '4', 'S'))
+            return Format::BC4RSNorm;
+        if (fourCC == MakeFourCC('A', 'T', 'I', '2') || fourCC == MakeFourCC('B', 'C', '5', 'U'))
+            return Format::BC5RGUNorm;
+        if (fourCC == MakeFourCC('B', 'C', '5', 'S'))
+            return Format::BC5RGSNorm;
+    }
+    else if ((pixelFormat.flags & g_ddsPixelFormatRGB) != 0 && pixelFormat.rgbBitCount == 32)
+    {
+        if (pixelFormat.rBitMask == 0x000000FF && pixelFormat.gBitMask == 0x0000FF00 && pixelFormat.bBitMask == 0x00FF0000)
+            return Format::RGBA8UNorm;
+        if (pixelFormat.rBitMask == 0x00FF0000 && pixelFormat.gBitMask == 0x0000FF00 && pixelFormat.bBitMask == 0x000000FF)
+            return Format::BGRA8UNorm;
+    }
+    return Format::Undefined;
+}
+
+// Maps the DXGI_FORMAT value of the DX10 header extension to a hardware format.
+static Format DXGIFormatToFormat(std::uint32_t dxgiFormat)
+{
+    switch (dxgiFormat)
+    {
+        case  2: return Format::RGBA32Float;    // DXGI_FORMAT_R32G32B32A32_FLOAT
+        case 10: return Format::RGBA16Float;    // DXGI_FORMAT_R16G16B16A16_FLOAT
+        case 28: return Format::RGBA8UNorm;     // DXGI_FORMAT_R8G8B8A8_UNORM
+        case 41: return Format::R32Float;       // DXGI_FORMAT_R32_FLOAT
+        case 49: return Format::RG8UNorm;       // DXGI_FORMAT_R8G8_UNORM
+        case 54: return Format::R16Float;       // DXGI_FORMAT_R16_FLOAT
+        case 61: return Format::R8UNorm;        // DXGI_FORMAT_R8_UNORM
+        case 71: return Format::BC1RGBA;        // DXGI_FORMAT_BC1_UNORM
+        case 74: return Format::BC2RGBA;        // DXGI_FORMAT_BC2_UNORM
+        case 77: return Format::BC3RGBA;        // DXGI_FORMAT_BC3_UNORM
+        case 80: return Format::BC4RUNorm;      // DXGI_FORMAT_BC4_UNORM
+        case 81: return Format::BC4RSNorm;      // DXGI_FORMAT_BC4_SNORM
+        case 83: return Format::BC5RGUNorm;     // DXGI_FORMAT_BC5_UNORM
+        case 84: return Format::BC5RGSNorm;     // DXGI_FORMAT_BC5_SNORM
+        case 87: return Format::BGRA8UNorm;     // DXGI_FORMAT_B8G8R8A8_UNORM
+        case 95: return Format::BC6HRGBUFloat;  // DXGI_FORMAT_BC6H_UF16
+        case 96: return Format::BC6HRGBSFloat;  // DXGI_FORMAT_BC6H_SF16
+        case 98: return Format::BC7RGBAUNorm;   // DXGI_FORMAT_BC7_UNORM
+        default: return Format::Undefined;
+    }
+}
+
+// Maps the VkFormat value of the KTX2 header to a hardware format.
+static Format VkFormatToFormat(std::uint32_t vkFormat)
+{
+    switch (vkFormat)
+    {
+        case   9: return Format::R8UNorm;           // VK_FORMAT_R8_UNORM
+        case  16: return Format::RG8UNorm;          // VK_FORMAT_R8G8_UNORM
+        case  37: return Format::RGBA8UNorm;        // VK_FORMAT_R8G8B8A8_UNORM
+        case  44: return Format::BGRA8UNorm;        // VK_FORMAT_B8G8R8A8_UNORM
+        case  76: return Format::R16Float;          // VK_FORMAT_R16_SFLOAT
+        case  97: return Format::RGBA16Float;       // VK_FORMAT_R16G16B16A16_SFLOAT
+        case 100: return Format::R32Float;          // VK_FORMAT_R32_SFLOAT
+        case 109: return Format::RGBA32Float;       // VK_FORMAT_R32G32B32A32_SFLOAT
+        case 131: return Format::BC1RGB;            // VK_FORMAT_BC1_RGB_UNORM_BLOCK
+        case 133: return Format::BC1RGBA;           // VK_FORMAT_BC1_RGBA_UNORM_BLOCK
+        case 135: return Format::BC2RGBA;           // VK_FORMAT_BC2_UNORM_BLOCK
+        case 137: return Format::BC3RGBA;           // VK_FORMAT_BC3_UNORM_BLOCK
+        case 139: return Format::BC4RUNorm;         // VK_FORMAT_BC4_UNORM_BLOCK
+        case 140: return Format::BC4RSNorm;         // VK_FORMAT_BC4_SNORM_BLOCK
+        case 141: return Format::BC5RGUNorm;        // VK_FORMAT_BC5_UNORM_BLOCK
+        case 142: return Format::BC5RGSNorm;        // VK_FORMAT_BC5_SNORM_BLOCK
+        case 143: return Format::BC6HRGBUFloat;     // VK_FORMAT_BC6H_UFLOAT_BLOCK
+        case 144: return Format::BC6HRGBSFloat;     // VK_FORMAT_BC6H_SFLOAT_BLOCK
+        case 145: return Format::BC7RGBAUNorm;      // VK_FORMAT_BC7_UNORM_BLOCK
+        case 147: return Format::ETC2RGB8UNorm;     // VK_FORMAT_ETC2_R8G8B8_UNORM_BLOCK
+        case 149: return Format::ETC2RGB8A1UNorm;   // VK_FORMAT_ETC2_R8G8B8A1_UNORM_BLOCK
+        case 151: return Format::ETC2RGBA8UNorm;    // VK_FORMAT_ETC2_R8G8B8A8_UNORM_BLOCK
+        default:  return Format::Undefined;
+    }
+}
+
+
+/* ----- Texture container ----- */
+
+TextureContainer::TextureContainer(const std::string& filename) :
+    file_ { MappedFile::Open(filename) }
+{
+    /* Determine container format by file header */
+    auto data = reinterpret_cast<const char*>(file_->GetData());
+    auto size = file_->GetSize();
+
+    if (size >= sizeof(std::uint32_t) && ReadValue<std::uint32_t>(data, 0) == g_ddsMagic)
+    {
+        fileFormat_ = TextureContainerFormat::DDS;
+        LoadDDS();
+    }
+    else if (size >= sizeof(g_ktx2Identifier) && ::memcmp(data, g_ktx2Identifier, sizeof(g_ktx2Identifier)) == 0)
+    {
+        fileFormat_ = TextureContainerFormat::KTX2;
+        LoadKTX2();
+    }
+    else
+        throw std::runtime_error("unknown texture container format (only DDS and KTX2 are supported): " + filename);
+}
+
+TextureContainer::~TextureContainer()
+{
+    // dummy
+}
+
+SrcImageDescriptor TextureContainer::GetImageDesc(std::uint32_t mipLevel, std::uint32_t arrayLayer) const
+{
+    const auto& subresource = subresources_[GetSubresourceIndex(mipLevel, arrayLayer)];
+
+    SrcImageDescriptor imageDesc;
+    {
+        FindSuitableImageFormat(textureDesc_.format, imageDesc.format, imageDesc.dataType);
+
+        /* Compressed image data must always be specified with the UInt8 data type */
+        if (IsCompressedFormat(textureDesc_.format))
+            imageDesc.dataType = DataType::UInt8;
+
+        imageDesc.data      = reinterpret_cast<const char*>(file_->GetData()) + subresource.offset;
+        imageDesc.dataSize  = subresource.size;
+    }
+    return imageDesc;
+}
+
+TextureRegion TextureContainer::GetTextureRegion(std::uint32_t mipLevel, std::uint32_t arrayLayer) const
+{
+    GetSubresourceIndex(mipLevel, arrayLayer);
+
+    TextureRegion region;
+    {
+        region.mipLevel = mipLevel;
+        region.extent   = GetMipExtent(mipLevel);
+
+        /* Specify array layer in the Y component for 1D-array textures, and in the Z component for all other array textures */
+        if (textureDesc_.type == TextureType::Texture1DArray)
+            region.offset.y = static_cast<std::int32_t>(arrayLayer);
+        else if (IsArrayTexture(textureDesc_.type) || IsCubeTexture(textureDesc_.type))
+            region.offset.z = static_cast<std::int32_t>(arrayLayer);
+    }
+    return region;
+}
+
+// Returns true if the specified format is a BC format that is not supported by the render system and must be decompressed on the CPU.
+static bool MustDecompressFormat(const RenderSystem& renderSystem, const Format format)
+{
+    const auto& textureFormats = renderSystem.GetRenderingCaps().textureFormats;
+    return
+    (
+        GetBCDecompressedFormat(format) != Format::Undefined &&
+        std::find(textureFormats.begin(), textureFormats.end(), format) == textureFormats.end()
+    );
+}
+
+// Decompresses the specified subresource and writes it to the texture, which has been created with the decompressed format.
+static void WriteDecompressedTexture(
+    RenderSystem&               renderSystem,
+    Texture&                    texture,
+    const TextureRegion&        textureRegion,
+    const Format                compressedFormat,
+    const SrcImageDescriptor&   compressedImageDesc,
+    const Extent3D&             extent)
+{
+    ImageFormat dstFormat   = ImageFormat::RGBA;
+    DataType    dstDataType = DataType::UInt8;
+    FindSuitableImageFormat(GetBCDecompressedFormat(compressedFormat), dstFormat, dstDataType);
+
+    auto image = DecompressImageBuffer(
+        compressedFormat,
+        compressedImageDesc,
+        extent,
+        dstFormat,
+        dstDataType,
+        renderSystem.GetConfiguration().threadCount
+    );
+
+    const SrcImageDescriptor imageDesc
+    {
+        dstFormat,
+        dstDataType,
+        image.get(),
+        ImageDataSize(dstFormat, dstDataType, extent.width * extent.height * extent.depth)
+    };
+
+    renderSystem.WriteTexture(texture, textureRegion, imageDesc);
+}
+
+Texture* TextureContainer::CreateTexture(RenderSystem& renderSystem, long flags) const
+{
+    auto textureDesc = textureDesc_;
+    textureDesc.flags = flags;
+
+    /* Pass base MIP-map level to texture creation for single layered textures, otherwise each layer is uploaded separately */
+    const bool initWithBaseLevel = (textureDesc.arrayLayers == 1);
+
+    Texture* texture = nullptr;
+
+    if (initWithBaseLevel)
+    {
+        auto imageDesc = GetImageDesc(0, 0);
+        texture = renderSystem.CreateTexture(textureDesc, &imageDesc);
+    }
+    else
+        texture = renderSystem.CreateTexture(textureDesc);
+
+    /* Upload remaining subresources directly from the memory mapped file (render system decompresses the base level on its own) */
+    const bool decompress = MustDecompressFormat(renderSystem, textureDesc.format);
+
+    for (std::uint32_t mipLevel = 0; mipLevel < textureDesc.mipLevels; ++mipLevel)
+    {
+        if (initWithBaseLevel && mipLevel == 0)
+            continue;
+        for (std::uint32_t arrayLayer = 0; arrayLayer < textureDesc.arrayLayers; ++arrayLayer)
+        {
+            if (decompress)
+            {
+                WriteDecompressedTexture(
+                    renderSystem,
+                    *texture,
+                    GetTextureRegion(mipLevel, arrayLayer),
+                    textureDesc.format,
+                    GetImageDesc(mipLevel, arrayLayer),
+                    GetMipExtent(mipLevel)
+                );
+            }
+            else
+                renderSystem.WriteTexture(*texture, GetTextureRegion(mipLevel, arrayLayer), GetImageDesc(mipLevel, arrayLayer));
+        }
+    }
+
+    return texture;
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+void TextureContainer::LoadDDS()
+{
+    auto data = reinterpret_cast<const char*>(file_->GetData());
+    auto size = file_->GetSize();
+
+    /* Read and validate DDS header */
+    std::size_t offset = sizeof(std::uint32_t);
+
+    if (size < offset + sizeof(DDSHeader))
+        throw std::runtime_error("invalid DDS file header");
+
+    const auto header = ReadValue<DDSHeader>(data, offset);
+    offset += sizeof(DDSHeader);
+
+    if (header.size != sizeof(DDSHeader) || header.pixelFormat.size != sizeof(DDSPixelFormat))
+        throw std::runtime_error("invalid DDS file header");
+
+    textureDesc_.extent.width   = std::max(1u, header.width);
+    textureDesc_.extent.height  = std::max(1u, header.height);
+    textureDesc_.mipLevels      = ((header.flags & g_ddsFlagMipMapCount) != 0 ? std::max(1u, header.mipMapCount) : 1u);
+
+    if ((header.pixelFormat.flags & g_ddsPixelFormatFourCC) != 0 && header.pixelFormat.fourCC == MakeFourCC('D', 'X', '1', '0'))
+    {
+        /* Read DX10 header extension */
+        if (size < offset + sizeof(DDSHeaderDX10))
+            throw std::runtime_error("invalid DDS file header extension (DX10)");
+
+        const auto headerDX10 = ReadValue<DDSHeaderDX10>(data, offset);
+        offset += sizeof(DDSHeaderDX10);
+
+        textureDesc_.format         = DXGIFormatToFormat(headerDX10.dxgiFormat);
+        textureDesc_.arrayLayers    = GetContainerArrayLayers(std::max(1u, headerDX10.arraySize), 1);
+
+        if (headerDX10.resourceDimension == g_ddsDimensionTexture1D)
+        {
+            textureDesc_.type           = (textureDesc_.arrayLayers > 1 ? TextureType::Texture1DArray : TextureType::Texture1D);
+            textureDesc_.extent.height  = 1;
+        }
+        else if (headerDX10.resourceDimension == g_ddsDimensionTexture3D)
+        {
+            textureDesc_.type           = TextureType::Texture3D;
+            textureDesc_.extent.depth   = std::max(1u, header.depth);
+        }
+        else if ((headerDX10.miscFlag & g_ddsMiscFlagTextureCube) != 0)
+        {
+            textureDesc_.type           = (textureDesc_.arrayLayers > 1 ? TextureType::TextureCubeArray : TextureType::TextureCube);
+            textureDesc_.arrayLayers    = GetContainerArrayLayers(textureDesc_.arrayLayers, 6);
+        }
+        else
+            textureDesc_.type           = (textureDesc_.arrayLayers > 1 ? TextureType::Texture2DArray : TextureType::Texture2D);
+    }
+    else
+    {
+        /* Determine texture type from legacy DDS header */
+        textureDesc_.format = DDSPixelFormatToFormat(header.pixelFormat);
+
+        if ((header.caps2 & g_ddsCaps2Cubemap) != 0)
+        {
+            if ((header.caps2 & g_ddsCaps2CubemapAllFaces) != g_ddsCaps2CubemapAllFaces)
+                throw std::runtime_error("DDS cube textures must contain all six faces");
+            textureDesc_.type           = TextureType::TextureCube;
+            textureDesc_.arrayLayers    = 6;
+        }
+        else if ((header.caps2 & g_ddsCaps2Volume) != 0)
+        {
+            textureDesc_.type           = TextureType::Texture3D;
+            textureDesc_.extent.depth   = std::max(1u, header.depth);
+        }
+        else
+            textureDesc_.type           = TextureType::Texture2D;
+    }
+
+    if (textureDesc_.format == Format::Undefined)
+        throw std::runtime_error("unsupported DDS texture format");
+
+    /* Subresources are stored layer by layer, each with its entire MIP-map chain */
+    InitSubresources();
+
+    for (std::uint32_t arrayLayer = 0; arrayLayer < textureDesc_.arrayLayers; ++arrayLayer)
+    {
+        for (std::uint32_t mipLevel = 0; mipLevel < textureDesc_.mipLevels; ++mipLevel)
+        {
+            const auto mipSize = GetMipSize(mipLevel);
+            SetSubresource(mipLevel, arrayLayer, offset, mipSize);
+            offset += mipSize;
+        }
+    }
+}
+
+void TextureContainer::LoadKTX2()
+{
+    auto data = reinterpret_cast<const char*>(file_->GetData());
+    auto size = file_->GetSize();
+
+    /* Read and validate KTX2 header */
+    if (size < g_ktx2HeaderSize)
+        throw std::runtime_error("invalid KTX2 file header");
+
+    const auto vkFormat                 = ReadValue<std::uint32_t>(data, 12);
+    const auto pixelWidth               = ReadValue<std::uint32_t>(data, 20);
+    const auto pixelHeight              = ReadValue<std::uint32_t>(data, 24);
+    const auto pixelDepth               = ReadValue<std::uint32_t>(data, 28);
+    const auto layerCount               = ReadValue<std::uint32_t>(data, 32);
+    const auto faceCount                = ReadValue<std::uint32_t>(data, 36);
+    const auto levelCount               = ReadValue<std::uint32_t>(data, 40);
+    const auto supercompressionScheme   = ReadValue<std::uint32_t>(data, 44);
+
+    if (supercompressionScheme != 0)
+        throw std::runtime_error("supercompressed KTX2 files are not supported");
+    if (faceCount != 1 && faceCount != 6)
+        throw std::runtime_error("invalid number of faces in KTX2 file header");
+
+    textureDesc_.format = VkFormatToFormat(vkFormat);
+    if (textureDesc_.format == Format::Undefined)
+        throw std::runtime_error("unsupported KTX2 texture format");
+
+    textureDesc_.extent.width   = std::max(1u, pixelWidth);
+    textureDesc_.extent.height  = std::max(1u, pixelHeight);
+    textureDesc_.extent.depth   = std::max(1u, pixelDepth);
+    textureDesc_.arrayLayers    = GetContainerArrayLayers(std::max(1u, layerCount), faceCount);
+    textureDesc_.mipLevels      = std::max(1u, levelCount);
+
+    /* Determine texture type (height and depth of zero denote 1D and 2D textures respectively) */
+    if (faceCount == 6)
+        textureDesc_.type = (layerCount > 0 ? TextureType::TextureCubeArray : TextureType::TextureCube);
+    else if (pixelDepth > 0)
+        textureDesc_.type = TextureType::Texture3D;
+    else if (pixelHeight > 0)
+        textureDesc_.type = (layerCount > 0 ? TextureType::Texture2DArray : TextureType::Texture2D);
+    else
+        textureDesc_.type = (layerCount > 0 ? TextureType::Texture1DArray : TextureType::Texture1D);
+
+    InitSubresources();
+
+    /* Read level index; each MIP-map level stores all array layers and cube faces consecutively */
+    if (size < g_ktx2HeaderSize + g_ktx2LevelIndexSize * textureDesc_.mipLevels)
+        throw std::runtime_error("invalid KTX2 level index");
+
+    for (std::uint32_t mipLevel = 0; mipLevel < textureDesc_.mipLevels; ++mipLevel)
+    {
+        const auto levelIndexOffset = g_ktx2HeaderSize + g_ktx2LevelIndexSize * mipLevel;
+        const auto byteOffset       = ReadValue<std::uint64_t>(data, levelIndexOffset);
+        const auto byteLength       = ReadValue<std::uint64_t>(data, levelIndexOffset + 8);
+        const auto mipSize          = GetMipSize(mipLevel);
+
+        if (byteOffset > size || byteLength > size - byteOffset)
+            throw std::runtime_error("invalid range of MIP-map level in KTX2 level index");
+        if (byteLength / textureDesc_.arrayLayers < mipSize)
+            throw std::runtime_error("invalid size of MIP-map level in KTX2 level index");
+
+        for (std::uint32_t arrayLayer = 0; arrayLayer < textureDesc_.arrayLayers; ++arrayLayer)
+            SetSubresource(mipLevel, arrayLayer, static_cast<std::size_t>(byteOffset) + mipSize * arrayLayer, mipSize);
+    }
+}
+
+void TextureContainer::InitSubresources()
+{
+    /* Validate header values before allocating the subresources */
+    const auto& extent = textureDesc_.extent;
+
+    if (extent.width > g_maxContainerExtent || extent.height > g_maxContainerExtent || extent.depth > g_maxContainerExtent)
+        throw std::runtime_error("texture extent in texture container file header exceeds limit");
+    if (textureDesc_.mipLevels > NumMipLevels(extent.width, extent.height, extent.depth))
+        throw std::runtime_error("number of MIP-map levels in texture container file header exceeds the full MIP-map chain");
+    if (textureDesc_.arrayLayers > g_maxContainerArrayLayers)
+        throw std::runtime_error("number of array layers in texture container file header exceeds limit");
+
+    /* Each subresource occupies at least one byte of the file */
+    if (static_cast<std::uint64_t>(textureDesc_.mipLevels) * textureDesc_.arrayLayers > file_->GetSize())
+        throw std::runtime_error("texture container file is too small for the number of subresources specified in its header");
+
+    Subresource initialSubresource { 0, 0 };
+    subresources_.resize(textureDesc_.mipLevels * textureDesc_.arrayLayers, initialSubresource);
+}
+
+void TextureContainer::SetSubresource(std::uint32_t mipLevel, std::uint32_t arrayLayer, std::size_t offset, std::size_t size)
+{
+    /* Validate subresource range against the mapped file size */
+    if (offset > file_->GetSize() || size > file_->GetSize() - offset)
+        throw std::runtime_error("texture container file is too small for the image data specified in its header");
+    subresources_[GetSubresourceIndex(mipLevel, arrayLayer)] = { offset, size };
+}
+
+Extent3D TextureContainer::GetMipExtent(std::uint32_t mipLevel) const
+{
+    const auto& extent = textureDesc_.extent;
+    return Extent3D
+    {
+        std::max(1u, extent.width  >> mipLevel),
+        std::max(1u, extent.height >> mipLevel),
+        std::max(1u, extent.depth  >> mipLevel),
+    };
+}
+
+std::size_t TextureContainer::GetMipSize(std::uint32_t mipLevel) const
+{
+    const auto extent   = GetMipExtent(mipLevel);
+    const auto bitSize  = static_cast<std::uint64_t>(FormatBitSize(textureDesc_.format));
+
+    /* Compute size in 64-bit, which can not overflow with the extent limit, and validate it against the file size */
+    std::uint64_t mipSize = 0;
+
+    if (IsCompressedFormat(textureDesc_.format))
+    {
+        /* Block compressed formats always store entire 4x4 blocks, i.e. 16 times the bit size per block */
+        const auto numBlocksX = static_cast<std::uint64_t>((extent.width  + 3) / 4);
+        const auto numBlocksY = static_cast<std::uint64_t>((extent.height + 3) / 4);
+        mipSize = (numBlocksX * numBlocksY * extent.depth * bitSize * 16 / 8);
+    }
+    else
+        mipSize = (static_cast<std::uint64_t>(extent.width) * extent.height * extent.depth * bitSize / 8);
+
+    if (mipSize > file_->GetSize())
+        throw std::runtime_error("texture container file is too small for the image data specified in its header");
+
+    return static_cast<std::size_t>(mipSize);
+}
+
+std::size_t TextureContainer::GetSubresourceIndex(std::uint32_t mipLevel, std::uint32_t arrayLayer) const
+{
+    if (mipLevel >= textureDesc_.mipLevels)
+        throw std::out_of_range("MIP-map level out of range in texture container: " + std::to_string(mipLevel));
+    if (arrayLayer >= textureDesc_.arrayLayers)
+        throw std::out_of_range("array layer out of range in texture container: " + std::to_string(arrayLayer));
+    return (mipLevel * textureDesc_.arrayLayers + arrayLayer);
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,344 @@
+/*
+ * VertexPacking.cpp
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifdef LLGL_ENABLE_UTILITY
+
+#include <LLGL/VertexPacking.h>
+#include <LLGL/Constants.h>
+#include <algorithm>
+#include <stdexcept>
+#include <thread>
+#include <limits>
+#include <cmath>
+#include <string.h>
+#include "Float16Compressor.h"
+#include "Helper.h"
+
+
+namespace LLGL
+{
+
+
+/* ----- Internal structures ----- */
+
+// Conversion parameters of a single vertex attribute
+struct VertexAttributeConversion
+{
+    std::uint32_t   srcOffset;
+    std::uint32_t   srcSize;
+    DataType        srcDataType;
+    std::uint32_t   srcComponents;
+    bool            srcNormalized;
+    std::uint32_t   dstOffset;
+    DataType        dstDataType;
+    std::uint32_t   dstComponents;
+    bool            dstNormalized;
+    bool            identical;
+};
+
+
+/* ----- Internal functions ----- */
+
+static Format FindPackingFormat(const VertexAttribute& attrib, const std::vector<VertexPackingRule>& rules)
+{
+    for (const auto& rule : rules)
+    {
+        if (rule.name == attrib.name && rule.format != Format::Undefined)
+            return rule.format;
+    }
+    return attrib.format;
+}
+
+static std::uint32_t AlignVertexOffset(std::uint32_t offset)
+{
+    return ((offset + 3u) & ~3u);
+}
+
+static void ValidateVertexFormat(const Format format)
+{
+    if (IsCompressedFormat(format) || IsDepthStencilFormat(format))
+        throw std::invalid_argument("cannot pack vertex attribute with compressed or depth-stencil format");
+}
+
+static void SplitVertexFormat(const Format format, DataType& dataType, std::uint32_t& components, bool& normalized)
+{
+    ValidateVertexFormat(format);
+    if (!SplitFormat(format, dataType, components))
+        throw std::invalid_argument("cannot pack vertex attribute with invalid format");
+    normalized = IsNormalizedFormat(format);
+}
+
+template <typename T>
+static T ReadVertexComponent(const char* src)
+{
+    T value;
+    ::memcpy(&value, src, sizeof(T));
+    return value;
+}
+
+template <typename T>
+static void WriteVertexComponent(char* dst, T value)
+{
+    ::memcpy(dst, &value, sizeof(T));
+}
+
+// Reads the normalized value for normalized integer types, i.e. in the range [0, 1] for unsigned types and [-1, 1] for signed types.
+template <typename T>
+static double ReadVertexComponentTyped(const char* src, bool normalized)
+{
+    auto value = static_cast<double>(ReadVertexComponent<T>(src));
+    if (normalized)
+        return std::max(-1.0, value / static_cast<double>(std::numeric_limits<T>::max()));
+    else
+        return value;
+}
+
+template <typename T>
+static void WriteVertexComponentTyped(char* dst, double value, bool normalized)
+{
+    if (normalized)
+    {
+        /* Clamp value to normalized range and scale it to the integral range */
+        auto minValue = (std::numeric_limits<T>::is_signed ? -1.0 : 0.0);
+        value = std::max(minValue, std::min(value, 1.0)) * static_cast<double>(std::numeric_limits<T>::max());
+    }
+    else
+    {
+        /* Clamp value to integral range */
+        value = std::max(static_cast<double>(std::numeric_limits<T>::lowest()), std::min(value, static_cast<double>(std::numeric_limits<T>::max())));
+    }
+    WriteVertexComponent<T>(dst, static_cast<T>(std::round(value)));
+}
+
+static double ReadVertexComponent(DataType dataType, const char* src, bool normalized)
+{
+    switch (dataType)
+    {
+        case DataType::Int8:
+            return ReadVertexComponentTyped<std::int8_t>(src, normalized);
+        case DataType::UInt8:
+            return ReadVertexComponentTyped<std::uint8_t>(src, normalized);
+        case DataType::Int16:
+            return ReadVertexComponentTyped<std::int16_t>(src, normalized);
+        case DataType::UInt16:
+            return ReadVertexComponentTyped<std::uint16_t>(src, normalized);
+        case DataType::Int32:
+            return ReadVertexComponentTyped<std::int32_t>(src, normalized);
+        case DataType::UInt32:
+            return ReadVertexComponentTyped<std::uint32_t>(src, normalized);
+        case DataType::Float16:
+            return static_cast<double>(DecompressFloat16(ReadVertexComponent<std::uint16_t>(src)));
+        case DataType::Float32:
+            return static_cast<double>(ReadVertexComponent<float>(src));
+        case DataType::Float64:
+            return ReadVertexComponent<double>(src);
+    }
+    return 0.0;
+}
+
+static void WriteVertexComponent(DataType dataType, char* dst, double value, bool normalized)
+{
+    switch (dataType)
+    {
+        case DataType::Int8:
+            WriteVertexComponentTyped<std::int8_t>(dst, value, normalized);
+            break;
+        case DataType::UInt8:
+            WriteVertexComponentTyped<std::uint8_t>(dst, value, normalized);
+            break;
+        case DataType::Int16:
+            WriteVertexComponentTyped<std::int16_t>(dst, value, normalized);
+            break;
+        case DataType::UInt16:
+            WriteVertexComponentTyped<std::uint16_t>(dst, value, normalized);
+            break;
+        case DataType::Int32:
+            WriteVertexComponentTyped<std::int32_t>(dst, value, normalized);
+            break;
+        case DataType::UInt32:
+            WriteVertexComponentTyped<std::uint32_t>(dst, value, normalized);
+            break;
+        case DataType::Float16:
+            WriteVertexComponent<std::uint16_t>(dst, CompressFloat16(static_cast<float>(value)));
+            break;
+        case DataType::Float32:
+            WriteVertexComponent<float>(dst, static_cast<float>(value));
+            break;
+        case DataType::Float64:
+            WriteVertexComponent<double>(dst, value);
+            break;
+    }
+}
+
+static void PackVertexAttribute(const VertexAttributeConversion& conv, const char* srcVertex, char* dstVertex)
+{
+    auto src = srcVertex + conv.srcOffset;
+    auto dst = dstVertex + conv.dstOffset;
+
+    if (conv.identical)
+    {
+        /* Copy attribute without conversion */
+        ::memcpy(dst, src, conv.srcSize);
+    }
+    else
+    {
+        auto srcStride = DataTypeSize(conv.srcDataType);
+        auto dstStride = DataTypeSize(conv.dstDataType);
+
+        for (std::uint32_t i = 0; i < conv.dstComponents; ++i)
+        {
+            /* Read source component or fill missing components with zero */
+            auto value = (i < conv.srcComponents ? ReadVertexComponent(conv.srcDataType, src + i * srcStride, conv.srcNormalized) : 0.0);
+
+            /* Write destination component */
+            WriteVertexComponent(conv.dstDataType, dst + i * dstStride, value, conv.dstNormalized);
+        }
+    }
+}
+
+// Worker thread procedure for the "PackVertexBuffer" function
+static void PackVertexBufferWorker(
+    const std::vector<VertexAttributeConversion>&   conversions,
+    const char*                                     srcVertices,
+    std::uint32_t                                   srcStride,
+    char*                                           dstVertices,
+    std::uint32_t                                   dstStride,
+    std::size_t                                     idxBegin,
+    std::size_t                                     idxEnd)
+{
+    for (auto i = idxBegin; i < idxEnd; ++i)
+    {
+        auto srcVertex = srcVertices + i * srcStride;
+        auto dstVertex = dstVertices + i * dstStride;
+        for (const auto& conv : conversions)
+            PackVertexAttribute(conv, srcVertex, dstVertex);
+    }
+}
+
+// Minimal number of vertices each worker thread shall process
+static const std::size_t g_threadMinVertexCount = 256;
+
+
+/* ----- Global functions ----- */
+
+LLGL_EXPORT VertexFormat GetPackedVertexFormat(
+    const VertexFormat&                     srcVertexFormat,
+    const std::vector<VertexPackingRule>&   rules)
+{
+    VertexFormat dstVertexFormat;
+
+    for (const auto& srcAttrib : srcVertexFormat.attributes)
+    {
+        /* Determine target format of the attribute */
+        auto dstAttrib = srcAttrib;
+        dstAttrib.format = FindPackingFormat(srcAttrib, rules);
+        ValidateVertexFormat(dstAttrib.format);
+
+        /* Append attribute at the next 4-byte aligned offset */
+        dstVertexFormat.AppendAttribute(dstAttrib, AlignVertexOffset(dstVertexFormat.stride));
+    }
+
+    dstVertexFormat.stride      = AlignVertexOffset(dstVertexFormat.stride);
+    dstVertexFormat.inputSlot   = srcVertexFormat.inputSlot;
+
+    return dstVertexFormat;
+}
+
+LLGL_EXPORT ByteBuffer PackVertexBuffer(
+    const VertexFormat&                     srcVertexFormat,
+    const void*                             srcVertices,
+    std::size_t                             numVertices,
+    const std::vector<VertexPackingRule>&   rules,
+    VertexFormat&                           dstVertexFormat,
+    std::size_t                             threadCount)
+{
+    /* Determine packed vertex format */
+    dstVertexFormat = GetPackedVertexFormat(srcVertexFormat, rules);
+
+    /* Determine conversion for each vertex attribute */
+    std::vector<VertexAttributeConversion> conversions(srcVertexFormat.attributes.size());
+
+    for (std::size_t i = 0; i < conversions.size(); ++i)
+    {
+        const auto& srcAttrib = srcVertexFormat.attributes[i];
+        const auto& dstAttrib = dstVertexFormat.attributes[i];
+
+        auto& conv = conversions[i];
+        {
+            conv.srcOffset  = srcAttrib.offset;
+            conv.srcSize    = srcAttrib.GetSize();
+            conv.dstOffset  = dstAttrib.offset;
+            conv.identical  = (srcAttrib.format == dstAttrib.format);
+            SplitVertexFormat(srcAttrib.format, conv.srcDataType, conv.srcComponents, conv.srcNormalized);
+            SplitVertexFormat(dstAttrib.format, conv.dstDataType, conv.dstComponents, conv.dstNormalized);
+        }
+    }
+
+    /* Allocate zero-initialized output buffer, so the alignment padding is deterministic */
+    auto dstBufferSize = static_cast<std::size_t>(dstVertexFormat.stride) * numVertices;
+    auto dstBuffer = MakeUniqueArray<char>(dstBufferSize);
+    ::memset(dstBuffer.get(), 0, dstBufferSize);
+
+    if (numVertices == 0 || conversions.empty())
+        return dstBuffer;
+
+    auto src = reinterpret_cast<const char*>(srcVertices);
+    auto dst = dstBuffer.get();
+
+    /* Determine number of threads */
+    if (threadCount == Constants::maxThreadCount)
+        threadCount = std::thread::hardware_concurrency();
+
+    threadCount = std::min(threadCount, numVertices / g_threadMinVertexCount);
+
+    if (threadCount > 1)
+    {
+        /* Create worker threads */
+        std::vector<std::thread> workers(threadCount);
+
+        auto workSize       = numVertices / threadCount;
+        auto workSizeRemain = numVertices % threadCount;
+
+        std::size_t offset = 0;
+
+        for (std::size_t i = 0; i < threadCount; ++i)
+        {
+            workers[i] = std::thread(
+                PackVertexBufferWorker,
+                std::cref(conversions),
+                src, srcVertexFormat.stride,
+                dst, dstVertexFormat.stride,
+                offset, offset + workSize
+            );
+            offset += workSize;
+        }
+
+        /* Execute conversion of remaining work on main thread */
+        if (workSizeRemain > 0)
+            PackVertexBufferWorker(conversions, src, srcVertexFormat.stride, dst, dstVertexFormat.stride, offset, offset + workSizeRemain);
+
+        /* Join worker threads */
+        for (auto& w : workers)
+            w.join();
+    }
+    else
+    {
+        /* Execute conversion only on main thread */
+        PackVertexBufferWorker(conversions, src, srcVertexFormat.stride, dst, dstVertexFormat.stride, 0, numVertices);
+    }
+
+    return dstBuffer;
+}
+
+
+} // /namespace LLGL
+
+#endif
+
+
+
+// ================================================================================
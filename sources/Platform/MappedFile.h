@@ -0,0 +1,47 @@
+/*
+ * MappedFile.h
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_MAPPED_FILE_H
+#define LLGL_MAPPED_FILE_H
+
+
+#include <LLGL/NonCopyable.h>
+#include <memory>
+#include <string>
+#include <cstddef>
+
+
+namespace LLGL
+{
+
+
+//! Memory mapped file class (to read large files without copying their content into an intermediate buffer).
+class MappedFile : public NonCopyable
+{
+
+    public:
+
+        //! Maps the specified file into memory with read-only access, or throws std::runtime_error if the file could not be mapped.
+        static std::unique_ptr<MappedFile> Open(const std::string& filename);
+
+        //! Returns a pointer to the beginning of the mapped file content.
+        virtual const void* GetData() const = 0;
+
+        //! Returns the size (in bytes) of the mapped file content.
+        virtual std::size_t GetSize() const = 0;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
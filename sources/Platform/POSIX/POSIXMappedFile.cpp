@@ -0,0 +1,78 @@
+/*
+ * POSIXMappedFile.cpp
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "POSIXMappedFile.h"
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <stdexcept>
+
+
+namespace LLGL
+{
+
+
+std::unique_ptr<MappedFile> MappedFile::Open(const std::string& filename)
+{
+    return std::unique_ptr<MappedFile>(new POSIXMappedFile(filename));
+}
+
+POSIXMappedFile::POSIXMappedFile(const std::string& filename)
+{
+    /* Open file for read-only access */
+    int fd = open(filename.c_str(), O_RDONLY);
+    if (fd == -1)
+        throw std::runtime_error("failed to open file: " + filename);
+
+    /* Determine file size */
+    struct stat fileStat;
+    if (fstat(fd, &fileStat) == -1)
+    {
+        close(fd);
+        throw std::runtime_error("failed to query file size: " + filename);
+    }
+
+    size_ = static_cast<std::size_t>(fileStat.st_size);
+
+    /* Map entire file into memory (the mapping remains valid after the file descriptor has been closed) */
+    if (size_ > 0)
+    {
+        data_ = mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (data_ == MAP_FAILED)
+        {
+            data_ = nullptr;
+            close(fd);
+            throw std::runtime_error("failed to map file into memory: " + filename);
+        }
+    }
+
+    close(fd);
+}
+
+POSIXMappedFile::~POSIXMappedFile()
+{
+    if (data_ != nullptr)
+        munmap(data_, size_);
+}
+
+const void* POSIXMappedFile::GetData() const
+{
+    return data_;
+}
+
+std::size_t POSIXMappedFile::GetSize() const
+{
+    return size_;
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,45 @@
+/*
+ * POSIXMappedFile.h
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_POSIX_MAPPED_FILE_H
+#define LLGL_POSIX_MAPPED_FILE_H
+
+
+#include "../MappedFile.h"
+
+
+namespace LLGL
+{
+
+
+class POSIXMappedFile : public MappedFile
+{
+
+    public:
+
+        POSIXMappedFile(const std::string& filename);
+        ~POSIXMappedFile();
+
+        const void* GetData() const override;
+        std::size_t GetSize() const override;
+
+    private:
+
+        void*       data_   = nullptr;
+        std::size_t size_   = 0;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -0,0 +1,78 @@
+/*
+ * Win32MappedFile.cpp
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "Win32MappedFile.h"
+#include <stdexcept>
+
+
+namespace LLGL
+{
+
+
+std::unique_ptr<MappedFile> MappedFile::Open(const std::string& filename)
+{
+    return std::unique_ptr<MappedFile>(new Win32MappedFile(filename));
+}
+
+Win32MappedFile::Win32MappedFile(const std::string& filename)
+{
+    /* Open file for read-only access */
+    HANDLE file = CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+        throw std::runtime_error("failed to open file: " + filename);
+
+    /* Determine file size */
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(file, &fileSize))
+    {
+        CloseHandle(file);
+        throw std::runtime_error("failed to query file size: " + filename);
+    }
+
+    size_ = static_cast<std::size_t>(fileSize.QuadPart);
+
+    /* Map entire file into memory (the view remains valid after the file and mapping handles have been closed) */
+    if (size_ > 0)
+    {
+        HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (mapping != nullptr)
+        {
+            view_ = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+            CloseHandle(mapping);
+        }
+        if (view_ == nullptr)
+        {
+            CloseHandle(file);
+            throw std::runtime_error("failed to map file into memory: " + filename);
+        }
+    }
+
+    CloseHandle(file);
+}
+
+Win32MappedFile::~Win32MappedFile()
+{
+    if (view_ != nullptr)
+        UnmapViewOfFile(view_);
+}
+
+const void* Win32MappedFile::GetData() const
+{
+    return view_;
+}
+
+std::size_t Win32MappedFile::GetSize() const
+{
+    return size_;
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -18,7 +18,7 @@ namespace LLGL
 {
 
 
-// This class only holds a copy of the binding descriptor list.
+// This class only holds a copy of the binding descriptor list and the inline constant ranges.
 class LLGL_EXPORT BasicPipelineLayout : public PipelineLayout
 {
 
@@ -32,9 +32,16 @@ class LLGL_EXPORT BasicPipelineLayout : public PipelineLayout
             return bindings_;
         }
 
+        // Returns the copied list of inline constant ranges.
+        inline const std::vector<InlineConstantsDescriptor>& GetInlineConstants() const
+        {
+            return inlineConstants_;
+        }
+
     private:
 
-        std::vector<BindingDescriptor> bindings_;
+        std::vector<BindingDescriptor>          bindings_;
+        std::vector<InlineConstantsDescriptor>  inlineConstants_;
 
 };
 
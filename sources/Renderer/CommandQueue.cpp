@@ -0,0 +1,48 @@
+/*
+ * CommandQueue.cpp
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include <LLGL/CommandQueue.h>
+#include "../Core/Exception.h"
+
+
+namespace LLGL
+{
+
+
+/* ----- Command Buffers ----- */
+
+void CommandQueue::Submit(std::uint32_t numCommandBuffers, CommandBuffer* const * commandBuffers)
+{
+    for (std::uint32_t i = 0; i < numCommandBuffers; ++i)
+        Submit(*commandBuffers[i]);
+}
+
+void CommandQueue::Submit(const SubmitDescriptor& desc)
+{
+    /* Submit batches one after another; command buffers are executed in submission order by default */
+    for (const auto& batch : desc.batches)
+        Submit(static_cast<std::uint32_t>(batch.commandBuffers.size()), batch.commandBuffers.data());
+}
+
+/* ----- Sparse Resources ----- */
+
+void CommandQueue::UpdateTileMappings(Buffer& /*buffer*/, std::uint32_t /*numMappings*/, const BufferTileMapping* /*mappings*/)
+{
+    ThrowNotSupportedExcept(__FUNCTION__, "sparse buffers");
+}
+
+void CommandQueue::UpdateTileMappings(Texture& /*texture*/, std::uint32_t /*numMappings*/, const TextureTileMapping* /*mappings*/)
+{
+    ThrowNotSupportedExcept(__FUNCTION__, "sparse textures");
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
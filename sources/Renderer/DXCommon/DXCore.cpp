@@ -230,6 +230,13 @@ static std::vector<Format> DXGetSupportedTextureFormats()
         Format::BC1RGBA,
         Format::BC2RGBA,
         Format::BC3RGBA,
+        Format::BC4RUNorm,
+        Format::BC4RSNorm,
+        Format::BC5RGUNorm,
+        Format::BC5RGSNorm,
+        Format::BC6HRGBUFloat,
+        Format::BC6HRGBSFloat,
+        Format::BC7RGBAUNorm,
     };
 }
 
@@ -263,6 +270,7 @@ void DXGetRenderingCaps(RenderingCapabilities& caps, D3D_FEATURE_LEVEL featureLe
     caps.features.hasViewportArrays                 = true;
     caps.features.hasStreamOutputs                  = (featureLevel >= D3D_FEATURE_LEVEL_10_0);
     caps.features.hasLogicOp                        = (featureLevel >= D3D_FEATURE_LEVEL_11_1);
+    caps.features.hasTextureViews                   = (featureLevel >= D3D_FEATURE_LEVEL_10_0);
 
     /* Query limits */
     caps.limits.lineWidthRange[0]                   = 1.0f;
@@ -485,6 +493,13 @@ D3DTextureFormatDescriptor DXGetTextureFormatDesc(DXGI_FORMAT format)
         case DXGI_FORMAT_BC1_UNORM:             return { ImageFormat::CompressedRGB,    DataType::UInt8   };
         case DXGI_FORMAT_BC2_UNORM:             return { ImageFormat::CompressedRGBA,   DataType::UInt8   };
         case DXGI_FORMAT_BC3_UNORM:             return { ImageFormat::CompressedRGBA,   DataType::UInt8   };
+        case DXGI_FORMAT_BC4_UNORM:             return { ImageFormat::CompressedRGB,    DataType::UInt8   };
+        case DXGI_FORMAT_BC4_SNORM:             return { ImageFormat::CompressedRGB,    DataType::UInt8   };
+        case DXGI_FORMAT_BC5_UNORM:             return { ImageFormat::CompressedRGB,    DataType::UInt8   };
+        case DXGI_FORMAT_BC5_SNORM:             return { ImageFormat::CompressedRGB,    DataType::UInt8   };
+        case DXGI_FORMAT_BC6H_UF16:             return { ImageFormat::CompressedRGB,    DataType::UInt8   };
+        case DXGI_FORMAT_BC6H_SF16:             return { ImageFormat::CompressedRGB,    DataType::UInt8   };
+        case DXGI_FORMAT_BC7_UNORM:             return { ImageFormat::CompressedRGBA,   DataType::UInt8   };
         default:                                break;
     }
     throw std::invalid_argument("failed to map hardware texture format into image buffer format");
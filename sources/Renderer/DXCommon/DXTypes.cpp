@@ -149,6 +149,16 @@ DXGI_FORMAT Map(const Format format)
         case Format::BC1RGBA:           return DXGI_FORMAT_BC1_UNORM;
         case Format::BC2RGBA:           return DXGI_FORMAT_BC2_UNORM;
         case Format::BC3RGBA:           return DXGI_FORMAT_BC3_UNORM;
+        case Format::BC4RUNorm:         return DXGI_FORMAT_BC4_UNORM;
+        case Format::BC4RSNorm:         return DXGI_FORMAT_BC4_SNORM;
+        case Format::BC5RGUNorm:        return DXGI_FORMAT_BC5_UNORM;
+        case Format::BC5RGSNorm:        return DXGI_FORMAT_BC5_SNORM;
+        case Format::BC6HRGBUFloat:     return DXGI_FORMAT_BC6H_UF16;
+        case Format::BC6HRGBSFloat:     return DXGI_FORMAT_BC6H_SF16;
+        case Format::BC7RGBAUNorm:      return DXGI_FORMAT_BC7_UNORM;
+        case Format::ETC2RGB8UNorm:     break;
+        case Format::ETC2RGB8A1UNorm:   break;
+        case Format::ETC2RGBA8UNorm:    break;
     }
     MapFailed("Format", "DXGI_FORMAT");
 }
@@ -272,6 +282,13 @@ Format Unmap(const DXGI_FORMAT format)
         case DXGI_FORMAT_BC1_UNORM:             return Format::BC1RGBA;
         case DXGI_FORMAT_BC2_UNORM:             return Format::BC2RGBA;
         case DXGI_FORMAT_BC3_UNORM:             return Format::BC3RGBA;
+        case DXGI_FORMAT_BC4_UNORM:             return Format::BC4RUNorm;
+        case DXGI_FORMAT_BC4_SNORM:             return Format::BC4RSNorm;
+        case DXGI_FORMAT_BC5_UNORM:             return Format::BC5RGUNorm;
+        case DXGI_FORMAT_BC5_SNORM:             return Format::BC5RGSNorm;
+        case DXGI_FORMAT_BC6H_UF16:             return Format::BC6HRGBUFloat;
+        case DXGI_FORMAT_BC6H_SF16:             return Format::BC6HRGBSFloat;
+        case DXGI_FORMAT_BC7_UNORM:             return Format::BC7RGBAUNorm;
 
         default:                                return Format::Undefined;
     }
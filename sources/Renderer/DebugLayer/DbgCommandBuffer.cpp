@@ -17,6 +17,7 @@
 #include "DbgRenderTarget.h"
 #include "DbgShaderProgram.h"
 #include "DbgQuery.h"
+#include "DbgResourceHeap.h"
 
 #include <LLGL/RenderingProfiler.h>
 #include <LLGL/RenderingDebugger.h>
@@ -80,6 +81,66 @@ void DbgCommandBuffer::CopyBuffer(Buffer& dstBuffer, std::uint64_t dstOffset, Bu
     instance.CopyBuffer(dstBufferDbg.instance, dstOffset, srcBufferDbg.instance, srcOffset, size);
 }
 
+void DbgCommandBuffer::FillBuffer(Buffer& dstBuffer, std::uint64_t dstOffset, std::uint32_t value, std::uint64_t fillSize)
+{
+    auto& dstBufferDbg = LLGL_CAST(DbgBuffer&, dstBuffer);
+
+    if (debugger_)
+    {
+        LLGL_DBG_SOURCE;
+        AssertRecording();
+        AssertOutsideRenderPass();
+        ValidateBufferRange(dstBufferDbg, dstOffset, fillSize);
+        if (dstOffset % 4 != 0 || fillSize % 4 != 0)
+            LLGL_DBG_ERROR(ErrorType::InvalidArgument, "buffer fill offset and size must be multiples of 4");
+    }
+
+    instance.FillBuffer(dstBufferDbg.instance, dstOffset, value, fillSize);
+}
+
+void DbgCommandBuffer::CopyTexture(
+    Texture&                dstTexture,
+    const TextureLocation&  dstLocation,
+    Texture&                srcTexture,
+    const TextureRegion&    srcRegion)
+{
+    auto& dstTextureDbg = LLGL_CAST(DbgTexture&, dstTexture);
+    auto& srcTextureDbg = LLGL_CAST(DbgTexture&, srcTexture);
+
+    if (debugger_)
+    {
+        LLGL_DBG_SOURCE;
+        AssertRecording();
+        AssertOutsideRenderPass();
+        ValidateTextureRegion(srcTextureDbg, srcRegion.mipLevel, srcRegion.offset, srcRegion.extent);
+        ValidateTextureRegion(dstTextureDbg, dstLocation.mipLevel, dstLocation.offset, srcRegion.extent);
+    }
+
+    instance.CopyTexture(dstTextureDbg.instance, dstLocation, srcTextureDbg.instance, srcRegion);
+}
+
+void DbgCommandBuffer::BlitTexture(
+    Texture&                dstTexture,
+    const TextureRegion&    dstRegion,
+    Texture&                srcTexture,
+    const TextureRegion&    srcRegion,
+    const SamplerFilter     filter)
+{
+    auto& dstTextureDbg = LLGL_CAST(DbgTexture&, dstTexture);
+    auto& srcTextureDbg = LLGL_CAST(DbgTexture&, srcTexture);
+
+    if (debugger_)
+    {
+        LLGL_DBG_SOURCE;
+        AssertRecording();
+        AssertOutsideRenderPass();
+        ValidateTextureRegion(srcTextureDbg, srcRegion.mipLevel, srcRegion.offset, srcRegion.extent);
+        ValidateTextureRegion(dstTextureDbg, dstRegion.mipLevel, dstRegion.offset, dstRegion.extent);
+    }
+
+    instance.BlitTexture(dstTextureDbg.instance, dstRegion, srcTextureDbg.instance, srcRegion, filter);
+}
+
 /* ----- Configuration ----- */
 
 void DbgCommandBuffer::SetGraphicsAPIDependentState(const void* stateDesc, std::size_t stateDescSize)
@@ -91,7 +152,7 @@ void DbgCommandBuffer::SetGraphicsAPIDependentState(const void* stateDesc, std::
 
 void DbgCommandBuffer::SetViewport(const Viewport& viewport)
 {
-    if (debugger_)
+    if (debugger_ && debugger_->IsFrameValidated())
     {
         LLGL_DBG_SOURCE;
         AssertRecording();
@@ -103,7 +164,7 @@ void DbgCommandBuffer::SetViewport(const Viewport& viewport)
 
 void DbgCommandBuffer::SetViewports(std::uint32_t numViewports, const Viewport* viewports)
 {
-    if (debugger_)
+    if (debugger_ && debugger_->IsFrameValidated())
     {
         LLGL_DBG_SOURCE;
 
@@ -143,7 +204,7 @@ void DbgCommandBuffer::SetScissor(const Scissor& scissor)
 
 void DbgCommandBuffer::SetScissors(std::uint32_t numScissors, const Scissor* scissors)
 {
-    if (debugger_)
+    if (debugger_ && debugger_->IsFrameValidated())
     {
         LLGL_DBG_SOURCE;
         AssertRecording();
@@ -282,7 +343,7 @@ void DbgCommandBuffer::SetConstantBuffer(Buffer& buffer, std::uint32_t slot, lon
 
     auto& bufferDbg = LLGL_CAST(DbgBuffer&, buffer);
 
-    if (debugger_)
+    if (debugger_ && debugger_->IsFrameValidated())
     {
         LLGL_DBG_SOURCE;
         AssertRecording();
@@ -303,7 +364,7 @@ void DbgCommandBuffer::SetStorageBuffer(Buffer& buffer, std::uint32_t slot, long
 
     auto& bufferDbg = LLGL_CAST(DbgBuffer&, buffer);
 
-    if (debugger_)
+    if (debugger_ && debugger_->IsFrameValidated())
     {
         LLGL_DBG_SOURCE;
         AssertRecording();
@@ -387,7 +448,7 @@ void DbgCommandBuffer::SetTexture(Texture& texture, std::uint32_t slot, long sta
 
     auto& textureDbg = LLGL_CAST(DbgTexture&, texture);
 
-    if (debugger_)
+    if (debugger_ && debugger_->IsFrameValidated())
     {
         LLGL_DBG_SOURCE;
         AssertRecording();
@@ -405,7 +466,7 @@ void DbgCommandBuffer::SetSampler(Sampler& sampler, std::uint32_t slot, long sta
 {
     AssertCommandBufferExt(__func__);
 
-    if (debugger_)
+    if (debugger_ && debugger_->IsFrameValidated())
     {
         LLGL_DBG_SOURCE;
         AssertRecording();
@@ -420,19 +481,54 @@ void DbgCommandBuffer::SetSampler(Sampler& sampler, std::uint32_t slot, long sta
 /* ----- Resource View Heaps ----- */
 
 //TODO: record bindings
-void DbgCommandBuffer::SetGraphicsResourceHeap(ResourceHeap& resourceHeap, std::uint32_t firstSet)
+void DbgCommandBuffer::SetGraphicsResourceHeap(ResourceHeap& resourceHeap, std::uint32_t firstSet, std::uint32_t numDynamicOffsets, const std::uint32_t* dynamicOffsets)
 {
     LLGL_DBG_SOURCE;
     AssertRecording();
-    instance.SetGraphicsResourceHeap(resourceHeap, firstSet);
+    auto& resourceHeapDbg = LLGL_CAST(DbgResourceHeap&, resourceHeap);
+    if (debugger_)
+        ValidateDynamicOffsets(resourceHeapDbg, numDynamicOffsets, dynamicOffsets);
+    instance.SetGraphicsResourceHeap(resourceHeapDbg.instance, firstSet, numDynamicOffsets, dynamicOffsets);
 }
 
 //TODO: record bindings
-void DbgCommandBuffer::SetComputeResourceHeap(ResourceHeap& resourceHeap, std::uint32_t firstSet)
+void DbgCommandBuffer::SetComputeResourceHeap(ResourceHeap& resourceHeap, std::uint32_t firstSet, std::uint32_t numDynamicOffsets, const std::uint32_t* dynamicOffsets)
 {
     LLGL_DBG_SOURCE;
     AssertRecording();
-    instance.SetComputeResourceHeap(resourceHeap, firstSet);
+    auto& resourceHeapDbg = LLGL_CAST(DbgResourceHeap&, resourceHeap);
+    if (debugger_)
+        ValidateDynamicOffsets(resourceHeapDbg, numDynamicOffsets, dynamicOffsets);
+    instance.SetComputeResourceHeap(resourceHeapDbg.instance, firstSet, numDynamicOffsets, dynamicOffsets);
+}
+
+/* ----- Inline Constants ----- */
+
+void DbgCommandBuffer::SetInlineConstants(long stageFlags, std::uint32_t offset, const void* data, std::uint32_t dataSize)
+{
+    if (debugger_)
+    {
+        LLGL_DBG_SOURCE;
+        AssertRecording();
+        ValidateStageFlags(stageFlags, StageFlags::AllStages);
+
+        if (!bindings_.graphicsPipeline && !bindings_.computePipeline)
+            LLGL_DBG_ERROR(ErrorType::InvalidState, "no graphics or compute pipeline is bound for inline constants");
+        if (data == nullptr)
+            LLGL_DBG_ERROR(ErrorType::InvalidArgument, "null pointer for inline constants data");
+        if (offset % 4 != 0 || dataSize % 4 != 0)
+            LLGL_DBG_ERROR(ErrorType::InvalidArgument, "inline constants offset and size must be multiples of 4");
+        if (static_cast<std::uint64_t>(offset) + dataSize > limits_.maxInlineConstantsSize)
+        {
+            LLGL_DBG_ERROR(
+                ErrorType::InvalidArgument,
+                "inline constants out of range (" + std::to_string(offset + dataSize) +
+                " bytes specified but limit is " + std::to_string(limits_.maxInlineConstantsSize) + ")"
+            );
+        }
+    }
+
+    instance.SetInlineConstants(stageFlags, offset, data, dataSize);
 }
 
 /* ----- Render Passes ----- */
@@ -597,6 +693,42 @@ bool DbgCommandBuffer::QueryPipelineStatisticsResult(Query& query, QueryPipeline
     return instance.QueryPipelineStatisticsResult(queryDbg.instance, result);
 }
 
+void DbgCommandBuffer::CopyQueryResults(std::uint32_t numQueries, Query* const * queries, Buffer& dstBuffer, std::uint64_t dstOffset)
+{
+    auto& dstBufferDbg = LLGL_CAST(DbgBuffer&, dstBuffer);
+
+    if (debugger_)
+    {
+        LLGL_DBG_SOURCE;
+        AssertRecording();
+        AssertOutsideRenderPass();
+        AssertQueryResultBuffersSupported();
+        ValidateBufferRange(dstBufferDbg, dstOffset, static_cast<std::uint64_t>(numQueries) * sizeof(std::uint64_t));
+        if (dstOffset % 8 != 0)
+            LLGL_DBG_ERROR(ErrorType::InvalidArgument, "query result buffer offset must be a multiple of 8");
+    }
+
+    /* Unwrap query objects */
+    std::vector<Query*> queryInstances(numQueries);
+
+    for (std::uint32_t i = 0; i < numQueries; ++i)
+    {
+        auto queryDbg = LLGL_CAST(DbgQuery*, queries[i]);
+
+        if (debugger_)
+        {
+            if (queryDbg->GetType() == QueryType::PipelineStatistics)
+                LLGL_DBG_ERROR(ErrorType::InvalidArgument, "cannot copy results of pipeline statistics query into buffer");
+            else if (queryDbg->state != DbgQuery::State::Ready)
+                LLGL_DBG_ERROR(ErrorType::InvalidState, "query result is not ready");
+        }
+
+        queryInstances[i] = &(queryDbg->instance);
+    }
+
+    instance.CopyQueryResults(numQueries, queryInstances.data(), dstBufferDbg.instance, dstOffset);
+}
+
 void DbgCommandBuffer::BeginRenderCondition(Query& query, const RenderConditionMode mode)
 {
     auto& queryDbg = LLGL_CAST(DbgQuery&, query);
@@ -607,6 +739,25 @@ void DbgCommandBuffer::BeginRenderCondition(Query& query, const RenderConditionM
     instance.BeginRenderCondition(queryDbg.instance, mode);
 }
 
+void DbgCommandBuffer::BeginRenderCondition(Buffer& buffer, std::uint64_t offset, const RenderConditionMode mode)
+{
+    auto& bufferDbg = LLGL_CAST(DbgBuffer&, buffer);
+
+    if (debugger_)
+    {
+        LLGL_DBG_SOURCE;
+        AssertRecording();
+        AssertRenderConditionBuffersSupported();
+        if ((bufferDbg.desc.flags & BufferFlags::RenderCondition) == 0)
+            LLGL_DBG_ERROR(ErrorType::InvalidArgument, "cannot use buffer as render condition that was not created with the 'LLGL::BufferFlags::RenderCondition' flag");
+        ValidateBufferRange(bufferDbg, offset, sizeof(std::uint64_t));
+        if (offset % 8 != 0)
+            LLGL_DBG_ERROR(ErrorType::InvalidArgument, "render condition buffer offset must be a multiple of 8");
+    }
+
+    instance.BeginRenderCondition(bufferDbg.instance, offset, mode);
+}
+
 void DbgCommandBuffer::EndRenderCondition()
 {
     LLGL_DBG_SOURCE;
@@ -952,13 +1103,20 @@ void DbgCommandBuffer::ValidateNumInstances(std::uint32_t numInstances, std::uin
 void DbgCommandBuffer::ValidateDrawCmd(
     std::uint32_t numVertices, std::uint32_t firstVertex, std::uint32_t numInstances, std::uint32_t firstInstance)
 {
-    AssertRecording();
-    AssertInsideRenderPass();
+    /* Fully validate draw command only if it is sampled by the debugger */
+    if (debugger_->BeginValidation())
+    {
+        AssertRecording();
+        AssertInsideRenderPass();
+        AssertVertexBufferBound();
+        ValidateVertexLayout();
+        ValidateNumVertices(numVertices);
+        ValidateNumInstances(numInstances, firstInstance);
+        debugger_->EndValidation();
+    }
+
+    /* Always validate pipeline state and vertex range */
     AssertGraphicsPipelineBound();
-    AssertVertexBufferBound();
-    ValidateVertexLayout();
-    ValidateNumVertices(numVertices);
-    ValidateNumInstances(numInstances, firstInstance);
 
     if (bindings_.numVertexBuffers > 0 && bindings_.anyShaderAttributes)
         ValidateVertexLimit(numVertices + firstVertex, static_cast<std::uint32_t>(bindings_.vertexBuffers[0]->elements));
@@ -967,14 +1125,21 @@ void DbgCommandBuffer::ValidateDrawCmd(
 void DbgCommandBuffer::ValidateDrawIndexedCmd(
     std::uint32_t numVertices, std::uint32_t numInstances, std::uint32_t firstIndex, std::int32_t vertexOffset, std::uint32_t firstInstance)
 {
-    AssertRecording();
-    AssertInsideRenderPass();
+    /* Fully validate draw command only if it is sampled by the debugger */
+    if (debugger_->BeginValidation())
+    {
+        AssertRecording();
+        AssertInsideRenderPass();
+        AssertVertexBufferBound();
+        ValidateVertexLayout();
+        ValidateNumVertices(numVertices);
+        ValidateNumInstances(numInstances, firstInstance);
+        debugger_->EndValidation();
+    }
+
+    /* Always validate pipeline state, index buffer, and index range */
     AssertGraphicsPipelineBound();
-    AssertVertexBufferBound();
     AssertIndexBufferBound();
-    ValidateVertexLayout();
-    ValidateNumVertices(numVertices);
-    ValidateNumInstances(numInstances, firstInstance);
 
     if (bindings_.indexBuffer)
         ValidateVertexLimit(numVertices + firstIndex, static_cast<std::uint32_t>(bindings_.indexBuffer->elements));
@@ -1030,6 +1195,75 @@ void DbgCommandBuffer::ValidateBufferType(const BufferType bufferType, const Buf
         LLGL_DBG_ERROR(ErrorType::InvalidArgument, "invalid buffer type");
 }
 
+void DbgCommandBuffer::ValidateBufferRange(DbgBuffer& bufferDbg, std::uint64_t offset, std::uint64_t size)
+{
+    if (offset + size > bufferDbg.desc.size)
+    {
+        LLGL_DBG_ERROR(
+            ErrorType::InvalidArgument,
+            "buffer range out of bounds (" + std::to_string(offset + size) +
+            " specified but limit is " + std::to_string(bufferDbg.desc.size) + ")"
+        );
+    }
+}
+
+void DbgCommandBuffer::ValidateTextureRegion(DbgTexture& textureDbg, std::uint32_t mipLevel, const Offset3D& offset, const Extent3D& extent)
+{
+    if (mipLevel >= textureDbg.mipLevels)
+    {
+        LLGL_DBG_ERROR(
+            ErrorType::InvalidArgument,
+            "texture MIP-map level out of bounds (" + std::to_string(mipLevel) +
+            " specified but limit is " + std::to_string(textureDbg.mipLevels - 1) + ")"
+        );
+    }
+    else if (offset.x < 0 || offset.y < 0 || offset.z < 0)
+        LLGL_DBG_ERROR(ErrorType::InvalidArgument, "negative texture region offset");
+    else
+    {
+        /* Validate region against MIP-map extent (which includes the number of array layers) */
+        auto mipExtent = textureDbg.QueryMipExtent(mipLevel);
+        if ( static_cast<std::uint32_t>(offset.x) + extent.width  > mipExtent.width  ||
+             static_cast<std::uint32_t>(offset.y) + extent.height > mipExtent.height ||
+             static_cast<std::uint32_t>(offset.z) + extent.depth  > mipExtent.depth )
+        {
+            LLGL_DBG_ERROR(ErrorType::InvalidArgument, "texture region out of bounds for MIP-map level " + std::to_string(mipLevel));
+        }
+    }
+}
+
+void DbgCommandBuffer::ValidateDynamicOffsets(const DbgResourceHeap& resourceHeap, std::uint32_t numDynamicOffsets, const std::uint32_t* dynamicOffsets)
+{
+    if (numDynamicOffsets != resourceHeap.numDynamicOffsets)
+    {
+        LLGL_DBG_ERROR(
+            ErrorType::InvalidArgument,
+            "mismatch between number of dynamic offsets (" + std::to_string(numDynamicOffsets) +
+            ") and number of bindings with dynamic offset in pipeline layout of resource heap (" + std::to_string(resourceHeap.numDynamicOffsets) + ")"
+        );
+    }
+
+    if (numDynamicOffsets > 0)
+    {
+        if (dynamicOffsets == nullptr)
+            LLGL_DBG_ERROR(ErrorType::InvalidArgument, "null pointer for dynamic offsets");
+        else if (limits_.minConstantBufferOffsetAlignment > 0)
+        {
+            for (std::uint32_t i = 0; i < numDynamicOffsets; ++i)
+            {
+                if (dynamicOffsets[i] % limits_.minConstantBufferOffsetAlignment != 0)
+                {
+                    LLGL_DBG_ERROR(
+                        ErrorType::InvalidArgument,
+                        "dynamic offset " + std::to_string(dynamicOffsets[i]) + " is not a multiple of the minimal alignment of " +
+                        std::to_string(limits_.minConstantBufferOffsetAlignment) + " bytes"
+                    );
+                }
+            }
+        }
+    }
+}
+
 void DbgCommandBuffer::AssertRecording()
 {
     if (!states_.recording)
@@ -1042,6 +1276,12 @@ void DbgCommandBuffer::AssertInsideRenderPass()
         LLGL_DBG_ERROR(ErrorType::InvalidState, "operation is only allowed inside a render pass: missing call to <LLGL::CommandBuffer::BeginRenderPass>");
 }
 
+void DbgCommandBuffer::AssertOutsideRenderPass()
+{
+    if (states_.insideRenderPass)
+        LLGL_DBG_ERROR(ErrorType::InvalidState, "operation is not allowed inside a render pass: missing call to <LLGL::CommandBuffer::EndRenderPass>");
+}
+
 void DbgCommandBuffer::AssertGraphicsPipelineBound()
 {
     if (!bindings_.graphicsPipeline)
@@ -1097,6 +1337,18 @@ void DbgCommandBuffer::AssertOffsetInstancingSupported()
         LLGL_DBG_ERROR_NOT_SUPPORTED("offset-instancing");
 }
 
+void DbgCommandBuffer::AssertRenderConditionBuffersSupported()
+{
+    if (!features_.hasRenderConditionBuffers)
+        LLGL_DBG_ERROR_NOT_SUPPORTED("render condition buffers");
+}
+
+void DbgCommandBuffer::AssertQueryResultBuffersSupported()
+{
+    if (!features_.hasQueryResultBuffers)
+        LLGL_DBG_ERROR_NOT_SUPPORTED("query result buffers");
+}
+
 void DbgCommandBuffer::WarnImproperVertices(const std::string& topologyName, std::uint32_t unusedVertices)
 {
     LLGL_DBG_WARN(
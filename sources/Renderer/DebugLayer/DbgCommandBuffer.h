@@ -19,8 +19,10 @@ namespace LLGL
 
 
 class DbgBuffer;
+class DbgTexture;
 class DbgRenderContext;
 class DbgRenderTarget;
+class DbgResourceHeap;
 class RenderingProfiler;
 class RenderingDebugger;
 
@@ -46,6 +48,22 @@ class DbgCommandBuffer : public CommandBufferExt
 
         void UpdateBuffer(Buffer& dstBuffer, std::uint64_t dstOffset, const void* data, std::uint16_t dataSize) override;
         void CopyBuffer(Buffer& dstBuffer, std::uint64_t dstOffset, Buffer& srcBuffer, std::uint64_t srcOffset, std::uint64_t size) override;
+        void FillBuffer(Buffer& dstBuffer, std::uint64_t dstOffset, std::uint32_t value, std::uint64_t fillSize) override;
+
+        void CopyTexture(
+            Texture&                dstTexture,
+            const TextureLocation&  dstLocation,
+            Texture&                srcTexture,
+            const TextureRegion&    srcRegion
+        ) override;
+
+        void BlitTexture(
+            Texture&                dstTexture,
+            const TextureRegion&    dstRegion,
+            Texture&                srcTexture,
+            const TextureRegion&    srcRegion,
+            const SamplerFilter     filter      = SamplerFilter::Linear
+        ) override;
 
         /* ----- Configuration ----- */
 
@@ -101,8 +119,12 @@ class DbgCommandBuffer : public CommandBufferExt
 
         /* ----- Resource View Heaps ----- */
 
-        void SetGraphicsResourceHeap(ResourceHeap& resourceHeap, std::uint32_t firstSet = 0) override;
-        void SetComputeResourceHeap(ResourceHeap& resourceHeap, std::uint32_t firstSet = 0) override;
+        void SetGraphicsResourceHeap(ResourceHeap& resourceHeap, std::uint32_t firstSet = 0, std::uint32_t numDynamicOffsets = 0, const std::uint32_t* dynamicOffsets = nullptr) override;
+        void SetComputeResourceHeap(ResourceHeap& resourceHeap, std::uint32_t firstSet = 0, std::uint32_t numDynamicOffsets = 0, const std::uint32_t* dynamicOffsets = nullptr) override;
+
+        /* ----- Inline Constants ----- */
+
+        void SetInlineConstants(long stageFlags, std::uint32_t offset, const void* data, std::uint32_t dataSize) override;
 
         /* ----- Render Passes ----- */
 
@@ -128,7 +150,10 @@ class DbgCommandBuffer : public CommandBufferExt
         bool QueryResult(Query& query, std::uint64_t& result) override;
         bool QueryPipelineStatisticsResult(Query& query, QueryPipelineStatistics& result) override;
 
+        void CopyQueryResults(std::uint32_t numQueries, Query* const * queries, Buffer& dstBuffer, std::uint64_t dstOffset) override;
+
         void BeginRenderCondition(Query& query, const RenderConditionMode mode) override;
+        void BeginRenderCondition(Buffer& buffer, std::uint64_t offset, const RenderConditionMode mode) override;
         void EndRenderCondition() override;
 
         /* ----- Drawing ----- */
@@ -180,9 +205,13 @@ class DbgCommandBuffer : public CommandBufferExt
 
         void ValidateStageFlags(long stageFlags, long validFlags);
         void ValidateBufferType(const BufferType bufferType, const BufferType compareType);
+        void ValidateBufferRange(DbgBuffer& bufferDbg, std::uint64_t offset, std::uint64_t size);
+        void ValidateTextureRegion(DbgTexture& textureDbg, std::uint32_t mipLevel, const Offset3D& offset, const Extent3D& extent);
+        void ValidateDynamicOffsets(const DbgResourceHeap& resourceHeap, std::uint32_t numDynamicOffsets, const std::uint32_t* dynamicOffsets);
 
         void AssertRecording();
         void AssertInsideRenderPass();
+        void AssertOutsideRenderPass();
         void AssertGraphicsPipelineBound();
         void AssertComputePipelineBound();
         void AssertVertexBufferBound();
@@ -190,6 +219,8 @@ class DbgCommandBuffer : public CommandBufferExt
 
         void AssertInstancingSupported();
         void AssertOffsetInstancingSupported();
+        void AssertRenderConditionBuffersSupported();
+        void AssertQueryResultBuffersSupported();
 
         void WarnImproperVertices(const std::string& topologyName, std::uint32_t unusedVertices);
 
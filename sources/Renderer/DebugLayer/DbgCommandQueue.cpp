@@ -7,6 +7,8 @@
 
 #include "DbgCommandQueue.h"
 #include "DbgCommandBuffer.h"
+#include "DbgBuffer.h"
+#include "DbgTexture.h"
 #include "DbgCore.h"
 #include "../CheckedCast.h"
 #include <LLGL/RenderingProfiler.h>
@@ -17,10 +19,12 @@ namespace LLGL
 {
 
 
-DbgCommandQueue::DbgCommandQueue(CommandQueue& instance, RenderingProfiler* profiler, RenderingDebugger* debugger) :
-    instance  { instance }
-    //profiler_ { profiler },
-    //debugger_ { debugger }
+DbgCommandQueue::DbgCommandQueue(
+    CommandQueue& instance, RenderingProfiler* profiler, RenderingDebugger* debugger, const RenderingCapabilities& caps) :
+        instance  { instance    },
+        //profiler_ { profiler    },
+        debugger_ { debugger    },
+        limits_   { caps.limits }
 {
 }
 
@@ -32,6 +36,61 @@ void DbgCommandQueue::Submit(CommandBuffer& commandBuffer)
     instance.Submit(commandBufferDbg.instance);
 }
 
+void DbgCommandQueue::Submit(std::uint32_t numCommandBuffers, CommandBuffer* const * commandBuffers)
+{
+    /* Forward command buffer instances to the wrapped command queue, but skip null pointers */
+    instanceCommandBuffers_.clear();
+    instanceCommandBuffers_.reserve(numCommandBuffers);
+
+    for (std::uint32_t i = 0; i < numCommandBuffers; ++i)
+    {
+        if (commandBuffers[i] != nullptr)
+        {
+            auto commandBufferDbg = LLGL_CAST(DbgCommandBuffer*, commandBuffers[i]);
+            instanceCommandBuffers_.push_back(&(commandBufferDbg->instance));
+        }
+        else if (debugger_)
+        {
+            LLGL_DBG_SOURCE;
+            LLGL_DBG_ERROR(ErrorType::InvalidArgument, "null pointer in command buffers at index " + std::to_string(i));
+        }
+    }
+
+    instance.Submit(static_cast<std::uint32_t>(instanceCommandBuffers_.size()), instanceCommandBuffers_.data());
+}
+
+void DbgCommandQueue::Submit(const SubmitDescriptor& desc)
+{
+    if (debugger_)
+    {
+        LLGL_DBG_SOURCE;
+        ValidateSubmitDescriptor(desc);
+    }
+
+    /* Forward command buffer instances to the wrapped command queue, but skip null pointers (already reported by the validation) */
+    instanceSubmitDesc_.batches.resize(desc.batches.size());
+
+    for (std::size_t i = 0; i < desc.batches.size(); ++i)
+    {
+        const auto& srcBatch = desc.batches[i];
+        auto& dstBatch = instanceSubmitDesc_.batches[i];
+
+        dstBatch.commandBuffers.clear();
+        for (auto commandBuffer : srcBatch.commandBuffers)
+        {
+            if (commandBuffer != nullptr)
+            {
+                auto commandBufferDbg = LLGL_CAST(DbgCommandBuffer*, commandBuffer);
+                dstBatch.commandBuffers.push_back(&(commandBufferDbg->instance));
+            }
+        }
+
+        dstBatch.waitBatches = srcBatch.waitBatches;
+    }
+
+    instance.Submit(instanceSubmitDesc_);
+}
+
 /* ----- Fences ----- */
 
 void DbgCommandQueue::Submit(Fence& fence)
@@ -49,6 +108,120 @@ void DbgCommandQueue::WaitIdle()
     instance.WaitIdle();
 }
 
+/* ----- Sparse Resources ----- */
+
+void DbgCommandQueue::UpdateTileMappings(Buffer& buffer, std::uint32_t numMappings, const BufferTileMapping* mappings)
+{
+    auto& bufferDbg = LLGL_CAST(DbgBuffer&, buffer);
+
+    if (debugger_)
+    {
+        LLGL_DBG_SOURCE;
+        ValidateBufferTileMappings(bufferDbg, numMappings, mappings);
+    }
+
+    instance.UpdateTileMappings(bufferDbg.instance, numMappings, mappings);
+}
+
+void DbgCommandQueue::UpdateTileMappings(Texture& texture, std::uint32_t numMappings, const TextureTileMapping* mappings)
+{
+    auto& textureDbg = LLGL_CAST(DbgTexture&, texture);
+
+    if (debugger_)
+    {
+        LLGL_DBG_SOURCE;
+        ValidateTextureTileMappings(textureDbg, numMappings, mappings);
+    }
+
+    instance.UpdateTileMappings(textureDbg.instance, numMappings, mappings);
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+void DbgCommandQueue::ValidateSubmitDescriptor(const SubmitDescriptor& desc)
+{
+    for (std::size_t i = 0; i < desc.batches.size(); ++i)
+    {
+        const auto& batch = desc.batches[i];
+
+        for (auto commandBuffer : batch.commandBuffers)
+        {
+            if (commandBuffer == nullptr)
+                LLGL_DBG_ERROR(ErrorType::InvalidArgument, "null pointer in command buffers of submit batch " + std::to_string(i));
+        }
+
+        for (auto waitBatch : batch.waitBatches)
+        {
+            if (waitBatch >= i)
+            {
+                LLGL_DBG_ERROR(
+                    ErrorType::InvalidArgument,
+                    "submit batch " + std::to_string(i) + " cannot wait for batch " + std::to_string(waitBatch) +
+                    " (only previous batches can be waited for)"
+                );
+            }
+        }
+
+        if (batch.commandBuffers.empty())
+            LLGL_DBG_WARN(WarningType::PointlessOperation, "submit batch " + std::to_string(i) + " has no command buffers");
+    }
+}
+
+void DbgCommandQueue::ValidateBufferTileMappings(const DbgBuffer& bufferDbg, std::uint32_t numMappings, const BufferTileMapping* mappings)
+{
+    if ((bufferDbg.desc.flags & BufferFlags::Sparse) == 0)
+    {
+        LLGL_DBG_ERROR(ErrorType::InvalidArgument, "cannot update tile mappings of buffer that was not created with 'LLGL::BufferFlags::Sparse' flag");
+        return;
+    }
+
+    for (std::uint32_t i = 0; i < numMappings; ++i)
+    {
+        const auto& mapping = mappings[i];
+
+        if (limits_.sparsePageSize > 0 && (mapping.offset % limits_.sparsePageSize != 0 || mapping.size % limits_.sparsePageSize != 0))
+        {
+            LLGL_DBG_ERROR(
+                ErrorType::InvalidArgument,
+                "offset and size of buffer tile mapping " + std::to_string(i) +
+                " are not aligned to sparse page size (" + std::to_string(limits_.sparsePageSize) + " bytes)"
+            );
+        }
+
+        if (mapping.offset + mapping.size > bufferDbg.desc.size)
+            LLGL_DBG_ERROR(ErrorType::InvalidArgument, "buffer tile mapping " + std::to_string(i) + " out of bounds");
+    }
+}
+
+void DbgCommandQueue::ValidateTextureTileMappings(const DbgTexture& textureDbg, std::uint32_t numMappings, const TextureTileMapping* mappings)
+{
+    if ((textureDbg.desc.flags & TextureFlags::Sparse) == 0)
+    {
+        LLGL_DBG_ERROR(ErrorType::InvalidArgument, "cannot update tile mappings of texture that was not created with 'LLGL::TextureFlags::Sparse' flag");
+        return;
+    }
+
+    for (std::uint32_t i = 0; i < numMappings; ++i)
+    {
+        const auto& region = mappings[i].region;
+
+        if (region.mipLevel >= textureDbg.mipLevels)
+        {
+            LLGL_DBG_ERROR(
+                ErrorType::InvalidArgument,
+                "MIP-map level " + std::to_string(region.mipLevel) + " of texture tile mapping " + std::to_string(i) +
+                " out of bounds (texture has " + std::to_string(textureDbg.mipLevels) + " levels)"
+            );
+        }
+
+        if (region.offset.x < 0 || region.offset.y < 0 || region.offset.z < 0)
+            LLGL_DBG_ERROR(ErrorType::InvalidArgument, "negative offset in texture tile mapping " + std::to_string(i));
+    }
+}
+
 
 } // /namespace LLGL
 
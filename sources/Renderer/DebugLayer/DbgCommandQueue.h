@@ -10,6 +10,7 @@
 
 
 #include <LLGL/CommandQueue.h>
+#include <LLGL/RenderSystemFlags.h>
 
 
 namespace LLGL
@@ -18,6 +19,8 @@ namespace LLGL
 
 class RenderingProfiler;
 class RenderingDebugger;
+class DbgBuffer;
+class DbgTexture;
 
 class DbgCommandQueue : public CommandQueue
 {
@@ -27,14 +30,17 @@ class DbgCommandQueue : public CommandQueue
         /* ----- Common ----- */
 
         DbgCommandQueue(
-            CommandQueue&       instance,
-            RenderingProfiler*  profiler,
-            RenderingDebugger*  debugger
+            CommandQueue&                   instance,
+            RenderingProfiler*              profiler,
+            RenderingDebugger*              debugger,
+            const RenderingCapabilities&    caps
         );
 
         /* ----- Command Buffers ----- */
 
         void Submit(CommandBuffer& commandBuffer) override;
+        void Submit(std::uint32_t numCommandBuffers, CommandBuffer* const * commandBuffers) override;
+        void Submit(const SubmitDescriptor& desc) override;
 
         /* ----- Fences ----- */
 
@@ -43,14 +49,28 @@ class DbgCommandQueue : public CommandQueue
         bool WaitFence(Fence& fence, std::uint64_t timeout) override;
         void WaitIdle() override;
 
+        /* ----- Sparse Resources ----- */
+
+        void UpdateTileMappings(Buffer& buffer, std::uint32_t numMappings, const BufferTileMapping* mappings) override;
+        void UpdateTileMappings(Texture& texture, std::uint32_t numMappings, const TextureTileMapping* mappings) override;
+
         /* ----- Debugging members ----- */
 
         CommandQueue& instance;
 
     private:
 
+        void ValidateSubmitDescriptor(const SubmitDescriptor& desc);
+        void ValidateBufferTileMappings(const DbgBuffer& bufferDbg, std::uint32_t numMappings, const BufferTileMapping* mappings);
+        void ValidateTextureTileMappings(const DbgTexture& textureDbg, std::uint32_t numMappings, const TextureTileMapping* mappings);
+
         //RenderingProfiler* profiler_ = nullptr;
-        //RenderingDebugger* debugger_ = nullptr;
+        RenderingDebugger* debugger_ = nullptr;
+
+        const RenderingLimits&      limits_;
+
+        std::vector<CommandBuffer*> instanceCommandBuffers_;
+        SubmitDescriptor            instanceSubmitDesc_;
 
 };
 
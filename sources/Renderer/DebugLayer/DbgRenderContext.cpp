@@ -6,14 +6,16 @@
  */
 
 #include "DbgRenderContext.h"
+#include <LLGL/RenderingDebugger.h>
 
 
 namespace LLGL
 {
 
 
-DbgRenderContext::DbgRenderContext(RenderContext& instance) :
-    instance { instance }
+DbgRenderContext::DbgRenderContext(RenderContext& instance, RenderingDebugger* debugger) :
+    instance  { instance },
+    debugger_ { debugger }
 {
     ShareSurfaceAndConfig(instance);
 }
@@ -21,6 +23,8 @@ DbgRenderContext::DbgRenderContext(RenderContext& instance) :
 void DbgRenderContext::Present()
 {
     instance.Present();
+    if (debugger_)
+        debugger_->NextFrame();
 }
 
 Format DbgRenderContext::QueryColorFormat() const
@@ -17,6 +17,7 @@ namespace LLGL
 
 
 class DbgBuffer;
+class RenderingDebugger;
 
 class DbgRenderContext : public RenderContext
 {
@@ -25,7 +26,7 @@ class DbgRenderContext : public RenderContext
 
         /* ----- Common ----- */
 
-        DbgRenderContext(RenderContext& instance);
+        DbgRenderContext(RenderContext& instance, RenderingDebugger* debugger);
 
         void Present() override;
 
@@ -43,6 +44,8 @@ class DbgRenderContext : public RenderContext
         bool OnSetVideoMode(const VideoModeDescriptor& videoModeDesc) override;
         bool OnSetVsync(const VsyncDescriptor& vsyncDesc) override;
 
+        RenderingDebugger* debugger_ = nullptr;
+
 };
 
 
@@ -54,7 +54,7 @@ RenderContext* DbgRenderSystem::CreateRenderContext(const RenderContextDescripto
     SetRendererInfo(instance_->GetRendererInfo());
     SetRenderingCaps(instance_->GetRenderingCaps());
 
-    return TakeOwnership(renderContexts_, MakeUnique<DbgRenderContext>(*renderContextInstance));
+    return TakeOwnership(renderContexts_, MakeUnique<DbgRenderContext>(*renderContextInstance, debugger_));
 }
 
 void DbgRenderSystem::Release(RenderContext& renderContext)
@@ -69,7 +69,7 @@ CommandQueue* DbgRenderSystem::GetCommandQueue()
     if (!commandQueue_)
     {
         /* Instantiate command queue */
-        commandQueue_ = MakeUnique<DbgCommandQueue>(*(instance_->GetCommandQueue()), profiler_, debugger_);
+        commandQueue_ = MakeUnique<DbgCommandQueue>(*(instance_->GetCommandQueue()), profiler_, debugger_, GetRenderingCaps());
     }
     return commandQueue_.get();;
 }
@@ -320,6 +320,17 @@ void DbgRenderSystem::GenerateMips(Texture& texture, std::uint32_t baseMipLevel,
 
 Sampler* DbgRenderSystem::CreateSampler(const SamplerDescriptor& desc)
 {
+    if (profiler_)
+    {
+        /* Record whether the sampler has been shared by the sampler cache of the render system instance */
+        const auto numHits = instance_->GetSamplerCacheStatistics().numHits;
+        auto sampler = instance_->CreateSampler(desc);
+        if (instance_->GetSamplerCacheStatistics().numHits > numHits)
+            profiler_->samplerCacheHits.Inc();
+        else
+            profiler_->samplerCacheMisses.Inc();
+        return sampler;
+    }
     return instance_->CreateSampler(desc);
     //return TakeOwnership(samplers_, MakeUnique<DbgSampler>());
 }
@@ -330,12 +341,26 @@ void DbgRenderSystem::Release(Sampler& sampler)
     //RemoveFromUniqueSet(samplers_, &sampler);
 }
 
+SamplerCacheStatistics DbgRenderSystem::GetSamplerCacheStatistics() const
+{
+    return instance_->GetSamplerCacheStatistics();
+}
+
 /* ----- Resource Views ----- */
 
 ResourceHeap* DbgRenderSystem::CreateResourceHeap(const ResourceHeapDescriptor& desc)
 {
+    std::uint32_t numDynamicOffsets = 0;
+
     auto instanceDesc = desc;
     {
+        if (desc.pipelineLayout)
+        {
+            auto pipelineLayoutDbg = LLGL_CAST(DbgPipelineLayout*, desc.pipelineLayout);
+            instanceDesc.pipelineLayout = &(pipelineLayoutDbg->instance);
+            numDynamicOffsets = pipelineLayoutDbg->numDynamicOffsets;
+        }
+
         for (auto& resourceView : instanceDesc.resourceViews)
         {
             if (auto resource = resourceView.resource)
@@ -350,8 +375,13 @@ ResourceHeap* DbgRenderSystem::CreateResourceHeap(const ResourceHeapDescriptor&
                         resourceView.resource = &(LLGL_CAST(DbgBuffer*, resourceView.resource)->instance);
                         break;
                     case ResourceType::Texture:
-                        resourceView.resource = &(LLGL_CAST(DbgTexture*, resourceView.resource)->instance);
-                        break;
+                    {
+                        auto textureDbg = LLGL_CAST(DbgTexture*, resourceView.resource);
+                        if (resourceView.textureView.format != Format::Undefined)
+                            ValidateTextureView(*textureDbg, resourceView.textureView);
+                        resourceView.resource = &(textureDbg->instance);
+                    }
+                    break;
                     case ResourceType::Sampler:
                         //TODO: DbgSampler
                         break;
@@ -364,12 +394,12 @@ ResourceHeap* DbgRenderSystem::CreateResourceHeap(const ResourceHeapDescriptor&
                 LLGL_DBG_ERROR(ErrorType::InvalidArgument, "null pointer passed to ResourceViewDescriptor");
         }
     }
-    return instance_->CreateResourceHeap(instanceDesc);
+    return TakeOwnership(resourceHeaps_, MakeUnique<DbgResourceHeap>(*instance_->CreateResourceHeap(instanceDesc), numDynamicOffsets));
 }
 
 void DbgRenderSystem::Release(ResourceHeap& resourceViewHeap)
 {
-    return instance_->Release(resourceViewHeap);
+    ReleaseDbg(resourceHeaps_, resourceViewHeap);
 }
 
 /* ----- Render Passes ----- */
@@ -456,12 +486,17 @@ void DbgRenderSystem::Release(ShaderProgram& shaderProgram)
 
 PipelineLayout* DbgRenderSystem::CreatePipelineLayout(const PipelineLayoutDescriptor& desc)
 {
-    return instance_->CreatePipelineLayout(desc);
+    LLGL_DBG_SOURCE;
+
+    if (debugger_)
+        ValidatePipelineLayoutDesc(desc);
+
+    return TakeOwnership(pipelineLayouts_, MakeUnique<DbgPipelineLayout>(*instance_->CreatePipelineLayout(desc), desc));
 }
 
 void DbgRenderSystem::Release(PipelineLayout& pipelineLayout)
 {
-    instance_->Release(pipelineLayout);
+    ReleaseDbg(pipelineLayouts_, pipelineLayout);
 }
 
 /* ----- Pipeline States ----- */
@@ -479,6 +514,8 @@ GraphicsPipeline* DbgRenderSystem::CreateGraphicsPipeline(const GraphicsPipeline
         {
             auto shaderProgramDbg = LLGL_CAST(const DbgShaderProgram*, desc.shaderProgram);
             instanceDesc.shaderProgram = &(shaderProgramDbg->instance);
+            if (desc.pipelineLayout)
+                instanceDesc.pipelineLayout = &(LLGL_CAST(const DbgPipelineLayout*, desc.pipelineLayout)->instance);
         }
         return TakeOwnership(graphicsPipelines_, MakeUnique<DbgGraphicsPipeline>(*instance_->CreateGraphicsPipeline(instanceDesc), desc));
     }
@@ -496,6 +533,8 @@ ComputePipeline* DbgRenderSystem::CreateComputePipeline(const ComputePipelineDes
         {
             auto shaderProgramDbg = LLGL_CAST(DbgShaderProgram*, desc.shaderProgram);
             instanceDesc.shaderProgram = &(shaderProgramDbg->instance);
+            if (desc.pipelineLayout)
+                instanceDesc.pipelineLayout = &(LLGL_CAST(DbgPipelineLayout*, desc.pipelineLayout)->instance);
         }
         return instance_->CreateComputePipeline(instanceDesc);
     }
@@ -516,6 +555,11 @@ void DbgRenderSystem::Release(ComputePipeline& computePipeline)
     //RemoveFromUniqueSet(computePipelines_, &computePipeline);
 }
 
+PipelineCacheStatistics DbgRenderSystem::GetPipelineCacheStatistics() const
+{
+    return instance_->GetPipelineCacheStatistics();
+}
+
 /* ----- Queries ----- */
 
 Query* DbgRenderSystem::CreateQuery(const QueryDescriptor& desc)
@@ -540,6 +584,41 @@ void DbgRenderSystem::Release(Fence& fence)
     return instance_->Release(fence);
 }
 
+/* ----- Asynchronous Readbacks ----- */
+
+AsyncReadback* DbgRenderSystem::ReadTextureAsync(const Texture& texture, std::uint32_t mipLevel)
+{
+    auto& textureDbg = LLGL_CAST(const DbgTexture&, texture);
+
+    if (debugger_)
+    {
+        LLGL_DBG_SOURCE;
+        AssertAsyncReadbacks();
+        ValidateMipLevelLimit(mipLevel, textureDbg.mipLevels);
+    }
+
+    return instance_->ReadTextureAsync(textureDbg.instance, mipLevel);
+}
+
+AsyncReadback* DbgRenderSystem::ReadBufferAsync(const Buffer& buffer, std::uint64_t offset, std::uint64_t size)
+{
+    auto& bufferDbg = LLGL_CAST(const DbgBuffer&, buffer);
+
+    if (debugger_)
+    {
+        LLGL_DBG_SOURCE;
+        AssertAsyncReadbacks();
+        ValidateBufferBoundary(bufferDbg.desc.size, offset, size);
+    }
+
+    return instance_->ReadBufferAsync(bufferDbg.instance, offset, size);
+}
+
+void DbgRenderSystem::Release(AsyncReadback& readback)
+{
+    return instance_->Release(readback);
+}
+
 
 /*
  * ======= Private: =======
@@ -588,6 +667,11 @@ void DbgRenderSystem::ValidateBufferDesc(const BufferDescriptor& desc, std::uint
         break;
     }
 
+    if ((desc.flags & BufferFlags::Sparse) != 0)
+        AssertSparseBuffers();
+    if ((desc.flags & BufferFlags::RenderCondition) != 0)
+        AssertRenderConditionBuffers();
+
     if (formatSize)
         *formatSize = formatSizeTemp;
 }
@@ -624,6 +708,8 @@ void DbgRenderSystem::ValidateBufferBoundary(std::uint64_t bufferSize, std::uint
 
 void DbgRenderSystem::ValidateBufferCPUAccess(DbgBuffer& bufferDbg, const CPUAccess access)
 {
+    if ((bufferDbg.desc.flags & BufferFlags::Sparse) != 0)
+        LLGL_DBG_ERROR(ErrorType::InvalidState, "cannot map buffer that was created with 'LLGL::BufferFlags::Sparse' flag");
     if (access == CPUAccess::ReadOnly || access == CPUAccess::ReadWrite)
     {
         if ((bufferDbg.desc.flags & BufferFlags::MapReadAccess) == 0)
@@ -721,6 +807,16 @@ void DbgRenderSystem::ValidateTextureDesc(const TextureDescriptor& desc)
 
     ValidateTextureDescMipLevels(desc);
     ValidateArrayTextureLayers(desc.type, desc.arrayLayers);
+
+    if ((desc.flags & TextureFlags::MutableFormat) != 0 && IsDepthStencilFormat(desc.format))
+        LLGL_DBG_ERROR(ErrorType::InvalidArgument, "cannot create depth-stencil texture with 'LLGL::TextureFlags::MutableFormat' flag");
+
+    if ((desc.flags & TextureFlags::Sparse) != 0)
+    {
+        AssertSparseTextures();
+        if (IsMultiSampleTexture(desc.type))
+            LLGL_DBG_ERROR(ErrorType::InvalidArgument, "cannot create multi-sample texture with 'LLGL::TextureFlags::Sparse' flag");
+    }
 }
 
 void DbgRenderSystem::ValidateTextureDescMipLevels(const TextureDescriptor& desc)
@@ -924,6 +1020,54 @@ void DbgRenderSystem::ValidateTextureArrayRangeWithEnd(std::uint32_t baseArrayLa
     }
 }
 
+void DbgRenderSystem::ValidateTextureView(const DbgTexture& textureDbg, const TextureViewDescriptor& desc)
+{
+    AssertTextureViews();
+
+    const auto& swizzle = desc.swizzle;
+    if (swizzle.r != TextureSwizzle::Red || swizzle.g != TextureSwizzle::Green || swizzle.b != TextureSwizzle::Blue || swizzle.a != TextureSwizzle::Alpha)
+        AssertTextureViewSwizzle();
+
+    /* Validate subresource range (array layers of cube textures are counted per face) */
+    const auto& subresource = desc.subresource;
+
+    if (subresource.numMipLevels == 0 || subresource.numArrayLayers == 0)
+        LLGL_DBG_ERROR(ErrorType::InvalidArgument, "texture view with empty subresource range");
+
+    ValidateTextureMipRange(textureDbg, subresource.baseMipLevel, subresource.numMipLevels);
+    ValidateTextureArrayRangeWithEnd(subresource.baseArrayLayer, subresource.numArrayLayers, textureDbg.desc.arrayLayers);
+
+    if (IsCubeTexture(desc.type) && subresource.numArrayLayers % 6 != 0)
+        LLGL_DBG_ERROR(ErrorType::InvalidArgument, "number of array layers for cube texture view must be a multiple of 6");
+
+    /* Validate format compatibility */
+    if (FormatBitSize(desc.format) != FormatBitSize(textureDbg.desc.format))
+    {
+        LLGL_DBG_ERROR(
+            ErrorType::InvalidArgument,
+            "texture view format must have the same bit size as the texture format (" + std::to_string(FormatBitSize(desc.format)) +
+            " specified but texture format has " + std::to_string(FormatBitSize(textureDbg.desc.format)) + ")"
+        );
+    }
+
+    if (desc.format != textureDbg.desc.format && (textureDbg.desc.flags & TextureFlags::MutableFormat) == 0)
+        LLGL_DBG_ERROR(ErrorType::InvalidArgument, "texture view with different format requires texture with 'LLGL::TextureFlags::MutableFormat' flag");
+}
+
+void DbgRenderSystem::ValidatePipelineLayoutDesc(const PipelineLayoutDescriptor& desc)
+{
+    for (const auto& binding : desc.bindings)
+    {
+        if ((binding.flags & BindingFlags::DynamicOffset) != 0)
+        {
+            if (binding.type != ResourceType::ConstantBuffer)
+                LLGL_DBG_ERROR(ErrorType::InvalidArgument, "dynamic offsets are only allowed for bindings of type 'LLGL::ResourceType::ConstantBuffer'");
+            if (binding.arraySize != 1)
+                LLGL_DBG_ERROR(ErrorType::InvalidArgument, "dynamic offsets are only allowed for bindings with an array size of 1");
+        }
+    }
+}
+
 void DbgRenderSystem::ValidateGraphicsPipelineDesc(const GraphicsPipelineDescriptor& desc)
 {
     if (desc.rasterizer.conservativeRasterization && !features_.hasConservativeRasterization)
@@ -981,6 +1125,42 @@ void DbgRenderSystem::AssertMultiSampleTextures()
         LLGL_DBG_ERROR_NOT_SUPPORTED("multi-sample textures");
 }
 
+void DbgRenderSystem::AssertSparseBuffers()
+{
+    if (!features_.hasSparseBuffers)
+        LLGL_DBG_ERROR_NOT_SUPPORTED("sparse buffers");
+}
+
+void DbgRenderSystem::AssertSparseTextures()
+{
+    if (!features_.hasSparseTextures)
+        LLGL_DBG_ERROR_NOT_SUPPORTED("sparse textures");
+}
+
+void DbgRenderSystem::AssertTextureViews()
+{
+    if (!features_.hasTextureViews)
+        LLGL_DBG_ERROR_NOT_SUPPORTED("texture views");
+}
+
+void DbgRenderSystem::AssertTextureViewSwizzle()
+{
+    if (!features_.hasTextureViewSwizzle)
+        LLGL_DBG_ERROR_NOT_SUPPORTED("texture view swizzle");
+}
+
+void DbgRenderSystem::AssertRenderConditionBuffers()
+{
+    if (!features_.hasRenderConditionBuffers)
+        LLGL_DBG_ERROR_NOT_SUPPORTED("render condition buffers");
+}
+
+void DbgRenderSystem::AssertAsyncReadbacks()
+{
+    if (!features_.hasAsyncReadbacks)
+        LLGL_DBG_ERROR_NOT_SUPPORTED("asynchronous readbacks");
+}
+
 template <typename T, typename TBase>
 void DbgRenderSystem::ReleaseDbg(std::set<std::unique_ptr<T>>& cont, TBase& entry)
 {
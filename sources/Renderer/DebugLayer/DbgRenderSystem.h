@@ -17,6 +17,8 @@
 #include "DbgBuffer.h"
 #include "DbgBufferArray.h"
 #include "DbgGraphicsPipeline.h"
+#include "DbgPipelineLayout.h"
+#include "DbgResourceHeap.h"
 #include "DbgTexture.h"
 #include "DbgRenderTarget.h"
 #include "DbgShader.h"
@@ -90,6 +92,8 @@ class DbgRenderSystem : public RenderSystem
 
         void Release(Sampler& sampler) override;
 
+        SamplerCacheStatistics GetSamplerCacheStatistics() const override;
+
         /* ----- Resource Views ----- */
 
         ResourceHeap* CreateResourceHeap(const ResourceHeapDescriptor& desc) override;
@@ -131,6 +135,8 @@ class DbgRenderSystem : public RenderSystem
         void Release(GraphicsPipeline& graphicsPipeline) override;
         void Release(ComputePipeline& computePipeline) override;
 
+        PipelineCacheStatistics GetPipelineCacheStatistics() const override;
+
         /* ----- Queries ----- */
 
         Query* CreateQuery(const QueryDescriptor& desc) override;
@@ -143,6 +149,13 @@ class DbgRenderSystem : public RenderSystem
 
         void Release(Fence& fence) override;
 
+        /* ----- Asynchronous Readbacks ----- */
+
+        AsyncReadback* ReadTextureAsync(const Texture& texture, std::uint32_t mipLevel) override;
+        AsyncReadback* ReadBufferAsync(const Buffer& buffer, std::uint64_t offset, std::uint64_t size) override;
+
+        void Release(AsyncReadback& readback) override;
+
     private:
 
         void ValidateBufferDesc(const BufferDescriptor& desc, std::uint32_t* formatSize = nullptr);
@@ -167,6 +180,9 @@ class DbgRenderSystem : public RenderSystem
         void ValidateTextureMipRange(const DbgTexture& textureDbg, std::uint32_t baseMipLevel, std::uint32_t numMipLevels);
         void ValidateTextureArrayRange(const DbgTexture& textureDbg, std::uint32_t baseArrayLayer, std::uint32_t numArrayLayers);
         void ValidateTextureArrayRangeWithEnd(std::uint32_t baseArrayLayer, std::uint32_t numArrayLayers, std::uint32_t arrayLayerLimit);
+        void ValidateTextureView(const DbgTexture& textureDbg, const TextureViewDescriptor& desc);
+
+        void ValidatePipelineLayoutDesc(const PipelineLayoutDescriptor& desc);
 
         void ValidateGraphicsPipelineDesc(const GraphicsPipelineDescriptor& desc);
         void ValidatePrimitiveTopology(const PrimitiveTopology primitiveTopology);
@@ -176,6 +192,12 @@ class DbgRenderSystem : public RenderSystem
         void AssertArrayTextures();
         void AssertCubeArrayTextures();
         void AssertMultiSampleTextures();
+        void AssertSparseBuffers();
+        void AssertSparseTextures();
+        void AssertTextureViews();
+        void AssertTextureViewSwizzle();
+        void AssertRenderConditionBuffers();
+        void AssertAsyncReadbacks();
 
         template <typename T, typename TBase>
         void ReleaseDbg(std::set<std::unique_ptr<T>>& cont, TBase& entry);
@@ -199,10 +221,12 @@ class DbgRenderSystem : public RenderSystem
         HWObjectContainer<DbgBuffer>            buffers_;
         HWObjectContainer<DbgBufferArray>       bufferArrays_;
         HWObjectContainer<DbgTexture>           textures_;
+        HWObjectContainer<DbgResourceHeap>      resourceHeaps_;
         //HWObjectContainer<DbgRenderPass>        renderPasses_;
         HWObjectContainer<DbgRenderTarget>      renderTargets_;
         HWObjectContainer<DbgShader>            shaders_;
         HWObjectContainer<DbgShaderProgram>     shaderPrograms_;
+        HWObjectContainer<DbgPipelineLayout>    pipelineLayouts_;
         HWObjectContainer<DbgGraphicsPipeline>  graphicsPipelines_;
         //HWObjectContainer<DbgComputePipeline>   computePipelines_;
         //HWObjectContainer<DbgSampler>           samplers_;
@@ -0,0 +1,44 @@
+/*
+ * DbgResourceHeap.h
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_DBG_RESOURCE_HEAP_H
+#define LLGL_DBG_RESOURCE_HEAP_H
+
+
+#include <LLGL/ResourceHeap.h>
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+class DbgResourceHeap : public ResourceHeap
+{
+
+    public:
+
+        DbgResourceHeap(ResourceHeap& instance, std::uint32_t numDynamicOffsets) :
+            instance          { instance          },
+            numDynamicOffsets { numDynamicOffsets }
+        {
+        }
+
+        ResourceHeap&       instance;
+        const std::uint32_t numDynamicOffsets;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -25,6 +25,11 @@ Extent3D DbgTexture::QueryMipExtent(std::uint32_t mipLevel) const
     return instance.QueryMipExtent(mipLevel);
 }
 
+Extent3D DbgTexture::QuerySparseTileExtent() const
+{
+    return instance.QuerySparseTileExtent();
+}
+
 TextureDescriptor DbgTexture::QueryDesc() const
 {
     return instance.QueryDesc();
@@ -24,6 +24,7 @@ class DbgTexture : public Texture
         DbgTexture(Texture& instance, const TextureDescriptor& desc);
 
         Extent3D QueryMipExtent(std::uint32_t mipLevel) const override;
+        Extent3D QuerySparseTileExtent() const override;
 
         TextureDescriptor QueryDesc() const override;
 
@@ -9,9 +9,12 @@
 #include "D3D11RenderContext.h"
 #include "D3D11Types.h"
 #include "../CheckedCast.h"
+#include "../TextureUtils.h"
 #include <LLGL/Platform/NativeHandle.h>
 #include "../../Core/Helper.h"
 #include <algorithm>
+#include <vector>
+#include <stdexcept>
 
 #include "RenderState/D3D11StateManager.h"
 #include "RenderState/D3D11GraphicsPipelineBase.h"
@@ -48,6 +51,10 @@ D3D11CommandBuffer::D3D11CommandBuffer(D3D11StateManager& stateMngr, const ComPt
     stateMngr_ { stateMngr },
     context_   { context   }
 {
+    #if LLGL_D3D11_ENABLE_FEATURELEVEL >= 1
+    /* Query Direct3D 11.1 device context for constant buffer offsets (fails silently on Direct3D 11.0) */
+    context_->QueryInterface(IID_PPV_ARGS(context1_.ReleaseAndGetAddressOf()));
+    #endif
 }
 
 /* ----- Encoding ----- */
@@ -88,6 +95,78 @@ void D3D11CommandBuffer::CopyBuffer(Buffer& dstBuffer, std::uint64_t dstOffset,
     );
 }
 
+void D3D11CommandBuffer::FillBuffer(Buffer& dstBuffer, std::uint64_t dstOffset, std::uint32_t value, std::uint64_t fillSize)
+{
+    auto& dstBufferD3D = LLGL_CAST(D3D11Buffer&, dstBuffer);
+
+    /* D3D11 has no buffer fill command, so update the buffer region with an intermediate buffer */
+    std::vector<std::uint32_t> intermediateBuffer(static_cast<std::size_t>(fillSize / sizeof(value)), value);
+    dstBufferD3D.UpdateSubresource(context_.Get(), intermediateBuffer.data(), static_cast<UINT>(fillSize), static_cast<UINT>(dstOffset));
+}
+
+void D3D11CommandBuffer::CopyTexture(
+    Texture&                dstTexture,
+    const TextureLocation&  dstLocation,
+    Texture&                srcTexture,
+    const TextureRegion&    srcRegion)
+{
+    auto& dstTextureD3D = LLGL_CAST(D3D11Texture&, dstTexture);
+    auto& srcTextureD3D = LLGL_CAST(D3D11Texture&, srcTexture);
+
+    auto srcSubresource = MakeTextureSubresourceRegion(srcTexture.GetType(), srcRegion);
+    auto dstSubresource = MakeTextureSubresourceRegion(dstTexture.GetType(), dstLocation, srcSubresource);
+
+    const CD3D11_BOX srcBox(
+        srcSubresource.offset.x,
+        srcSubresource.offset.y,
+        srcSubresource.offset.z,
+        srcSubresource.offset.x + static_cast<LONG>(srcSubresource.extent.width),
+        srcSubresource.offset.y + static_cast<LONG>(srcSubresource.extent.height),
+        srcSubresource.offset.z + static_cast<LONG>(srcSubresource.extent.depth)
+    );
+
+    /* Copy each array layer separately, since D3D11 subresources only cover a single array layer */
+    for (std::uint32_t i = 0; i < srcSubresource.numArrayLayers; ++i)
+    {
+        auto dstIndex = D3D11CalcSubresource(dstSubresource.mipLevel, dstSubresource.baseArrayLayer + i, dstTextureD3D.GetNumMipLevels());
+        auto srcIndex = D3D11CalcSubresource(srcSubresource.mipLevel, srcSubresource.baseArrayLayer + i, srcTextureD3D.GetNumMipLevels());
+
+        context_->CopySubresourceRegion(
+            dstTextureD3D.GetNative().resource.Get(),   // pDstResource
+            dstIndex,                                   // DstSubresource
+            static_cast<UINT>(dstSubresource.offset.x), // DstX
+            static_cast<UINT>(dstSubresource.offset.y), // DstY
+            static_cast<UINT>(dstSubresource.offset.z), // DstZ
+            srcTextureD3D.GetNative().resource.Get(),   // pSrcResource
+            srcIndex,                                   // SrcSubresource
+            &srcBox                                     // pSrcBox
+        );
+    }
+}
+
+void D3D11CommandBuffer::BlitTexture(
+    Texture&                dstTexture,
+    const TextureRegion&    dstRegion,
+    Texture&                srcTexture,
+    const TextureRegion&    srcRegion,
+    const SamplerFilter     /*filter*/)
+{
+    /* D3D11 has no blit command, so only unscaled blits are supported, which are equivalent to a texture copy */
+    if (dstRegion.extent.width  != srcRegion.extent.width  ||
+        dstRegion.extent.height != srcRegion.extent.height ||
+        dstRegion.extent.depth  != srcRegion.extent.depth)
+    {
+        throw std::runtime_error("scaled texture blits are not supported by Direct3D 11 renderer");
+    }
+
+    TextureLocation dstLocation;
+    {
+        dstLocation.mipLevel    = dstRegion.mipLevel;
+        dstLocation.offset      = dstRegion.offset;
+    }
+    CopyTexture(dstTexture, dstLocation, srcTexture, srcRegion);
+}
+
 /* ----- Configuration ----- */
 
 void D3D11CommandBuffer::SetGraphicsAPIDependentState(const void* stateDesc, std::size_t stateDescSize)
@@ -315,16 +394,39 @@ void D3D11CommandBuffer::SetSampler(Sampler& sampler, std::uint32_t slot, long s
 
 /* ----- Resource Heaps ----- */
 
-void D3D11CommandBuffer::SetGraphicsResourceHeap(ResourceHeap& resourceHeap, std::uint32_t /*firstSet*/)
+void D3D11CommandBuffer::SetGraphicsResourceHeap(ResourceHeap& resourceHeap, std::uint32_t /*firstSet*/, std::uint32_t numDynamicOffsets, const std::uint32_t* dynamicOffsets)
 {
     auto& resourceHeapD3D = LLGL_CAST(D3D11ResourceHeap&, resourceHeap);
     resourceHeapD3D.BindForGraphicsPipeline(context_.Get());
+    SetDynamicConstantBuffers(resourceHeapD3D, numDynamicOffsets, dynamicOffsets, ~StageFlags::ComputeStage);
 }
 
-void D3D11CommandBuffer::SetComputeResourceHeap(ResourceHeap& resourceHeap, std::uint32_t /*firstSet*/)
+void D3D11CommandBuffer::SetComputeResourceHeap(ResourceHeap& resourceHeap, std::uint32_t /*firstSet*/, std::uint32_t numDynamicOffsets, const std::uint32_t* dynamicOffsets)
 {
     auto& resourceHeapD3D = LLGL_CAST(D3D11ResourceHeap&, resourceHeap);
     resourceHeapD3D.BindForComputePipeline(context_.Get());
+    SetDynamicConstantBuffers(resourceHeapD3D, numDynamicOffsets, dynamicOffsets, StageFlags::ComputeStage);
+}
+
+/* ----- Inline Constants ----- */
+
+void D3D11CommandBuffer::SetInlineConstants(long stageFlags, std::uint32_t offset, const void* data, std::uint32_t dataSize)
+{
+    if (boundPipelineLayout_ != nullptr)
+    {
+        const auto& ranges = boundPipelineLayout_->GetInlineConstants();
+        inlineConstants_.Update(
+            ranges,
+            stageFlags,
+            offset,
+            data,
+            dataSize,
+            [this, &ranges](const InlineConstantsDescriptor& range, const void* rangeData)
+            {
+                WriteInlineConstantsRange(static_cast<std::size_t>(&range - ranges.data()), range, rangeData);
+            }
+        );
+    }
 }
 
 /* ----- Render Passes ----- */
@@ -360,12 +462,14 @@ void D3D11CommandBuffer::SetGraphicsPipeline(GraphicsPipeline& graphicsPipeline)
 {
     auto& graphicsPipelineD3D = LLGL_CAST(D3D11GraphicsPipelineBase&, graphicsPipeline);
     graphicsPipelineD3D.Bind(stateMngr_);
+    boundPipelineLayout_ = graphicsPipelineD3D.GetPipelineLayout();
 }
 
 void D3D11CommandBuffer::SetComputePipeline(ComputePipeline& computePipeline)
 {
     auto& computePipelineD3D = LLGL_CAST(D3D11ComputePipeline&, computePipeline);
     computePipelineD3D.Bind(stateMngr_);
+    boundPipelineLayout_ = computePipelineD3D.GetPipelineLayout();
 }
 
 /* ----- Queries ----- */
@@ -515,12 +619,24 @@ bool D3D11CommandBuffer::QueryPipelineStatisticsResult(Query& query, QueryPipeli
     return false;
 }
 
+void D3D11CommandBuffer::CopyQueryResults(std::uint32_t /*numQueries*/, Query* const * /*queries*/, Buffer& /*dstBuffer*/, std::uint64_t /*dstOffset*/)
+{
+    /* D3D11 query results can only be read back by the CPU with ID3D11DeviceContext::GetData */
+    throw std::runtime_error("copying query results into buffers is not supported by Direct3D 11 renderer");
+}
+
 void D3D11CommandBuffer::BeginRenderCondition(Query& query, const RenderConditionMode mode)
 {
     auto& queryD3D = LLGL_CAST(D3D11Query&, query);
     context_->SetPredication(queryD3D.GetPredicate(), (mode >= RenderConditionMode::WaitInverted));
 }
 
+void D3D11CommandBuffer::BeginRenderCondition(Buffer& /*buffer*/, std::uint64_t /*offset*/, const RenderConditionMode /*mode*/)
+{
+    /* D3D11 predication only works with ID3D11Predicate objects */
+    throw std::runtime_error("render conditions from buffers are not supported by Direct3D 11 renderer");
+}
+
 void D3D11CommandBuffer::EndRenderCondition()
 {
     context_->SetPredication(nullptr, FALSE);
@@ -590,6 +706,82 @@ void D3D11CommandBuffer::SetConstantBuffersOnStages(UINT startSlot, UINT count,
     if (CS_STAGE(stageFlags)) { context_->CSSetConstantBuffers(startSlot, count, buffers); }
 }
 
+void D3D11CommandBuffer::SetDynamicConstantBuffers(
+    const D3D11ResourceHeap&    resourceHeapD3D,
+    std::uint32_t               numDynamicOffsets,
+    const std::uint32_t*        dynamicOffsets,
+    long                        stageFlags)
+{
+    const auto& dynamicConstantBuffers = resourceHeapD3D.GetDynamicConstantBuffers();
+
+    for (std::size_t i = 0; i < dynamicConstantBuffers.size(); ++i)
+    {
+        const auto& cbuffer = dynamicConstantBuffers[i];
+        const auto  stages  = (cbuffer.stageFlags & stageFlags);
+
+        if (stages == 0)
+            continue;
+
+        #if LLGL_D3D11_ENABLE_FEATURELEVEL >= 1
+        if (context1_ && cbuffer.numConstants > 0)
+        {
+            /* Bind constant buffer range at the dynamic offset (in units of 16-byte constants) */
+            UINT firstConstant  = (i < numDynamicOffsets ? dynamicOffsets[i] / 16 : 0u);
+            UINT numConstants   = cbuffer.numConstants;
+
+            if (VS_STAGE(stages)) { context1_->VSSetConstantBuffers1(cbuffer.slot, 1, &(cbuffer.buffer), &firstConstant, &numConstants); }
+            if (HS_STAGE(stages)) { context1_->HSSetConstantBuffers1(cbuffer.slot, 1, &(cbuffer.buffer), &firstConstant, &numConstants); }
+            if (DS_STAGE(stages)) { context1_->DSSetConstantBuffers1(cbuffer.slot, 1, &(cbuffer.buffer), &firstConstant, &numConstants); }
+            if (GS_STAGE(stages)) { context1_->GSSetConstantBuffers1(cbuffer.slot, 1, &(cbuffer.buffer), &firstConstant, &numConstants); }
+            if (PS_STAGE(stages)) { context1_->PSSetConstantBuffers1(cbuffer.slot, 1, &(cbuffer.buffer), &firstConstant, &numConstants); }
+            if (CS_STAGE(stages)) { context1_->CSSetConstantBuffers1(cbuffer.slot, 1, &(cbuffer.buffer), &firstConstant, &numConstants); }
+            continue;
+        }
+        #endif
+
+        /* Bind entire constant buffer, since offsets are not supported by this device context */
+        SetConstantBuffersOnStages(cbuffer.slot, 1, &(cbuffer.buffer), stages);
+    }
+}
+
+void D3D11CommandBuffer::WriteInlineConstantsRange(std::size_t rangeIndex, const InlineConstantsDescriptor& range, const void* rangeData)
+{
+    if (rangeIndex >= inlineConstantsBuffers_.size())
+        inlineConstantsBuffers_.resize(rangeIndex + 1);
+
+    auto& buffer = inlineConstantsBuffers_[rangeIndex];
+    if (!buffer)
+    {
+        /* Create dynamic constant buffer that is large enough for any range of inline constants */
+        ComPtr<ID3D11Device> device;
+        context_->GetDevice(device.ReleaseAndGetAddressOf());
+
+        D3D11_BUFFER_DESC desc;
+        {
+            desc.ByteWidth              = LLGL_MAX_INLINE_CONSTANTS_SIZE;
+            desc.Usage                  = D3D11_USAGE_DYNAMIC;
+            desc.BindFlags              = D3D11_BIND_CONSTANT_BUFFER;
+            desc.CPUAccessFlags         = D3D11_CPU_ACCESS_WRITE;
+            desc.MiscFlags              = 0;
+            desc.StructureByteStride    = 0;
+        }
+        auto hr = device->CreateBuffer(&desc, nullptr, buffer.ReleaseAndGetAddressOf());
+        DXThrowIfFailed(hr, "failed to create D3D11 constant buffer for inline constants");
+    }
+
+    /* Discard previous content and write entire range into constant buffer */
+    D3D11_MAPPED_SUBRESOURCE mappedSubresource;
+    if (SUCCEEDED(context_->Map(buffer.Get(), 0, D3D11_MAP_WRITE_DISCARD, 0, &mappedSubresource)))
+    {
+        ::memcpy(mappedSubresource.pData, rangeData, range.size);
+        context_->Unmap(buffer.Get(), 0);
+    }
+
+    /* Bind constant buffer to all shader stages of this range */
+    ID3D11Buffer* buffers[] = { buffer.Get() };
+    SetConstantBuffersOnStages(range.slot, 1, buffers, range.stageFlags);
+}
+
 void D3D11CommandBuffer::SetShaderResourcesOnStages(UINT startSlot, UINT count, ID3D11ShaderResourceView* const* views, long stageFlags)
 {
     if (VS_STAGE(stageFlags)) { context_->VSSetShaderResources(startSlot, count, views); }
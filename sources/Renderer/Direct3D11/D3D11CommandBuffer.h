@@ -13,9 +13,11 @@
 #include <cstddef>
 #include "../DXCommon/ComPtr.h"
 #include "../DXCommon/DXCore.h"
+#include "../InlineConstantsBlock.h"
+#include "RenderState/D3D11PipelineLayout.h"
 #include <vector>
-#include <d3d11.h>
 #include <dxgi.h>
+#include "Direct3D11.h"
 
 
 namespace LLGL
@@ -26,6 +28,7 @@ class D3D11StateManager;
 class D3D11RenderTarget;
 class D3D11RenderContext;
 class D3D11RenderPass;
+class D3D11ResourceHeap;
 
 class D3D11CommandBuffer final : public CommandBufferExt
 {
@@ -43,6 +46,22 @@ class D3D11CommandBuffer final : public CommandBufferExt
 
         void UpdateBuffer(Buffer& dstBuffer, std::uint64_t dstOffset, const void* data, std::uint16_t dataSize) override;
         void CopyBuffer(Buffer& dstBuffer, std::uint64_t dstOffset, Buffer& srcBuffer, std::uint64_t srcOffset, std::uint64_t size) override;
+        void FillBuffer(Buffer& dstBuffer, std::uint64_t dstOffset, std::uint32_t value, std::uint64_t fillSize) override;
+
+        void CopyTexture(
+            Texture&                dstTexture,
+            const TextureLocation&  dstLocation,
+            Texture&                srcTexture,
+            const TextureRegion&    srcRegion
+        ) override;
+
+        void BlitTexture(
+            Texture&                dstTexture,
+            const TextureRegion&    dstRegion,
+            Texture&                srcTexture,
+            const TextureRegion&    srcRegion,
+            const SamplerFilter     filter      = SamplerFilter::Linear
+        ) override;
 
         /* ----- Configuration ----- */
 
@@ -98,8 +117,12 @@ class D3D11CommandBuffer final : public CommandBufferExt
 
         /* ----- Resource Heaps ----- */
 
-        void SetGraphicsResourceHeap(ResourceHeap& resourceHeap, std::uint32_t firstSet = 0) override;
-        void SetComputeResourceHeap(ResourceHeap& resourceHeap, std::uint32_t firstSet = 0) override;
+        void SetGraphicsResourceHeap(ResourceHeap& resourceHeap, std::uint32_t firstSet = 0, std::uint32_t numDynamicOffsets = 0, const std::uint32_t* dynamicOffsets = nullptr) override;
+        void SetComputeResourceHeap(ResourceHeap& resourceHeap, std::uint32_t firstSet = 0, std::uint32_t numDynamicOffsets = 0, const std::uint32_t* dynamicOffsets = nullptr) override;
+
+        /* ----- Inline Constants ----- */
+
+        void SetInlineConstants(long stageFlags, std::uint32_t offset, const void* data, std::uint32_t dataSize) override;
 
         /* ----- Render Passes ----- */
 
@@ -125,7 +148,10 @@ class D3D11CommandBuffer final : public CommandBufferExt
         bool QueryResult(Query& query, std::uint64_t& result) override;
         bool QueryPipelineStatisticsResult(Query& query, QueryPipelineStatistics& result) override;
 
+        void CopyQueryResults(std::uint32_t numQueries, Query* const * queries, Buffer& dstBuffer, std::uint64_t dstOffset) override;
+
         void BeginRenderCondition(Query& query, const RenderConditionMode mode) override;
+        void BeginRenderCondition(Buffer& buffer, std::uint64_t offset, const RenderConditionMode mode) override;
         void EndRenderCondition() override;
 
         /* ----- Drawing ----- */
@@ -159,6 +185,17 @@ class D3D11CommandBuffer final : public CommandBufferExt
         void SetSamplersOnStages(UINT startSlot, UINT count, ID3D11SamplerState* const* samplers, long stageFlags);
         void SetUnorderedAccessViewsOnStages(UINT startSlot, UINT count, ID3D11UnorderedAccessView* const* views, const UINT* initialCounts, long stageFlags);
 
+        // Binds the constant buffers with dynamic offsets of the specified resource heap to the specified shader stages.
+        void SetDynamicConstantBuffers(
+            const D3D11ResourceHeap&    resourceHeapD3D,
+            std::uint32_t               numDynamicOffsets,
+            const std::uint32_t*        dynamicOffsets,
+            long                        stageFlags
+        );
+
+        // Writes the specified range of inline constants into its dynamic constant buffer and binds it to the respective shader stages.
+        void WriteInlineConstantsRange(std::size_t rangeIndex, const InlineConstantsDescriptor& range, const void* rangeData);
+
         void ResolveBoundRenderTarget();
         void BindFramebufferView();
         void BindRenderTarget(D3D11RenderTarget& renderTargetD3D);
@@ -179,14 +216,22 @@ class D3D11CommandBuffer final : public CommandBufferExt
             std::uint32_t&      idx
         );
 
-        D3D11StateManager&          stateMngr_;
+        D3D11StateManager&                  stateMngr_;
+
+        ComPtr<ID3D11DeviceContext>         context_;
+
+        #if LLGL_D3D11_ENABLE_FEATURELEVEL >= 1
+        ComPtr<ID3D11DeviceContext1>        context1_;                  // Only used for constant buffer offsets
+        #endif
 
-        ComPtr<ID3D11DeviceContext> context_;
+        D3D11FramebufferView                framebufferView_;
+        D3D11RenderTarget*                  boundRenderTarget_      = nullptr;
 
-        D3D11FramebufferView        framebufferView_;
-        D3D11RenderTarget*          boundRenderTarget_  = nullptr;
+        ClearValue                          clearValue_;
 
-        ClearValue                  clearValue_;
+        const D3D11PipelineLayout*          boundPipelineLayout_    = nullptr;
+        InlineConstantsBlock                inlineConstants_;
+        std::vector<ComPtr<ID3D11Buffer>>   inlineConstantsBuffers_;    // Dynamic constant buffer for each range of inline constants
 
 };
 
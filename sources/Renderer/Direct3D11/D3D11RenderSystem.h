@@ -36,6 +36,8 @@
 #include "Texture/D3D11RenderTarget.h"
 
 #include "../ContainerTypes.h"
+#include "../PipelineCache.h"
+#include "../SamplerCache.h"
 #include "../DXCommon/ComPtr.h"
 
 #include <dxgi.h>
@@ -104,6 +106,8 @@ class D3D11RenderSystem final : public RenderSystem
 
         void Release(Sampler& sampler) override;
 
+        SamplerCacheStatistics GetSamplerCacheStatistics() const override;
+
         /* ----- Resource Heaps ----- */
 
         ResourceHeap* CreateResourceHeap(const ResourceHeapDescriptor& desc) override;
@@ -144,6 +148,8 @@ class D3D11RenderSystem final : public RenderSystem
         void Release(GraphicsPipeline& graphicsPipeline) override;
         void Release(ComputePipeline& computePipeline) override;
 
+        PipelineCacheStatistics GetPipelineCacheStatistics() const override;
+
         /* ----- Queries ----- */
 
         Query* CreateQuery(const QueryDescriptor& desc) override;
@@ -156,6 +162,13 @@ class D3D11RenderSystem final : public RenderSystem
 
         void Release(Fence& fence) override;
 
+        /* ----- Asynchronous Readbacks ----- */
+
+        AsyncReadback* ReadTextureAsync(const Texture& texture, std::uint32_t mipLevel) override;
+        AsyncReadback* ReadBufferAsync(const Buffer& buffer, std::uint64_t offset, std::uint64_t size) override;
+
+        void Release(AsyncReadback& readback) override;
+
         /* ----- Extended internal functions ----- */
 
         // Returns the ID3D11Device object.
@@ -184,6 +197,9 @@ class D3D11RenderSystem final : public RenderSystem
         // Returns the minor version of Direct3D 11.X.
         int GetMinorVersion() const;
 
+        // Creates a new graphics pipeline for the highest available Direct3D 11.X device.
+        GraphicsPipeline* CreateGraphicsPipelineInternal(const GraphicsPipelineDescriptor& desc);
+
         void BuildGenericTexture1D(D3D11Texture& textureD3D, const TextureDescriptor& desc, const SrcImageDescriptor* imageDesc);
         void BuildGenericTexture2D(D3D11Texture& textureD3D, const TextureDescriptor& desc, const SrcImageDescriptor* imageDesc);
         void BuildGenericTexture3D(D3D11Texture& textureD3D, const TextureDescriptor& desc, const SrcImageDescriptor* imageDesc);
@@ -261,6 +277,7 @@ class D3D11RenderSystem final : public RenderSystem
         HWObjectContainer<D3D11BufferArray>             bufferArrays_;
         HWObjectContainer<D3D11Texture>                 textures_;
         HWObjectContainer<D3D11Sampler>                 samplers_;
+        SamplerCache                                    samplerCache_;
         HWObjectContainer<D3D11RenderPass>              renderPasses_;
         HWObjectContainer<D3D11RenderTarget>            renderTargets_;
         HWObjectContainer<D3D11Shader>                  shaders_;
@@ -268,6 +285,7 @@ class D3D11RenderSystem final : public RenderSystem
         HWObjectContainer<D3D11PipelineLayout>          pipelineLayouts_;
         HWObjectContainer<D3D11GraphicsPipelineBase>    graphicsPipelines_;
         HWObjectContainer<D3D11ComputePipeline>         computePipelines_;
+        PipelineCache                                   pipelineCache_;
         HWObjectContainer<D3D11ResourceHeap>            resourceHeaps_;
         HWObjectContainer<D3D11Query>                   queries_;
         HWObjectContainer<D3D11Fence>                   fences_;
@@ -9,6 +9,7 @@
 #include "D3D11Types.h"
 #include "../DXCommon/DXCore.h"
 #include "../CheckedCast.h"
+#include "../StaticLimits.h"
 #include "../../Core/Vendor.h"
 #include "../../Core/Helper.h"
 #include "../../Core/Assertion.h"
@@ -154,19 +155,31 @@ void D3D11RenderSystem::UnmapBuffer(Buffer& buffer)
 
 Sampler* D3D11RenderSystem::CreateSampler(const SamplerDescriptor& desc)
 {
-    return TakeOwnership(samplers_, MakeUnique<D3D11Sampler>(device_.Get(), desc));
+    return samplerCache_.GetOrCreate(
+        desc,
+        [&]()
+        {
+            return TakeOwnership(samplers_, MakeUnique<D3D11Sampler>(device_.Get(), desc));
+        }
+    );
 }
 
 void D3D11RenderSystem::Release(Sampler& sampler)
 {
-    RemoveFromUniqueSet(samplers_, &sampler);
+    if (samplerCache_.Release(sampler))
+        RemoveFromUniqueSet(samplers_, &sampler);
+}
+
+SamplerCacheStatistics D3D11RenderSystem::GetSamplerCacheStatistics() const
+{
+    return samplerCache_.GetStatistics();
 }
 
 /* ----- Resource Heaps ----- */
 
 ResourceHeap* D3D11RenderSystem::CreateResourceHeap(const ResourceHeapDescriptor& desc)
 {
-    return TakeOwnership(resourceHeaps_, MakeUnique<D3D11ResourceHeap>(desc));
+    return TakeOwnership(resourceHeaps_, MakeUnique<D3D11ResourceHeap>(device_.Get(), desc));
 }
 
 void D3D11RenderSystem::Release(ResourceHeap& resourceHeap)
@@ -183,6 +196,7 @@ RenderPass* D3D11RenderSystem::CreateRenderPass(const RenderPassDescriptor& desc
 
 void D3D11RenderSystem::Release(RenderPass& renderPass)
 {
+    pipelineCache_.Evict(renderPass);
     RemoveFromUniqueSet(renderPasses_, &renderPass);
 }
 
@@ -219,6 +233,7 @@ void D3D11RenderSystem::Release(Shader& shader)
 
 void D3D11RenderSystem::Release(ShaderProgram& shaderProgram)
 {
+    pipelineCache_.Evict(shaderProgram);
     RemoveFromUniqueSet(shaderPrograms_, &shaderProgram);
 }
 
@@ -231,12 +246,35 @@ PipelineLayout* D3D11RenderSystem::CreatePipelineLayout(const PipelineLayoutDesc
 
 void D3D11RenderSystem::Release(PipelineLayout& pipelineLayout)
 {
+    pipelineCache_.Evict(pipelineLayout);
     RemoveFromUniqueSet(pipelineLayouts_, &pipelineLayout);
 }
 
 /* ----- Pipeline States ----- */
 
 GraphicsPipeline* D3D11RenderSystem::CreateGraphicsPipeline(const GraphicsPipelineDescriptor& desc)
+{
+    return pipelineCache_.GetOrCreate(
+        desc,
+        [&]()
+        {
+            return CreateGraphicsPipelineInternal(desc);
+        }
+    );
+}
+
+ComputePipeline* D3D11RenderSystem::CreateComputePipeline(const ComputePipelineDescriptor& desc)
+{
+    return pipelineCache_.GetOrCreate(
+        desc,
+        [&]()
+        {
+            return TakeOwnership(computePipelines_, MakeUnique<D3D11ComputePipeline>(desc));
+        }
+    );
+}
+
+GraphicsPipeline* D3D11RenderSystem::CreateGraphicsPipelineInternal(const GraphicsPipelineDescriptor& desc)
 {
     #if LLGL_D3D11_ENABLE_FEATURELEVEL >= 3
     if (device3_)
@@ -266,19 +304,21 @@ GraphicsPipeline* D3D11RenderSystem::CreateGraphicsPipeline(const GraphicsPipeli
     return TakeOwnership(graphicsPipelines_, MakeUnique<D3D11GraphicsPipeline>(device_.Get(), desc));
 }
 
-ComputePipeline* D3D11RenderSystem::CreateComputePipeline(const ComputePipelineDescriptor& desc)
+void D3D11RenderSystem::Release(GraphicsPipeline& graphicsPipeline)
 {
-    return TakeOwnership(computePipelines_, MakeUnique<D3D11ComputePipeline>(desc));
+    if (pipelineCache_.Release(graphicsPipeline))
+        RemoveFromUniqueSet(graphicsPipelines_, &graphicsPipeline);
 }
 
-void D3D11RenderSystem::Release(GraphicsPipeline& graphicsPipeline)
+void D3D11RenderSystem::Release(ComputePipeline& computePipeline)
 {
-    RemoveFromUniqueSet(graphicsPipelines_, &graphicsPipeline);
+    if (pipelineCache_.Release(computePipeline))
+        RemoveFromUniqueSet(computePipelines_, &computePipeline);
 }
 
-void D3D11RenderSystem::Release(ComputePipeline& computePipeline)
+PipelineCacheStatistics D3D11RenderSystem::GetPipelineCacheStatistics() const
 {
-    RemoveFromUniqueSet(computePipelines_, &computePipeline);
+    return pipelineCache_.GetStatistics();
 }
 
 /* ----- Queries ----- */
@@ -305,6 +345,23 @@ void D3D11RenderSystem::Release(Fence& fence)
     RemoveFromUniqueSet(fences_, &fence);
 }
 
+/* ----- Asynchronous Readbacks ----- */
+
+AsyncReadback* D3D11RenderSystem::ReadTextureAsync(const Texture& texture, std::uint32_t mipLevel)
+{
+    throw std::runtime_error("asynchronous readbacks are not supported by Direct3D 11 renderer");
+}
+
+AsyncReadback* D3D11RenderSystem::ReadBufferAsync(const Buffer& buffer, std::uint64_t offset, std::uint64_t size)
+{
+    throw std::runtime_error("asynchronous readbacks are not supported by Direct3D 11 renderer");
+}
+
+void D3D11RenderSystem::Release(AsyncReadback& readback)
+{
+    throw std::runtime_error("asynchronous readbacks are not supported by Direct3D 11 renderer");
+}
+
 
 /*
  * ======= Private: =======
@@ -455,6 +512,8 @@ void D3D11RenderSystem::QueryRenderingCaps()
         caps.limits.maxViewportSize[1]              = D3D11_VIEWPORT_BOUNDS_MAX;
         caps.limits.maxBufferSize                   = std::numeric_limits<UINT>::max();
         caps.limits.maxConstantBufferSize           = D3D11_REQ_CONSTANT_BUFFER_ELEMENT_COUNT * 16;
+        caps.limits.minConstantBufferOffsetAlignment    = 256; // First constant for 'VSSetConstantBuffers1' must be a multiple of 16 constants
+        caps.limits.maxInlineConstantsSize          = LLGL_MAX_INLINE_CONSTANTS_SIZE;
     }
     SetRenderingCaps(caps);
 }
@@ -24,6 +24,9 @@ D3D11ComputePipeline::D3D11ComputePipeline(const ComputePipelineDescriptor& desc
         cs_ = shaderProgramD3D->GetCS()->GetNative().cs;
     else
         throw std::invalid_argument("failed to create compute pipeline due to missing compute shader program");
+
+    /* Store pipeline layout for inline constants */
+    pipelineLayout_ = LLGL_CAST(const D3D11PipelineLayout*, desc.pipelineLayout);
 }
 
 void D3D11ComputePipeline::Bind(D3D11StateManager& stateMngr)
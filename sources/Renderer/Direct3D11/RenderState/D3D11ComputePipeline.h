@@ -11,6 +11,7 @@
 
 #include <LLGL/ComputePipeline.h>
 #include "../../DXCommon/ComPtr.h"
+#include "D3D11PipelineLayout.h"
 #include <d3d11.h>
 
 
@@ -29,9 +30,16 @@ class D3D11ComputePipeline final : public ComputePipeline
 
         void Bind(D3D11StateManager& stateMngr);
 
+        // Returns the pipeline layout this compute pipeline was created with, or null if there is none.
+        inline const D3D11PipelineLayout* GetPipelineLayout() const
+        {
+            return pipelineLayout_;
+        }
+
     private:
 
         ComPtr<ID3D11ComputeShader> cs_;
+        const D3D11PipelineLayout*  pipelineLayout_ = nullptr;
 
 };
 
@@ -53,6 +53,9 @@ D3D11GraphicsPipelineBase::D3D11GraphicsPipelineBase(const GraphicsPipelineDescr
 
     inputLayout_ = shaderProgramD3D->GetInputLayout();
 
+    /* Store pipeline layout for inline constants */
+    pipelineLayout_ = LLGL_CAST(const D3D11PipelineLayout*, desc.pipelineLayout);
+
     /* Store dynamic pipeline states */
     primitiveTopology_  = D3D11Types::Map(desc.primitiveTopology);
     stencilRef_         = desc.stencil.front.reference;
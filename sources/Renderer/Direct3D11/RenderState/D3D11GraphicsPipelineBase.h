@@ -12,6 +12,7 @@
 #include <LLGL/GraphicsPipeline.h>
 #include <LLGL/ForwardDecls.h>
 #include "../../DXCommon/ComPtr.h"
+#include "D3D11PipelineLayout.h"
 #include <d3d11.h>
 #include <memory>
 
@@ -32,6 +33,12 @@ class D3D11GraphicsPipelineBase : public GraphicsPipeline
         // Binds the input layout, primitive topology, and all shader stages.
         virtual void Bind(D3D11StateManager& stateMngr);
 
+        // Returns the pipeline layout this graphics pipeline was created with, or null if there is none.
+        inline const D3D11PipelineLayout* GetPipelineLayout() const
+        {
+            return pipelineLayout_;
+        }
+
     protected:
 
         D3D11GraphicsPipelineBase(const GraphicsPipelineDescriptor& desc);
@@ -70,6 +77,8 @@ class D3D11GraphicsPipelineBase : public GraphicsPipeline
         void BuildStaticViewports(std::size_t numViewports, const Viewport* viewports, RawBufferIterator& rawBufferIter);
         void BuildStaticScissors(std::size_t numScissors, const Scissor* scissors, RawBufferIterator& rawBufferIter);
 
+        const D3D11PipelineLayout*      pipelineLayout_     = nullptr;
+
         ComPtr<ID3D11InputLayout>       inputLayout_;
 
         ComPtr<ID3D11VertexShader>      vs_;
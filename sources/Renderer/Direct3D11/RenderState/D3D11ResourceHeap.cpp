@@ -88,7 +88,7 @@ struct D3DResourceBinding
  * D3D11ResourceHeap class
  */
 
-D3D11ResourceHeap::D3D11ResourceHeap(const ResourceHeapDescriptor& desc)
+D3D11ResourceHeap::D3D11ResourceHeap(ID3D11Device* device, const ResourceHeapDescriptor& desc)
 {
     /* Initialize segmentation header */
     InitMemory(segmentationHeader_);
@@ -103,6 +103,9 @@ D3D11ResourceHeap::D3D11ResourceHeap(const ResourceHeapDescriptor& desc)
     if (desc.resourceViews.size() != bindings.size())
         throw std::invalid_argument("failed to create resource heap due to mismatch between number of resources and bindings");
 
+    /* Create SRVs for texture subresources before they are referenced by the segments */
+    CreateTextureViews(device, desc);
+
     /* Build buffer segments (stage after stage, so the internal buffer is constructed in the correct order) */
     ResourceBindingIterator resourceIterator { desc.resourceViews, bindings };
 
@@ -120,6 +123,7 @@ D3D11ResourceHeap::D3D11ResourceHeap(const ResourceHeapDescriptor& desc)
     BuildSegmentsForStage(resourceIterator, StageFlags::ComputeStage);
 
     StoreResourceUsage();
+    BuildDynamicConstantBuffers(resourceIterator);
 }
 
 void D3D11ResourceHeap::BindForGraphicsPipeline(ID3D11DeviceContext* context)
@@ -144,6 +148,20 @@ void D3D11ResourceHeap::BindForComputePipeline(ID3D11DeviceContext* context)
  * ======= Private: =======
  */
 
+void D3D11ResourceHeap::CreateTextureViews(ID3D11Device* device, const ResourceHeapDescriptor& desc)
+{
+    for (std::size_t i = 0, n = desc.resourceViews.size(); i < n; ++i)
+    {
+        const auto& rsvDesc = desc.resourceViews[i];
+        if (rsvDesc.textureView.format != Format::Undefined && rsvDesc.resource != nullptr && rsvDesc.resource->QueryResourceType() == ResourceType::Texture)
+        {
+            textureViews_.resize(n);
+            auto textureD3D = LLGL_CAST(D3D11Texture*, rsvDesc.resource);
+            textureD3D->CreateSubresourceSRV(device, textureViews_[i].GetAddressOf(), rsvDesc.textureView);
+        }
+    }
+}
+
 using D3DResourceBindingFunc = std::function<D3DResourceBinding(Resource* resource, std::uint32_t slot, long stageFlags)>;
 
 static std::vector<D3DResourceBinding> CollectD3DResourceBindings(
@@ -224,14 +242,19 @@ void D3D11ResourceHeap::BuildShaderResourceViewSegments(ResourceBindingIterator&
         resourceIterator,
         ResourceType::Texture,
         stage,
-        [](Resource* resource, std::uint32_t slot, long stageFlags) -> D3DResourceBinding
+        [this, &resourceIterator](Resource* resource, std::uint32_t slot, long stageFlags) -> D3DResourceBinding
         {
             auto textureD3D = LLGL_CAST(D3D11Texture*, resource);
+
+            /* Use SRV of texture subresource if the resource view has one, or the SRV of the entire texture otherwise */
+            auto index = resourceIterator.GetCurrentIndex();
+            auto srv = (index < textureViews_.size() && textureViews_[index] ? textureViews_[index].Get() : textureD3D->GetSRV());
+
             D3DResourceBinding resourceBinding;
             {
                 resourceBinding.slot    = slot;
                 resourceBinding.stages  = stageFlags;
-                resourceBinding.srv     = textureD3D->GetSRV();
+                resourceBinding.srv     = srv;
             }
             return resourceBinding;
         }
@@ -292,6 +315,27 @@ void D3D11ResourceHeap::BuildSamplerSegments(ResourceBindingIterator& resourceIt
     }
 }
 
+void D3D11ResourceHeap::BuildDynamicConstantBuffers(ResourceBindingIterator& resourceIterator)
+{
+    /* Collect all constant buffers with dynamic offsets in the order of their bindings */
+    BindingDescriptor bindingDesc;
+    ResourceViewDescriptor rsvDesc;
+    resourceIterator.Reset(ResourceType::ConstantBuffer, StageFlags::AllStages, true);
+
+    while (auto resource = resourceIterator.Next(bindingDesc, &rsvDesc))
+    {
+        auto bufferD3D = LLGL_CAST(D3D11Buffer*, resource);
+        D3D11DynamicConstantBuffer cbuffer;
+        {
+            cbuffer.buffer          = bufferD3D->GetNative();
+            cbuffer.slot            = bindingDesc.slot;
+            cbuffer.stageFlags      = bindingDesc.stageFlags;
+            cbuffer.numConstants    = static_cast<UINT>((rsvDesc.bufferRange + 15) / 16);
+        }
+        dynamicConstantBuffers_.push_back(cbuffer);
+    }
+}
+
 void D3D11ResourceHeap::BuildAllSegments(
     const std::vector<D3DResourceBinding>&  resourceBindings,
     const BuildSegmentFunc&                 buildSegmentFunc,
@@ -11,6 +11,7 @@
 
 #include <LLGL/ResourceHeap.h>
 #include <LLGL/ResourceFlags.h>
+#include "../../DXCommon/ComPtr.h"
 #include <vector>
 #include <functional>
 #include <d3d11.h>
@@ -23,6 +24,15 @@ namespace LLGL
 class ResourceBindingIterator;
 struct D3DResourceBinding;
 
+// Constant buffer that is bound with a dynamic offset.
+struct D3D11DynamicConstantBuffer
+{
+    ID3D11Buffer*   buffer;
+    UINT            slot;
+    long            stageFlags;
+    UINT            numConstants;   // Number of 16-byte constants that are visible to the shader
+};
+
 /*
 This class emulates the behavior of a descriptor heap like in D3D12,
 by binding all shader resources within one bind call in the command buffer.
@@ -32,21 +42,30 @@ class D3D11ResourceHeap final : public ResourceHeap
 
     public:
 
-        D3D11ResourceHeap(const ResourceHeapDescriptor& desc);
+        D3D11ResourceHeap(ID3D11Device* device, const ResourceHeapDescriptor& desc);
 
         void BindForGraphicsPipeline(ID3D11DeviceContext* context);
         void BindForComputePipeline(ID3D11DeviceContext* context);
 
+        // Returns the list of constant buffers with dynamic offsets, in the order of their bindings.
+        inline const std::vector<D3D11DynamicConstantBuffer>& GetDynamicConstantBuffers() const
+        {
+            return dynamicConstantBuffers_;
+        }
+
     private:
 
         using D3DResourceBindingIter = std::vector<D3DResourceBinding>::const_iterator;
         using BuildSegmentFunc = std::function<void(D3DResourceBindingIter begin, UINT count)>;
 
+        void CreateTextureViews(ID3D11Device* device, const ResourceHeapDescriptor& desc);
+
         void BuildSegmentsForStage(ResourceBindingIterator& resourceIterator, long stage);
         void BuildConstantBufferSegments(ResourceBindingIterator& resourceIterator, long stage);
         void BuildShaderResourceViewSegments(ResourceBindingIterator& resourceIterator, long stage);
         void BuildUnorderedAccessViewSegments(ResourceBindingIterator& resourceIterator, long stage);
         void BuildSamplerSegments(ResourceBindingIterator& resourceIterator, long stage);
+        void BuildDynamicConstantBuffers(ResourceBindingIterator& resourceIterator);
 
         void BuildAllSegments(
             const std::vector<D3DResourceBinding>&  resourceBindings,
@@ -115,9 +134,13 @@ class D3D11ResourceHeap final : public ResourceHeap
             std::uint8_t numCSShaderResourceViewSegments;
         };
 
-        SegmentationHeader          segmentationHeader_;
-        std::uint16_t               bufferOffsetCS_         = 0;
-        std::vector<std::int8_t>    buffer_;
+        SegmentationHeader                      segmentationHeader_;
+        std::uint16_t                           bufferOffsetCS_         = 0;
+        std::vector<std::int8_t>                buffer_;
+        std::vector<D3D11DynamicConstantBuffer> dynamicConstantBuffers_;
+
+        // SRVs of texture subresources, indexed by resource view (null for resource views without texture view).
+        std::vector<ComPtr<ID3D11ShaderResourceView>> textureViews_;
 
 };
 
@@ -364,6 +364,67 @@ void D3D11Texture::CreateSubresourceCopyWithCPUAccess(
     );
 }
 
+// Initializes the subresource range of the specified SRV descriptor for its view dimension.
+static void InitD3D11SubresourceSRVDesc(
+    D3D11_SHADER_RESOURCE_VIEW_DESC&    srvDesc,
+    UINT                                baseMipLevel,
+    UINT                                numMipLevels,
+    UINT                                baseArrayLayer,
+    UINT                                numArrayLayers)
+{
+    switch (srvDesc.ViewDimension)
+    {
+        case D3D11_SRV_DIMENSION_TEXTURE1D:
+            srvDesc.Texture1D.MostDetailedMip           = baseMipLevel;
+            srvDesc.Texture1D.MipLevels                 = numMipLevels;
+            break;
+
+        case D3D11_SRV_DIMENSION_TEXTURE2D:
+            srvDesc.Texture2D.MostDetailedMip           = baseMipLevel;
+            srvDesc.Texture2D.MipLevels                 = numMipLevels;
+            break;
+
+        case D3D11_SRV_DIMENSION_TEXTURE3D:
+            srvDesc.Texture3D.MostDetailedMip           = baseMipLevel;
+            srvDesc.Texture3D.MipLevels                 = numMipLevels;
+            break;
+
+        case D3D11_SRV_DIMENSION_TEXTURECUBE:
+            srvDesc.TextureCube.MostDetailedMip         = baseMipLevel;
+            srvDesc.TextureCube.MipLevels               = numMipLevels;
+            break;
+
+        case D3D11_SRV_DIMENSION_TEXTURE1DARRAY:
+            srvDesc.Texture1DArray.MostDetailedMip      = baseMipLevel;
+            srvDesc.Texture1DArray.MipLevels            = numMipLevels;
+            srvDesc.Texture1DArray.FirstArraySlice      = baseArrayLayer;
+            srvDesc.Texture1DArray.ArraySize            = numArrayLayers;
+            break;
+
+        case D3D11_SRV_DIMENSION_TEXTURE2DARRAY:
+            srvDesc.Texture2DArray.MostDetailedMip      = baseMipLevel;
+            srvDesc.Texture2DArray.MipLevels            = numMipLevels;
+            srvDesc.Texture2DArray.FirstArraySlice      = baseArrayLayer;
+            srvDesc.Texture2DArray.ArraySize            = numArrayLayers;
+            break;
+
+        case D3D11_SRV_DIMENSION_TEXTURECUBEARRAY:
+            srvDesc.TextureCubeArray.MostDetailedMip    = baseMipLevel;
+            srvDesc.TextureCubeArray.MipLevels          = numMipLevels;
+            srvDesc.TextureCubeArray.First2DArrayFace   = baseArrayLayer;
+            srvDesc.TextureCubeArray.NumCubes           = numArrayLayers;
+            break;
+
+        case D3D11_SRV_DIMENSION_TEXTURE2DMS:
+            break;
+
+        case D3D11_SRV_DIMENSION_TEXTURE2DMSARRAY:
+            srvDesc.Texture2DMSArray.FirstArraySlice    = baseArrayLayer;
+            srvDesc.Texture2DMSArray.ArraySize          = numArrayLayers;
+            break;
+    }
+}
+
 void D3D11Texture::CreateSubresourceSRV(
     ID3D11Device*               device,
     ID3D11ShaderResourceView**  srvOutput,
@@ -377,63 +438,43 @@ void D3D11Texture::CreateSubresourceSRV(
     {
         srvDesc.Format          = format_;
         srvDesc.ViewDimension   = D3D11Types::Map(GetType());
-
-        switch (srvDesc.ViewDimension)
-        {
-            case D3D11_SRV_DIMENSION_TEXTURE1D:
-                srvDesc.Texture1D.MostDetailedMip           = baseMipLevel;
-                srvDesc.Texture1D.MipLevels                 = numMipLevels;
-                break;
-
-            case D3D11_SRV_DIMENSION_TEXTURE2D:
-                srvDesc.Texture2D.MostDetailedMip           = baseMipLevel;
-                srvDesc.Texture2D.MipLevels                 = numMipLevels;
-                break;
-
-            case D3D11_SRV_DIMENSION_TEXTURE3D:
-                srvDesc.Texture3D.MostDetailedMip           = baseMipLevel;
-                srvDesc.Texture3D.MipLevels                 = numMipLevels;
-                break;
-
-            case D3D11_SRV_DIMENSION_TEXTURECUBE:
-                srvDesc.TextureCube.MostDetailedMip         = baseMipLevel;
-                srvDesc.TextureCube.MipLevels               = numMipLevels;
-                break;
-
-            case D3D11_SRV_DIMENSION_TEXTURE1DARRAY:
-                srvDesc.Texture1DArray.MostDetailedMip      = baseMipLevel;
-                srvDesc.Texture1DArray.MipLevels            = numMipLevels;
-                srvDesc.Texture1DArray.FirstArraySlice      = baseArrayLayer;
-                srvDesc.Texture1DArray.ArraySize            = numArrayLayers;
-                break;
-
-            case D3D11_SRV_DIMENSION_TEXTURE2DARRAY:
-                srvDesc.Texture2DArray.MostDetailedMip      = baseMipLevel;
-                srvDesc.Texture2DArray.MipLevels            = numMipLevels;
-                srvDesc.Texture2DArray.FirstArraySlice      = baseArrayLayer;
-                srvDesc.Texture2DArray.ArraySize            = numArrayLayers;
-                break;
-
-            case D3D11_SRV_DIMENSION_TEXTURECUBEARRAY:
-                srvDesc.TextureCubeArray.MostDetailedMip    = baseMipLevel;
-                srvDesc.TextureCubeArray.MipLevels          = numMipLevels;
-                srvDesc.TextureCubeArray.First2DArrayFace   = baseArrayLayer;
-                srvDesc.TextureCubeArray.NumCubes           = numArrayLayers;
-                break;
-
-            case D3D11_SRV_DIMENSION_TEXTURE2DMS:
-                break;
-
-            case D3D11_SRV_DIMENSION_TEXTURE2DMSARRAY:
-                srvDesc.Texture2DMSArray.FirstArraySlice    = baseArrayLayer;
-                srvDesc.Texture2DMSArray.ArraySize          = numArrayLayers;
-                break;
-        }
+        InitD3D11SubresourceSRVDesc(srvDesc, baseMipLevel, numMipLevels, baseArrayLayer, numArrayLayers);
     }
     auto hr = device->CreateShaderResourceView(native_.resource.Get(), &srvDesc, srvOutput);
     DXThrowIfFailed(hr, "failed to create D3D11 shader-resouce-view (SRV) for texture subresource");
 }
 
+void D3D11Texture::CreateSubresourceSRV(
+    ID3D11Device*                   device,
+    ID3D11ShaderResourceView**      srvOutput,
+    const TextureViewDescriptor&    textureViewDesc)
+{
+    const auto& subresource = textureViewDesc.subresource;
+
+    auto type           = textureViewDesc.type;
+    auto numArrayLayers = subresource.numArrayLayers;
+
+    if (IsCubeTexture(type))
+    {
+        /* Cube views that do not start at the first face can only be described as cube array */
+        if (type == TextureType::TextureCube && subresource.baseArrayLayer > 0)
+            type = TextureType::TextureCubeArray;
+
+        /* Array size of cube array views is specified in number of cubes, not faces */
+        numArrayLayers /= 6;
+    }
+
+    /* Create SRV for subresource with the format of the texture view */
+    D3D11_SHADER_RESOURCE_VIEW_DESC srvDesc;
+    {
+        srvDesc.Format          = D3D11Types::Map(textureViewDesc.format);
+        srvDesc.ViewDimension   = D3D11Types::Map(type);
+        InitD3D11SubresourceSRVDesc(srvDesc, subresource.baseMipLevel, subresource.numMipLevels, subresource.baseArrayLayer, numArrayLayers);
+    }
+    auto hr = device->CreateShaderResourceView(native_.resource.Get(), &srvDesc, srvOutput);
+    DXThrowIfFailed(hr, "failed to create D3D11 shader-resouce-view (SRV) for texture view");
+}
+
 
 /*
  * ====== Private: ======
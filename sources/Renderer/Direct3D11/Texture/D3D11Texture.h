@@ -101,6 +101,13 @@ class D3D11Texture final : public Texture
             UINT                        numArrayLayers
         );
 
+        // Creates a shader-resource-view (SRV) for the subresource and format of the specified texture view.
+        void CreateSubresourceSRV(
+            ID3D11Device*                   device,
+            ID3D11ShaderResourceView**      srvOutput,
+            const TextureViewDescriptor&    textureViewDesc
+        );
+
         /* ----- Hardware texture objects ----- */
 
         // Returns the native D3D texture object.
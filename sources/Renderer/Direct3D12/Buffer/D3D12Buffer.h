@@ -47,6 +47,12 @@ class D3D12Buffer : public Buffer
             return bufferSize_;
         }
 
+        //! Returns the resource state the buffer is in outside of command buffers that transition it temporarily.
+        inline D3D12_RESOURCE_STATES GetResourceState() const
+        {
+            return resourceState_;
+        }
+
     protected:
 
         D3D12Buffer(const BufferType type);
@@ -57,7 +63,8 @@ class D3D12Buffer : public Buffer
     private:
 
         ComPtr<ID3D12Resource>  resource_;
-        UINT64                  bufferSize_ = 0;
+        UINT64                  bufferSize_     = 0;
+        D3D12_RESOURCE_STATES   resourceState_  = D3D12_RESOURCE_STATE_COMMON;
 
 };
 
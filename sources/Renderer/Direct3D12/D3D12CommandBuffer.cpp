@@ -10,8 +10,11 @@
 #include "D3D12RenderSystem.h"
 #include "D3D12Types.h"
 #include "../CheckedCast.h"
+#include "../TextureUtils.h"
 #include "../../Core/Helper.h"
 #include <algorithm>
+#include <vector>
+#include <stdexcept>
 #include "D3DX12/d3dx12.h"
 
 #include "Buffer/D3D12VertexBuffer.h"
@@ -68,6 +71,152 @@ void D3D12CommandBuffer::CopyBuffer(Buffer& dstBuffer, std::uint64_t dstOffset,
     commandList_->CopyBufferRegion(dstBufferD3D.GetNative(), dstOffset, srcBufferD3D.GetNative(), srcOffset, size);
 }
 
+void D3D12CommandBuffer::FillBuffer(Buffer& dstBuffer, std::uint64_t dstOffset, std::uint32_t value, std::uint64_t fillSize)
+{
+    auto& dstBufferD3D = LLGL_CAST(D3D12Buffer&, dstBuffer);
+    const auto numValues = static_cast<std::size_t>(fillSize / sizeof(value));
+
+    /* Buffers in the upload heap can not be written by the GPU, so they can only be filled by the CPU */
+    if (dstBufferD3D.GetResourceState() == D3D12_RESOURCE_STATE_GENERIC_READ)
+    {
+        std::vector<std::uint32_t> intermediateBuffer(numValues, value);
+        dstBufferD3D.UpdateDynamicSubresource(intermediateBuffer.data(), static_cast<UINT64>(fillSize), dstOffset);
+        return;
+    }
+
+    /* D3D12 has no buffer fill command, so copy the fill pattern from an intermediate upload buffer */
+    ComPtr<ID3D12Resource> uploadBuffer;
+
+    CD3DX12_HEAP_PROPERTIES heapProperties(D3D12_HEAP_TYPE_UPLOAD);
+    auto bufferDesc = CD3DX12_RESOURCE_DESC::Buffer(fillSize);
+
+    auto hr = device_->CreateCommittedResource(
+        &heapProperties,
+        D3D12_HEAP_FLAG_NONE,
+        &bufferDesc,
+        D3D12_RESOURCE_STATE_GENERIC_READ,
+        nullptr,
+        IID_PPV_ARGS(uploadBuffer.ReleaseAndGetAddressOf())
+    );
+    DXThrowIfFailed(hr, "failed to create D3D12 committed resource for intermediate fill buffer");
+
+    void* mappedData = nullptr;
+    hr = uploadBuffer->Map(0, nullptr, &mappedData);
+    DXThrowIfFailed(hr, "failed to map D3D12 intermediate fill buffer");
+    {
+        auto values = reinterpret_cast<std::uint32_t*>(mappedData);
+        std::fill(values, values + numValues, value);
+    }
+    uploadBuffer->Unmap(0, nullptr);
+
+    /* Encode copy command between transitions from and back to the tracked buffer state */
+    const auto dstState = dstBufferD3D.GetResourceState();
+
+    if (dstState != D3D12_RESOURCE_STATE_COPY_DEST)
+        TransitionResource(dstBufferD3D.GetNative(), dstState, D3D12_RESOURCE_STATE_COPY_DEST);
+
+    commandList_->CopyBufferRegion(dstBufferD3D.GetNative(), dstOffset, uploadBuffer.Get(), 0, fillSize);
+
+    if (dstState != D3D12_RESOURCE_STATE_COPY_DEST)
+        TransitionResource(dstBufferD3D.GetNative(), D3D12_RESOURCE_STATE_COPY_DEST, dstState);
+
+    /* Keep upload buffer alive until the command allocator is reset */
+    intermediateBuffers_[currentCmdAllocator_].push_back(std::move(uploadBuffer));
+}
+
+void D3D12CommandBuffer::CopyTexture(
+    Texture&                dstTexture,
+    const TextureLocation&  dstLocation,
+    Texture&                srcTexture,
+    const TextureRegion&    srcRegion)
+{
+    auto& dstTextureD3D = LLGL_CAST(D3D12Texture&, dstTexture);
+    auto& srcTextureD3D = LLGL_CAST(D3D12Texture&, srcTexture);
+
+    auto srcSubresource = MakeTextureSubresourceRegion(srcTexture.GetType(), srcRegion);
+    auto dstSubresource = MakeTextureSubresourceRegion(dstTexture.GetType(), dstLocation, srcSubresource);
+
+    const D3D12_BOX srcBox
+    {
+        static_cast<UINT>(srcSubresource.offset.x),
+        static_cast<UINT>(srcSubresource.offset.y),
+        static_cast<UINT>(srcSubresource.offset.z),
+        static_cast<UINT>(srcSubresource.offset.x) + srcSubresource.extent.width,
+        static_cast<UINT>(srcSubresource.offset.y) + srcSubresource.extent.height,
+        static_cast<UINT>(srcSubresource.offset.z) + srcSubresource.extent.depth
+    };
+
+    /* Copy each array layer separately, since D3D12 subresources only cover a single array layer */
+    for (std::uint32_t i = 0; i < srcSubresource.numArrayLayers; ++i)
+    {
+        auto dstIndex = D3D12CalcSubresource(dstSubresource.mipLevel, dstSubresource.baseArrayLayer + i, 0, dstTextureD3D.GetNumMipLevels(), dstTextureD3D.GetNumArrayLayers());
+        auto srcIndex = D3D12CalcSubresource(srcSubresource.mipLevel, srcSubresource.baseArrayLayer + i, 0, srcTextureD3D.GetNumMipLevels(), srcTextureD3D.GetNumArrayLayers());
+
+        /* Transition subresources from their tracked states to copy states (textures without initial data are still in copy-destination state) */
+        const auto srcState = srcTextureD3D.GetResourceState();
+        const auto dstState = dstTextureD3D.GetResourceState();
+
+        D3D12_RESOURCE_BARRIER barriersBefore[2];
+        UINT numBarriers = 0;
+
+        if (srcState != D3D12_RESOURCE_STATE_COPY_SOURCE)
+            barriersBefore[numBarriers++] = CD3DX12_RESOURCE_BARRIER::Transition(srcTextureD3D.GetNative(), srcState, D3D12_RESOURCE_STATE_COPY_SOURCE, srcIndex);
+        if (dstState != D3D12_RESOURCE_STATE_COPY_DEST)
+            barriersBefore[numBarriers++] = CD3DX12_RESOURCE_BARRIER::Transition(dstTextureD3D.GetNative(), dstState, D3D12_RESOURCE_STATE_COPY_DEST, dstIndex);
+
+        if (numBarriers > 0)
+            commandList_->ResourceBarrier(numBarriers, barriersBefore);
+
+        /* Copy texture subresource region */
+        const CD3DX12_TEXTURE_COPY_LOCATION dstCopyLocation(dstTextureD3D.GetNative(), dstIndex);
+        const CD3DX12_TEXTURE_COPY_LOCATION srcCopyLocation(srcTextureD3D.GetNative(), srcIndex);
+
+        commandList_->CopyTextureRegion(
+            &dstCopyLocation,
+            static_cast<UINT>(dstSubresource.offset.x),
+            static_cast<UINT>(dstSubresource.offset.y),
+            static_cast<UINT>(dstSubresource.offset.z),
+            &srcCopyLocation,
+            &srcBox
+        );
+
+        /* Transition subresources back to their tracked states */
+        D3D12_RESOURCE_BARRIER barriersAfter[2];
+        numBarriers = 0;
+
+        if (dstState != D3D12_RESOURCE_STATE_COPY_DEST)
+            barriersAfter[numBarriers++] = CD3DX12_RESOURCE_BARRIER::Transition(dstTextureD3D.GetNative(), D3D12_RESOURCE_STATE_COPY_DEST, dstState, dstIndex);
+        if (srcState != D3D12_RESOURCE_STATE_COPY_SOURCE)
+            barriersAfter[numBarriers++] = CD3DX12_RESOURCE_BARRIER::Transition(srcTextureD3D.GetNative(), D3D12_RESOURCE_STATE_COPY_SOURCE, srcState, srcIndex);
+
+        if (numBarriers > 0)
+            commandList_->ResourceBarrier(numBarriers, barriersAfter);
+    }
+}
+
+void D3D12CommandBuffer::BlitTexture(
+    Texture&                dstTexture,
+    const TextureRegion&    dstRegion,
+    Texture&                srcTexture,
+    const TextureRegion&    srcRegion,
+    const SamplerFilter     /*filter*/)
+{
+    /* D3D12 has no blit command, so only unscaled blits are supported, which are equivalent to a texture copy */
+    if (dstRegion.extent.width  != srcRegion.extent.width  ||
+        dstRegion.extent.height != srcRegion.extent.height ||
+        dstRegion.extent.depth  != srcRegion.extent.depth)
+    {
+        throw std::runtime_error("scaled texture blits are not supported by Direct3D 12 renderer");
+    }
+
+    TextureLocation dstLocation;
+    {
+        dstLocation.mipLevel    = dstRegion.mipLevel;
+        dstLocation.offset      = dstRegion.offset;
+    }
+    CopyTexture(dstTexture, dstLocation, srcTexture, srcRegion);
+}
+
 /* ----- Configuration ----- */
 
 void D3D12CommandBuffer::SetGraphicsAPIDependentState(const void* stateDesc, std::size_t stateDescSize)
@@ -259,7 +408,7 @@ void D3D12CommandBuffer::EndStreamOutput()
 
 /* ----- Resource Heaps ----- */
 
-void D3D12CommandBuffer::SetGraphicsResourceHeap(ResourceHeap& resourceHeap, std::uint32_t firstSet)
+void D3D12CommandBuffer::SetGraphicsResourceHeap(ResourceHeap& resourceHeap, std::uint32_t firstSet, std::uint32_t numDynamicOffsets, const std::uint32_t* dynamicOffsets)
 {
     /* Get descriptor heaps */
     auto& resourceHeapD3D = LLGL_CAST(D3D12ResourceHeap&, resourceHeap);
@@ -276,13 +425,55 @@ void D3D12CommandBuffer::SetGraphicsResourceHeap(ResourceHeap& resourceHeap, std
         for (UINT i = 0; i < heapCount; ++i)
             commandList_->SetGraphicsRootDescriptorTable(i, descHeaps[i]->GetGPUDescriptorHandleForHeapStart());
     }
+
+    /* Bind root CBVs at the dynamic offsets */
+    auto rootParamIndex = resourceHeapD3D.GetDynamicRootParamIndex();
+    const auto& dynamicConstantBuffers = resourceHeapD3D.GetDynamicConstantBuffers();
+
+    for (std::size_t i = 0; i < dynamicConstantBuffers.size(); ++i, ++rootParamIndex)
+    {
+        auto offset = (i < numDynamicOffsets ? dynamicOffsets[i] : 0u);
+        commandList_->SetGraphicsRootConstantBufferView(rootParamIndex, dynamicConstantBuffers[i] + offset);
+    }
 }
 
-void D3D12CommandBuffer::SetComputeResourceHeap(ResourceHeap& resourceHeap, std::uint32_t firstSet)
+void D3D12CommandBuffer::SetComputeResourceHeap(ResourceHeap& resourceHeap, std::uint32_t firstSet, std::uint32_t numDynamicOffsets, const std::uint32_t* dynamicOffsets)
 {
     //todo...
 }
 
+/* ----- Inline Constants ----- */
+
+void D3D12CommandBuffer::SetInlineConstants(long stageFlags, std::uint32_t offset, const void* data, std::uint32_t dataSize)
+{
+    if (!boundPipelineLayout_)
+        return;
+
+    auto rootParamIndex = boundPipelineLayout_->GetInlineConstantsRootParamIndex();
+    auto byteData       = reinterpret_cast<const std::uint8_t*>(data);
+
+    for (const auto& range : boundPipelineLayout_->GetInlineConstants())
+    {
+        /* Clip data to range of root constants that is affected by the specified shader stages */
+        auto first = std::max(offset, range.offset);
+        auto last  = std::min(offset + dataSize, range.offset + range.size);
+
+        if ((range.stageFlags & stageFlags) != 0 && first < last)
+        {
+            auto num32BitValues     = static_cast<UINT>((last - first) / 4);
+            auto destOffsetIn32Bit  = static_cast<UINT>((first - range.offset) / 4);
+            auto srcData            = byteData + (first - offset);
+
+            if ((range.stageFlags & StageFlags::ComputeStage) != 0)
+                commandList_->SetComputeRoot32BitConstants(rootParamIndex, num32BitValues, srcData, destOffsetIn32Bit);
+            else
+                commandList_->SetGraphicsRoot32BitConstants(rootParamIndex, num32BitValues, srcData, destOffsetIn32Bit);
+        }
+
+        ++rootParamIndex;
+    }
+}
+
 /* ----- Render Passes ----- */
 
 void D3D12CommandBuffer::BeginRenderPass(
@@ -328,6 +519,7 @@ void D3D12CommandBuffer::SetGraphicsPipeline(GraphicsPipeline& graphicsPipeline)
     /* Set graphics root signature, graphics pipeline state, and primitive topology */
     auto& graphicsPipelineD3D = LLGL_CAST(D3D12GraphicsPipeline&, graphicsPipeline);
     graphicsPipelineD3D.Bind(commandList_.Get());
+    boundPipelineLayout_ = graphicsPipelineD3D.GetPipelineLayout();
 
     /* Scissor rectangle must be updated (if scissor test is disabled) */
     scissorEnabled_ = graphicsPipelineD3D.IsScissorEnabled();
@@ -362,17 +554,44 @@ bool D3D12CommandBuffer::QueryPipelineStatisticsResult(Query& query, QueryPipeli
     return false; //todo
 }
 
+void D3D12CommandBuffer::CopyQueryResults(std::uint32_t /*numQueries*/, Query* const * /*queries*/, Buffer& /*dstBuffer*/, std::uint64_t /*dstOffset*/)
+{
+    /* Resolving query data requires query heaps, which are not implemented by this renderer yet */
+    throw std::runtime_error("copying query results into buffers is not supported by Direct3D 12 renderer");
+}
+
 void D3D12CommandBuffer::BeginRenderCondition(Query& query, const RenderConditionMode mode)
 {
-    //auto predicateOp = (mode >= RenderConditionMode::WaitInverted ? D3D12_PREDICATION_OP_EQUAL_NOT_ZERO : D3D12_PREDICATION_OP_EQUAL_ZERO);
-    //commandList_->SetPredication(nullptr, offset, predicateOp);
-    //todo...
+    //todo: requires query heaps (ResolveQueryData into a predication buffer)
+}
+
+void D3D12CommandBuffer::BeginRenderCondition(Buffer& buffer, std::uint64_t offset, const RenderConditionMode mode)
+{
+    auto& bufferD3D = LLGL_CAST(D3D12Buffer&, buffer);
+
+    /* Commands are discarded if the predicate is zero (EQUAL_ZERO) or non-zero for inverted conditions (NOT_EQUAL_ZERO) */
+    auto predicateOp = (mode >= RenderConditionMode::WaitInverted ? D3D12_PREDICATION_OP_NOT_EQUAL_ZERO : D3D12_PREDICATION_OP_EQUAL_ZERO);
+
+    /* Transition buffer into predication state until the render condition ends (upload heap buffers are already readable in GENERIC_READ) */
+    if ((bufferD3D.GetResourceState() & D3D12_RESOURCE_STATE_PREDICATION) == 0)
+    {
+        TransitionResource(bufferD3D.GetNative(), bufferD3D.GetResourceState(), D3D12_RESOURCE_STATE_PREDICATION);
+        renderConditionBuffer_ = &bufferD3D;
+    }
+
+    commandList_->SetPredication(bufferD3D.GetNative(), offset, predicateOp);
 }
 
 void D3D12CommandBuffer::EndRenderCondition()
 {
-    //commandList_->SetPredication(nullptr, offset, D3D12_PREDICATION_OP_EQUAL_ZERO);
-    //todo...
+    commandList_->SetPredication(nullptr, 0, D3D12_PREDICATION_OP_EQUAL_ZERO);
+
+    /* Transition predication buffer back into its previous state */
+    if (renderConditionBuffer_ != nullptr)
+    {
+        TransitionResource(renderConditionBuffer_->GetNative(), D3D12_RESOURCE_STATE_PREDICATION, renderConditionBuffer_->GetResourceState());
+        renderConditionBuffer_ = nullptr;
+    }
 }
 
 /* ----- Drawing ----- */
@@ -431,6 +650,8 @@ void D3D12CommandBuffer::Dispatch(std::uint32_t groupSizeX, std::uint32_t groupS
 
 void D3D12CommandBuffer::CreateDevices(D3D12RenderSystem& renderSystem)
 {
+    device_ = renderSystem.GetDevice().GetNative();
+
     /* Create command allocators */
     for (auto& cmdAllocator : cmdAllocators_)
         cmdAllocator = renderSystem.GetDevice().CreateDXCommandAllocator(D3D12_COMMAND_LIST_TYPE_DIRECT);
@@ -448,6 +669,9 @@ void D3D12CommandBuffer::NextCommandAllocator()
     /* Reclaim memory allocated by command allocator using <ID3D12CommandAllocator::Reset> */
     auto hr = GetCommandAllocator()->Reset();
     DXThrowIfFailed(hr, "failed to reset D3D12 command allocator");
+
+    /* Release intermediate buffers of the commands that were recorded with this allocator */
+    intermediateBuffers_[currentCmdAllocator_].clear();
 }
 
 void D3D12CommandBuffer::SetBackBufferRTV(D3D12RenderContext& renderContextD3D)
@@ -529,8 +753,16 @@ void D3D12CommandBuffer::TransitionRenderTarget(
     D3D12_RESOURCE_STATES   stateAfter)
 {
     /* Indicate a transition in the render-target usage and synchronize with the resource barrier */
+    TransitionResource(colorBuffer, stateBefore, stateAfter);
+}
+
+void D3D12CommandBuffer::TransitionResource(
+    ID3D12Resource*         resource,
+    D3D12_RESOURCE_STATES   stateBefore,
+    D3D12_RESOURCE_STATES   stateAfter)
+{
     commandList_->ResourceBarrier(
-        1, &CD3DX12_RESOURCE_BARRIER::Transition(colorBuffer, stateBefore, stateAfter)
+        1, &CD3DX12_RESOURCE_BARRIER::Transition(resource, stateBefore, stateAfter)
     );
 }
 
@@ -11,6 +11,7 @@
 
 #include <LLGL/CommandBuffer.h>
 #include <cstddef>
+#include <vector>
 #include "../DXCommon/ComPtr.h"
 #include "../DXCommon/DXCore.h"
 
@@ -25,6 +26,8 @@ namespace LLGL
 class D3D12RenderSystem;
 class D3D12RenderContext;
 class D3D12RenderPass;
+class D3D12PipelineLayout;
+class D3D12Buffer;
 
 class D3D12CommandBuffer final : public CommandBuffer
 {
@@ -42,6 +45,22 @@ class D3D12CommandBuffer final : public CommandBuffer
 
         void UpdateBuffer(Buffer& dstBuffer, std::uint64_t dstOffset, const void* data, std::uint16_t dataSize) override;
         void CopyBuffer(Buffer& dstBuffer, std::uint64_t dstOffset, Buffer& srcBuffer, std::uint64_t srcOffset, std::uint64_t size) override;
+        void FillBuffer(Buffer& dstBuffer, std::uint64_t dstOffset, std::uint32_t value, std::uint64_t fillSize) override;
+
+        void CopyTexture(
+            Texture&                dstTexture,
+            const TextureLocation&  dstLocation,
+            Texture&                srcTexture,
+            const TextureRegion&    srcRegion
+        ) override;
+
+        void BlitTexture(
+            Texture&                dstTexture,
+            const TextureRegion&    dstRegion,
+            Texture&                srcTexture,
+            const TextureRegion&    srcRegion,
+            const SamplerFilter     filter      = SamplerFilter::Linear
+        ) override;
 
         /* ----- Configuration ----- */
 
@@ -81,8 +100,12 @@ class D3D12CommandBuffer final : public CommandBuffer
 
         /* ----- Resource Heaps ----- */
 
-        void SetGraphicsResourceHeap(ResourceHeap& resourceHeap, std::uint32_t firstSet = 0) override;
-        void SetComputeResourceHeap(ResourceHeap& resourceHeap, std::uint32_t firstSet = 0) override;
+        void SetGraphicsResourceHeap(ResourceHeap& resourceHeap, std::uint32_t firstSet = 0, std::uint32_t numDynamicOffsets = 0, const std::uint32_t* dynamicOffsets = nullptr) override;
+        void SetComputeResourceHeap(ResourceHeap& resourceHeap, std::uint32_t firstSet = 0, std::uint32_t numDynamicOffsets = 0, const std::uint32_t* dynamicOffsets = nullptr) override;
+
+        /* ----- Inline Constants ----- */
+
+        void SetInlineConstants(long stageFlags, std::uint32_t offset, const void* data, std::uint32_t dataSize) override;
 
         /* ----- Render Passes ----- */
 
@@ -108,7 +131,10 @@ class D3D12CommandBuffer final : public CommandBuffer
         bool QueryResult(Query& query, std::uint64_t& result) override;
         bool QueryPipelineStatisticsResult(Query& query, QueryPipelineStatistics& result) override;
 
+        void CopyQueryResults(std::uint32_t numQueries, Query* const * queries, Buffer& dstBuffer, std::uint64_t dstOffset) override;
+
         void BeginRenderCondition(Query& query, const RenderConditionMode mode) override;
+        void BeginRenderCondition(Buffer& buffer, std::uint64_t offset, const RenderConditionMode mode) override;
         void EndRenderCondition() override;
 
         /* ----- Drawing ----- */
@@ -159,6 +185,12 @@ class D3D12CommandBuffer final : public CommandBuffer
             D3D12_RESOURCE_STATES   stateAfter
         );
 
+        void TransitionResource(
+            ID3D12Resource*         resource,
+            D3D12_RESOURCE_STATES   stateBefore,
+            D3D12_RESOURCE_STATES   stateAfter
+        );
+
         void ClearAttachmentsWithRenderPass(
             const D3D12RenderPass&  renderPassD3D,
             std::uint32_t           numClearValues,
@@ -179,9 +211,13 @@ class D3D12CommandBuffer final : public CommandBuffer
 
         static const std::size_t g_numCmdAllocators = 3;
 
+        ID3D12Device*                       device_                             = nullptr;
+
         ComPtr<ID3D12CommandAllocator>      cmdAllocators_[g_numCmdAllocators];
         std::size_t                         currentCmdAllocator_                = 0;
 
+        std::vector<ComPtr<ID3D12Resource>> intermediateBuffers_[g_numCmdAllocators];   // Upload buffers that must be kept alive until their command allocator is reset
+
         ComPtr<ID3D12GraphicsCommandList>   commandList_;
 
         D3D12_CPU_DESCRIPTOR_HANDLE         rtvDescHandle_          = {};
@@ -192,12 +228,15 @@ class D3D12CommandBuffer final : public CommandBuffer
         bool                                scissorEnabled_         = false;
         UINT                                numBoundScissorRects_   = 0;
 
+        const D3D12PipelineLayout*          boundPipelineLayout_    = nullptr;
+
         #if 0//unused
         LONG                                framebufferWidth_       = 0;
         LONG                                framebufferHeight_      = 0;
         #endif
 
         ID3D12Resource*                     boundBackBuffer_        = nullptr;  // Currently bound color buffer from D3D12RenderContext
+        const D3D12Buffer*                  renderConditionBuffer_  = nullptr;  // Predication buffer that must be transitioned back in EndRenderCondition
 
 };
 
@@ -33,6 +33,23 @@ void D3D12CommandQueue::Submit(CommandBuffer& commandBuffer)
     queue_->ExecuteCommandLists(1, cmdLists);
 }
 
+void D3D12CommandQueue::Submit(std::uint32_t numCommandBuffers, CommandBuffer* const * commandBuffers)
+{
+    /* Gather native command lists */
+    commandLists_.clear();
+    commandLists_.reserve(numCommandBuffers);
+
+    for (std::uint32_t i = 0; i < numCommandBuffers; ++i)
+    {
+        auto commandBufferD3D = LLGL_CAST(D3D12CommandBuffer*, commandBuffers[i]);
+        commandLists_.push_back(commandBufferD3D->GetNative());
+    }
+
+    /* Execute all command lists at once */
+    if (!commandLists_.empty())
+        queue_->ExecuteCommandLists(numCommandBuffers, commandLists_.data());
+}
+
 /* ----- Fences ----- */
 
 void D3D12CommandQueue::Submit(Fence& fence)
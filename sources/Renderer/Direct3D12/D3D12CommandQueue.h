@@ -15,6 +15,7 @@
 #include "../StaticLimits.h"
 #include <d3d12.h>
 #include <cstddef>
+#include <vector>
 
 
 namespace LLGL
@@ -33,6 +34,7 @@ class D3D12CommandQueue final : public CommandQueue
         /* ----- Command Buffers ----- */
 
         void Submit(CommandBuffer& commandBuffer) override;
+        void Submit(std::uint32_t numCommandBuffers, CommandBuffer* const * commandBuffers) override;
 
         /* ----- Fences ----- */
 
@@ -51,8 +53,10 @@ class D3D12CommandQueue final : public CommandQueue
 
     private:
 
-        ID3D12CommandQueue* queue_              = nullptr;
-        D3D12Fence          intermediateFence_;
+        ID3D12CommandQueue*                 queue_              = nullptr;
+        D3D12Fence                          intermediateFence_;
+
+        std::vector<ID3D12CommandList*>     commandLists_;
 
 };
 
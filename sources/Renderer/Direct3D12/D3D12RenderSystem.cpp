@@ -323,12 +323,24 @@ void D3D12RenderSystem::GenerateMips(Texture& texture, std::uint32_t baseMipLeve
 
 Sampler* D3D12RenderSystem::CreateSampler(const SamplerDescriptor& desc)
 {
-    return TakeOwnership(samplers_, MakeUnique<D3D12Sampler>(desc));
+    return samplerCache_.GetOrCreate(
+        desc,
+        [&]()
+        {
+            return TakeOwnership(samplers_, MakeUnique<D3D12Sampler>(desc));
+        }
+    );
 }
 
 void D3D12RenderSystem::Release(Sampler& sampler)
 {
-    RemoveFromUniqueSet(samplers_, &sampler);
+    if (samplerCache_.Release(sampler))
+        RemoveFromUniqueSet(samplers_, &sampler);
+}
+
+SamplerCacheStatistics D3D12RenderSystem::GetSamplerCacheStatistics() const
+{
+    return samplerCache_.GetStatistics();
 }
 
 /* ----- Resource Heaps ----- */
@@ -352,6 +364,7 @@ RenderPass* D3D12RenderSystem::CreateRenderPass(const RenderPassDescriptor& desc
 
 void D3D12RenderSystem::Release(RenderPass& renderPass)
 {
+    pipelineCache_.Evict(renderPass);
     RemoveFromUniqueSet(renderPasses_, &renderPass);
 }
 
@@ -388,6 +401,7 @@ void D3D12RenderSystem::Release(Shader& shader)
 
 void D3D12RenderSystem::Release(ShaderProgram& shaderProgram)
 {
+    pipelineCache_.Evict(shaderProgram);
     RemoveFromUniqueSet(shaderPrograms_, &shaderProgram);
 }
 
@@ -400,6 +414,7 @@ PipelineLayout* D3D12RenderSystem::CreatePipelineLayout(const PipelineLayoutDesc
 
 void D3D12RenderSystem::Release(PipelineLayout& pipelineLayout)
 {
+    pipelineCache_.Evict(pipelineLayout);
     RemoveFromUniqueSet(pipelineLayouts_, &pipelineLayout);
 }
 
@@ -407,9 +422,15 @@ void D3D12RenderSystem::Release(PipelineLayout& pipelineLayout)
 
 GraphicsPipeline* D3D12RenderSystem::CreateGraphicsPipeline(const GraphicsPipelineDescriptor& desc)
 {
-    return TakeOwnership(
-        graphicsPipelines_,
-        MakeUnique<D3D12GraphicsPipeline>(device_, defaultPipelineLayout_.GetRootSignature(), desc)
+    return pipelineCache_.GetOrCreate(
+        desc,
+        [&]()
+        {
+            return TakeOwnership(
+                graphicsPipelines_,
+                MakeUnique<D3D12GraphicsPipeline>(device_, defaultPipelineLayout_.GetRootSignature(), desc)
+            );
+        }
     );
 }
 
@@ -420,7 +441,8 @@ ComputePipeline* D3D12RenderSystem::CreateComputePipeline(const ComputePipelineD
 
 void D3D12RenderSystem::Release(GraphicsPipeline& graphicsPipeline)
 {
-    RemoveFromUniqueSet(graphicsPipelines_, &graphicsPipeline);
+    if (pipelineCache_.Release(graphicsPipeline))
+        RemoveFromUniqueSet(graphicsPipelines_, &graphicsPipeline);
 }
 
 void D3D12RenderSystem::Release(ComputePipeline& computePipeline)
@@ -428,6 +450,11 @@ void D3D12RenderSystem::Release(ComputePipeline& computePipeline)
     //RemoveFromUniqueSet(computePipelines_, &computePipeline);
 }
 
+PipelineCacheStatistics D3D12RenderSystem::GetPipelineCacheStatistics() const
+{
+    return pipelineCache_.GetStatistics();
+}
+
 /* ----- Queries ----- */
 
 Query* D3D12RenderSystem::CreateQuery(const QueryDescriptor& desc)
@@ -452,6 +479,23 @@ void D3D12RenderSystem::Release(Fence& fence)
     RemoveFromUniqueSet(fences_, &fence);
 }
 
+/* ----- Asynchronous Readbacks ----- */
+
+AsyncReadback* D3D12RenderSystem::ReadTextureAsync(const Texture& texture, std::uint32_t mipLevel)
+{
+    throw std::runtime_error("asynchronous readbacks are not supported by Direct3D 12 renderer");
+}
+
+AsyncReadback* D3D12RenderSystem::ReadBufferAsync(const Buffer& buffer, std::uint64_t offset, std::uint64_t size)
+{
+    throw std::runtime_error("asynchronous readbacks are not supported by Direct3D 12 renderer");
+}
+
+void D3D12RenderSystem::Release(AsyncReadback& readback)
+{
+    throw std::runtime_error("asynchronous readbacks are not supported by Direct3D 12 renderer");
+}
+
 /* ----- Extended internal functions ----- */
 
 ComPtr<IDXGISwapChain1> D3D12RenderSystem::CreateDXSwapChain(const DXGI_SWAP_CHAIN_DESC1& desc, HWND wnd)
@@ -611,12 +655,16 @@ void D3D12RenderSystem::QueryRenderingCaps()
 
         /* Set extended attributes */
         caps.features.hasConservativeRasterization  = (GetFeatureLevel() >= D3D_FEATURE_LEVEL_12_0);
+        caps.features.hasTextureViewSwizzle         = true;
+        caps.features.hasRenderConditionBuffers     = true;
 
         caps.limits.maxNumViewports                 = D3D12_VIEWPORT_AND_SCISSORRECT_OBJECT_COUNT_PER_PIPELINE;
         caps.limits.maxViewportSize[0]              = D3D12_VIEWPORT_BOUNDS_MAX;
         caps.limits.maxViewportSize[1]              = D3D12_VIEWPORT_BOUNDS_MAX;
         caps.limits.maxBufferSize                   = std::numeric_limits<UINT64>::max();
         caps.limits.maxConstantBufferSize           = D3D12_REQ_CONSTANT_BUFFER_ELEMENT_COUNT * 16;
+        caps.limits.minConstantBufferOffsetAlignment    = D3D12_CONSTANT_BUFFER_DATA_PLACEMENT_ALIGNMENT;
+        caps.limits.maxInlineConstantsSize          = 128; // Half of the 64 DWORDs a root signature can hold
     }
     SetRenderingCaps(caps);
 }
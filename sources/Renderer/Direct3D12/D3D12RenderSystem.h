@@ -31,6 +31,8 @@
 #include "Shader/D3D12ShaderProgram.h"
 
 #include "../ContainerTypes.h"
+#include "../PipelineCache.h"
+#include "../SamplerCache.h"
 #include "../DXCommon/ComPtr.h"
 #include <d3d12.h>
 #include <dxgi1_4.h>
@@ -99,6 +101,8 @@ class D3D12RenderSystem final : public RenderSystem
 
         void Release(Sampler& sampler) override;
 
+        SamplerCacheStatistics GetSamplerCacheStatistics() const override;
+
         /* ----- Resource Heaps ----- */
 
         ResourceHeap* CreateResourceHeap(const ResourceHeapDescriptor& desc) override;
@@ -139,6 +143,8 @@ class D3D12RenderSystem final : public RenderSystem
         void Release(GraphicsPipeline& graphicsPipeline) override;
         void Release(ComputePipeline& computePipeline) override;
 
+        PipelineCacheStatistics GetPipelineCacheStatistics() const override;
+
         /* ----- Queries ----- */
 
         Query* CreateQuery(const QueryDescriptor& desc) override;
@@ -151,6 +157,13 @@ class D3D12RenderSystem final : public RenderSystem
 
         void Release(Fence& fence) override;
 
+        /* ----- Asynchronous Readbacks ----- */
+
+        AsyncReadback* ReadTextureAsync(const Texture& texture, std::uint32_t mipLevel) override;
+        AsyncReadback* ReadBufferAsync(const Buffer& buffer, std::uint64_t offset, std::uint64_t size) override;
+
+        void Release(AsyncReadback& readback) override;
+
         /* ----- Extended internal functions ----- */
 
         ComPtr<IDXGISwapChain1> CreateDXSwapChain(const DXGI_SWAP_CHAIN_DESC1& desc, HWND wnd);
@@ -234,12 +247,14 @@ class D3D12RenderSystem final : public RenderSystem
         HWObjectContainer<BufferArray>              bufferArrays_;
         HWObjectContainer<D3D12Texture>             textures_;
         HWObjectContainer<D3D12Sampler>             samplers_;
+        SamplerCache                                samplerCache_;
         HWObjectContainer<D3D12RenderPass>          renderPasses_;
         //HWObjectContainer<D3D12RenderTarget>        renderTargets_;
         HWObjectContainer<D3D12Shader>              shaders_;
         HWObjectContainer<D3D12ShaderProgram>       shaderPrograms_;
         HWObjectContainer<D3D12PipelineLayout>      pipelineLayouts_;
         HWObjectContainer<D3D12GraphicsPipeline>    graphicsPipelines_;
+        PipelineCache                               pipelineCache_;
         HWObjectContainer<D3D12ResourceHeap>        resourceHeaps_;
         //HWObjectContainer<D3D12Query>               queries_;
         HWObjectContainer<D3D12Fence>               fences_;
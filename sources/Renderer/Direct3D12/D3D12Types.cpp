@@ -248,6 +248,20 @@ D3D12_SRV_DIMENSION Map(const TextureType textureType)
     DXTypes::MapFailed("TextureType", "D3D12_SRV_DIMENSION");
 }
 
+D3D12_SHADER_COMPONENT_MAPPING Map(const TextureSwizzle textureSwizzle)
+{
+    switch (textureSwizzle)
+    {
+        case TextureSwizzle::Zero:  return D3D12_SHADER_COMPONENT_MAPPING_FORCE_VALUE_0;
+        case TextureSwizzle::One:   return D3D12_SHADER_COMPONENT_MAPPING_FORCE_VALUE_1;
+        case TextureSwizzle::Red:   return D3D12_SHADER_COMPONENT_MAPPING_FROM_MEMORY_COMPONENT_0;
+        case TextureSwizzle::Green: return D3D12_SHADER_COMPONENT_MAPPING_FROM_MEMORY_COMPONENT_1;
+        case TextureSwizzle::Blue:  return D3D12_SHADER_COMPONENT_MAPPING_FROM_MEMORY_COMPONENT_2;
+        case TextureSwizzle::Alpha: return D3D12_SHADER_COMPONENT_MAPPING_FROM_MEMORY_COMPONENT_3;
+    }
+    DXTypes::MapFailed("TextureSwizzle", "D3D12_SHADER_COMPONENT_MAPPING");
+}
+
 D3D12_RESOURCE_DIMENSION ToResourceDimension(const TextureType type)
 {
     switch (type)
@@ -40,8 +40,8 @@ D3D12GraphicsPipeline::D3D12GraphicsPipeline(
     if (auto pipelineLayout = desc.pipelineLayout)
     {
         /* Create pipeline state with root signature from pipeline layout */
-        auto pipelineLayoutD3D = LLGL_CAST(const D3D12PipelineLayout*, pipelineLayout);
-        CreatePipelineState(device, *shaderProgramD3D, pipelineLayoutD3D->GetRootSignature(), desc);
+        pipelineLayout_ = LLGL_CAST(const D3D12PipelineLayout*, pipelineLayout);
+        CreatePipelineState(device, *shaderProgramD3D, pipelineLayout_->GetRootSignature(), desc);
     }
     else
     {
@@ -22,6 +22,7 @@ namespace LLGL
 
 class D3D12Device;
 class D3D12ShaderProgram;
+class D3D12PipelineLayout;
 class RawBufferIterator;
 
 class D3D12GraphicsPipeline final : public GraphicsPipeline
@@ -43,6 +44,12 @@ class D3D12GraphicsPipeline final : public GraphicsPipeline
             return scissorEnabled_;
         }
 
+        // Returns the pipeline layout this graphics pipeline was created with, or null if there is none.
+        inline const D3D12PipelineLayout* GetPipelineLayout() const
+        {
+            return pipelineLayout_;
+        }
+
     private:
 
         void CreatePipelineState(
@@ -59,6 +66,7 @@ class D3D12GraphicsPipeline final : public GraphicsPipeline
 
         ComPtr<ID3D12PipelineState> pipelineState_;
         ID3D12RootSignature*        rootSignature_      = nullptr;
+        const D3D12PipelineLayout*  pipelineLayout_     = nullptr;
 
         D3D12_PRIMITIVE_TOPOLOGY    primitiveTopology_  = D3D_PRIMITIVE_TOPOLOGY_UNDEFINED;
         FLOAT                       blendFactor_[4]     = { 0.0f, 0.0f, 0.0f, 0.0f };
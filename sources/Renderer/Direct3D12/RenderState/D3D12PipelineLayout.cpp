@@ -15,6 +15,26 @@ namespace LLGL
 {
 
 
+// Returns the shader visibility for root parameters that are only used by the specified shader stages.
+static D3D12_SHADER_VISIBILITY GetShaderVisibility(long stageFlags)
+{
+    switch (stageFlags)
+    {
+        case StageFlags::VertexStage:           return D3D12_SHADER_VISIBILITY_VERTEX;
+        case StageFlags::TessControlStage:      return D3D12_SHADER_VISIBILITY_HULL;
+        case StageFlags::TessEvaluationStage:   return D3D12_SHADER_VISIBILITY_DOMAIN;
+        case StageFlags::GeometryStage:         return D3D12_SHADER_VISIBILITY_GEOMETRY;
+        case StageFlags::FragmentStage:         return D3D12_SHADER_VISIBILITY_PIXEL;
+        default:                                return D3D12_SHADER_VISIBILITY_ALL;
+    }
+}
+
+// Returns true if the specified binding is a constant buffer with a dynamic offset, which is bound as root CBV instead of a descriptor table.
+static bool IsDynamicConstantBuffer(const BindingDescriptor& binding)
+{
+    return (binding.type == ResourceType::ConstantBuffer && (binding.flags & BindingFlags::DynamicOffset) != 0);
+}
+
 D3D12PipelineLayout::D3D12PipelineLayout(ID3D12Device* device, const PipelineLayoutDescriptor& desc)
 {
     CreateRootSignature(device, desc);
@@ -23,7 +43,7 @@ D3D12PipelineLayout::D3D12PipelineLayout(ID3D12Device* device, const PipelineLay
 void D3D12PipelineLayout::CreateRootSignature(ID3D12Device* device, const PipelineLayoutDescriptor& desc)
 {
     D3D12RootSignature rootSignature;
-    rootSignature.Reset(desc.bindings.size(), 0);
+    rootSignature.Reset(static_cast<UINT>(desc.bindings.size() + desc.inlineConstants.size()), 0);
 
     /* Build root parameter for each descriptor range type */
     BuildRootParameter(rootSignature, D3D12_DESCRIPTOR_RANGE_TYPE_CBV,     desc, ResourceType::ConstantBuffer);
@@ -31,6 +51,12 @@ void D3D12PipelineLayout::CreateRootSignature(ID3D12Device* device, const Pipeli
     BuildRootParameter(rootSignature, D3D12_DESCRIPTOR_RANGE_TYPE_UAV,     desc, ResourceType::StorageBuffer );
     BuildRootParameter(rootSignature, D3D12_DESCRIPTOR_RANGE_TYPE_SAMPLER, desc, ResourceType::Sampler       );
 
+    /* Build root constants for inline constants after all descriptor tables */
+    BuildRootConstants(rootSignature, desc);
+
+    /* Build root CBVs for constant buffers with dynamic offsets */
+    BuildRootDescriptors(rootSignature, desc);
+
     /* Get root signature flags */
     D3D12_ROOT_SIGNATURE_FLAGS signatureFlags = D3D12_ROOT_SIGNATURE_FLAG_NONE;
     BuildRootSignatureFlags(signatureFlags, desc);
@@ -57,7 +83,7 @@ void D3D12PipelineLayout::BuildRootParameter(
 {
     for (const auto& binding : layoutDesc.bindings)
     {
-        if (binding.type == resourceType)
+        if (binding.type == resourceType && !IsDynamicConstantBuffer(binding))
         {
             if (auto rootParam = rootSignature.FindCompatibleRootParameter(descRangeType))
             {
@@ -75,6 +101,39 @@ void D3D12PipelineLayout::BuildRootParameter(
     }
 }
 
+void D3D12PipelineLayout::BuildRootConstants(
+    D3D12RootSignature&             rootSignature,
+    const PipelineLayoutDescriptor& layoutDesc)
+{
+    inlineConstants_                = layoutDesc.inlineConstants;
+    inlineConstantsRootParamIndex_  = rootSignature.GetNumRootParameters();
+
+    for (const auto& range : layoutDesc.inlineConstants)
+    {
+        auto rootParam = rootSignature.AppendRootParameter();
+        rootParam->InitAsConstants(range.slot, range.size / 4, GetShaderVisibility(range.stageFlags));
+    }
+}
+
+void D3D12PipelineLayout::BuildRootDescriptors(
+    D3D12RootSignature&             rootSignature,
+    const PipelineLayoutDescriptor& layoutDesc)
+{
+    dynamicBindings_.clear();
+    dynamicRootParamIndex_ = rootSignature.GetNumRootParameters();
+
+    for (std::size_t i = 0; i < layoutDesc.bindings.size(); ++i)
+    {
+        const auto& binding = layoutDesc.bindings[i];
+        if (IsDynamicConstantBuffer(binding))
+        {
+            auto rootParam = rootSignature.AppendRootParameter();
+            rootParam->InitAsDescriptorCBV(binding.slot, GetShaderVisibility(binding.stageFlags));
+            dynamicBindings_.push_back(i);
+        }
+    }
+}
+
 //TODO: properly enable D3D12_ROOT_SIGNATURE_FLAG_ALLOW_INPUT_ASSEMBLER_INPUT_LAYOUT and D3D12_ROOT_SIGNATURE_FLAG_ALLOW_STREAM_OUTPUT
 void D3D12PipelineLayout::BuildRootSignatureFlags(
     D3D12_ROOT_SIGNATURE_FLAGS&     signatureFlags,
@@ -86,6 +145,8 @@ void D3D12PipelineLayout::BuildRootSignatureFlags(
     long stageFlags = 0;
     for (const auto& binding : layoutDesc.bindings)
         stageFlags |= binding.stageFlags;
+    for (const auto& range : layoutDesc.inlineConstants)
+        stageFlags |= range.stageFlags;
 
     /* Deny access to root signature for shader stages that are not affected by any binding point */
     if ((stageFlags & StageFlags::VertexStage) == 0)
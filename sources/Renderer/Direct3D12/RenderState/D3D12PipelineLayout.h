@@ -39,6 +39,30 @@ class D3D12PipelineLayout final : public PipelineLayout
             return rootSignature_.Get();
         }
 
+        // Returns the list of inline constant ranges. Each range is stored in its own root parameter.
+        inline const std::vector<InlineConstantsDescriptor>& GetInlineConstants() const
+        {
+            return inlineConstants_;
+        }
+
+        // Returns the index of the root parameter for the first range of inline constants.
+        inline UINT GetInlineConstantsRootParamIndex() const
+        {
+            return inlineConstantsRootParamIndex_;
+        }
+
+        // Returns the indices of all bindings with dynamic offsets. Each of these constant buffers is stored in its own root CBV.
+        inline const std::vector<std::size_t>& GetDynamicBindings() const
+        {
+            return dynamicBindings_;
+        }
+
+        // Returns the index of the root parameter for the first constant buffer with a dynamic offset.
+        inline UINT GetDynamicRootParamIndex() const
+        {
+            return dynamicRootParamIndex_;
+        }
+
     private:
 
         void BuildRootParameter(
@@ -48,12 +72,28 @@ class D3D12PipelineLayout final : public PipelineLayout
             const ResourceType              resourceType
         );
 
+        void BuildRootConstants(
+            D3D12RootSignature&             rootSignature,
+            const PipelineLayoutDescriptor& layoutDesc
+        );
+
+        void BuildRootDescriptors(
+            D3D12RootSignature&             rootSignature,
+            const PipelineLayoutDescriptor& layoutDesc
+        );
+
         void BuildRootSignatureFlags(
             D3D12_ROOT_SIGNATURE_FLAGS&     signatureFlags,
             const PipelineLayoutDescriptor& layoutDesc
         );
 
-        ComPtr<ID3D12RootSignature> rootSignature_;
+        ComPtr<ID3D12RootSignature>             rootSignature_;
+
+        std::vector<InlineConstantsDescriptor>  inlineConstants_;
+        UINT                                    inlineConstantsRootParamIndex_  = 0;
+
+        std::vector<std::size_t>                dynamicBindings_;
+        UINT                                    dynamicRootParamIndex_          = 0;
 
 };
 
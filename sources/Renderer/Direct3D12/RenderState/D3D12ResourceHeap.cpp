@@ -6,7 +6,7 @@
  */
 
 #include "D3D12ResourceHeap.h"
-//#include "D3D12PipelineLayout.h"
+#include "D3D12PipelineLayout.h"
 #include "../Buffer/D3D12ConstantBuffer.h"
 #include "../Texture/D3D12Sampler.h"
 #include "../Texture/D3D12Texture.h"
@@ -23,12 +23,16 @@ namespace LLGL
 
 D3D12ResourceHeap::D3D12ResourceHeap(ID3D12Device* device, const ResourceHeapDescriptor& desc)
 {
+    /* Constant buffers with dynamic offsets are bound as root CBVs instead of descriptors */
+    std::vector<bool> dynamicResourceViews(desc.resourceViews.size(), false);
+    CollectDynamicConstantBuffers(desc, dynamicResourceViews);
+
     /* Create descriptor heaps */
-    auto cpuDescHandleCbvSrvUav = CreateHeapTypeCbvSrvUav(device, desc);
+    auto cpuDescHandleCbvSrvUav = CreateHeapTypeCbvSrvUav(device, desc, dynamicResourceViews);
     auto cpuDescHandleSampler   = CreateHeapTypeSampler(device, desc);
 
     /* Create descriptors */
-    CreateConstantBufferViews(device, cpuDescHandleCbvSrvUav, desc);
+    CreateConstantBufferViews(device, cpuDescHandleCbvSrvUav, desc, dynamicResourceViews);
     CreateShaderResourceViews(device, cpuDescHandleCbvSrvUav, desc);
     CreateUnorderedAccessViews(device, cpuDescHandleCbvSrvUav, desc);
     CreateSamplers(device, cpuDescHandleSampler, desc);
@@ -44,14 +48,39 @@ static void ErrNullPointerInResource()
     throw std::invalid_argument("cannot create resource heap with null pointer in resource view");
 }
 
-D3D12_CPU_DESCRIPTOR_HANDLE D3D12ResourceHeap::CreateHeapTypeCbvSrvUav(ID3D12Device* device, const ResourceHeapDescriptor& desc)
+void D3D12ResourceHeap::CollectDynamicConstantBuffers(const ResourceHeapDescriptor& desc, std::vector<bool>& dynamicResourceViews)
+{
+    if (auto pipelineLayoutD3D = LLGL_CAST(const D3D12PipelineLayout*, desc.pipelineLayout))
+    {
+        dynamicRootParamIndex_ = pipelineLayoutD3D->GetDynamicRootParamIndex();
+
+        for (auto i : pipelineLayoutD3D->GetDynamicBindings())
+        {
+            if (i < desc.resourceViews.size())
+            {
+                if (auto resource = desc.resourceViews[i].resource)
+                {
+                    auto constantBufferD3D = LLGL_CAST(D3D12ConstantBuffer*, resource);
+                    dynamicConstantBuffers_.push_back(constantBufferD3D->GetNative()->GetGPUVirtualAddress());
+                    dynamicResourceViews[i] = true;
+                }
+                else
+                    ErrNullPointerInResource();
+            }
+        }
+    }
+}
+
+D3D12_CPU_DESCRIPTOR_HANDLE D3D12ResourceHeap::CreateHeapTypeCbvSrvUav(ID3D12Device* device, const ResourceHeapDescriptor& desc, const std::vector<bool>& dynamicResourceViews)
 {
     /* Determine number of view descriptors */
     UINT numDescriptors = 0;
 
-    for (const auto& resourceView : desc.resourceViews)
+    for (std::size_t i = 0; i < desc.resourceViews.size(); ++i)
     {
-        if (auto resource = resourceView.resource)
+        if (dynamicResourceViews[i])
+            continue;
+        if (auto resource = desc.resourceViews[i].resource)
         {
             switch (resource->QueryResourceType())
             {
@@ -142,33 +171,39 @@ D3D12_CPU_DESCRIPTOR_HANDLE D3D12ResourceHeap::CreateHeapTypeSampler(ID3D12Devic
     return {};
 }
 
+using ResourceViewCallback = std::function<void(Resource& resource, const ResourceViewDescriptor& rsvDesc)>;
+
 static void ForEachResourceViewOfType(
-    const ResourceHeapDescriptor&                   desc,
-    const ResourceType                              resourceType,
-    const std::function<void(Resource& resource)>&  callback)
+    const ResourceHeapDescriptor&   desc,
+    const ResourceType              resourceType,
+    const ResourceViewCallback&     callback,
+    const std::vector<bool>*        excludedResourceViews = nullptr)
 {
-    for (const auto& resourceView : desc.resourceViews)
+    for (std::size_t i = 0; i < desc.resourceViews.size(); ++i)
     {
-        if (auto resource = resourceView.resource)
+        if (excludedResourceViews != nullptr && (*excludedResourceViews)[i])
+            continue;
+        if (auto resource = desc.resourceViews[i].resource)
         {
             if (resource->QueryResourceType() == resourceType)
-                callback(*resource);
+                callback(*resource, desc.resourceViews[i]);
         }
     }
 }
 
-void D3D12ResourceHeap::CreateConstantBufferViews(ID3D12Device* device, D3D12_CPU_DESCRIPTOR_HANDLE& cpuDescHandle, const ResourceHeapDescriptor& desc)
+void D3D12ResourceHeap::CreateConstantBufferViews(ID3D12Device* device, D3D12_CPU_DESCRIPTOR_HANDLE& cpuDescHandle, const ResourceHeapDescriptor& desc, const std::vector<bool>& dynamicResourceViews)
 {
     UINT cpuDescStride = device->GetDescriptorHandleIncrementSize(D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
 
     ForEachResourceViewOfType(
         desc, ResourceType::ConstantBuffer,
-        [&](Resource& resource)
+        [&](Resource& resource, const ResourceViewDescriptor& /*rsvDesc*/)
         {
             auto& constantBufferD3D = LLGL_CAST(D3D12ConstantBuffer&, resource);
             constantBufferD3D.CreateResourceView(device, cpuDescHandle);
             cpuDescHandle.ptr += cpuDescStride;
-        }
+        },
+        &dynamicResourceViews
     );
 }
 
@@ -178,10 +213,13 @@ void D3D12ResourceHeap::CreateShaderResourceViews(ID3D12Device* device, D3D12_CP
 
     ForEachResourceViewOfType(
         desc, ResourceType::Texture,
-        [&](Resource& resource)
+        [&](Resource& resource, const ResourceViewDescriptor& rsvDesc)
         {
             auto& textureD3D = LLGL_CAST(D3D12Texture&, resource);
-            textureD3D.CreateResourceView(device, cpuDescHandle);
+            if (rsvDesc.textureView.format != Format::Undefined)
+                textureD3D.CreateResourceView(device, cpuDescHandle, rsvDesc.textureView);
+            else
+                textureD3D.CreateResourceView(device, cpuDescHandle);
             cpuDescHandle.ptr += cpuDescStride;
         }
     );
@@ -198,7 +236,7 @@ void D3D12ResourceHeap::CreateSamplers(ID3D12Device* device, D3D12_CPU_DESCRIPTO
 
     ForEachResourceViewOfType(
         desc, ResourceType::Sampler,
-        [&](Resource& resource)
+        [&](Resource& resource, const ResourceViewDescriptor& /*rsvDesc*/)
         {
             auto& samplerD3D = LLGL_CAST(D3D12Sampler&, resource);
             samplerD3D.CreateResourceView(device, cpuDescHandle);
@@ -12,6 +12,7 @@
 #include <LLGL/ResourceHeap.h>
 #include "../../DXCommon/ComPtr.h"
 #include <d3d12.h>
+#include <vector>
 
 
 namespace LLGL
@@ -35,23 +36,40 @@ class D3D12ResourceHeap final : public ResourceHeap
             return numDescriptorHeaps_;
         }
 
+        // Returns the GPU virtual addresses of all constant buffers with dynamic offsets, in the order of their bindings.
+        inline const std::vector<D3D12_GPU_VIRTUAL_ADDRESS>& GetDynamicConstantBuffers() const
+        {
+            return dynamicConstantBuffers_;
+        }
+
+        // Returns the index of the root parameter for the first constant buffer with a dynamic offset.
+        inline UINT GetDynamicRootParamIndex() const
+        {
+            return dynamicRootParamIndex_;
+        }
+
     private:
 
-        D3D12_CPU_DESCRIPTOR_HANDLE CreateHeapTypeCbvSrvUav(ID3D12Device* device, const ResourceHeapDescriptor& desc);
+        void CollectDynamicConstantBuffers(const ResourceHeapDescriptor& desc, std::vector<bool>& dynamicResourceViews);
+
+        D3D12_CPU_DESCRIPTOR_HANDLE CreateHeapTypeCbvSrvUav(ID3D12Device* device, const ResourceHeapDescriptor& desc, const std::vector<bool>& dynamicResourceViews);
         D3D12_CPU_DESCRIPTOR_HANDLE CreateHeapTypeSampler(ID3D12Device* device, const ResourceHeapDescriptor& desc);
 
-        void CreateConstantBufferViews(ID3D12Device* device, D3D12_CPU_DESCRIPTOR_HANDLE& cpuDescHandle, const ResourceHeapDescriptor& desc);
+        void CreateConstantBufferViews(ID3D12Device* device, D3D12_CPU_DESCRIPTOR_HANDLE& cpuDescHandle, const ResourceHeapDescriptor& desc, const std::vector<bool>& dynamicResourceViews);
         void CreateShaderResourceViews(ID3D12Device* device, D3D12_CPU_DESCRIPTOR_HANDLE& cpuDescHandle, const ResourceHeapDescriptor& desc);
         void CreateUnorderedAccessViews(ID3D12Device* device, D3D12_CPU_DESCRIPTOR_HANDLE& cpuDescHandle, const ResourceHeapDescriptor& desc);
         void CreateSamplers(ID3D12Device* device, D3D12_CPU_DESCRIPTOR_HANDLE& cpuDescHandle, const ResourceHeapDescriptor& desc);
 
         void AppendDescriptorHeapToArray(ID3D12DescriptorHeap* descriptorHeap);
 
-        ComPtr<ID3D12DescriptorHeap>    heapTypeCbvSrvUav_;
-        ComPtr<ID3D12DescriptorHeap>    heapTypeSampler_;
+        ComPtr<ID3D12DescriptorHeap>            heapTypeCbvSrvUav_;
+        ComPtr<ID3D12DescriptorHeap>            heapTypeSampler_;
+
+        ID3D12DescriptorHeap*                   descriptorHeaps_[2]     = {};   // References to the ComPtr objects
+        UINT                                    numDescriptorHeaps_     = 0;
 
-        ID3D12DescriptorHeap*           descriptorHeaps_[2] = {};   // References to the ComPtr objects
-        UINT                            numDescriptorHeaps_ = 0;
+        std::vector<D3D12_GPU_VIRTUAL_ADDRESS>  dynamicConstantBuffers_;
+        UINT                                    dynamicRootParamIndex_  = 0;
 
 };
 
@@ -232,6 +232,80 @@ void D3D12Texture::UpdateSubresource(
     );
 
     commandList->ResourceBarrier(1, &resourceBarrier);
+    resourceState_ = D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE;
+}
+
+// Initializes the subresource range of the specified SRV descriptor for its view dimension.
+static void InitD3D12SubresourceSRVDesc(
+    D3D12_SHADER_RESOURCE_VIEW_DESC&    srvDesc,
+    UINT                                baseMipLevel,
+    UINT                                numMipLevels,
+    UINT                                baseArrayLayer,
+    UINT                                numArrayLayers)
+{
+    switch (srvDesc.ViewDimension)
+    {
+        case D3D12_SRV_DIMENSION_TEXTURE1D:
+            srvDesc.Texture1D.MostDetailedMip               = baseMipLevel;
+            srvDesc.Texture1D.MipLevels                     = numMipLevels;
+            srvDesc.Texture1D.ResourceMinLODClamp           = 0.0f;
+            break;
+
+        case D3D12_SRV_DIMENSION_TEXTURE1DARRAY:
+            srvDesc.Texture1DArray.MostDetailedMip          = baseMipLevel;
+            srvDesc.Texture1DArray.MipLevels                = numMipLevels;
+            srvDesc.Texture1DArray.FirstArraySlice          = baseArrayLayer;
+            srvDesc.Texture1DArray.ArraySize                = numArrayLayers;
+            srvDesc.Texture1DArray.ResourceMinLODClamp      = 0.0f;
+            break;
+
+        case D3D12_SRV_DIMENSION_TEXTURE2D:
+            srvDesc.Texture2D.MostDetailedMip               = baseMipLevel;
+            srvDesc.Texture2D.MipLevels                     = numMipLevels;
+            srvDesc.Texture2D.PlaneSlice                    = 0;
+            srvDesc.Texture2D.ResourceMinLODClamp           = 0.0f;
+            break;
+
+        case D3D12_SRV_DIMENSION_TEXTURE2DARRAY:
+            srvDesc.Texture2DArray.MostDetailedMip          = baseMipLevel;
+            srvDesc.Texture2DArray.MipLevels                = numMipLevels;
+            srvDesc.Texture2DArray.FirstArraySlice          = baseArrayLayer;
+            srvDesc.Texture2DArray.ArraySize                = numArrayLayers;
+            srvDesc.Texture2DArray.PlaneSlice               = 0;
+            srvDesc.Texture2DArray.ResourceMinLODClamp      = 0.0f;
+            break;
+
+        case D3D12_SRV_DIMENSION_TEXTURE2DMS:
+            break;
+
+        case D3D12_SRV_DIMENSION_TEXTURE2DMSARRAY:
+            srvDesc.Texture2DMSArray.FirstArraySlice        = baseArrayLayer;
+            srvDesc.Texture2DMSArray.ArraySize              = numArrayLayers;
+            break;
+
+        case D3D12_SRV_DIMENSION_TEXTURE3D:
+            srvDesc.Texture3D.MostDetailedMip               = baseMipLevel;
+            srvDesc.Texture3D.MipLevels                     = numMipLevels;
+            srvDesc.Texture3D.ResourceMinLODClamp           = 0.0f;
+            break;
+
+        case D3D12_SRV_DIMENSION_TEXTURECUBE:
+            srvDesc.TextureCube.MostDetailedMip             = baseMipLevel;
+            srvDesc.TextureCube.MipLevels                   = numMipLevels;
+            srvDesc.TextureCube.ResourceMinLODClamp         = 0.0f;
+            break;
+
+        case D3D12_SRV_DIMENSION_TEXTURECUBEARRAY:
+            srvDesc.TextureCubeArray.MostDetailedMip        = baseMipLevel;
+            srvDesc.TextureCubeArray.MipLevels              = numMipLevels;
+            srvDesc.TextureCubeArray.First2DArrayFace       = baseArrayLayer;
+            srvDesc.TextureCubeArray.NumCubes               = numArrayLayers;
+            srvDesc.TextureCubeArray.ResourceMinLODClamp    = 0.0f;
+            break;
+
+        default:
+            break;
+    }
 }
 
 void D3D12Texture::CreateResourceView(ID3D12Device* device, D3D12_CPU_DESCRIPTOR_HANDLE cpuDescriptorHandle)
@@ -241,70 +315,40 @@ void D3D12Texture::CreateResourceView(ID3D12Device* device, D3D12_CPU_DESCRIPTOR
         srvDesc.Format                  = format_;
         srvDesc.ViewDimension           = D3D12Types::Map(GetType());
         srvDesc.Shader4ComponentMapping = D3D12_DEFAULT_SHADER_4_COMPONENT_MAPPING;
+        InitD3D12SubresourceSRVDesc(srvDesc, 0, numMipLevels_, 0, numArrayLayers_);
+    }
+    device->CreateShaderResourceView(resource_.Get(), &srvDesc, cpuDescriptorHandle);
+}
 
-        switch (srvDesc.ViewDimension)
-        {
-            case D3D12_SRV_DIMENSION_TEXTURE1D:
-                srvDesc.Texture1D.MostDetailedMip               = 0;
-                srvDesc.Texture1D.MipLevels                     = numMipLevels_;
-                srvDesc.Texture1D.ResourceMinLODClamp           = 0.0f;
-                break;
-
-            case D3D12_SRV_DIMENSION_TEXTURE1DARRAY:
-                srvDesc.Texture1DArray.MostDetailedMip          = 0;
-                srvDesc.Texture1DArray.MipLevels                = numMipLevels_;
-                srvDesc.Texture1DArray.FirstArraySlice          = 0;
-                srvDesc.Texture1DArray.ArraySize                = numArrayLayers_;
-                srvDesc.Texture1DArray.ResourceMinLODClamp      = 0.0f;
-                break;
-
-            case D3D12_SRV_DIMENSION_TEXTURE2D:
-                srvDesc.Texture2D.MostDetailedMip               = 0;
-                srvDesc.Texture2D.MipLevels                     = numMipLevels_;
-                srvDesc.Texture2D.PlaneSlice                    = 0;
-                srvDesc.Texture2D.ResourceMinLODClamp           = 0.0f;
-                break;
-
-            case D3D12_SRV_DIMENSION_TEXTURE2DARRAY:
-                srvDesc.Texture2DArray.MostDetailedMip          = 0;
-                srvDesc.Texture2DArray.MipLevels                = numMipLevels_;
-                srvDesc.Texture2DArray.FirstArraySlice          = 0;
-                srvDesc.Texture2DArray.ArraySize                = numArrayLayers_;
-                srvDesc.Texture2DArray.PlaneSlice               = 0;
-                srvDesc.Texture2DArray.ResourceMinLODClamp      = 0.0f;
-                break;
-
-            case D3D12_SRV_DIMENSION_TEXTURE2DMS:
-                break;
-
-            case D3D12_SRV_DIMENSION_TEXTURE2DMSARRAY:
-                srvDesc.Texture2DMSArray.FirstArraySlice        = 0;
-                srvDesc.Texture2DMSArray.ArraySize              = numArrayLayers_;
-                break;
-
-            case D3D12_SRV_DIMENSION_TEXTURE3D:
-                srvDesc.Texture3D.MostDetailedMip               = 0;
-                srvDesc.Texture3D.MipLevels                     = numMipLevels_;
-                srvDesc.Texture3D.ResourceMinLODClamp           = 0.0f;
-                break;
-
-            case D3D12_SRV_DIMENSION_TEXTURECUBE:
-                srvDesc.TextureCube.MostDetailedMip             = 0;
-                srvDesc.TextureCube.MipLevels                   = numMipLevels_;
-                srvDesc.TextureCube.ResourceMinLODClamp         = 0.0f;
-                break;
-
-            case D3D12_SRV_DIMENSION_TEXTURECUBEARRAY:
-                srvDesc.TextureCubeArray.MostDetailedMip        = 0;
-                srvDesc.TextureCubeArray.MipLevels              = numMipLevels_;
-                srvDesc.TextureCubeArray.First2DArrayFace       = 0;
-                srvDesc.TextureCubeArray.NumCubes               = numArrayLayers_;
-                srvDesc.TextureCubeArray.ResourceMinLODClamp    = 0.0f;
-                break;
-
-            default:
-                break;
-        }
+void D3D12Texture::CreateResourceView(ID3D12Device* device, D3D12_CPU_DESCRIPTOR_HANDLE cpuDescriptorHandle, const TextureViewDescriptor& textureViewDesc)
+{
+    const auto& subresource = textureViewDesc.subresource;
+    const auto& swizzle     = textureViewDesc.swizzle;
+
+    auto type           = textureViewDesc.type;
+    auto numArrayLayers = subresource.numArrayLayers;
+
+    if (IsCubeTexture(type))
+    {
+        /* Cube views that do not start at the first face can only be described as cube array */
+        if (type == TextureType::TextureCube && subresource.baseArrayLayer > 0)
+            type = TextureType::TextureCubeArray;
+
+        /* Array size of cube array views is specified in number of cubes, not faces */
+        numArrayLayers /= 6;
+    }
+
+    D3D12_SHADER_RESOURCE_VIEW_DESC srvDesc;
+    {
+        srvDesc.Format                  = D3D12Types::Map(textureViewDesc.format);
+        srvDesc.ViewDimension           = D3D12Types::Map(type);
+        srvDesc.Shader4ComponentMapping = D3D12_ENCODE_SHADER_4_COMPONENT_MAPPING(
+            D3D12Types::Map(swizzle.r),
+            D3D12Types::Map(swizzle.g),
+            D3D12Types::Map(swizzle.b),
+            D3D12Types::Map(swizzle.a)
+        );
+        InitD3D12SubresourceSRVDesc(srvDesc, subresource.baseMipLevel, subresource.numMipLevels, subresource.baseArrayLayer, numArrayLayers);
     }
     device->CreateShaderResourceView(resource_.Get(), &srvDesc, cpuDescriptorHandle);
 }
@@ -326,6 +370,8 @@ void D3D12Texture::CreateResource(ID3D12Device* device, const D3D12_RESOURCE_DES
         IID_PPV_ARGS(resource_.ReleaseAndGetAddressOf())
     );
     DXThrowIfFailed(hr, "failed to create D3D12 committed resource for texture");
+
+    resourceState_ = D3D12_RESOURCE_STATE_COPY_DEST;
 }
 
 
@@ -42,6 +42,9 @@ class D3D12Texture final : public Texture
 
         void CreateResourceView(ID3D12Device* device, D3D12_CPU_DESCRIPTOR_HANDLE cpuDescriptorHandle);
 
+        // Creates a shader-resource-view (SRV) for the subresource, format, and component swizzle of the specified texture view.
+        void CreateResourceView(ID3D12Device* device, D3D12_CPU_DESCRIPTOR_HANDLE cpuDescriptorHandle, const TextureViewDescriptor& textureViewDesc);
+
         //! Returns the native ID3D12Resource object.
         inline ID3D12Resource* GetNative() const
         {
@@ -66,6 +69,12 @@ class D3D12Texture final : public Texture
             return numArrayLayers_;
         }
 
+        // Returns the resource state the texture is in outside of command buffers that transition it temporarily.
+        inline D3D12_RESOURCE_STATES GetResourceState() const
+        {
+            return resourceState_;
+        }
+
     private:
 
         void CreateResource(ID3D12Device* device, const D3D12_RESOURCE_DESC& desc);
@@ -75,6 +84,7 @@ class D3D12Texture final : public Texture
         DXGI_FORMAT             format_         = DXGI_FORMAT_UNKNOWN;
         UINT                    numMipLevels_   = 0;
         UINT                    numArrayLayers_ = 0;
+        D3D12_RESOURCE_STATES   resourceState_  = D3D12_RESOURCE_STATE_COMMON;
 
 };
 
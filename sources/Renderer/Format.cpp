@@ -79,6 +79,16 @@ LLGL_EXPORT std::uint32_t FormatBitSize(const Format format)
         case Format::BC1RGBA:           return 4;   // 64-bit per 4x4 block
         case Format::BC2RGBA:           return 8;   // 128-bit per 4x4 block
         case Format::BC3RGBA:           return 8;   // 128-bit per 4x4 block
+        case Format::BC4RUNorm:         return 4;   // 64-bit per 4x4 block
+        case Format::BC4RSNorm:         return 4;   // 64-bit per 4x4 block
+        case Format::BC5RGUNorm:        return 8;   // 128-bit per 4x4 block
+        case Format::BC5RGSNorm:        return 8;   // 128-bit per 4x4 block
+        case Format::BC6HRGBUFloat:     return 8;   // 128-bit per 4x4 block
+        case Format::BC6HRGBSFloat:     return 8;   // 128-bit per 4x4 block
+        case Format::BC7RGBAUNorm:      return 8;   // 128-bit per 4x4 block
+        case Format::ETC2RGB8UNorm:     return 4;   // 64-bit per 4x4 block
+        case Format::ETC2RGB8A1UNorm:   return 4;   // 64-bit per 4x4 block
+        case Format::ETC2RGBA8UNorm:    return 8;   // 128-bit per 4x4 block
 
         default:                        return 0;
     }
@@ -176,6 +186,16 @@ static std::tuple<DataType, std::uint32_t> SplitFormatPrimary(const Format forma
         case Format::BC1RGBA:           break;
         case Format::BC2RGBA:           break;
         case Format::BC3RGBA:           break;
+        case Format::BC4RUNorm:         break;
+        case Format::BC4RSNorm:         break;
+        case Format::BC5RGUNorm:        break;
+        case Format::BC5RGSNorm:        break;
+        case Format::BC6HRGBUFloat:     break;
+        case Format::BC6HRGBSFloat:     break;
+        case Format::BC7RGBAUNorm:      break;
+        case Format::ETC2RGB8UNorm:     break;
+        case Format::ETC2RGB8A1UNorm:   break;
+        case Format::ETC2RGBA8UNorm:    break;
     }
 
     /* Return an invalid image format */
@@ -202,7 +222,7 @@ LLGL_EXPORT bool SplitFormat(const Format format, DataType& dataType, std::uint3
 
 LLGL_EXPORT bool IsCompressedFormat(const Format format)
 {
-    return (format >= Format::BC1RGB && format <= Format::BC3RGBA);
+    return (format >= Format::BC1RGB && format <= Format::ETC2RGBA8UNorm);
 }
 
 LLGL_EXPORT bool IsDepthStencilFormat(const Format format)
@@ -65,11 +65,17 @@ enum class GLExt
     ARB_texture_storage_multisample,
     ARB_buffer_storage,
     ARB_copy_buffer,
+    ARB_copy_image,
+    ARB_clear_buffer_object,
     ARB_direct_state_access,
     ARB_polygon_offset_clamp,
     ARB_texture_view,
     ARB_shader_image_load_store,
     ARB_framebuffer_no_attachments,
+    ARB_invalidate_subdata,
+    ARB_vertex_attrib_binding,
+    ARB_sparse_buffer,
+    ARB_sparse_texture,
 
     /* Extensions without procedures */
     ARB_texture_cube_map,
@@ -78,6 +84,11 @@ enum class GLExt
     ARB_geometry_shader4,
     NV_conservative_raster,
     INTEL_conservative_rasterization,
+    ARB_texture_compression_rgtc,
+    ARB_texture_compression_bptc,
+    ARB_ES3_compatibility,
+    ARB_texture_swizzle,
+    ARB_query_buffer_object,
 
     /* Enumeration entry counter */
     Count,
@@ -136,6 +136,25 @@ GLenum MapOrZero(const Format format)
         case Format::BC3RGBA:           return GL_COMPRESSED_RGBA_S3TC_DXT5_EXT;
         #endif
 
+        #ifdef GL_ARB_texture_compression_rgtc
+        case Format::BC4RUNorm:         return GL_COMPRESSED_RED_RGTC1;
+        case Format::BC4RSNorm:         return GL_COMPRESSED_SIGNED_RED_RGTC1;
+        case Format::BC5RGUNorm:        return GL_COMPRESSED_RG_RGTC2;
+        case Format::BC5RGSNorm:        return GL_COMPRESSED_SIGNED_RG_RGTC2;
+        #endif
+
+        #ifdef GL_ARB_texture_compression_bptc
+        case Format::BC6HRGBUFloat:     return GL_COMPRESSED_RGB_BPTC_UNSIGNED_FLOAT;
+        case Format::BC6HRGBSFloat:     return GL_COMPRESSED_RGB_BPTC_SIGNED_FLOAT;
+        case Format::BC7RGBAUNorm:      return GL_COMPRESSED_RGBA_BPTC_UNORM;
+        #endif
+
+        #if defined GL_ARB_ES3_compatibility || defined LLGL_OPENGLES3
+        case Format::ETC2RGB8UNorm:     return GL_COMPRESSED_RGB8_ETC2;
+        case Format::ETC2RGB8A1UNorm:   return GL_COMPRESSED_RGB8_PUNCHTHROUGH_ALPHA1_ETC2;
+        case Format::ETC2RGBA8UNorm:    return GL_COMPRESSED_RGBA8_ETC2_EAC;
+        #endif
+
         default:                        return 0;
     }
 }
@@ -544,6 +563,20 @@ GLenum Map(const LogicOp logicOp)
     MapFailed("LogicOp");
 }
 
+GLenum Map(const TextureSwizzle textureSwizzle)
+{
+    switch (textureSwizzle)
+    {
+        case TextureSwizzle::Zero:  return GL_ZERO;
+        case TextureSwizzle::One:   return GL_ONE;
+        case TextureSwizzle::Red:   return GL_RED;
+        case TextureSwizzle::Green: return GL_GREEN;
+        case TextureSwizzle::Blue:  return GL_BLUE;
+        case TextureSwizzle::Alpha: return GL_ALPHA;
+    }
+    MapFailed("TextureSwizzle");
+}
+
 
 /* ----- Unmap functions ----- */
 
@@ -845,6 +878,25 @@ static Format UnmapTextureFormat(const GLenum internalFormat)
         case GL_COMPRESSED_RGBA_S3TC_DXT5_EXT:  return Format::BC3RGBA;
         #endif
 
+        #ifdef GL_ARB_texture_compression_rgtc
+        case GL_COMPRESSED_RED_RGTC1:                       return Format::BC4RUNorm;
+        case GL_COMPRESSED_SIGNED_RED_RGTC1:                return Format::BC4RSNorm;
+        case GL_COMPRESSED_RG_RGTC2:                        return Format::BC5RGUNorm;
+        case GL_COMPRESSED_SIGNED_RG_RGTC2:                 return Format::BC5RGSNorm;
+        #endif
+
+        #ifdef GL_ARB_texture_compression_bptc
+        case GL_COMPRESSED_RGB_BPTC_UNSIGNED_FLOAT:         return Format::BC6HRGBUFloat;
+        case GL_COMPRESSED_RGB_BPTC_SIGNED_FLOAT:           return Format::BC6HRGBSFloat;
+        case GL_COMPRESSED_RGBA_BPTC_UNORM:                 return Format::BC7RGBAUNorm;
+        #endif
+
+        #if defined GL_ARB_ES3_compatibility || defined LLGL_OPENGLES3
+        case GL_COMPRESSED_RGB8_ETC2:                       return Format::ETC2RGB8UNorm;
+        case GL_COMPRESSED_RGB8_PUNCHTHROUGH_ALPHA1_ETC2:   return Format::ETC2RGB8A1UNorm;
+        case GL_COMPRESSED_RGBA8_ETC2_EAC:                  return Format::ETC2RGBA8UNorm;
+        #endif
+
         default:                                break;
     }
     return Format::Undefined;
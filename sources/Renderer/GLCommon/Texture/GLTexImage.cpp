@@ -11,7 +11,9 @@
 #include "../GLImportExt.h"
 #include "../GLExtensionRegistry.h"
 #include <array>
+#include <vector>
 #include <algorithm>
+#include <cstring>
 
 
 namespace LLGL
@@ -27,14 +29,172 @@ void GLTexImageInitialization(const ImageInitialization& imageInitialization)
     g_imageInitialization = imageInitialization;
 }
 
-static std::vector<ColorRGBAf> GenImageDataRGBAf(std::uint32_t numPixels, const ColorRGBAf& color)
+// Maximum size (in bytes) of the intermediate buffer to initialize textures when GL_ARB_clear_texture is not supported
+static const std::size_t g_maxInitialImageChunkSize = (1024 * 1024);
+
+// Texel value to initialize textures with the default clear value
+struct GLDefaultTexel
+{
+    GLenum          format;
+    GLenum          type;
+    std::uint32_t   size;
+    union
+    {
+        GLfloat     floats[4];
+        GLint       ints[4];
+        GLuint      uints[4];
+    };
+};
+
+static GLDefaultTexel GetDefaultTexel(const Format format)
 {
-    return std::vector<ColorRGBAf>(static_cast<std::size_t>(numPixels), color);
+    GLDefaultTexel texel;
+
+    const auto& clearValue = g_imageInitialization.clearValue;
+
+    if (format == Format::D24UNormS8UInt)
+    {
+        /* Packed depth-stencil formats must be initialized with packed depth-stencil data (24-bit depth in the upper bits, 8-bit stencil in the lower bits) */
+        const auto depth = std::max(0.0f, std::min(clearValue.depth, 1.0f));
+        texel.format    = GL_DEPTH_STENCIL;
+        texel.type      = GL_UNSIGNED_INT_24_8;
+        texel.size      = sizeof(GLuint);
+        texel.uints[0]  = (static_cast<GLuint>(depth * 16777215.0f + 0.5f) << 8) | (clearValue.stencil & 0xFF);
+    }
+    else if (format == Format::D32FloatS8X24UInt)
+    {
+        /* 32-bit float depth, followed by a 32-bit word with the 8-bit stencil in the lower bits */
+        texel.format    = GL_DEPTH_STENCIL;
+        texel.type      = GL_FLOAT_32_UNSIGNED_INT_24_8_REV;
+        texel.size      = sizeof(GLfloat) + sizeof(GLuint);
+        texel.floats[0] = clearValue.depth;
+        texel.uints[1]  = (clearValue.stencil & 0xFF);
+    }
+    else if (IsDepthStencilFormat(format))
+    {
+        texel.format    = GL_DEPTH_COMPONENT;
+        texel.type      = GL_FLOAT;
+        texel.size      = sizeof(GLfloat);
+        texel.floats[0] = clearValue.depth;
+    }
+    else if (IsIntegralFormat(format) && !IsNormalizedFormat(format))
+    {
+        /* Integer formats must be initialized with integer data */
+        texel.format    = GL_RGBA_INTEGER;
+        texel.type      = GL_INT;
+        texel.size      = sizeof(GLint) * 4;
+        for (int i = 0; i < 4; ++i)
+            texel.ints[i] = static_cast<GLint>(clearValue.color[i]);
+    }
+    else
+    {
+        texel.format    = GL_RGBA;
+        texel.type      = GL_FLOAT;
+        texel.size      = sizeof(GLfloat) * 4;
+        for (int i = 0; i < 4; ++i)
+            texel.floats[i] = clearValue.color[i];
+    }
+
+    return texel;
+}
+
+// Returns the extent of the specified MIP-map level, where array layers are stored in the height (1D arrays) or depth (2D and cube arrays)
+static Extent3D GetMipExtentWithLayers(const TextureDescriptor& desc, std::uint32_t mipLevel)
+{
+    const auto width    = std::max(1u, desc.extent.width  >> mipLevel);
+    const auto height   = std::max(1u, desc.extent.height >> mipLevel);
+    const auto depth    = std::max(1u, desc.extent.depth  >> mipLevel);
+
+    switch (desc.type)
+    {
+        case TextureType::Texture1D:        return { width, 1u, 1u };
+        case TextureType::Texture2D:        return { width, height, 1u };
+        case TextureType::Texture3D:        return { width, height, depth };
+        case TextureType::TextureCube:      return { width, height, 1u };
+        case TextureType::Texture1DArray:   return { width, desc.arrayLayers, 1u };
+        case TextureType::Texture2DArray:   /*pass*/
+        case TextureType::TextureCubeArray: return { width, height, desc.arrayLayers };
+        default:                            return { width, height, depth };
+    }
 }
 
-static std::vector<float> GenImageDataRf(std::uint32_t numPixels, float value)
+// Writes the default texel into the specified row range of a MIP-map level for the currently bound texture
+static void GLTexSubImageDefaultRows(
+    const TextureType       type,
+    GLenum                  target,
+    GLint                   mipLevel,
+    GLint                   y,
+    GLint                   z,
+    GLsizei                 width,
+    GLsizei                 rows,
+    const GLDefaultTexel&   texel,
+    const void*             data)
 {
-    return std::vector<float>(static_cast<std::size_t>(numPixels), value);
+    switch (type)
+    {
+        #ifdef LLGL_OPENGL
+        case TextureType::Texture1D:
+            glTexSubImage1D(target, mipLevel, 0, width, texel.format, texel.type, data);
+            break;
+        #endif
+
+        case TextureType::Texture3D:
+        case TextureType::Texture2DArray:
+        case TextureType::TextureCubeArray:
+            glTexSubImage3D(target, mipLevel, 0, y, z, width, rows, 1, texel.format, texel.type, data);
+            break;
+
+        default:
+            glTexSubImage2D(target, mipLevel, 0, y, width, rows, texel.format, texel.type, data);
+            break;
+    }
+}
+
+// Initializes all MIP-map levels of the currently bound texture with an intermediate buffer, which is limited in size and reused for all uploads
+static void GLTexImageInitializeWithChunks(const TextureDescriptor& desc, const GLDefaultTexel& texel)
+{
+    const auto numMipLevels = NumMipLevels(desc);
+
+    /* Determine number of rows per chunk by the extent of the first MIP-map level */
+    const auto  rowSize         = static_cast<std::size_t>(desc.extent.width) * texel.size;
+    const auto  maxRows         = std::max(1u, GetMipExtentWithLayers(desc, 0).height);
+    const auto  rowsPerChunk    = static_cast<std::uint32_t>(std::max<std::size_t>(1, std::min<std::size_t>(maxRows, g_maxInitialImageChunkSize / rowSize)));
+
+    /* Fill intermediate buffer with default texel only once */
+    std::vector<char> chunk(rowSize * rowsPerChunk);
+    for (std::size_t offset = 0; offset < chunk.size(); offset += texel.size)
+        ::memcpy(&chunk[offset], texel.floats, texel.size);
+
+    /* Determine texture targets (cube textures are initialized face by face) */
+    const auto numTargets = (desc.type == TextureType::TextureCube ? desc.arrayLayers : 1u);
+
+    for (std::uint32_t i = 0; i < numTargets; ++i)
+    {
+        const auto target = (desc.type == TextureType::TextureCube ? GLTypes::ToTextureCubeMap(i) : GLTypes::Map(desc.type));
+
+        for (std::uint32_t mipLevel = 0; mipLevel < numMipLevels; ++mipLevel)
+        {
+            const auto extent = GetMipExtentWithLayers(desc, mipLevel);
+
+            for (std::uint32_t z = 0; z < extent.depth; ++z)
+            {
+                for (std::uint32_t y = 0; y < extent.height; y += rowsPerChunk)
+                {
+                    GLTexSubImageDefaultRows(
+                        desc.type,
+                        target,
+                        static_cast<GLint>(mipLevel),
+                        static_cast<GLint>(y),
+                        static_cast<GLint>(z),
+                        static_cast<GLsizei>(extent.width),
+                        static_cast<GLsizei>(std::min(rowsPerChunk, extent.height - y)),
+                        texel,
+                        chunk.data()
+                    );
+                }
+            }
+        }
+    }
 }
 
 [[noreturn]]
@@ -453,7 +613,7 @@ void GLTexImage1D(const TextureDescriptor& desc, const SrcImageDescriptor* image
         /* Throw runtime error for illegal use of depth-stencil format */
         ErrIllegalUseOfDepthFormat();
     }
-    else if (IsCompressedFormat(desc.format) || !g_imageInitialization.enabled)
+    else
     {
         /* Allocate texture without initial data */
         GLTexImage1D(
@@ -465,19 +625,6 @@ void GLTexImage1D(const TextureDescriptor& desc, const SrcImageDescriptor* image
             nullptr
         );
     }
-    else
-    {
-        /* Initialize texture image with default color */
-        auto image = GenImageDataRGBAf(desc.extent.width, g_imageInitialization.clearValue.color);
-        GLTexImage1D(
-            NumMipLevels(desc),
-            desc.format,
-            desc.extent.width,
-            GL_RGBA,
-            GL_FLOAT,
-            image.data()
-        );
-    }
 }
 
 #endif
@@ -500,60 +647,28 @@ void GLTexImage2D(const TextureDescriptor& desc, const SrcImageDescriptor* image
     }
     else if (IsDepthStencilFormat(desc.format))
     {
-        if (g_imageInitialization.enabled)
-        {
-            //TODO: add support for default initialization of stencil values
-            /* Initialize depth texture image with default depth */
-            auto image = GenImageDataRf(desc.extent.width * desc.extent.height, g_imageInitialization.clearValue.depth);
-            GLTexImage2D(
-                NumMipLevels(desc),
-                desc.format,
-                desc.extent.width,
-                desc.extent.height,
-                GL_DEPTH_COMPONENT,
-                GL_FLOAT,
-                image.data()
-            );
-        }
-        else
-        {
-            /* Allocate depth texture image without initial data */
-            GLTexImage2D(
-                NumMipLevels(desc),
-                desc.format,
-                desc.extent.width,
-                desc.extent.height,
-                GL_DEPTH_COMPONENT,
-                GL_FLOAT,
-                nullptr
-            );
-        }
-    }
-    else if (IsCompressedFormat(desc.format) || !g_imageInitialization.enabled)
-    {
-        /* Allocate texture without initial data */
+        /* Allocate depth texture image without initial data */
         GLTexImage2D(
             NumMipLevels(desc),
             desc.format,
             desc.extent.width,
             desc.extent.height,
-            GL_RGBA,
-            GL_UNSIGNED_BYTE,
+            GL_DEPTH_COMPONENT,
+            GL_FLOAT,
             nullptr
         );
     }
     else
     {
-        /* Initialize texture image with default color */
-        auto image = GenImageDataRGBAf(desc.extent.width * desc.extent.height, g_imageInitialization.clearValue.color);
+        /* Allocate texture without initial data */
         GLTexImage2D(
             NumMipLevels(desc),
             desc.format,
             desc.extent.width,
             desc.extent.height,
             GL_RGBA,
-            GL_FLOAT,
-            image.data()
+            GL_UNSIGNED_BYTE,
+            nullptr
         );
     }
 }
@@ -580,7 +695,7 @@ void GLTexImage3D(const TextureDescriptor& desc, const SrcImageDescriptor* image
         /* Throw runtime error for illegal use of depth-stencil format */
         ErrIllegalUseOfDepthFormat();
     }
-    else if (IsCompressedFormat(desc.format) || !g_imageInitialization.enabled)
+    else
     {
         /* Allocate texture without initial data */
         GLTexImage3D(
@@ -594,21 +709,6 @@ void GLTexImage3D(const TextureDescriptor& desc, const SrcImageDescriptor* image
             nullptr
         );
     }
-    else
-    {
-        /* Initialize texture image with default color */
-        auto image = GenImageDataRGBAf(desc.extent.width * desc.extent.height * desc.extent.depth, g_imageInitialization.clearValue.color);
-        GLTexImage3D(
-            NumMipLevels(desc),
-            desc.format,
-            desc.extent.width,
-            desc.extent.height,
-            desc.extent.depth,
-            GL_RGBA,
-            GL_FLOAT,
-            image.data()
-        );
-    }
 }
 
 void GLTexImageCube(const TextureDescriptor& desc, const SrcImageDescriptor* imageDesc)
@@ -648,7 +748,7 @@ void GLTexImageCube(const TextureDescriptor& desc, const SrcImageDescriptor* ima
         /* Throw runtime error for illegal use of depth-stencil format */
         ErrIllegalUseOfDepthFormat();
     }
-    else if (IsCompressedFormat(desc.format) || !g_imageInitialization.enabled)
+    else
     {
         /* Allocate texture without initial data */
         for (std::uint32_t arrayLayer = 0; arrayLayer < desc.arrayLayers; ++arrayLayer)
@@ -665,24 +765,6 @@ void GLTexImageCube(const TextureDescriptor& desc, const SrcImageDescriptor* ima
             );
         }
     }
-    else
-    {
-        /* Initialize texture image cube-faces with default color */
-        auto image = GenImageDataRGBAf(desc.extent.width * desc.extent.height, g_imageInitialization.clearValue.color);
-        for (std::uint32_t arrayLayer = 0; arrayLayer < desc.arrayLayers; ++arrayLayer)
-        {
-            GLTexImageCube(
-                numMipLevels,
-                desc.format,
-                desc.extent.width,
-                desc.extent.height,
-                arrayLayer,
-                GL_RGBA,
-                GL_FLOAT,
-                image.data()
-            );
-        }
-    }
 }
 
 #ifdef LLGL_OPENGL
@@ -708,7 +790,7 @@ void GLTexImage1DArray(const TextureDescriptor& desc, const SrcImageDescriptor*
         /* Throw runtime error for illegal use of depth-stencil format */
         ErrIllegalUseOfDepthFormat();
     }
-    else if (IsCompressedFormat(desc.format) || !g_imageInitialization.enabled)
+    else
     {
         /* Allocate texture without initial data */
         GLTexImage1DArray(
@@ -721,20 +803,6 @@ void GLTexImage1DArray(const TextureDescriptor& desc, const SrcImageDescriptor*
             nullptr
         );
     }
-    else
-    {
-        /* Initialize texture image with default color */
-        auto image = GenImageDataRGBAf(desc.extent.width * desc.arrayLayers, g_imageInitialization.clearValue.color);
-        GLTexImage1DArray(
-            NumMipLevels(desc),
-            desc.format,
-            desc.extent.width,
-            desc.arrayLayers,
-            GL_RGBA,
-            GL_FLOAT,
-            image.data()
-        );
-    }
 }
 
 #endif
@@ -758,54 +826,21 @@ void GLTexImage2DArray(const TextureDescriptor& desc, const SrcImageDescriptor*
     }
     else if (IsDepthStencilFormat(desc.format))
     {
-        if (g_imageInitialization.enabled)
-        {
-            /* Initialize depth texture image with default depth */
-            auto image = GenImageDataRf(desc.extent.width * desc.extent.height * desc.arrayLayers, g_imageInitialization.clearValue.depth);
-            GLTexImage2DArray(
-                NumMipLevels(desc),
-                desc.format,
-                desc.extent.width,
-                desc.extent.height,
-                desc.arrayLayers,
-                GL_DEPTH_COMPONENT,
-                GL_FLOAT,
-                image.data()
-            );
-        }
-        else
-        {
-            /* Allocate depth texture image without initial data */
-            GLTexImage2DArray(
-                NumMipLevels(desc),
-                desc.format,
-                desc.extent.width,
-                desc.extent.height,
-                desc.arrayLayers,
-                GL_DEPTH_COMPONENT,
-                GL_FLOAT,
-                nullptr
-            );
-        }
-    }
-    else if (IsCompressedFormat(desc.format) || !g_imageInitialization.enabled)
-    {
-        /* Allocate texture without initial data */
+        /* Allocate depth texture image without initial data */
         GLTexImage2DArray(
             NumMipLevels(desc),
             desc.format,
             desc.extent.width,
             desc.extent.height,
             desc.arrayLayers,
-            GL_RGBA,
-            GL_UNSIGNED_BYTE,
+            GL_DEPTH_COMPONENT,
+            GL_FLOAT,
             nullptr
         );
     }
     else
     {
-        /* Initialize texture image with default color */
-        auto image = GenImageDataRGBAf(desc.extent.width * desc.extent.height * desc.arrayLayers, g_imageInitialization.clearValue.color);
+        /* Allocate texture without initial data */
         GLTexImage2DArray(
             NumMipLevels(desc),
             desc.format,
@@ -813,8 +848,8 @@ void GLTexImage2DArray(const TextureDescriptor& desc, const SrcImageDescriptor*
             desc.extent.height,
             desc.arrayLayers,
             GL_RGBA,
-            GL_FLOAT,
-            image.data()
+            GL_UNSIGNED_BYTE,
+            nullptr
         );
     }
 }
@@ -843,7 +878,7 @@ void GLTexImageCubeArray(const TextureDescriptor& desc, const SrcImageDescriptor
         /* Throw runtime error for illegal use of depth-stencil format */
         ErrIllegalUseOfDepthFormat();
     }
-    else if (IsCompressedFormat(desc.format) || !g_imageInitialization.enabled)
+    else
     {
         /* Allocate texture without initial data */
         GLTexImageCubeArray(
@@ -857,21 +892,6 @@ void GLTexImageCubeArray(const TextureDescriptor& desc, const SrcImageDescriptor
             nullptr
         );
     }
-    else
-    {
-        /* Initialize texture image cube-faces with default color */
-        auto image = GenImageDataRGBAf(desc.extent.width * desc.extent.height * desc.arrayLayers, g_imageInitialization.clearValue.color);
-        GLTexImageCubeArray(
-            NumMipLevels(desc),
-            desc.format,
-            desc.extent.width,
-            desc.extent.height,
-            desc.arrayLayers,
-            GL_RGBA,
-            GL_FLOAT,
-            image.data()
-        );
-    }
 }
 
 void GLTexImage2DMS(const TextureDescriptor& desc)
@@ -901,6 +921,30 @@ void GLTexImage2DMSArray(const TextureDescriptor& desc)
 
 #endif
 
+void GLTexImageInitialize(GLuint texID, const TextureDescriptor& desc)
+{
+    /* Compressed and multi-sampled textures are not initialized */
+    if (!g_imageInitialization.enabled || IsCompressedFormat(desc.format) || IsMultiSampleTexture(desc.type))
+        return;
+
+    const auto texel = GetDefaultTexel(desc.format);
+
+    #ifdef GL_ARB_clear_texture
+    if (HasExtension(GLExt::ARB_clear_texture))
+    {
+        /* Clear all MIP-map levels including all array layers on the GPU */
+        const auto numMipLevels = NumMipLevels(desc);
+        for (std::uint32_t mipLevel = 0; mipLevel < numMipLevels; ++mipLevel)
+            glClearTexImage(texID, static_cast<GLint>(mipLevel), texel.format, texel.type, texel.floats);
+    }
+    else
+    #endif
+    {
+        /* Upload default texel with an intermediate buffer */
+        GLTexImageInitializeWithChunks(desc, texel);
+    }
+}
+
 
 } // /namespace LLGL
 
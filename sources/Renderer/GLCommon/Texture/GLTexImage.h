@@ -12,6 +12,7 @@
 #include <LLGL/ImageFlags.h>
 #include <LLGL/TextureFlags.h>
 #include <LLGL/RenderSystemFlags.h>
+#include "../GLImport.h"
 
 
 namespace LLGL
@@ -41,6 +42,9 @@ void GLTexImage2DArray  (const TextureDescriptor& desc, const SrcImageDescriptor
 
 #endif
 
+// Initializes all MIP-map levels of the specified texture with the default image initialization value (if enabled). The texture must be currently bound.
+void GLTexImageInitialize(GLuint texID, const TextureDescriptor& desc);
+
 
 } // /namespace LLGL
 
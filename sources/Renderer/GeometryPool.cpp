@@ -0,0 +1,459 @@
+/*
+ * GeometryPool.cpp
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include <LLGL/GeometryPool.h>
+#include <LLGL/RenderSystem.h>
+#include <LLGL/CommandBuffer.h>
+#include <algorithm>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+
+
+namespace LLGL
+{
+
+
+/* ----- Internal functions ----- */
+
+static bool IsEqualVertexAttribute(const VertexAttribute& lhs, const VertexAttribute& rhs)
+{
+    return
+    (
+        lhs.name            == rhs.name             &&
+        lhs.semanticIndex   == rhs.semanticIndex    &&
+        lhs.format          == rhs.format           &&
+        lhs.offset          == rhs.offset           &&
+        lhs.instanceDivisor == rhs.instanceDivisor
+    );
+}
+
+static bool IsEqualVertexFormat(const VertexFormat& lhs, const VertexFormat& rhs)
+{
+    return
+    (
+        lhs.stride == rhs.stride &&
+        lhs.attributes.size() == rhs.attributes.size() &&
+        std::equal(lhs.attributes.begin(), lhs.attributes.end(), rhs.attributes.begin(), IsEqualVertexAttribute)
+    );
+}
+
+// Returns the number of elements that fit into a buffer of the specified size, but at least one.
+static std::uint32_t GetPageCapacity(std::uint64_t bufferSize, std::uint32_t stride)
+{
+    return static_cast<std::uint32_t>(std::max<std::uint64_t>(1, bufferSize / stride));
+}
+
+
+/* ----- Geometry pool ----- */
+
+GeometryPool::GeometryPool(RenderSystem& renderSystem, const GeometryPoolDescriptor& desc) :
+    renderSystem_ { renderSystem },
+    desc_         { desc         }
+{
+}
+
+GeometryPool::~GeometryPool()
+{
+    for (auto heaps : { &vertexHeaps_, &indexHeaps_ })
+    {
+        for (auto& heap : *heaps)
+        {
+            for (auto& page : heap.pages)
+                renderSystem_.Release(*page.buffer);
+        }
+    }
+    ReleaseRetiredBuffers();
+}
+
+GeometryHandle GeometryPool::Alloc(
+    const VertexFormat& vertexFormat,
+    std::uint32_t       numVertices,
+    const void*         vertices,
+    const IndexFormat&  indexFormat,
+    std::uint32_t       numIndices,
+    const void*         indices)
+{
+    if (numVertices == 0 || vertexFormat.stride == 0)
+        return Constants::invalidGeometryHandle;
+
+    Allocation alloc;
+    alloc.live = true;
+
+    /* Allocate vertex range and write vertex data */
+    alloc.vertexBlock = AllocBlock(vertexHeaps_, FindOrCreateVertexHeap(vertexFormat), numVertices);
+
+    if (vertices != nullptr)
+    {
+        const auto& block   = alloc.vertexBlock;
+        const auto  stride  = vertexHeaps_[block.heap].stride;
+        renderSystem_.WriteBuffer(
+            *vertexHeaps_[block.heap].pages[block.page].buffer,
+            static_cast<std::uint64_t>(block.first) * stride,
+            vertices,
+            static_cast<std::uint64_t>(block.count) * stride
+        );
+    }
+
+    /* Allocate index range and write index data */
+    if (numIndices > 0)
+    {
+        alloc.indexBlock = AllocBlock(indexHeaps_, FindOrCreateIndexHeap(indexFormat), numIndices);
+
+        if (indices != nullptr)
+        {
+            const auto& block   = alloc.indexBlock;
+            const auto  stride  = indexHeaps_[block.heap].stride;
+            renderSystem_.WriteBuffer(
+                *indexHeaps_[block.heap].pages[block.page].buffer,
+                static_cast<std::uint64_t>(block.first) * stride,
+                indices,
+                static_cast<std::uint64_t>(block.count) * stride
+            );
+        }
+    }
+
+    UpdateRange(alloc);
+
+    /* Store allocation with a recycled handle if possible */
+    if (!freeHandles_.empty())
+    {
+        auto handle = freeHandles_.back();
+        freeHandles_.pop_back();
+        allocs_[handle] = alloc;
+        return handle;
+    }
+
+    allocs_.push_back(alloc);
+    return static_cast<GeometryHandle>(allocs_.size() - 1);
+}
+
+void GeometryPool::Free(GeometryHandle handle)
+{
+    if (handle < allocs_.size() && allocs_[handle].live)
+    {
+        auto& alloc = allocs_[handle];
+
+        FreeBlock(vertexHeaps_, alloc.vertexBlock);
+        if (alloc.indexBlock.count > 0)
+            FreeBlock(indexHeaps_, alloc.indexBlock);
+
+        alloc.live = false;
+        freeHandles_.push_back(handle);
+    }
+}
+
+const GeometryRange& GeometryPool::GetRange(GeometryHandle handle) const
+{
+    if (handle >= allocs_.size() || !allocs_[handle].live)
+        throw std::out_of_range("invalid geometry handle: " + std::to_string(handle));
+    return allocs_[handle].range;
+}
+
+bool GeometryPool::Defragment(CommandBuffer& commandBuffer)
+{
+    const bool vertexHeapsMoved = DefragmentHeaps(commandBuffer, vertexHeaps_, true);
+    const bool indexHeapsMoved  = DefragmentHeaps(commandBuffer, indexHeaps_, false);
+
+    if (vertexHeapsMoved || indexHeapsMoved)
+    {
+        for (auto& alloc : allocs_)
+        {
+            if (alloc.live)
+                UpdateRange(alloc);
+        }
+        return true;
+    }
+
+    return false;
+}
+
+void GeometryPool::ReleaseRetiredBuffers()
+{
+    for (auto buffer : retiredBuffers_)
+        renderSystem_.Release(*buffer);
+    retiredBuffers_.clear();
+}
+
+float GeometryPool::GetFragmentation() const
+{
+    std::uint64_t capacity = 0, used = 0;
+
+    for (auto heaps : { &vertexHeaps_, &indexHeaps_ })
+    {
+        for (const auto& heap : *heaps)
+        {
+            for (const auto& page : heap.pages)
+            {
+                capacity    += static_cast<std::uint64_t>(page.capacity) * heap.stride;
+                used        += static_cast<std::uint64_t>(page.numUsed) * heap.stride;
+            }
+        }
+    }
+
+    if (capacity > 0)
+        return 1.0f - static_cast<float>(static_cast<double>(used) / static_cast<double>(capacity));
+    else
+        return 0.0f;
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+std::size_t GeometryPool::FindOrCreateVertexHeap(const VertexFormat& vertexFormat)
+{
+    for (std::size_t i = 0; i < vertexHeaps_.size(); ++i)
+    {
+        if (IsEqualVertexFormat(vertexHeaps_[i].bufferDesc.vertexBuffer.format, vertexFormat))
+            return i;
+    }
+
+    Heap heap;
+    {
+        heap.bufferDesc.type                    = BufferType::Vertex;
+        heap.bufferDesc.vertexBuffer.format     = vertexFormat;
+        heap.stride                             = vertexFormat.stride;
+        heap.pageCapacity                       = GetPageCapacity(desc_.vertexBufferSize, heap.stride);
+    }
+    vertexHeaps_.push_back(heap);
+
+    return vertexHeaps_.size() - 1;
+}
+
+std::size_t GeometryPool::FindOrCreateIndexHeap(const IndexFormat& indexFormat)
+{
+    for (std::size_t i = 0; i < indexHeaps_.size(); ++i)
+    {
+        if (indexHeaps_[i].bufferDesc.indexBuffer.format.GetDataType() == indexFormat.GetDataType())
+            return i;
+    }
+
+    Heap heap;
+    {
+        heap.bufferDesc.type                    = BufferType::Index;
+        heap.bufferDesc.indexBuffer.format      = indexFormat;
+        heap.stride                             = indexFormat.GetFormatSize();
+        heap.pageCapacity                       = GetPageCapacity(desc_.indexBufferSize, heap.stride);
+    }
+    indexHeaps_.push_back(heap);
+
+    return indexHeaps_.size() - 1;
+}
+
+GeometryPool::Block GeometryPool::AllocBlock(std::vector<Heap>& heaps, std::size_t heapIndex, std::uint32_t count)
+{
+    auto& heap = heaps[heapIndex];
+
+    Block block;
+    block.heap  = heapIndex;
+    block.count = count;
+
+    /* Find first free range that is large enough */
+    for (std::size_t i = 0; i < heap.pages.size(); ++i)
+    {
+        auto& page = heap.pages[i];
+        for (auto it = page.freeRanges.begin(); it != page.freeRanges.end(); ++it)
+        {
+            if (it->second >= count)
+            {
+                /* Take allocation from the front of the free range */
+                block.page  = i;
+                block.first = it->first;
+
+                const auto remainder = it->second - count;
+                page.freeRanges.erase(it);
+                if (remainder > 0)
+                    page.freeRanges[block.first + count] = remainder;
+
+                page.numUsed += count;
+                return block;
+            }
+        }
+    }
+
+    /* Create new page; geometry that exceeds the page capacity gets a dedicated buffer */
+    heap.pages.push_back(CreatePage(heap, std::max(heap.pageCapacity, count)));
+
+    auto& page = heap.pages.back();
+    {
+        block.page  = heap.pages.size() - 1;
+        block.first = 0;
+
+        page.freeRanges.clear();
+        if (page.capacity > count)
+            page.freeRanges[count] = page.capacity - count;
+
+        page.numUsed = count;
+    }
+
+    return block;
+}
+
+void GeometryPool::FreeBlock(std::vector<Heap>& heaps, const Block& block)
+{
+    auto& page = heaps[block.heap].pages[block.page];
+
+    auto first = block.first;
+    auto count = block.count;
+
+    /* Merge with next free range */
+    auto next = page.freeRanges.find(first + count);
+    if (next != page.freeRanges.end())
+    {
+        count += next->second;
+        page.freeRanges.erase(next);
+    }
+
+    /* Merge with previous free range */
+    auto it = page.freeRanges.lower_bound(first);
+    if (it != page.freeRanges.begin())
+    {
+        auto prev = std::prev(it);
+        if (prev->first + prev->second == first)
+        {
+            first = prev->first;
+            count += prev->second;
+            page.freeRanges.erase(prev);
+        }
+    }
+
+    page.freeRanges[first] = count;
+    page.numUsed -= block.count;
+}
+
+GeometryPool::Page GeometryPool::CreatePage(const Heap& heap, std::uint32_t capacity)
+{
+    auto bufferDesc = heap.bufferDesc;
+    bufferDesc.size = static_cast<std::uint64_t>(capacity) * heap.stride;
+
+    Page page;
+    {
+        page.buffer     = renderSystem_.CreateBuffer(bufferDesc);
+        page.capacity   = capacity;
+        page.numUsed    = 0;
+        page.freeRanges[0] = capacity;
+    }
+    return page;
+}
+
+bool GeometryPool::DefragmentHeaps(CommandBuffer& commandBuffer, std::vector<Heap>& heaps, bool vertexHeaps)
+{
+    bool moved = false;
+
+    for (std::size_t heapIndex = 0; heapIndex < heaps.size(); ++heapIndex)
+    {
+        auto& heap = heaps[heapIndex];
+
+        /* Skip heaps whose pages are all full, except for a non-empty tail of the last page */
+        bool compact = true;
+        for (std::size_t i = 0; i < heap.pages.size() && compact; ++i)
+        {
+            const auto& page = heap.pages[i];
+            if (!page.freeRanges.empty())
+            {
+                const auto& range = *page.freeRanges.begin();
+                compact =
+                (
+                    i + 1 == heap.pages.size()          &&
+                    page.freeRanges.size() == 1         &&
+                    range.first > 0                     &&
+                    range.first + range.second == page.capacity
+                );
+            }
+        }
+
+        if (compact)
+            continue;
+
+        /* Gather all blocks of this heap in the order of their current location */
+        std::vector<Block*> blocks;
+        for (auto& alloc : allocs_)
+        {
+            if (alloc.live)
+            {
+                auto& block = (vertexHeaps ? alloc.vertexBlock : alloc.indexBlock);
+                if (block.count > 0 && block.heap == heapIndex)
+                    blocks.push_back(&block);
+            }
+        }
+
+        std::sort(
+            blocks.begin(), blocks.end(),
+            [](const Block* lhs, const Block* rhs)
+            {
+                return (lhs->page < rhs->page || (lhs->page == rhs->page && lhs->first < rhs->first));
+            }
+        );
+
+        /* Pack all blocks into new pages and record copy commands from the previous pages */
+        std::vector<Page> pages;
+
+        for (auto block : blocks)
+        {
+            if (pages.empty() || pages.back().numUsed + block->count > pages.back().capacity)
+                pages.push_back(CreatePage(heap, std::max(heap.pageCapacity, block->count)));
+
+            auto& dstPage = pages.back();
+            auto& srcPage = heap.pages[block->page];
+
+            commandBuffer.CopyBuffer(
+                *dstPage.buffer,
+                static_cast<std::uint64_t>(dstPage.numUsed) * heap.stride,
+                *srcPage.buffer,
+                static_cast<std::uint64_t>(block->first) * heap.stride,
+                static_cast<std::uint64_t>(block->count) * heap.stride
+            );
+
+            block->page     = pages.size() - 1;
+            block->first    = dstPage.numUsed;
+            dstPage.numUsed += block->count;
+        }
+
+        /* Update free ranges of new pages */
+        for (auto& page : pages)
+        {
+            page.freeRanges.clear();
+            if (page.numUsed < page.capacity)
+                page.freeRanges[page.numUsed] = page.capacity - page.numUsed;
+        }
+
+        /* Retire previous pages until the copy commands have been completed */
+        for (auto& page : heap.pages)
+            retiredBuffers_.push_back(page.buffer);
+
+        heap.pages = std::move(pages);
+        moved = true;
+    }
+
+    return moved;
+}
+
+void GeometryPool::UpdateRange(Allocation& alloc)
+{
+    const auto& vertexBlock = alloc.vertexBlock;
+    const auto& indexBlock  = alloc.indexBlock;
+
+    alloc.range.vertexBuffer    = vertexHeaps_[vertexBlock.heap].pages[vertexBlock.page].buffer;
+    alloc.range.numVertices     = vertexBlock.count;
+    alloc.range.vertexOffset    = static_cast<std::int32_t>(vertexBlock.first);
+
+    if (indexBlock.count > 0)
+    {
+        alloc.range.indexBuffer = indexHeaps_[indexBlock.heap].pages[indexBlock.page].buffer;
+        alloc.range.numIndices  = indexBlock.count;
+        alloc.range.firstIndex  = indexBlock.first;
+    }
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,81 @@
+/*
+ * InlineConstantsBlock.h
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_INLINE_CONSTANTS_BLOCK_H
+#define LLGL_INLINE_CONSTANTS_BLOCK_H
+
+
+#include <LLGL/PipelineLayoutFlags.h>
+#include "StaticLimits.h"
+#include <algorithm>
+#include <cstring>
+#include <cstdint>
+#include <vector>
+
+
+namespace LLGL
+{
+
+
+/*
+CPU side copy of the inline constants for renderers that emulate them with constant buffers.
+Each inline constant range is stored in its own constant buffer, which must always be updated with the entire range,
+so the data of a partial update is merged with the previous content of the range first.
+*/
+class InlineConstantsBlock
+{
+
+    public:
+
+        /*
+        Writes the specified data into the block and calls the update function for each range that overlaps with the data.
+        The update function must have the signature: void(const InlineConstantsDescriptor& range, const void* rangeData).
+        */
+        template <typename TUpdateFunc>
+        void Update(
+            const std::vector<InlineConstantsDescriptor>&   ranges,
+            long                                            stageFlags,
+            std::uint32_t                                   offset,
+            const void*                                     data,
+            std::uint32_t                                   dataSize,
+            const TUpdateFunc&                              updateFunc)
+        {
+            /* Clamp data to size of the block */
+            if (offset >= LLGL_MAX_INLINE_CONSTANTS_SIZE)
+                return;
+
+            dataSize = std::min(dataSize, LLGL_MAX_INLINE_CONSTANTS_SIZE - offset);
+            ::memcpy(data_ + offset, data, dataSize);
+
+            /* Pass entire content of each affected range to the update function */
+            for (const auto& range : ranges)
+            {
+                if ( (range.stageFlags & stageFlags) != 0 &&
+                     range.offset < offset + dataSize     &&
+                     offset < range.offset + range.size   &&
+                     range.offset + range.size <= LLGL_MAX_INLINE_CONSTANTS_SIZE )
+                {
+                    updateFunc(range, data_ + range.offset);
+                }
+            }
+        }
+
+    private:
+
+        std::uint8_t data_[LLGL_MAX_INLINE_CONSTANTS_SIZE] = {};
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
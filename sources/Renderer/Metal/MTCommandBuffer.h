@@ -12,6 +12,8 @@
 #import <MetalKit/MetalKit.h>
 
 #include <LLGL/CommandBufferExt.h>
+#include "RenderState/MTPipelineLayout.h"
+#include "../InlineConstantsBlock.h"
 #include "../StaticLimits.h"
 
 
@@ -19,7 +21,7 @@ namespace LLGL
 {
 
 
-class MTCommandBuffer : public CommandBufferExt
+class MTCommandBuffer final : public CommandBufferExt
 {
 
     public:
@@ -36,6 +38,22 @@ class MTCommandBuffer : public CommandBufferExt
     
         void UpdateBuffer(Buffer& dstBuffer, std::uint64_t dstOffset, const void* data, std::uint16_t dataSize) override;
         void CopyBuffer(Buffer& dstBuffer, std::uint64_t dstOffset, Buffer& srcBuffer, std::uint64_t srcOffset, std::uint64_t size) override;
+        void FillBuffer(Buffer& dstBuffer, std::uint64_t dstOffset, std::uint32_t value, std::uint64_t fillSize) override;
+
+        void CopyTexture(
+            Texture&                dstTexture,
+            const TextureLocation&  dstLocation,
+            Texture&                srcTexture,
+            const TextureRegion&    srcRegion
+        ) override;
+
+        void BlitTexture(
+            Texture&                dstTexture,
+            const TextureRegion&    dstRegion,
+            Texture&                srcTexture,
+            const TextureRegion&    srcRegion,
+            const SamplerFilter     filter      = SamplerFilter::Linear
+        ) override;
 
         /* ----- Configuration ----- */
 
@@ -91,8 +109,12 @@ class MTCommandBuffer : public CommandBufferExt
 
         /* ----- Resource Heaps ----- */
 
-        void SetGraphicsResourceHeap(ResourceHeap& resourceHeap, std::uint32_t firstSet = 0) override;
-        void SetComputeResourceHeap(ResourceHeap& resourceHeap, std::uint32_t firstSet = 0) override;
+        void SetGraphicsResourceHeap(ResourceHeap& resourceHeap, std::uint32_t firstSet = 0, std::uint32_t numDynamicOffsets = 0, const std::uint32_t* dynamicOffsets = nullptr) override;
+        void SetComputeResourceHeap(ResourceHeap& resourceHeap, std::uint32_t firstSet = 0, std::uint32_t numDynamicOffsets = 0, const std::uint32_t* dynamicOffsets = nullptr) override;
+
+        /* ----- Inline Constants ----- */
+
+        void SetInlineConstants(long stageFlags, std::uint32_t offset, const void* data, std::uint32_t dataSize) override;
 
         /* ----- Render Passes ----- */
 
@@ -118,7 +140,10 @@ class MTCommandBuffer : public CommandBufferExt
         bool QueryResult(Query& query, std::uint64_t& result) override;
         bool QueryPipelineStatisticsResult(Query& query, QueryPipelineStatistics& result) override;
 
+        void CopyQueryResults(std::uint32_t numQueries, Query* const * queries, Buffer& dstBuffer, std::uint64_t dstOffset) override;
+
         void BeginRenderCondition(Query& query, const RenderConditionMode mode) override;
+        void BeginRenderCondition(Buffer& buffer, std::uint64_t offset, const RenderConditionMode mode) override;
         void EndRenderCondition() override;
 
         /* ----- Drawing ----- */
@@ -186,6 +211,9 @@ class MTCommandBuffer : public CommandBufferExt
         MTClearValue                    clearValue_;
         MTLRenderPassDescriptor*        renderPassDesc_         = nullptr;
 
+        const MTPipelineLayout*         boundPipelineLayout_    = nullptr;
+        InlineConstantsBlock            inlineConstants_;
+
 };
 
 
@@ -15,7 +15,10 @@
 #include "Texture/MTTexture.h"
 #include "Texture/MTSampler.h"
 #include "../CheckedCast.h"
+#include "../TextureUtils.h"
 #include <algorithm>
+#include <vector>
+#include <stdexcept>
 
 
 namespace LLGL
@@ -69,6 +72,102 @@ void MTCommandBuffer::CopyBuffer(Buffer& dstBuffer, std::uint64_t dstOffset, Buf
     [blitEncoder endEncoding];
 }
 
+void MTCommandBuffer::FillBuffer(Buffer& dstBuffer, std::uint64_t dstOffset, std::uint32_t value, std::uint64_t fillSize)
+{
+    auto& dstBufferMT = LLGL_CAST(MTBuffer&, dstBuffer);
+
+    id<MTLBlitCommandEncoder> blitEncoder = [cmdBuffer_ blitCommandEncoder];
+
+    const auto valueByte = static_cast<std::uint8_t>(value & 0xFF);
+    if (value == valueByte * 0x01010101u)
+    {
+        /* Fill buffer with blit command, since all bytes of the value are equal */
+        [blitEncoder
+            fillBuffer: dstBufferMT.GetNative()
+            range:      NSMakeRange(static_cast<NSUInteger>(dstOffset), static_cast<NSUInteger>(fillSize))
+            value:      valueByte
+        ];
+    }
+    else
+    {
+        /* Metal can only fill buffers with a single byte value, so copy the fill pattern from an intermediate buffer */
+        std::vector<std::uint32_t> intermediateData(static_cast<std::size_t>(fillSize / sizeof(value)), value);
+        id<MTLBuffer> intermediateBuffer = [[cmdQueue_ device]
+            newBufferWithBytes: intermediateData.data()
+            length:             static_cast<NSUInteger>(fillSize)
+            options:            MTLResourceStorageModeShared
+        ];
+        [blitEncoder
+            copyFromBuffer:     intermediateBuffer
+            sourceOffset:       0
+            toBuffer:           dstBufferMT.GetNative()
+            destinationOffset:  static_cast<NSUInteger>(dstOffset)
+            size:               static_cast<NSUInteger>(fillSize)
+        ];
+
+        /* Command buffer retains the intermediate buffer until it has been completed */
+        [intermediateBuffer release];
+    }
+
+    [blitEncoder endEncoding];
+}
+
+void MTCommandBuffer::CopyTexture(
+    Texture&                dstTexture,
+    const TextureLocation&  dstLocation,
+    Texture&                srcTexture,
+    const TextureRegion&    srcRegion)
+{
+    auto& dstTextureMT = LLGL_CAST(MTTexture&, dstTexture);
+    auto& srcTextureMT = LLGL_CAST(MTTexture&, srcTexture);
+
+    auto srcSubresource = MakeTextureSubresourceRegion(srcTexture.GetType(), srcRegion);
+    auto dstSubresource = MakeTextureSubresourceRegion(dstTexture.GetType(), dstLocation, srcSubresource);
+
+    id<MTLBlitCommandEncoder> blitEncoder = [cmdBuffer_ blitCommandEncoder];
+
+    /* Copy each array layer separately, since Metal texture slices can only be copied one at a time */
+    for (std::uint32_t i = 0; i < srcSubresource.numArrayLayers; ++i)
+    {
+        [blitEncoder
+            copyFromTexture:    srcTextureMT.GetNative()
+            sourceSlice:        static_cast<NSUInteger>(srcSubresource.baseArrayLayer + i)
+            sourceLevel:        static_cast<NSUInteger>(srcSubresource.mipLevel)
+            sourceOrigin:       MTLOriginMake(srcSubresource.offset.x, srcSubresource.offset.y, srcSubresource.offset.z)
+            sourceSize:         MTLSizeMake(srcSubresource.extent.width, srcSubresource.extent.height, srcSubresource.extent.depth)
+            toTexture:          dstTextureMT.GetNative()
+            destinationSlice:   static_cast<NSUInteger>(dstSubresource.baseArrayLayer + i)
+            destinationLevel:   static_cast<NSUInteger>(dstSubresource.mipLevel)
+            destinationOrigin:  MTLOriginMake(dstSubresource.offset.x, dstSubresource.offset.y, dstSubresource.offset.z)
+        ];
+    }
+
+    [blitEncoder endEncoding];
+}
+
+void MTCommandBuffer::BlitTexture(
+    Texture&                dstTexture,
+    const TextureRegion&    dstRegion,
+    Texture&                srcTexture,
+    const TextureRegion&    srcRegion,
+    const SamplerFilter     /*filter*/)
+{
+    /* Metal blit encoders can not scale textures, so only unscaled blits are supported, which are equivalent to a texture copy */
+    if (dstRegion.extent.width  != srcRegion.extent.width  ||
+        dstRegion.extent.height != srcRegion.extent.height ||
+        dstRegion.extent.depth  != srcRegion.extent.depth)
+    {
+        throw std::runtime_error("scaled texture blits are not supported by Metal renderer");
+    }
+
+    TextureLocation dstLocation;
+    {
+        dstLocation.mipLevel    = dstRegion.mipLevel;
+        dstLocation.offset      = dstRegion.offset;
+    }
+    CopyTexture(dstTexture, dstLocation, srcTexture, srcRegion);
+}
+
 /* ----- Configuration ----- */
 
 void MTCommandBuffer::SetGraphicsAPIDependentState(const void* stateDesc, std::size_t stateDescSize)
@@ -395,17 +494,49 @@ void MTCommandBuffer::SetSampler(Sampler& sampler, std::uint32_t slot, long stag
 
 /* ----- Resource Heaps ----- */
 
-void MTCommandBuffer::SetGraphicsResourceHeap(ResourceHeap& resourceHeap, std::uint32_t firstSet)
+void MTCommandBuffer::SetGraphicsResourceHeap(ResourceHeap& resourceHeap, std::uint32_t firstSet, std::uint32_t numDynamicOffsets, const std::uint32_t* dynamicOffsets)
 {
     auto& resourceHeapMT = LLGL_CAST(MTResourceHeap&, resourceHeap);
-    resourceHeapMT.Bind(renderEncoder_, computeEncoder_);
+    resourceHeapMT.Bind(renderEncoder_, computeEncoder_, numDynamicOffsets, dynamicOffsets);
 }
 
-void MTCommandBuffer::SetComputeResourceHeap(ResourceHeap& resourceHeap, std::uint32_t firstSet)
+void MTCommandBuffer::SetComputeResourceHeap(ResourceHeap& resourceHeap, std::uint32_t firstSet, std::uint32_t numDynamicOffsets, const std::uint32_t* dynamicOffsets)
 {
     //todo
 }
 
+/* ----- Inline Constants ----- */
+
+void MTCommandBuffer::SetInlineConstants(long stageFlags, std::uint32_t offset, const void* data, std::uint32_t dataSize)
+{
+    if (boundPipelineLayout_ == nullptr)
+        return;
+
+    inlineConstants_.Update(
+        boundPipelineLayout_->GetInlineConstants(),
+        stageFlags,
+        offset,
+        data,
+        dataSize,
+        [this](const InlineConstantsDescriptor& range, const void* rangeData)
+        {
+            /* Copy entire range directly into the argument table of each shader stage (no buffer required) */
+            if (renderEncoder_ != nil)
+            {
+                if ((range.stageFlags & StageFlags::VertexStage) != 0)
+                    [renderEncoder_ setVertexBytes:rangeData length:range.size atIndex:range.slot];
+                if ((range.stageFlags & StageFlags::FragmentStage) != 0)
+                    [renderEncoder_ setFragmentBytes:rangeData length:range.size atIndex:range.slot];
+            }
+            if (computeEncoder_ != nil)
+            {
+                if ((range.stageFlags & StageFlags::ComputeStage) != 0)
+                    [computeEncoder_ setBytes:rangeData length:range.size atIndex:range.slot];
+            }
+        }
+    );
+}
+
 /* ----- Render Passes ----- */
 
 void MTCommandBuffer::BeginRenderPass(
@@ -471,8 +602,9 @@ void MTCommandBuffer::SetGraphicsPipeline(GraphicsPipeline& graphicsPipeline)
         renderEncoderState_.depthStencilState   = graphicsPipelineMT.GetDepthStencilState();
     }
     
-    /* Store primitive type to subsequent draw commands */
-    primitiveType_ = graphicsPipelineMT.GetMTLPrimitiveType();
+    /* Store primitive type and pipeline layout to subsequent draw commands */
+    primitiveType_          = graphicsPipelineMT.GetMTLPrimitiveType();
+    boundPipelineLayout_    = graphicsPipelineMT.GetPipelineLayout();
 }
 
 void MTCommandBuffer::SetComputePipeline(ComputePipeline& computePipeline)
@@ -504,11 +636,22 @@ bool MTCommandBuffer::QueryPipelineStatisticsResult(Query& query, QueryPipelineS
     return false;
 }
 
+void MTCommandBuffer::CopyQueryResults(std::uint32_t /*numQueries*/, Query* const * /*queries*/, Buffer& /*dstBuffer*/, std::uint64_t /*dstOffset*/)
+{
+    throw std::runtime_error("copying query results into buffers is not supported by Metal renderer");
+}
+
 void MTCommandBuffer::BeginRenderCondition(Query& query, const RenderConditionMode mode)
 {
     //todo
 }
 
+void MTCommandBuffer::BeginRenderCondition(Buffer& /*buffer*/, std::uint64_t /*offset*/, const RenderConditionMode /*mode*/)
+{
+    /* Metal has no predicated rendering */
+    throw std::runtime_error("render conditions from buffers are not supported by Metal renderer");
+}
+
 void MTCommandBuffer::EndRenderCondition()
 {
     //todo
@@ -6,6 +6,7 @@
  */
 
 #include "MTFeatureSet.h"
+#include "../StaticLimits.h"
 #include <initializer_list>
 #include <algorithm>
 
@@ -54,12 +55,20 @@ void LoadFeatureSetCaps(id<MTLDevice> device, MTLFeatureSet fset, RenderingCapab
     features.hasConservativeRasterization   = false;
     features.hasStreamOutputs               = false;
     features.hasLogicOp                     = false;
+    features.hasRenderConditionBuffers      = false;
+    features.hasQueryResultBuffers          = false;
     
     /* Specify limits */
     MTLSize workGroupSize = [device maxThreadsPerThreadgroup];
     limits.maxComputeShaderWorkGroupSize[0] = static_cast<std::uint32_t>(workGroupSize.width);
     limits.maxComputeShaderWorkGroupSize[1] = static_cast<std::uint32_t>(workGroupSize.height);
     limits.maxComputeShaderWorkGroupSize[2] = static_cast<std::uint32_t>(workGroupSize.depth);
+
+    /* Buffer offsets for the constant address space must be aligned to 256 bytes on macOS */
+    limits.minConstantBufferOffsetAlignment = 256;
+
+    /* Inline constants are copied directly into the argument tables (see MTCommandBuffer::SetInlineConstants) */
+    limits.maxInlineConstantsSize           = LLGL_MAX_INLINE_CONSTANTS_SIZE;
 }
 
 
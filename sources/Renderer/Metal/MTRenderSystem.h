@@ -13,6 +13,8 @@
 
 #include <LLGL/RenderSystem.h>
 #include "../ContainerTypes.h"
+#include "../PipelineCache.h"
+#include "../SamplerCache.h"
 
 #include "MTCommandQueue.h"
 #include "MTCommandBuffer.h"
@@ -94,6 +96,8 @@ class MTRenderSystem : public RenderSystem
 
         void Release(Sampler& sampler) override;
 
+        SamplerCacheStatistics GetSamplerCacheStatistics() const override;
+
         /* ----- Resource Heaps ----- */
 
         ResourceHeap* CreateResourceHeap(const ResourceHeapDescriptor& desc) override;
@@ -134,6 +138,8 @@ class MTRenderSystem : public RenderSystem
         void Release(GraphicsPipeline& graphicsPipeline) override;
         void Release(ComputePipeline& computePipeline) override;
 
+        PipelineCacheStatistics GetPipelineCacheStatistics() const override;
+
         /* ----- Queries ----- */
 
         Query* CreateQuery(const QueryDescriptor& desc) override;
@@ -146,6 +152,13 @@ class MTRenderSystem : public RenderSystem
 
         void Release(Fence& fence) override;
 
+        /* ----- Asynchronous Readbacks ----- */
+
+        AsyncReadback* ReadTextureAsync(const Texture& texture, std::uint32_t mipLevel) override;
+        AsyncReadback* ReadBufferAsync(const Buffer& buffer, std::uint64_t offset, std::uint64_t size) override;
+
+        void Release(AsyncReadback& readback) override;
+
     private:
 
         void CreateDeviceResources();
@@ -164,12 +177,14 @@ class MTRenderSystem : public RenderSystem
         HWObjectContainer<MTBufferArray>        bufferArrays_;
         HWObjectContainer<MTTexture>            textures_;
         HWObjectContainer<MTSampler>            samplers_;
+        SamplerCache                            samplerCache_;
         //HWObjectContainer<MTRenderTarget>       renderTargets_;
         HWObjectContainer<MTShader>             shaders_;
         HWObjectContainer<MTShaderProgram>      shaderPrograms_;
         HWObjectContainer<MTPipelineLayout>     pipelineLayouts_;
         HWObjectContainer<MTGraphicsPipeline>   graphicsPipelines_;
         //HWObjectContainer<MTComputePipeline>    computePipelines_;
+        PipelineCache                           pipelineCache_;
         HWObjectContainer<MTResourceHeap>       resourceHeaps_;
         //HWObjectContainer<MTQuery>              queries_;
         //HWObjectContainer<MTFence>              fences_;
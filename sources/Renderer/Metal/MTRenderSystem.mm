@@ -152,12 +152,24 @@ void MTRenderSystem::GenerateMips(Texture& texture, std::uint32_t baseMipLevel,
 
 Sampler* MTRenderSystem::CreateSampler(const SamplerDescriptor& desc)
 {
-    return TakeOwnership(samplers_, MakeUnique<MTSampler>(device_, desc));
+    return samplerCache_.GetOrCreate(
+        desc,
+        [&]()
+        {
+            return TakeOwnership(samplers_, MakeUnique<MTSampler>(device_, desc));
+        }
+    );
 }
 
 void MTRenderSystem::Release(Sampler& sampler)
 {
-    RemoveFromUniqueSet(samplers_, &sampler);
+    if (samplerCache_.Release(sampler))
+        RemoveFromUniqueSet(samplers_, &sampler);
+}
+
+SamplerCacheStatistics MTRenderSystem::GetSamplerCacheStatistics() const
+{
+    return samplerCache_.GetStatistics();
 }
 
 /* ----- Resource Heaps ----- */
@@ -182,6 +194,7 @@ RenderPass* MTRenderSystem::CreateRenderPass(const RenderPassDescriptor& desc)
 
 void MTRenderSystem::Release(RenderPass& renderPass)
 {
+    pipelineCache_.Evict(renderPass);
     //RemoveFromUniqueSet(renderPasses_, &renderPass);
 }
 
@@ -218,6 +231,7 @@ void MTRenderSystem::Release(Shader& shader)
 
 void MTRenderSystem::Release(ShaderProgram& shaderProgram)
 {
+    pipelineCache_.Evict(shaderProgram);
     RemoveFromUniqueSet(shaderPrograms_, &shaderProgram);
 }
 
@@ -230,6 +244,7 @@ PipelineLayout* MTRenderSystem::CreatePipelineLayout(const PipelineLayoutDescrip
 
 void MTRenderSystem::Release(PipelineLayout& pipelineLayout)
 {
+    pipelineCache_.Evict(pipelineLayout);
     RemoveFromUniqueSet(pipelineLayouts_, &pipelineLayout);
 }
 
@@ -237,7 +252,13 @@ void MTRenderSystem::Release(PipelineLayout& pipelineLayout)
 
 GraphicsPipeline* MTRenderSystem::CreateGraphicsPipeline(const GraphicsPipelineDescriptor& desc)
 {
-    return TakeOwnership(graphicsPipelines_, MakeUnique<MTGraphicsPipeline>(device_, desc));
+    return pipelineCache_.GetOrCreate(
+        desc,
+        [&]()
+        {
+            return TakeOwnership(graphicsPipelines_, MakeUnique<MTGraphicsPipeline>(device_, desc));
+        }
+    );
 }
 
 ComputePipeline* MTRenderSystem::CreateComputePipeline(const ComputePipelineDescriptor& desc)
@@ -247,7 +268,8 @@ ComputePipeline* MTRenderSystem::CreateComputePipeline(const ComputePipelineDesc
 
 void MTRenderSystem::Release(GraphicsPipeline& graphicsPipeline)
 {
-    RemoveFromUniqueSet(graphicsPipelines_, &graphicsPipeline);
+    if (pipelineCache_.Release(graphicsPipeline))
+        RemoveFromUniqueSet(graphicsPipelines_, &graphicsPipeline);
 }
 
 void MTRenderSystem::Release(ComputePipeline& computePipeline)
@@ -256,6 +278,11 @@ void MTRenderSystem::Release(ComputePipeline& computePipeline)
     //RemoveFromUniqueSet(computePipelines_, &computePipeline);
 }
 
+PipelineCacheStatistics MTRenderSystem::GetPipelineCacheStatistics() const
+{
+    return pipelineCache_.GetStatistics();
+}
+
 /* ----- Queries ----- */
 
 Query* MTRenderSystem::CreateQuery(const QueryDescriptor& desc)
@@ -282,6 +309,23 @@ void MTRenderSystem::Release(Fence& fence)
     //RemoveFromUniqueSet(fences_, &fence);
 }
 
+/* ----- Asynchronous Readbacks ----- */
+
+AsyncReadback* MTRenderSystem::ReadTextureAsync(const Texture& texture, std::uint32_t mipLevel)
+{
+    throw std::runtime_error("asynchronous readbacks are not supported by Metal renderer");
+}
+
+AsyncReadback* MTRenderSystem::ReadBufferAsync(const Buffer& buffer, std::uint64_t offset, std::uint64_t size)
+{
+    throw std::runtime_error("asynchronous readbacks are not supported by Metal renderer");
+}
+
+void MTRenderSystem::Release(AsyncReadback& readback)
+{
+    throw std::runtime_error("asynchronous readbacks are not supported by Metal renderer");
+}
+
 
 /*
  * ======= Private: =======
@@ -140,6 +140,16 @@ MTLPixelFormat ToMTLPixelFormat(const Format format)
         case Format::BC1RGBA:           return MTLPixelFormatBC1_RGBA;
         case Format::BC2RGBA:           return MTLPixelFormatBC2_RGBA;
         case Format::BC3RGBA:           return MTLPixelFormatBC3_RGBA;
+        case Format::BC4RUNorm:         return MTLPixelFormatBC4_RUnorm;
+        case Format::BC4RSNorm:         return MTLPixelFormatBC4_RSnorm;
+        case Format::BC5RGUNorm:        return MTLPixelFormatBC5_RGUnorm;
+        case Format::BC5RGSNorm:        return MTLPixelFormatBC5_RGSnorm;
+        case Format::BC6HRGBUFloat:     return MTLPixelFormatBC6H_RGBUfloat;
+        case Format::BC6HRGBSFloat:     return MTLPixelFormatBC6H_RGBFloat;
+        case Format::BC7RGBAUNorm:      return MTLPixelFormatBC7_RGBAUnorm;
+        case Format::ETC2RGB8UNorm:     break;
+        case Format::ETC2RGB8A1UNorm:   break;
+        case Format::ETC2RGBA8UNorm:    break;
     }
     MapFailed("Format", "MTLPixelFormat");
 }
@@ -390,6 +400,13 @@ Format ToFormat(const MTLPixelFormat pixelFormat)
         case MTLPixelFormatBC1_RGBA:                return Format::BC1RGBA;
         case MTLPixelFormatBC2_RGBA:                return Format::BC2RGBA;
         case MTLPixelFormatBC3_RGBA:                return Format::BC3RGBA;
+        case MTLPixelFormatBC4_RUnorm:              return Format::BC4RUNorm;
+        case MTLPixelFormatBC4_RSnorm:              return Format::BC4RSNorm;
+        case MTLPixelFormatBC5_RGUnorm:             return Format::BC5RGUNorm;
+        case MTLPixelFormatBC5_RGSnorm:             return Format::BC5RGSNorm;
+        case MTLPixelFormatBC6H_RGBUfloat:          return Format::BC6HRGBUFloat;
+        case MTLPixelFormatBC6H_RGBFloat:           return Format::BC6HRGBSFloat;
+        case MTLPixelFormatBC7_RGBAUnorm:           return Format::BC7RGBAUNorm;
         
         default:                                    break;
     }
@@ -13,6 +13,7 @@
 
 #include <LLGL/GraphicsPipeline.h>
 #include <LLGL/ForwardDecls.h>
+#include "MTPipelineLayout.h"
 
 
 namespace LLGL
@@ -41,11 +42,18 @@ class MTGraphicsPipeline : public GraphicsPipeline
             return primitiveType_;
         }
 
+        // Returns the pipeline layout this graphics pipeline was created with, or null if there is none.
+        inline const MTPipelineLayout* GetPipelineLayout() const
+        {
+            return pipelineLayout_;
+        }
+
     private:
 
         id<MTLRenderPipelineState>  renderPipelineState_    = nil;
         id<MTLDepthStencilState>    depthStencilState_      = nil;
         MTLPrimitiveType            primitiveType_          = MTLPrimitiveTypeTriangle;
+        const MTPipelineLayout*     pipelineLayout_         = nullptr;
 
 };
 
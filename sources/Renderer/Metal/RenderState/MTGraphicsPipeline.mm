@@ -44,7 +44,8 @@ MTGraphicsPipeline::MTGraphicsPipeline(id<MTLDevice> device, const GraphicsPipel
         throw std::invalid_argument("failed to create graphics pipeline due to missing shader program");
     
     /* Convert standalone parameters */
-    primitiveType_ = MTTypes::ToMTLPrimitiveType(desc.primitiveTopology);
+    primitiveType_  = MTTypes::ToMTLPrimitiveType(desc.primitiveTopology);
+    pipelineLayout_ = LLGL_CAST(const MTPipelineLayout*, desc.pipelineLayout);
 
     /* Create render pipeline state */
     MTLRenderPipelineDescriptor* renderPipelineDesc = [[MTLRenderPipelineDescriptor alloc] init];
@@ -35,9 +35,12 @@ class MTResourceHeap : public ResourceHeap
 
         MTResourceHeap(const ResourceHeapDescriptor& desc);
 
+        // Binds all resources; constant buffers with dynamic offsets are bound at the respective offsets.
         void Bind(
             id<MTLRenderCommandEncoder>     renderEncoder,
-            id<MTLComputeCommandEncoder>    computeEncoder
+            id<MTLComputeCommandEncoder>    computeEncoder,
+            std::uint32_t                   numDynamicOffsets   = 0,
+            const std::uint32_t*            dynamicOffsets      = nullptr
         );
 
     private:
@@ -48,6 +51,7 @@ class MTResourceHeap : public ResourceHeap
         void BuildBufferSegments(ResourceBindingIterator& resourceIterator, long stage, std::uint8_t& numSegments);
         void BuildTextureSegments(ResourceBindingIterator& resourceIterator, long stage, std::uint8_t& numSegments);
         void BuildSamplerSegments(ResourceBindingIterator& resourceIterator, long stage, std::uint8_t& numSegments);
+        void BuildDynamicBuffers(ResourceBindingIterator& resourceIterator);
 
         void BuildAllSegments(
             const std::vector<MTResourceBinding>&   resourceBindings,
@@ -82,8 +86,17 @@ class MTResourceHeap : public ResourceHeap
             std::uint8_t numKernelSamplerSegments;
         };
 
-        SegmentationHeader          segmentationHeader_;
-        std::vector<std::int8_t>    buffer_;
+        // Constant buffer that is bound with a dynamic offset.
+        struct MTDynamicBuffer
+        {
+            id<MTLBuffer>   buffer;
+            NSUInteger      slot;
+            long            stageFlags;
+        };
+
+        SegmentationHeader              segmentationHeader_;
+        std::vector<std::int8_t>        buffer_;
+        std::vector<MTDynamicBuffer>    dynamicBuffers_;
 
 };
 
@@ -129,11 +129,16 @@ MTResourceHeap::MTResourceHeap(const ResourceHeapDescriptor& desc)
     {
         segmentationHeader_.hasKernelResources = 1;
     }
+
+    /* Build list of constant buffers with dynamic offsets */
+    BuildDynamicBuffers(resourceIterator);
 }
 
 void MTResourceHeap::Bind(
     id<MTLRenderCommandEncoder>     renderEncoder,
-    id<MTLComputeCommandEncoder>    computeEncoder)
+    id<MTLComputeCommandEncoder>    computeEncoder,
+    std::uint32_t                   numDynamicOffsets,
+    const std::uint32_t*            dynamicOffsets)
 {
     auto byteAlignedBuffer = buffer_.data();
     if (segmentationHeader_.hasVertexResources)
@@ -142,6 +147,18 @@ void MTResourceHeap::Bind(
         BindFragmentResources(renderEncoder, byteAlignedBuffer);
     //if (segmentationHeader_.hasKernelResources)
     //    BindKernelResources(computeEncoder, byteAlignedBuffer);
+
+    /* Bind constant buffers at their dynamic offsets */
+    for (std::size_t i = 0; i < dynamicBuffers_.size(); ++i)
+    {
+        const auto& dynamicBuffer = dynamicBuffers_[i];
+        NSUInteger offset = (i < numDynamicOffsets ? dynamicOffsets[i] : 0u);
+
+        if ((dynamicBuffer.stageFlags & (StageFlags::VertexStage | StageFlags::TessEvaluationStage)) != 0)
+            [renderEncoder setVertexBuffer:dynamicBuffer.buffer offset:offset atIndex:dynamicBuffer.slot];
+        if ((dynamicBuffer.stageFlags & StageFlags::FragmentStage) != 0)
+            [renderEncoder setFragmentBuffer:dynamicBuffer.buffer offset:offset atIndex:dynamicBuffer.slot];
+    }
 }
 
 
@@ -230,6 +247,18 @@ void MTResourceHeap::BuildBufferSegments(ResourceBindingIterator& resourceIterat
     );
 }
 
+void MTResourceHeap::BuildDynamicBuffers(ResourceBindingIterator& resourceIterator)
+{
+    BindingDescriptor bindingDesc;
+    resourceIterator.Reset(ResourceType::ConstantBuffer, StageFlags::AllStages, true);
+
+    while (auto resource = resourceIterator.Next(bindingDesc))
+    {
+        auto bufferMT = LLGL_CAST(MTBuffer*, resource);
+        dynamicBuffers_.push_back({ bufferMT->GetNative(), static_cast<NSUInteger>(bindingDesc.slot), bindingDesc.stageFlags });
+    }
+}
+
 void MTResourceHeap::BuildTextureSegments(ResourceBindingIterator& resourceIterator, long stage, std::uint8_t& numSegments)
 {
     /* Collect all textures */
@@ -0,0 +1,173 @@
+/*
+ * GLAsyncReadback.cpp
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "GLAsyncReadback.h"
+#include "GLBuffer.h"
+#include "../Texture/GLTexture.h"
+#include "../RenderState/GLStateManager.h"
+#include "../Ext/GLExtensions.h"
+#include "../../GLCommon/GLTypes.h"
+#include "../../GLCommon/GLExtensionRegistry.h"
+#include "../../../Core/Helper.h"
+#include <limits>
+
+
+namespace LLGL
+{
+
+
+GLAsyncReadback::GLAsyncReadback(GLsizeiptr size) :
+    size_ { size }
+{
+    /* Create pixel-pack buffer with storage for reading data back to the CPU */
+    glGenBuffers(1, &id_);
+    GLStateManager::active->PushBoundBuffer(GLBufferTarget::PIXEL_PACK_BUFFER);
+    {
+        GLStateManager::active->BindBuffer(GLBufferTarget::PIXEL_PACK_BUFFER, id_);
+        glBufferData(GL_PIXEL_PACK_BUFFER, size, nullptr, GL_STREAM_READ);
+    }
+    GLStateManager::active->PopBoundBuffer();
+}
+
+GLAsyncReadback::~GLAsyncReadback()
+{
+    glDeleteBuffers(1, &id_);
+    GLStateManager::active->NotifyBufferRelease(id_, GLBufferTarget::PIXEL_PACK_BUFFER);
+    GLStateManager::active->NotifyBufferRelease(id_, GLBufferTarget::COPY_WRITE_BUFFER);
+}
+
+bool GLAsyncReadback::Poll()
+{
+    /* Check if fence has been signaled without waiting (the fence is not queried again once it has been signaled) */
+    if (!signaled_)
+        signaled_ = fence_.Wait(0);
+    return signaled_;
+}
+
+bool GLAsyncReadback::Wait(std::uint64_t timeout)
+{
+    if (!signaled_)
+        signaled_ = fence_.Wait(timeout);
+    return signaled_;
+}
+
+const void* GLAsyncReadback::Map()
+{
+    /* Wait until the copy operation has been completed, then map readback buffer for read access */
+    Wait(std::numeric_limits<std::uint64_t>::max());
+
+    void* data = nullptr;
+
+    GLStateManager::active->PushBoundBuffer(GLBufferTarget::PIXEL_PACK_BUFFER);
+    {
+        GLStateManager::active->BindBuffer(GLBufferTarget::PIXEL_PACK_BUFFER, id_);
+        data = glMapBuffer(GL_PIXEL_PACK_BUFFER, GL_READ_ONLY);
+    }
+    GLStateManager::active->PopBoundBuffer();
+
+    return data;
+}
+
+void GLAsyncReadback::Unmap()
+{
+    GLStateManager::active->PushBoundBuffer(GLBufferTarget::PIXEL_PACK_BUFFER);
+    {
+        GLStateManager::active->BindBuffer(GLBufferTarget::PIXEL_PACK_BUFFER, id_);
+        glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+    }
+    GLStateManager::active->PopBoundBuffer();
+}
+
+std::uint64_t GLAsyncReadback::GetSize() const
+{
+    return static_cast<std::uint64_t>(size_);
+}
+
+void GLAsyncReadback::ReadTexture(const GLTexture& texture, GLint mipLevel, GLenum format, GLenum type)
+{
+    /*
+    Read image data into the pixel-pack buffer, i.e. the data pointer is an offset into the buffer.
+    The previous pixel-pack buffer is restored, so synchronous reads into CPU memory are not affected.
+    */
+    GLStateManager::active->PushBoundBuffer(GLBufferTarget::PIXEL_PACK_BUFFER);
+    {
+        GLStateManager::active->BindBuffer(GLBufferTarget::PIXEL_PACK_BUFFER, id_);
+
+        /* Pack rows without padding, since the readback buffer is sized for tightly packed rows */
+        GLint prevPackAlignment = 4;
+        glGetIntegerv(GL_PACK_ALIGNMENT, &prevPackAlignment);
+        glPixelStorei(GL_PACK_ALIGNMENT, 1);
+
+        #if defined GL_ARB_direct_state_access && defined LLGL_GL_ENABLE_DSA_EXT
+        if (HasExtension(GLExt::ARB_direct_state_access))
+        {
+            glGetTextureImage(texture.GetID(), mipLevel, format, type, static_cast<GLsizei>(size_), nullptr);
+        }
+        else
+        #endif
+        {
+            GLStateManager::active->BindTexture(texture);
+            glGetTexImage(GLTypes::Map(texture.GetType()), mipLevel, format, type, nullptr);
+        }
+
+        glPixelStorei(GL_PACK_ALIGNMENT, prevPackAlignment);
+    }
+    GLStateManager::active->PopBoundBuffer();
+
+    /* Submit fence after the copy operation */
+    signaled_ = false;
+    fence_.Submit();
+}
+
+void GLAsyncReadback::ReadBuffer(const GLBuffer& buffer, GLintptr offset)
+{
+    #if defined GL_ARB_direct_state_access && defined LLGL_GL_ENABLE_DSA_EXT
+    if (HasExtension(GLExt::ARB_direct_state_access))
+    {
+        /* Copy buffer directly (GL 4.5+) */
+        glCopyNamedBufferSubData(buffer.GetID(), id_, offset, 0, size_);
+    }
+    else
+    #endif // /GL_ARB_direct_state_access
+    #ifdef GL_ARB_copy_buffer
+    if (HasExtension(GLExt::ARB_copy_buffer))
+    {
+        /* Bind source and readback buffer for copy operation (GL 3.1+) */
+        GLStateManager::active->BindBuffer(GLBufferTarget::COPY_READ_BUFFER, buffer.GetID());
+        GLStateManager::active->BindBuffer(GLBufferTarget::COPY_WRITE_BUFFER, id_);
+        glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, offset, 0, size_);
+    }
+    else
+    #endif // /GL_ARB_copy_buffer
+    {
+        /* Emulate buffer copy operation (this is not asynchronous) */
+        auto intermediateBuffer = MakeUniqueArray<char>(static_cast<std::size_t>(size_));
+
+        /* Read source buffer data */
+        GLStateManager::active->BindBuffer(buffer);
+        glGetBufferSubData(GLTypes::Map(buffer.GetType()), offset, size_, intermediateBuffer.get());
+
+        /* Write readback buffer data */
+        GLStateManager::active->PushBoundBuffer(GLBufferTarget::PIXEL_PACK_BUFFER);
+        {
+            GLStateManager::active->BindBuffer(GLBufferTarget::PIXEL_PACK_BUFFER, id_);
+            glBufferSubData(GL_PIXEL_PACK_BUFFER, 0, size_, intermediateBuffer.get());
+        }
+        GLStateManager::active->PopBoundBuffer();
+    }
+
+    /* Submit fence after the copy operation */
+    signaled_ = false;
+    fence_.Submit();
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,64 @@
+/*
+ * GLAsyncReadback.h
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_GL_ASYNC_READBACK_H
+#define LLGL_GL_ASYNC_READBACK_H
+
+
+#include <LLGL/AsyncReadback.h>
+#include "../RenderState/GLFence.h"
+#include "../OpenGL.h"
+
+
+namespace LLGL
+{
+
+
+class GLBuffer;
+class GLTexture;
+
+// Asynchronous readback with a pixel-pack buffer, which is synchronized with a GL fence.
+class GLAsyncReadback final : public AsyncReadback
+{
+
+    public:
+
+        GLAsyncReadback(GLsizeiptr size);
+        ~GLAsyncReadback();
+
+        bool Poll() override;
+        bool Wait(std::uint64_t timeout) override;
+
+        const void* Map() override;
+        void Unmap() override;
+
+        std::uint64_t GetSize() const override;
+
+        // Records the copy operation of the specified texture MIP-map level into the readback buffer.
+        void ReadTexture(const GLTexture& texture, GLint mipLevel, GLenum format, GLenum type);
+
+        // Records the copy operation of the specified buffer range into the readback buffer.
+        void ReadBuffer(const GLBuffer& buffer, GLintptr offset);
+
+    private:
+
+        GLuint      id_         = 0;
+        GLsizeiptr  size_       = 0;
+        GLFence     fence_;
+        bool        signaled_   = false;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
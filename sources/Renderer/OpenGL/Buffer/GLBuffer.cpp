@@ -11,6 +11,7 @@
 #include "../../GLCommon/GLTypes.h"
 #include "../../GLCommon/GLExtensionRegistry.h"
 #include "../../../Core/Helper.h"
+#include <algorithm>
 #include <memory>
 
 
@@ -116,6 +117,37 @@ void GLBuffer::CopyBufferSubData(const GLBuffer& readBuffer, GLintptr readOffset
     }
 }
 
+void GLBuffer::ClearBufferSubData(GLintptr offset, GLsizeiptr size, std::uint32_t value)
+{
+    #if defined GL_ARB_direct_state_access && defined LLGL_GL_ENABLE_DSA_EXT
+    if (HasExtension(GLExt::ARB_direct_state_access))
+    {
+        /* Clear buffer directly (GL 4.5+) */
+        glClearNamedBufferSubData(GetID(), GL_R32UI, offset, size, GL_RED_INTEGER, GL_UNSIGNED_INT, &value);
+    }
+    else
+    #endif // /GL_ARB_direct_state_access
+    #ifdef GL_ARB_clear_buffer_object
+    if (HasExtension(GLExt::ARB_clear_buffer_object))
+    {
+        /* Bind and clear buffer (GL 4.3+) */
+        GLStateManager::active->BindBuffer(*this);
+        glClearBufferSubData(GLTypes::Map(GetType()), GL_R32UI, offset, size, GL_RED_INTEGER, GL_UNSIGNED_INT, &value);
+    }
+    else
+    #endif // /GL_ARB_clear_buffer_object
+    {
+        /* Emulate buffer clear operation with an intermediate buffer */
+        const auto numValues = static_cast<std::size_t>(size) / sizeof(value);
+        auto intermediateBuffer = MakeUniqueArray<std::uint32_t>(numValues);
+        std::fill(intermediateBuffer.get(), intermediateBuffer.get() + numValues, value);
+
+        /* Write destination buffer data */
+        GLStateManager::active->BindBuffer(*this);
+        glBufferSubData(GLTypes::Map(GetType()), offset, size, intermediateBuffer.get());
+    }
+}
+
 void* GLBuffer::MapBuffer(GLenum access)
 {
     #if defined GL_ARB_direct_state_access && defined LLGL_GL_ENABLE_DSA_EXT
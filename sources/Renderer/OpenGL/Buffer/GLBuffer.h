@@ -28,6 +28,7 @@ class GLBuffer : public Buffer
         void BufferStorage(GLsizeiptr size, const void* data, GLbitfield flags, GLenum usage);
         void BufferSubData(GLintptr offset, GLsizeiptr size, const void* data);
         void CopyBufferSubData(const GLBuffer& readBuffer, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size);
+        void ClearBufferSubData(GLintptr offset, GLsizeiptr size, std::uint32_t value);
         void* MapBuffer(GLenum access);
         void UnmapBuffer();
 
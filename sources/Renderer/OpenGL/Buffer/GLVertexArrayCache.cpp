@@ -0,0 +1,89 @@
+/*
+ * GLVertexArrayCache.cpp
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "GLVertexArrayCache.h"
+#include "../RenderState/GLStateManager.h"
+#include "../Ext/GLExtensionLoader.h"
+#include "../../../Core/Helper.h"
+
+
+namespace LLGL
+{
+
+
+/* ----- Vertex array cache ----- */
+
+bool GLVertexArrayCache::IsSupported(const VertexFormat& vertexFormat)
+{
+    if (!HasExtension(GLExt::ARB_vertex_attrib_binding))
+        return false;
+
+    /* Instance divisor is a state of the binding point, so all attributes of the format must share the same divisor */
+    for (const auto& attrib : vertexFormat.attributes)
+    {
+        if (attrib.instanceDivisor != vertexFormat.attributes.front().instanceDivisor)
+            return false;
+    }
+
+    return true;
+}
+
+std::shared_ptr<GLVertexArrayObject> GLVertexArrayCache::GetOrCreate(std::size_t numVertexFormats, const VertexFormat* const * vertexFormats)
+{
+    auto& entry = entries_[MakeKey(numVertexFormats, vertexFormats)];
+
+    /* Share cached VAO if it is still in use */
+    if (auto vao = entry.lock())
+        return vao;
+
+    /* Build new VAO with one binding point for each vertex format */
+    auto vao = std::make_shared<GLVertexArrayObject>();
+
+    GLStateManager::active->BindVertexArray(vao->GetID());
+    {
+        for (std::uint32_t i = 0, j = 0; i < numVertexFormats; ++i)
+        {
+            for (const auto& attrib : vertexFormats[i]->attributes)
+                vao->BuildVertexAttributeFormat(attrib, j++, i);
+        }
+    }
+    GLStateManager::active->BindVertexArray(0);
+
+    entry = vao;
+
+    return vao;
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+std::string GLVertexArrayCache::MakeKey(std::size_t numVertexFormats, const VertexFormat* const * vertexFormats)
+{
+    /* Stride is not part of the key, since it is specified when the vertex buffer is bound */
+    std::string key;
+    for (std::size_t i = 0; i < numVertexFormats; ++i)
+    {
+        const auto& attribs = vertexFormats[i]->attributes;
+        AppendKey(key, attribs.size());
+        for (const auto& attrib : attribs)
+        {
+            AppendKey(key, attrib.format);
+            AppendKey(key, attrib.offset);
+            AppendKey(key, attrib.instanceDivisor);
+        }
+    }
+    return key;
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,56 @@
+/*
+ * GLVertexArrayCache.h
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_GL_VERTEX_ARRAY_CACHE_H
+#define LLGL_GL_VERTEX_ARRAY_CACHE_H
+
+
+#include <LLGL/VertexFormat.h>
+#include "GLVertexArrayObject.h"
+#include <unordered_map>
+#include <memory>
+#include <string>
+
+
+namespace LLGL
+{
+
+
+/*
+Cache for vertex-array-objects (VAOs) whose vertex formats are separated from the vertex buffers (GL_ARB_vertex_attrib_binding).
+Such a VAO only depends on the vertex formats of its binding points, so all vertex buffers and buffer arrays with equal formats share the same VAO,
+and switching between them only rebinds the vertex buffers with 'glBindVertexBuffer'.
+VAOs are released as soon as they are no longer referenced by any vertex buffer.
+*/
+class GLVertexArrayCache
+{
+
+    public:
+
+        // Returns true if shared VAOs are supported for the specified vertex format, i.e. all attributes can be described by a single binding point.
+        static bool IsSupported(const VertexFormat& vertexFormat);
+
+        // Returns the shared VAO for the specified vertex formats (one binding point per format), or builds a new one on a cache miss.
+        std::shared_ptr<GLVertexArrayObject> GetOrCreate(std::size_t numVertexFormats, const VertexFormat* const * vertexFormats);
+
+    private:
+
+        static std::string MakeKey(std::size_t numVertexFormats, const VertexFormat* const * vertexFormats);
+
+        std::unordered_map<std::string, std::weak_ptr<GLVertexArrayObject>> entries_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -78,6 +78,58 @@ void GLVertexArrayObject::BuildVertexAttribute(const VertexAttribute& attribute,
     }
 }
 
+void GLVertexArrayObject::BuildVertexAttributeFormat(const VertexAttribute& attribute, std::uint32_t index, std::uint32_t bindingIndex)
+{
+    #ifdef GL_ARB_vertex_attrib_binding
+
+    /* Enable array index in currently bound VAO */
+    glEnableVertexAttribArray(index);
+
+    /* Get data type and components of vector type */
+    DataType        dataType    = DataType::Float32;
+    std::uint32_t   components  = 0;
+    SplitFormat(attribute.format, dataType, components);
+
+    auto isNormalizedFormat = IsNormalizedFormat(attribute.format);
+    auto isFloatFormat      = IsFloatFormat(attribute.format);
+
+    /* Specify vertex format independently of any VBO; the buffer is bound to the binding point later */
+    if (!isNormalizedFormat && !isFloatFormat)
+    {
+        if (HasExtension(GLExt::EXT_gpu_shader4))
+        {
+            glVertexAttribIFormat(
+                index,
+                components,
+                GLTypes::Map(dataType),
+                attribute.offset
+            );
+        }
+        else
+            ThrowNotSupportedExcept(__FUNCTION__, "integral vertex attributes");
+    }
+    else
+    {
+        glVertexAttribFormat(
+            index,
+            components,
+            GLTypes::Map(dataType),
+            GLBoolean(isNormalizedFormat),
+            attribute.offset
+        );
+    }
+
+    /* Assign attribute to binding point; the instance divisor is a state of the binding point */
+    glVertexAttribBinding(index, bindingIndex);
+    glVertexBindingDivisor(bindingIndex, attribute.instanceDivisor);
+
+    #else
+
+    ThrowNotSupportedExcept(__FUNCTION__, "GL_ARB_vertex_attrib_binding");
+
+    #endif // /GL_ARB_vertex_attrib_binding
+}
+
 
 } // /namespace LLGL
 
@@ -27,6 +27,9 @@ class GLVertexArrayObject
 
         void BuildVertexAttribute(const VertexAttribute& attribute, std::uint32_t stride, std::uint32_t index);
 
+        //! Builds the vertex attribute format at the specified index and assigns it to the vertex buffer binding point (requires GL_ARB_vertex_attrib_binding).
+        void BuildVertexAttributeFormat(const VertexAttribute& attribute, std::uint32_t index, std::uint32_t bindingIndex);
+
         //! Returns the ID of the hardware vertex-array-object (VAO)
         inline GLuint GetID() const
         {
@@ -6,7 +6,10 @@
  */
 
 #include "GLVertexBuffer.h"
+#include "GLVertexArrayCache.h"
 #include "../RenderState/GLStateManager.h"
+#include "../Ext/GLExtensions.h"
+#include "../../../Core/Helper.h"
 
 
 namespace LLGL
@@ -18,22 +21,61 @@ GLVertexBuffer::GLVertexBuffer() :
 {
 }
 
-void GLVertexBuffer::BuildVertexArray(const VertexFormat& vertexFormat)
+void GLVertexBuffer::BuildVertexArray(const VertexFormat& vertexFormat, bool deferred)
 {
+    /* Store vertex format (required if this buffer is used in a buffer array) */
+    vertexFormat_ = vertexFormat;
+
+    /* Share VAO with other vertex buffers of the same format if the format is separated from the buffer binding */
+    sharedVao_ = GLVertexArrayCache::IsSupported(vertexFormat);
+
+    /* Build VAO immediately or with the first call to "GetVaoID" */
+    vao_.reset();
+    if (!deferred)
+        BuildVertexArrayObject();
+}
+
+void GLVertexBuffer::Bind(GLStateManager& stateMngr)
+{
+    stateMngr.BindVertexArray(GetVaoID());
+
+    #ifdef GL_ARB_vertex_attrib_binding
+    if (sharedVao_)
+    {
+        /* Bind this buffer to the binding point of the shared VAO */
+        glBindVertexBuffer(0, GetID(), 0, static_cast<GLsizei>(vertexFormat_.stride));
+    }
+    #endif // /GL_ARB_vertex_attrib_binding
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+void GLVertexBuffer::BuildVertexArrayObject()
+{
+    if (sharedVao_)
+    {
+        /* Get shared VAO from the cache of the active GL context; the buffer itself is bound with every call to "Bind" */
+        const VertexFormat* vertexFormat = &vertexFormat_;
+        vao_ = GLStateManager::active->GetVertexArrayCache().GetOrCreate(1, &vertexFormat);
+        return;
+    }
+
+    vao_ = std::make_shared<GLVertexArrayObject>();
+
     /* Bind VAO */
-    GLStateManager::active->BindVertexArray(GetVaoID());
+    GLStateManager::active->BindVertexArray(vao_->GetID());
     {
         /* Bind VBO */
         GLStateManager::active->BindBuffer(GLBufferTarget::ARRAY_BUFFER, GetID());
 
         /* Build each vertex attribute */
-        for (std::uint32_t i = 0, n = static_cast<std::uint32_t>(vertexFormat.attributes.size()); i < n; ++i)
-            vao_.BuildVertexAttribute(vertexFormat.attributes[i], vertexFormat.stride, i);
+        for (std::uint32_t i = 0, n = static_cast<std::uint32_t>(vertexFormat_.attributes.size()); i < n; ++i)
+            vao_->BuildVertexAttribute(vertexFormat_.attributes[i], vertexFormat_.stride, i);
     }
     GLStateManager::active->BindVertexArray(0);
-
-    /* Store vertex format (required if this buffer is used in a buffer array) */
-    vertexFormat_ = vertexFormat;
 }
 
 
@@ -11,12 +11,15 @@
 
 #include "GLBuffer.h"
 #include "GLVertexArrayObject.h"
+#include <memory>
 
 
 namespace LLGL
 {
 
 
+class GLStateManager;
+
 class GLVertexBuffer final : public GLBuffer
 {
 
@@ -24,12 +27,22 @@ class GLVertexBuffer final : public GLBuffer
 
         GLVertexBuffer();
 
-        void BuildVertexArray(const VertexFormat& vertexFormat);
+        /**
+        \brief Stores the vertex format and builds the VAO. If 'deferred' is true, the VAO is built with the first call to 'GetVaoID' (VAOs are not shared between GL contexts).
+        \remarks If the vertex format is supported by the VAO cache, this buffer shares its VAO with all other vertex buffers of the same format,
+        using the VAO cache of the GL context that is active when the VAO is built.
+        */
+        void BuildVertexArray(const VertexFormat& vertexFormat, bool deferred = false);
+
+        //! Binds the VAO, and binds this buffer to the binding point of the VAO if the VAO is shared.
+        void Bind(GLStateManager& stateMngr);
 
-        //! Returns the ID of the vertex-array-object (VAO)
-        inline GLuint GetVaoID() const
+        //! Returns the ID of the vertex-array-object (VAO), and builds the VAO if it has been deferred.
+        inline GLuint GetVaoID()
         {
-            return vao_.GetID();
+            if (!vao_)
+                BuildVertexArrayObject();
+            return vao_->GetID();
         }
 
         //! Returns the vertex format.
@@ -40,8 +53,11 @@ class GLVertexBuffer final : public GLBuffer
 
     private:
 
-        GLVertexArrayObject vao_;
-        VertexFormat        vertexFormat_;
+        void BuildVertexArrayObject();
+
+        std::shared_ptr<GLVertexArrayObject>    vao_;
+        VertexFormat                            vertexFormat_;
+        bool                                    sharedVao_          = false;
 
 };
 
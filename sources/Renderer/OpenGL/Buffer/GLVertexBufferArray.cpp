@@ -7,7 +7,10 @@
 
 #include "GLVertexBufferArray.h"
 #include "GLVertexBuffer.h"
+#include "GLVertexArrayCache.h"
 #include "../RenderState/GLStateManager.h"
+#include "../Ext/GLExtensions.h"
+#include "../Ext/GLExtensionLoader.h"
 #include "../../CheckedCast.h"
 
 
@@ -22,6 +25,70 @@ GLVertexBufferArray::GLVertexBufferArray() :
 
 void GLVertexBufferArray::BuildVertexArray(std::uint32_t numBuffers, Buffer* const * bufferArray)
 {
+    /* Gather vertex formats of all buffers */
+    std::vector<const VertexFormat*> vertexFormats;
+    vertexFormats.reserve(numBuffers);
+
+    bool sharedVao = true;
+
+    for (std::uint32_t i = 0; i < numBuffers; ++i)
+    {
+        auto vertexBufferGL = LLGL_CAST(GLVertexBuffer*, bufferArray[i]);
+        const auto& vertexFormat = vertexBufferGL->GetVertexFormat();
+        if (!GLVertexArrayCache::IsSupported(vertexFormat))
+            sharedVao = false;
+        vertexFormats.push_back(&vertexFormat);
+    }
+
+    if (sharedVao)
+    {
+        /* Get shared VAO from the cache of the active GL context with one binding point per buffer; the buffers themselves are bound with every call to "Bind" */
+        vao_ = GLStateManager::active->GetVertexArrayCache().GetOrCreate(vertexFormats.size(), vertexFormats.data());
+
+        BuildArray(numBuffers, bufferArray);
+        offsets_.resize(numBuffers, 0);
+        strides_.reserve(numBuffers);
+        for (auto vertexFormat : vertexFormats)
+            strides_.push_back(static_cast<GLsizei>(vertexFormat->stride));
+    }
+    else
+        BuildVertexArrayObject(numBuffers, bufferArray);
+}
+
+void GLVertexBufferArray::Bind(GLStateManager& stateMngr)
+{
+    stateMngr.BindVertexArray(GetVaoID());
+
+    #ifdef GL_ARB_vertex_attrib_binding
+    if (!strides_.empty())
+    {
+        /* Bind all buffers to the binding points of the shared VAO */
+        const auto& idArray = GetIDArray();
+        const auto  count   = static_cast<GLsizei>(idArray.size());
+
+        #ifdef GL_ARB_multi_bind
+        if (HasExtension(GLExt::ARB_multi_bind))
+        {
+            glBindVertexBuffers(0, count, idArray.data(), offsets_.data(), strides_.data());
+            return;
+        }
+        #endif // /GL_ARB_multi_bind
+
+        for (GLsizei i = 0; i < count; ++i)
+            glBindVertexBuffer(static_cast<GLuint>(i), idArray[i], offsets_[i], strides_[i]);
+    }
+    #endif // /GL_ARB_vertex_attrib_binding
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+void GLVertexBufferArray::BuildVertexArrayObject(std::uint32_t numBuffers, Buffer* const * bufferArray)
+{
+    vao_ = std::make_shared<GLVertexArrayObject>();
+
     /* Bind VAO */
     GLStateManager::active->BindVertexArray(GetVaoID());
     {
@@ -36,7 +103,7 @@ void GLVertexBufferArray::BuildVertexArray(std::uint32_t numBuffers, Buffer* con
 
                 /* Build each vertex attribute */
                 for (std::uint32_t j = 0, n = static_cast<std::uint32_t>(vertexFormat.attributes.size()); j < n; ++j, ++i)
-                    vao_.BuildVertexAttribute(vertexFormat.attributes[j], vertexFormat.stride, i);
+                    vao_->BuildVertexAttribute(vertexFormat.attributes[j], vertexFormat.stride, i);
             }
             ++bufferArray;
         }
@@ -44,7 +111,6 @@ void GLVertexBufferArray::BuildVertexArray(std::uint32_t numBuffers, Buffer* con
     GLStateManager::active->BindVertexArray(0);
 }
 
-
 } // /namespace LLGL
 
 
@@ -11,12 +11,15 @@
 
 #include "GLBufferArray.h"
 #include "GLVertexArrayObject.h"
+#include <memory>
 
 
 namespace LLGL
 {
 
 
+class GLStateManager;
+
 class GLVertexBufferArray final : public GLBufferArray
 {
 
@@ -24,17 +27,27 @@ class GLVertexBufferArray final : public GLBufferArray
 
         GLVertexBufferArray();
 
+        //! Builds the VAO, or shares it with other buffer arrays of the same vertex formats if all formats are supported by the VAO cache.
         void BuildVertexArray(std::uint32_t numBuffers, Buffer* const * bufferArray);
 
+        //! Binds the VAO, and binds all buffers to the binding points of the VAO if the VAO is shared.
+        void Bind(GLStateManager& stateMngr);
+
         //! Returns the ID of the vertex-array-object (VAO)
         inline GLuint GetVaoID() const
         {
-            return vao_.GetID();
+            return vao_->GetID();
         }
 
     private:
 
-        GLVertexArrayObject vao_;
+        void BuildVertexArrayObject(std::uint32_t numBuffers, Buffer* const * bufferArray);
+
+        std::shared_ptr<GLVertexArrayObject>    vao_;
+
+        // Binding points of the shared VAO (empty if the VAO is not shared)
+        std::vector<GLintptr>                   offsets_;
+        std::vector<GLsizei>                    strides_;
 
 };
 
@@ -10,6 +10,8 @@
 #include "GLExtensionsNull.h"
 #include <LLGL/Log.h>
 #include <functional>
+#include <atomic>
+#include <string>
 
 
 namespace LLGL
@@ -61,21 +63,84 @@ static void ExtractExtensionsFromString(GLExtensionList& extensions, const std::
 
 #ifndef __APPLE__
 
+// Global member to store if the extension procedures are loaded on their first call
+static bool g_lazyProcLoading = false;
+
+/*
+Trampoline for lazily loaded OpenGL procedures. The procedure pointer is initialized with the 'Invoke' function,
+which resolves the actual procedure address on the first call and forwards all calls to it.
+The procedure pointer itself is never patched after registration, because the procedures are also called from the
+worker threads of the upload context pool (see GLUploadContextPool). Instead, the resolved address is stored atomically.
+A procedure that cannot be resolved is reported once and all its calls are ignored, since GL calls must not throw
+(e.g. from within destructors).
+*/
+template <typename TProc, TProc* ProcAddr>
+struct GLProcTrampoline;
+
+template <typename TRet, typename... TArgs, TRet (APIENTRY** ProcAddr)(TArgs...)>
+struct GLProcTrampoline<TRet (APIENTRY*)(TArgs...), ProcAddr>
+{
+    using ProcType = TRet (APIENTRY*)(TArgs...);
+
+    static const char*              procName;
+    static std::atomic<ProcType>    resolvedProc;
+    static std::atomic<bool>        unresolved;
+
+    static TRet APIENTRY Invoke(TArgs... args)
+    {
+        auto proc = resolvedProc.load(std::memory_order_acquire);
+
+        if (proc == nullptr && !unresolved.load(std::memory_order_relaxed))
+        {
+            /* Resolve procedure address; concurrent threads resolve the same address, so no further synchronization is required */
+            if (LoadGLProc(proc, procName))
+                resolvedProc.store(proc, std::memory_order_release);
+            else
+                unresolved.store(true, std::memory_order_relaxed);
+        }
+
+        if (proc != nullptr)
+            return proc(args...);
+
+        return TRet();
+    }
+};
+
+template <typename TRet, typename... TArgs, TRet (APIENTRY** ProcAddr)(TArgs...)>
+const char* GLProcTrampoline<TRet (APIENTRY*)(TArgs...), ProcAddr>::procName = nullptr;
+
+template <typename TRet, typename... TArgs, TRet (APIENTRY** ProcAddr)(TArgs...)>
+std::atomic<TRet (APIENTRY*)(TArgs...)> GLProcTrampoline<TRet (APIENTRY*)(TArgs...), ProcAddr>::resolvedProc { nullptr };
+
+template <typename TRet, typename... TArgs, TRet (APIENTRY** ProcAddr)(TArgs...)>
+std::atomic<bool> GLProcTrampoline<TRet (APIENTRY*)(TArgs...), ProcAddr>::unresolved { false };
+
+template <typename TProc, TProc* ProcAddr>
+void LoadGLProcLazy(const char* procName)
+{
+    GLProcTrampoline<TProc, ProcAddr>::procName = procName;
+    *ProcAddr = GLProcTrampoline<TProc, ProcAddr>::Invoke;
+}
+
 #define LOAD_GLPROC_SIMPLE(NAME) \
     LoadGLProc(NAME, #NAME)
 
 #ifdef LLGL_GL_ENABLE_EXT_PLACEHOLDERS
 
-#define LOAD_GLPROC(NAME)               \
-    if (usePlaceholder)                 \
-        NAME = Dummy_##NAME;            \
-    else if (!LoadGLProc(NAME, #NAME))  \
+#define LOAD_GLPROC(NAME)                               \
+    if (usePlaceholder)                                 \
+        NAME = Dummy_##NAME;                            \
+    else if (g_lazyProcLoading)                         \
+        LoadGLProcLazy<decltype(NAME), &NAME>(#NAME);   \
+    else if (!LoadGLProc(NAME, #NAME))                  \
         return false
 
 #else
 
-#define LOAD_GLPROC(NAME)           \
-    if (!LoadGLProc(NAME, #NAME))   \
+#define LOAD_GLPROC(NAME)                               \
+    if (g_lazyProcLoading)                              \
+        LoadGLProcLazy<decltype(NAME), &NAME>(#NAME);   \
+    else if (!LoadGLProc(NAME, #NAME))                  \
         return false
 
 #endif // /LLGL_GL_ENABLE_EXT_PLACEHOLDERS
@@ -181,6 +246,7 @@ static bool Load_GL_ARB_uniform_buffer_object(bool usePlaceholder)
     LOAD_GLPROC( glGetActiveUniformBlockName );
     LOAD_GLPROC( glUniformBlockBinding       );
     LOAD_GLPROC( glBindBufferBase            );
+    LOAD_GLPROC( glBindBufferRange           );
     return true;
 }
 
@@ -570,6 +636,19 @@ static bool Load_GL_ARB_copy_buffer(bool usePlaceholder)
     return true;
 }
 
+static bool Load_GL_ARB_copy_image(bool usePlaceholder)
+{
+    LOAD_GLPROC( glCopyImageSubData );
+    return true;
+}
+
+static bool Load_GL_ARB_clear_buffer_object(bool usePlaceholder)
+{
+    LOAD_GLPROC( glClearBufferData    );
+    LOAD_GLPROC( glClearBufferSubData );
+    return true;
+}
+
 static bool Load_GL_ARB_polygon_offset_clamp(bool usePlaceholder)
 {
     LOAD_GLPROC( glPolygonOffsetClamp );
@@ -596,6 +675,40 @@ static bool Load_GL_ARB_framebuffer_no_attachments(bool usePlaceholder)
     return true;
 }
 
+static bool Load_GL_ARB_invalidate_subdata(bool usePlaceholder)
+{
+    LOAD_GLPROC( glInvalidateTexSubImage    );
+    LOAD_GLPROC( glInvalidateTexImage       );
+    LOAD_GLPROC( glInvalidateBufferSubData  );
+    LOAD_GLPROC( glInvalidateBufferData     );
+    LOAD_GLPROC( glInvalidateFramebuffer    );
+    LOAD_GLPROC( glInvalidateSubFramebuffer );
+    return true;
+}
+
+static bool Load_GL_ARB_vertex_attrib_binding(bool usePlaceholder)
+{
+    LOAD_GLPROC( glBindVertexBuffer     );
+    LOAD_GLPROC( glVertexAttribFormat   );
+    LOAD_GLPROC( glVertexAttribIFormat  );
+    LOAD_GLPROC( glVertexAttribLFormat  );
+    LOAD_GLPROC( glVertexAttribBinding  );
+    LOAD_GLPROC( glVertexBindingDivisor );
+    return true;
+}
+
+static bool Load_GL_ARB_sparse_buffer(bool usePlaceholder)
+{
+    LOAD_GLPROC( glBufferPageCommitmentARB );
+    return true;
+}
+
+static bool Load_GL_ARB_sparse_texture(bool usePlaceholder)
+{
+    LOAD_GLPROC( glTexPageCommitmentARB );
+    return true;
+}
+
 static bool Load_GL_ARB_direct_state_access(bool usePlaceholder)
 {
     LOAD_GLPROC( glCreateTransformFeedbacks                 );
@@ -762,7 +875,7 @@ GLExtensionList QueryExtensions(bool coreProfile)
 // Global member to store if the extension have already been loaded
 static bool g_extAlreadyLoaded = false;
 
-void LoadAllExtensions(GLExtensionList& extensions, bool coreProfile)
+void LoadAllExtensions(GLExtensionList& extensions, bool coreProfile, bool lazyProcLoading)
 {
     /* Only load GL extensions once */
     if (g_extAlreadyLoaded)
@@ -825,11 +938,17 @@ void LoadAllExtensions(GLExtensionList& extensions, bool coreProfile)
     ENABLE_GLEXT( EXT_texture_array                );
     ENABLE_GLEXT( ARB_texture_cube_map_array       );
     ENABLE_GLEXT( ARB_geometry_shader4             );
+    ENABLE_GLEXT( ARB_texture_compression_rgtc     );
+    ENABLE_GLEXT( ARB_texture_swizzle              );
+    ENABLE_GLEXT( ARB_query_buffer_object          );
 
     #undef ENABLE_GLEXT
 
     #else
 
+    /* Only determine available extensions here, if their procedures are loaded on demand */
+    g_lazyProcLoading = lazyProcLoading;
+
     auto LoadExtension = [&](const std::string& extName, const std::function<bool(bool)>& extLoadingProc, GLExt extensionID) -> void
     {
         /* Try to load OpenGL extension */
@@ -936,10 +1055,16 @@ void LoadAllExtensions(GLExtensionList& extensions, bool coreProfile)
     LOAD_GLEXT( ARB_texture_storage_multisample  );
     LOAD_GLEXT( ARB_buffer_storage               );
     LOAD_GLEXT( ARB_copy_buffer                  );
+    LOAD_GLEXT( ARB_copy_image                   );
+    LOAD_GLEXT( ARB_clear_buffer_object          );
     LOAD_GLEXT( ARB_polygon_offset_clamp         );
     LOAD_GLEXT( ARB_texture_view                 );
     LOAD_GLEXT( ARB_shader_image_load_store      );
     LOAD_GLEXT( ARB_framebuffer_no_attachments   );
+    LOAD_GLEXT( ARB_invalidate_subdata           );
+    LOAD_GLEXT( ARB_vertex_attrib_binding        );
+    LOAD_GLEXT( ARB_sparse_buffer                );
+    LOAD_GLEXT( ARB_sparse_texture               );
     #ifdef LLGL_GL_ENABLE_DSA_EXT
     LOAD_GLEXT( ARB_direct_state_access          );
     #endif
@@ -952,6 +1077,11 @@ void LoadAllExtensions(GLExtensionList& extensions, bool coreProfile)
     ENABLE_GLEXT( NV_conservative_raster           );
     ENABLE_GLEXT( INTEL_conservative_rasterization );
     ENABLE_GLEXT( ARB_pipeline_statistics_query    );
+    ENABLE_GLEXT( ARB_texture_compression_rgtc     );
+    ENABLE_GLEXT( ARB_texture_compression_bptc     );
+    ENABLE_GLEXT( ARB_ES3_compatibility            );
+    ENABLE_GLEXT( ARB_texture_swizzle              );
+    ENABLE_GLEXT( ARB_query_buffer_object          );
 
     #undef LOAD_GLEXT
     #undef ENABLE_GLEXT
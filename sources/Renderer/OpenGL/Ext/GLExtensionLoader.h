@@ -36,9 +36,11 @@ Loads all available extensions and prints errors if an extension is available,
 but their respective functions could not be loaded.
 \param[in,out] extensions Specifies the extension map. This can be queried by the "QueryExtensions" function.
 The respective entry will be set to true if all its functions have been loaded successfully.
+\param[in] lazyProcLoading Specifies whether the extension procedures are only resolved on their first call.
+In this case, the procedure pointers of all available extensions are initialized with trampolines, that patch themselves on the first call.
 \see QueryExtensions
 */
-void LoadAllExtensions(GLExtensionList& extensions, bool coreProfile);
+void LoadAllExtensions(GLExtensionList& extensions, bool coreProfile, bool lazyProcLoading = false);
 
 //! Returns true if all available extensions have been loaded.
 bool AreExtensionsLoaded();
@@ -394,6 +394,15 @@ PFNGLBUFFERSTORAGEPROC                                  glBufferStorage
 
 PFNGLCOPYBUFFERSUBDATAPROC                              glCopyBufferSubData                             = nullptr;
 
+/* GL_ARB_copy_image */
+
+PFNGLCOPYIMAGESUBDATAPROC                               glCopyImageSubData                              = nullptr;
+
+/* GL_ARB_clear_buffer_object */
+
+PFNGLCLEARBUFFERDATAPROC                                glClearBufferData                               = nullptr;
+PFNGLCLEARBUFFERSUBDATAPROC                             glClearBufferSubData                            = nullptr;
+
 /* GL_ARB_polygon_offset_clamp */
 
 PFNGLPOLYGONOFFSETCLAMPPROC                             glPolygonOffsetClamp                            = nullptr;
@@ -412,6 +421,32 @@ PFNGLMEMORYBARRIERPROC                                  glMemoryBarrier
 PFNGLFRAMEBUFFERPARAMETERIPROC                          glFramebufferParameteri                         = nullptr;
 PFNGLGETFRAMEBUFFERPARAMETERIVPROC                      glGetFramebufferParameteriv                     = nullptr;
 
+/* GL_ARB_invalidate_subdata */
+
+PFNGLINVALIDATETEXSUBIMAGEPROC                          glInvalidateTexSubImage                         = nullptr;
+PFNGLINVALIDATETEXIMAGEPROC                             glInvalidateTexImage                            = nullptr;
+PFNGLINVALIDATEBUFFERSUBDATAPROC                        glInvalidateBufferSubData                       = nullptr;
+PFNGLINVALIDATEBUFFERDATAPROC                           glInvalidateBufferData                          = nullptr;
+PFNGLINVALIDATEFRAMEBUFFERPROC                          glInvalidateFramebuffer                         = nullptr;
+PFNGLINVALIDATESUBFRAMEBUFFERPROC                       glInvalidateSubFramebuffer                      = nullptr;
+
+/* GL_ARB_vertex_attrib_binding */
+
+PFNGLBINDVERTEXBUFFERPROC                               glBindVertexBuffer                              = nullptr;
+PFNGLVERTEXATTRIBFORMATPROC                             glVertexAttribFormat                            = nullptr;
+PFNGLVERTEXATTRIBIFORMATPROC                            glVertexAttribIFormat                           = nullptr;
+PFNGLVERTEXATTRIBLFORMATPROC                            glVertexAttribLFormat                           = nullptr;
+PFNGLVERTEXATTRIBBINDINGPROC                            glVertexAttribBinding                           = nullptr;
+PFNGLVERTEXBINDINGDIVISORPROC                           glVertexBindingDivisor                          = nullptr;
+
+/* GL_ARB_sparse_buffer */
+
+PFNGLBUFFERPAGECOMMITMENTARBPROC                        glBufferPageCommitmentARB                       = nullptr;
+
+/* GL_ARB_sparse_texture */
+
+PFNGLTEXPAGECOMMITMENTARBPROC                           glTexPageCommitmentARB                          = nullptr;
+
 /* GL_ARB_direct_state_access */
 
 PFNGLCREATETRANSFORMFEEDBACKSPROC                       glCreateTransformFeedbacks                      = nullptr;
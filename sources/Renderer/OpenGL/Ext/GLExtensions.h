@@ -397,6 +397,15 @@ extern PFNGLBUFFERSTORAGEPROC                               glBufferStorage;
 
 extern PFNGLCOPYBUFFERSUBDATAPROC                           glCopyBufferSubData;
 
+/* GL_ARB_copy_image */
+
+extern PFNGLCOPYIMAGESUBDATAPROC                            glCopyImageSubData;
+
+/* GL_ARB_clear_buffer_object */
+
+extern PFNGLCLEARBUFFERDATAPROC                             glClearBufferData;
+extern PFNGLCLEARBUFFERSUBDATAPROC                          glClearBufferSubData;
+
 /* GL_ARB_polygon_offset_clamp */
 
 extern PFNGLPOLYGONOFFSETCLAMPPROC                          glPolygonOffsetClamp;
@@ -415,6 +424,32 @@ extern PFNGLMEMORYBARRIERPROC                               glMemoryBarrier;
 extern PFNGLFRAMEBUFFERPARAMETERIPROC                       glFramebufferParameteri;
 extern PFNGLGETFRAMEBUFFERPARAMETERIVPROC                   glGetFramebufferParameteriv;
 
+/* GL_ARB_invalidate_subdata */
+
+extern PFNGLINVALIDATETEXSUBIMAGEPROC                       glInvalidateTexSubImage;
+extern PFNGLINVALIDATETEXIMAGEPROC                          glInvalidateTexImage;
+extern PFNGLINVALIDATEBUFFERSUBDATAPROC                     glInvalidateBufferSubData;
+extern PFNGLINVALIDATEBUFFERDATAPROC                        glInvalidateBufferData;
+extern PFNGLINVALIDATEFRAMEBUFFERPROC                       glInvalidateFramebuffer;
+extern PFNGLINVALIDATESUBFRAMEBUFFERPROC                    glInvalidateSubFramebuffer;
+
+/* GL_ARB_vertex_attrib_binding */
+
+extern PFNGLBINDVERTEXBUFFERPROC                            glBindVertexBuffer;
+extern PFNGLVERTEXATTRIBFORMATPROC                          glVertexAttribFormat;
+extern PFNGLVERTEXATTRIBIFORMATPROC                         glVertexAttribIFormat;
+extern PFNGLVERTEXATTRIBLFORMATPROC                         glVertexAttribLFormat;
+extern PFNGLVERTEXATTRIBBINDINGPROC                         glVertexAttribBinding;
+extern PFNGLVERTEXBINDINGDIVISORPROC                        glVertexBindingDivisor;
+
+/* GL_ARB_sparse_buffer */
+
+extern PFNGLBUFFERPAGECOMMITMENTARBPROC                     glBufferPageCommitmentARB;
+
+/* GL_ARB_sparse_texture */
+
+extern PFNGLTEXPAGECOMMITMENTARBPROC                        glTexPageCommitmentARB;
+
 /* GL_ARB_direct_state_access */
 
 extern PFNGLCREATETRANSFORMFEEDBACKSPROC                    glCreateTransformFeedbacks;
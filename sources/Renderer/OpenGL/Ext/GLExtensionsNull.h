@@ -424,6 +424,15 @@ DECL_GLPROC(void, glBufferStorage, (GLenum, GLsizeiptr, const void*, GLbitfield)
 
 DECL_GLPROC(void, glCopyBufferSubData, (GLenum, GLenum, GLintptr, GLintptr, GLsizeiptr));
 
+/* GL_ARB_copy_image */
+
+DECL_GLPROC(void, glCopyImageSubData, (GLuint, GLenum, GLint, GLint, GLint, GLint, GLuint, GLenum, GLint, GLint, GLint, GLint, GLsizei, GLsizei, GLsizei));
+
+/* GL_ARB_clear_buffer_object */
+
+DECL_GLPROC(void, glClearBufferData, (GLenum, GLenum, GLenum, GLenum, const void*));
+DECL_GLPROC(void, glClearBufferSubData, (GLenum, GLenum, GLintptr, GLsizeiptr, GLenum, GLenum, const void*));
+
 /* GL_ARB_polygon_offset_clamp */
 
 DECL_GLPROC(void, glPolygonOffsetClamp, (GLfloat, GLfloat, GLfloat));
@@ -442,6 +451,32 @@ DECL_GLPROC(void, glMemoryBarrier, (GLbitfield));
 DECL_GLPROC(void, glFramebufferParameteri, (GLenum, GLenum, GLint));
 DECL_GLPROC(void, glGetFramebufferParameteriv, (GLenum, GLenum, GLint*));
 
+/* GL_ARB_invalidate_subdata */
+
+DECL_GLPROC(void, glInvalidateTexSubImage, (GLuint, GLint, GLint, GLint, GLint, GLsizei, GLsizei, GLsizei));
+DECL_GLPROC(void, glInvalidateTexImage, (GLuint, GLint));
+DECL_GLPROC(void, glInvalidateBufferSubData, (GLuint, GLintptr, GLsizeiptr));
+DECL_GLPROC(void, glInvalidateBufferData, (GLuint));
+DECL_GLPROC(void, glInvalidateFramebuffer, (GLenum, GLsizei, const GLenum*));
+DECL_GLPROC(void, glInvalidateSubFramebuffer, (GLenum, GLsizei, const GLenum*, GLint, GLint, GLsizei, GLsizei));
+
+/* GL_ARB_vertex_attrib_binding */
+
+DECL_GLPROC(void, glBindVertexBuffer, (GLuint, GLuint, GLintptr, GLsizei));
+DECL_GLPROC(void, glVertexAttribFormat, (GLuint, GLint, GLenum, GLboolean, GLuint));
+DECL_GLPROC(void, glVertexAttribIFormat, (GLuint, GLint, GLenum, GLuint));
+DECL_GLPROC(void, glVertexAttribLFormat, (GLuint, GLint, GLenum, GLuint));
+DECL_GLPROC(void, glVertexAttribBinding, (GLuint, GLuint));
+DECL_GLPROC(void, glVertexBindingDivisor, (GLuint, GLuint));
+
+/* GL_ARB_sparse_buffer */
+
+DECL_GLPROC(void, glBufferPageCommitmentARB, (GLenum, GLintptr, GLsizeiptr, GLboolean));
+
+/* GL_ARB_sparse_texture */
+
+DECL_GLPROC(void, glTexPageCommitmentARB, (GLenum, GLint, GLint, GLint, GLint, GLsizei, GLsizei, GLsizei, GLboolean));
+
 /* GL_ARB_direct_state_access */
 
 DECL_GLPROC(void, glCreateTransformFeedbacks, (GLsizei, GLuint*));
@@ -13,6 +13,7 @@
 #include "Ext/GLExtensionLoader.h"
 #include "../CheckedCast.h"
 #include "../StaticLimits.h"
+#include "../TextureUtils.h"
 #include "../../Core/Assertion.h"
 
 #include "Shader/GLShaderProgram.h"
@@ -32,16 +33,30 @@
 #include "RenderState/GLRenderPass.h"
 #include "RenderState/GLQuery.h"
 
+#include <stdexcept>
+
 
 namespace LLGL
 {
 
 
+// Size (in bytes) of the ring buffer for inline constants; it is orphaned each time it wraps around.
+static const GLsizeiptr g_inlineConstantsBufferSize = 65536;
+
 GLCommandBuffer::GLCommandBuffer(const std::shared_ptr<GLStateManager>& stateMngr) :
     stateMngr_ { stateMngr }
 {
 }
 
+GLCommandBuffer::~GLCommandBuffer()
+{
+    if (inlineConstantsBuffer_ != 0)
+    {
+        glDeleteBuffers(1, &inlineConstantsBuffer_);
+        stateMngr_->NotifyBufferRelease(inlineConstantsBuffer_, GLBufferTarget::UNIFORM_BUFFER);
+    }
+}
+
 /* ----- Encoding ----- */
 
 void GLCommandBuffer::Begin()
@@ -72,6 +87,69 @@ void GLCommandBuffer::CopyBuffer(Buffer& dstBuffer, std::uint64_t dstOffset, Buf
     );
 }
 
+void GLCommandBuffer::FillBuffer(Buffer& dstBuffer, std::uint64_t dstOffset, std::uint32_t value, std::uint64_t fillSize)
+{
+    auto& dstBufferGL = LLGL_CAST(GLBuffer&, dstBuffer);
+    dstBufferGL.ClearBufferSubData(static_cast<GLintptr>(dstOffset), static_cast<GLsizeiptr>(fillSize), value);
+}
+
+void GLCommandBuffer::CopyTexture(
+    Texture&                dstTexture,
+    const TextureLocation&  dstLocation,
+    Texture&                srcTexture,
+    const TextureRegion&    srcRegion)
+{
+    auto& dstTextureGL = LLGL_CAST(GLTexture&, dstTexture);
+    auto& srcTextureGL = LLGL_CAST(GLTexture&, srcTexture);
+
+    #ifdef GL_ARB_copy_image
+    if (HasExtension(GLExt::ARB_copy_image))
+    {
+        /* Copy texture region directly (GL 4.3+); the texture region layout matches the GL conventions for array layers and cube faces */
+        glCopyImageSubData(
+            srcTextureGL.GetID(),
+            GLTypes::Map(srcTexture.GetType()),
+            static_cast<GLint>(srcRegion.mipLevel),
+            srcRegion.offset.x,
+            srcRegion.offset.y,
+            srcRegion.offset.z,
+            dstTextureGL.GetID(),
+            GLTypes::Map(dstTexture.GetType()),
+            static_cast<GLint>(dstLocation.mipLevel),
+            dstLocation.offset.x,
+            dstLocation.offset.y,
+            dstLocation.offset.z,
+            static_cast<GLsizei>(srcRegion.extent.width),
+            static_cast<GLsizei>(srcRegion.extent.height),
+            static_cast<GLsizei>(srcRegion.extent.depth)
+        );
+    }
+    else
+    #endif // /GL_ARB_copy_image
+    {
+        /* Emulate texture copy with an unscaled framebuffer blit */
+        TextureRegion dstRegion;
+        {
+            dstRegion.mipLevel  = dstLocation.mipLevel;
+            dstRegion.offset    = dstLocation.offset;
+            dstRegion.extent    = srcRegion.extent;
+        }
+        BlitTextureWithFramebuffers(dstTextureGL, dstRegion, srcTextureGL, srcRegion, GL_NEAREST);
+    }
+}
+
+void GLCommandBuffer::BlitTexture(
+    Texture&                dstTexture,
+    const TextureRegion&    dstRegion,
+    Texture&                srcTexture,
+    const TextureRegion&    srcRegion,
+    const SamplerFilter     filter)
+{
+    auto& dstTextureGL = LLGL_CAST(GLTexture&, dstTexture);
+    auto& srcTextureGL = LLGL_CAST(GLTexture&, srcTexture);
+    BlitTextureWithFramebuffers(dstTextureGL, dstRegion, srcTextureGL, srcRegion, GLTypes::Map(filter));
+}
+
 /* ----- Configuration ----- */
 
 void GLCommandBuffer::SetGraphicsAPIDependentState(const void* stateDesc, std::size_t stateDescSize)
@@ -268,14 +346,14 @@ void GLCommandBuffer::SetVertexBuffer(Buffer& buffer)
 {
     /* Bind vertex buffer */
     auto& vertexBufferGL = LLGL_CAST(GLVertexBuffer&, buffer);
-    stateMngr_->BindVertexArray(vertexBufferGL.GetVaoID());
+    vertexBufferGL.Bind(*stateMngr_);
 }
 
 void GLCommandBuffer::SetVertexBufferArray(BufferArray& bufferArray)
 {
     /* Bind vertex buffer */
     auto& vertexBufferArrayGL = LLGL_CAST(GLVertexBufferArray&, bufferArray);
-    stateMngr_->BindVertexArray(vertexBufferArrayGL.GetVaoID());
+    vertexBufferArrayGL.Bind(*stateMngr_);
 }
 
 void GLCommandBuffer::SetIndexBuffer(Buffer& buffer)
@@ -374,14 +452,34 @@ void GLCommandBuffer::SetSampler(Sampler& sampler, std::uint32_t slot, long /*st
 
 /* ----- Resource Heaps ----- */
 
-void GLCommandBuffer::SetGraphicsResourceHeap(ResourceHeap& resourceHeap, std::uint32_t /*startSlot*/)
+void GLCommandBuffer::SetGraphicsResourceHeap(ResourceHeap& resourceHeap, std::uint32_t /*startSlot*/, std::uint32_t numDynamicOffsets, const std::uint32_t* dynamicOffsets)
 {
-    SetResourceHeap(resourceHeap);
+    SetResourceHeap(resourceHeap, numDynamicOffsets, dynamicOffsets);
 }
 
-void GLCommandBuffer::SetComputeResourceHeap(ResourceHeap& resourceHeap, std::uint32_t /*startSlot*/)
+void GLCommandBuffer::SetComputeResourceHeap(ResourceHeap& resourceHeap, std::uint32_t /*startSlot*/, std::uint32_t numDynamicOffsets, const std::uint32_t* dynamicOffsets)
 {
-    SetResourceHeap(resourceHeap);
+    SetResourceHeap(resourceHeap, numDynamicOffsets, dynamicOffsets);
+}
+
+/* ----- Inline Constants ----- */
+
+void GLCommandBuffer::SetInlineConstants(long stageFlags, std::uint32_t offset, const void* data, std::uint32_t dataSize)
+{
+    if (boundPipelineLayout_ != nullptr)
+    {
+        inlineConstants_.Update(
+            boundPipelineLayout_->GetInlineConstants(),
+            stageFlags,
+            offset,
+            data,
+            dataSize,
+            [this](const InlineConstantsDescriptor& range, const void* rangeData)
+            {
+                WriteInlineConstantsRange(range, rangeData);
+            }
+        );
+    }
 }
 
 /* ----- Render Passes ----- */
@@ -398,17 +496,26 @@ void GLCommandBuffer::BeginRenderPass(
     else
         BindRenderTarget(LLGL_CAST(GLRenderTarget&, renderTarget));
 
-    /* Clear attachments */
+    /* Invalidate attachments whose previous content is not required, and clear attachments */
     if (renderPass)
     {
         auto renderPassGL = LLGL_CAST(const GLRenderPass*, renderPass);
+        InvalidateAttachments(renderPassGL->GetNumInvalidateOnBegin(), renderPassGL->GetInvalidateOnBegin());
         ClearAttachmentsWithRenderPass(*renderPassGL, numClearValues, clearValues);
+        boundRenderPass_ = renderPassGL;
     }
+    else
+        boundRenderPass_ = nullptr;
 }
 
 void GLCommandBuffer::EndRenderPass()
 {
-    // dummy
+    /* Invalidate attachments whose outcome is not required */
+    if (boundRenderPass_)
+    {
+        InvalidateAttachments(boundRenderPass_->GetNumInvalidateOnEnd(), boundRenderPass_->GetInvalidateOnEnd());
+        boundRenderPass_ = nullptr;
+    }
 }
 
 /* ----- Pipeline States ----- */
@@ -419,14 +526,16 @@ void GLCommandBuffer::SetGraphicsPipeline(GraphicsPipeline& graphicsPipeline)
     auto& graphicsPipelineGL = LLGL_CAST(GLGraphicsPipeline&, graphicsPipeline);
     graphicsPipelineGL.Bind(*stateMngr_);
 
-    /* Store draw modes */
-    renderState_.drawMode = graphicsPipelineGL.GetDrawMode();
+    /* Store draw modes and pipeline layout for inline constants */
+    renderState_.drawMode   = graphicsPipelineGL.GetDrawMode();
+    boundPipelineLayout_    = graphicsPipelineGL.GetPipelineLayout();
 }
 
 void GLCommandBuffer::SetComputePipeline(ComputePipeline& computePipeline)
 {
     auto& computePipelineGL = LLGL_CAST(GLComputePipeline&, computePipeline);
     computePipelineGL.Bind(*stateMngr_);
+    boundPipelineLayout_ = computePipelineGL.GetPipelineLayout();
 }
 
 /* ----- Queries ----- */
@@ -546,12 +655,35 @@ bool GLCommandBuffer::QueryPipelineStatisticsResult(Query& query, QueryPipelineS
     return true;
 }
 
+void GLCommandBuffer::CopyQueryResults(std::uint32_t numQueries, Query* const * queries, Buffer& dstBuffer, std::uint64_t dstOffset)
+{
+    auto& dstBufferGL = LLGL_CAST(GLBuffer&, dstBuffer);
+
+    /* While a buffer is bound to GL_QUERY_BUFFER, the result pointer is interpreted as offset into that buffer (GL_ARB_query_buffer_object) */
+    stateMngr_->BindBuffer(GLBufferTarget::QUERY_BUFFER, dstBufferGL.GetID());
+
+    for (std::uint32_t i = 0; i < numQueries; ++i)
+    {
+        auto& queryGL = LLGL_CAST(GLQuery&, *queries[i]);
+        auto offset = static_cast<std::uintptr_t>(dstOffset + i * sizeof(GLuint64));
+        glGetQueryObjectui64v(queryGL.GetFirstID(), GL_QUERY_RESULT, reinterpret_cast<GLuint64*>(offset));
+    }
+
+    stateMngr_->BindBuffer(GLBufferTarget::QUERY_BUFFER, 0);
+}
+
 void GLCommandBuffer::BeginRenderCondition(Query& query, const RenderConditionMode mode)
 {
     auto& queryGL = LLGL_CAST(GLQuery&, query);
     glBeginConditionalRender(queryGL.GetFirstID(), GLTypes::Map(mode));
 }
 
+void GLCommandBuffer::BeginRenderCondition(Buffer& /*buffer*/, std::uint64_t /*offset*/, const RenderConditionMode /*mode*/)
+{
+    /* GL conditional rendering only works with query objects, but not with query results that have been written into buffers */
+    throw std::runtime_error("render conditions from buffers are not supported by OpenGL renderer");
+}
+
 void GLCommandBuffer::EndRenderCondition()
 {
     glEndConditionalRender();
@@ -698,10 +830,43 @@ void GLCommandBuffer::SetGenericBufferArray(const GLBufferTarget bufferTarget, B
     );
 }
 
-void GLCommandBuffer::SetResourceHeap(ResourceHeap& resourceHeap)
+void GLCommandBuffer::SetResourceHeap(ResourceHeap& resourceHeap, std::uint32_t numDynamicOffsets, const std::uint32_t* dynamicOffsets)
 {
     auto& resourceHeapGL = LLGL_CAST(GLResourceHeap&, resourceHeap);
-    resourceHeapGL.Bind(*stateMngr_);
+    resourceHeapGL.Bind(*stateMngr_, numDynamicOffsets, dynamicOffsets);
+}
+
+void GLCommandBuffer::WriteInlineConstantsRange(const InlineConstantsDescriptor& range, const void* rangeData)
+{
+    const auto size = static_cast<GLsizeiptr>(range.size);
+
+    if (inlineConstantsBuffer_ == 0)
+    {
+        /* Create ring buffer on first use */
+        GLint alignment = 0;
+        glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &alignment);
+        inlineConstantsAlignment_ = std::max(GLintptr(1), static_cast<GLintptr>(alignment));
+
+        glGenBuffers(1, &inlineConstantsBuffer_);
+        stateMngr_->BindBuffer(GLBufferTarget::UNIFORM_BUFFER, inlineConstantsBuffer_);
+        glBufferData(GL_UNIFORM_BUFFER, g_inlineConstantsBufferSize, nullptr, GL_STREAM_DRAW);
+    }
+    else
+    {
+        stateMngr_->BindBuffer(GLBufferTarget::UNIFORM_BUFFER, inlineConstantsBuffer_);
+        if (inlineConstantsOffset_ + size > g_inlineConstantsBufferSize)
+        {
+            /* Orphan buffer storage when the ring wraps around, so previous draw calls can still read their ranges */
+            glBufferData(GL_UNIFORM_BUFFER, g_inlineConstantsBufferSize, nullptr, GL_STREAM_DRAW);
+            inlineConstantsOffset_ = 0;
+        }
+    }
+
+    /* Write range into next free region of the ring buffer and bind it to the uniform buffer slot of the range */
+    glBufferSubData(GL_UNIFORM_BUFFER, inlineConstantsOffset_, size, rangeData);
+    stateMngr_->BindBufferRange(GLBufferTarget::UNIFORM_BUFFER, range.slot, inlineConstantsBuffer_, inlineConstantsOffset_, size);
+
+    inlineConstantsOffset_ += ((size + inlineConstantsAlignment_ - 1) / inlineConstantsAlignment_) * inlineConstantsAlignment_;
 }
 
 void GLCommandBuffer::BlitBoundRenderTarget()
@@ -774,7 +939,7 @@ void GLCommandBuffer::ClearAttachmentsWithRenderPass(
         }
         stateMngr_->PopDepthMask();
     }
-    if ((mask & GL_DEPTH_BUFFER_BIT) != 0)
+    else if ((mask & GL_DEPTH_BUFFER_BIT) != 0)
     {
         stateMngr_->PushDepthMask();
         stateMngr_->SetDepthMask(GL_TRUE);
@@ -800,6 +965,46 @@ void GLCommandBuffer::ClearAttachmentsWithRenderPass(
     }
 }
 
+// Returns the attachment of the default framebuffer for the specified framebuffer object attachment.
+static GLenum ToDefaultFramebufferAttachment(GLenum attachment)
+{
+    switch (attachment)
+    {
+        case GL_DEPTH_ATTACHMENT:   return GL_DEPTH;
+        case GL_STENCIL_ATTACHMENT: return GL_STENCIL;
+        default:                    return GL_COLOR;
+    }
+}
+
+void GLCommandBuffer::InvalidateAttachments(GLsizei numAttachments, const GLenum* attachments)
+{
+    #ifdef GL_ARB_invalidate_subdata
+    if (numAttachments > 0 && HasExtension(GLExt::ARB_invalidate_subdata))
+    {
+        if (boundRenderTarget_)
+        {
+            /* Invalidate attachments of the bound framebuffer object */
+            glInvalidateFramebuffer(GL_DRAW_FRAMEBUFFER, numAttachments, attachments);
+        }
+        else
+        {
+            /* Invalidate attachments of the default framebuffer, which only has a single color buffer */
+            GLenum defaultAttachments[3];
+            GLsizei numDefaultAttachments = 0;
+
+            for (GLsizei i = 0; i < numAttachments && numDefaultAttachments < 3; ++i)
+            {
+                auto attachment = ToDefaultFramebufferAttachment(attachments[i]);
+                if (attachment != GL_COLOR || attachments[i] == GL_COLOR_ATTACHMENT0)
+                    defaultAttachments[numDefaultAttachments++] = attachment;
+            }
+
+            glInvalidateFramebuffer(GL_DRAW_FRAMEBUFFER, numDefaultAttachments, defaultAttachments);
+        }
+    }
+    #endif // /GL_ARB_invalidate_subdata
+}
+
 void GLCommandBuffer::ClearColorBuffers(
     const std::uint8_t* colorBuffers,
     std::uint32_t       numClearValues,
@@ -829,6 +1034,159 @@ void GLCommandBuffer::ClearColorBuffers(
     }
 }
 
+// Returns the framebuffer attachment and blit mask for the specified internal texture format.
+static GLenum GetBlitFramebufferAttachment(GLenum internalFormat, GLbitfield& mask)
+{
+    switch (internalFormat)
+    {
+        case GL_DEPTH_COMPONENT:
+        case GL_DEPTH_COMPONENT16:
+        case GL_DEPTH_COMPONENT24:
+        case GL_DEPTH_COMPONENT32:
+        case GL_DEPTH_COMPONENT32F:
+            mask = GL_DEPTH_BUFFER_BIT;
+            return GL_DEPTH_ATTACHMENT;
+
+        case GL_DEPTH_STENCIL:
+        case GL_DEPTH24_STENCIL8:
+        case GL_DEPTH32F_STENCIL8:
+            mask = (GL_DEPTH_BUFFER_BIT | GL_STENCIL_BUFFER_BIT);
+            return GL_DEPTH_STENCIL_ATTACHMENT;
+
+        case GL_STENCIL_INDEX8:
+            mask = GL_STENCIL_BUFFER_BIT;
+            return GL_STENCIL_ATTACHMENT;
+
+        default:
+            mask = GL_COLOR_BUFFER_BIT;
+            return GL_COLOR_ATTACHMENT0;
+    }
+}
+
+// Attaches the specified slice (i.e. array layer, cube face, or depth slice) of a texture to the currently bound draw framebuffer.
+static void AttachFramebufferSlice(GLenum attachment, const GLTexture& textureGL, GLint mipLevel, GLint slice)
+{
+    auto textureID = textureGL.GetID();
+
+    switch (textureGL.GetType())
+    {
+        case TextureType::Texture1D:
+            GLFramebuffer::AttachTexture1D(attachment, GL_TEXTURE_1D, textureID, mipLevel);
+            break;
+        case TextureType::Texture2D:
+            GLFramebuffer::AttachTexture2D(attachment, GL_TEXTURE_2D, textureID, mipLevel);
+            break;
+        case TextureType::Texture3D:
+            GLFramebuffer::AttachTexture3D(attachment, GL_TEXTURE_3D, textureID, mipLevel, slice);
+            break;
+        case TextureType::TextureCube:
+            GLFramebuffer::AttachTexture2D(attachment, GLTypes::ToTextureCubeMap(static_cast<std::uint32_t>(slice)), textureID, mipLevel);
+            break;
+        case TextureType::Texture1DArray:
+        case TextureType::Texture2DArray:
+        case TextureType::TextureCubeArray:
+            GLFramebuffer::AttachTextureLayer(attachment, textureID, mipLevel, slice);
+            break;
+        case TextureType::Texture2DMS:
+            GLFramebuffer::AttachTexture2D(attachment, GL_TEXTURE_2D_MULTISAMPLE, textureID, 0);
+            break;
+        case TextureType::Texture2DMSArray:
+            GLFramebuffer::AttachTextureLayer(attachment, textureID, 0, slice);
+            break;
+    }
+}
+
+// Returns the first slice and number of slices of the specified subresource region (depth slices for 3D textures, array layers otherwise).
+static void GetSubresourceSlices(const TextureType type, const TextureSubresourceRegion& subresourceRegion, GLint& firstSlice, GLint& numSlices)
+{
+    if (type == TextureType::Texture3D)
+    {
+        firstSlice  = subresourceRegion.offset.z;
+        numSlices   = static_cast<GLint>(subresourceRegion.extent.depth);
+    }
+    else
+    {
+        firstSlice  = static_cast<GLint>(subresourceRegion.baseArrayLayer);
+        numSlices   = static_cast<GLint>(subresourceRegion.numArrayLayers);
+    }
+}
+
+void GLCommandBuffer::BlitTextureWithFramebuffers(
+    GLTexture&              dstTextureGL,
+    const TextureRegion&    dstRegion,
+    GLTexture&              srcTextureGL,
+    const TextureRegion&    srcRegion,
+    GLenum                  filter)
+{
+    /* Create intermediate framebuffers on first use */
+    if (!blitReadFramebuffer_)
+        blitReadFramebuffer_.GenFramebuffer();
+    if (!blitDrawFramebuffer_)
+        blitDrawFramebuffer_.GenFramebuffer();
+
+    /* Determine framebuffer attachment by source texture format (depth-stencil and integer blits only support nearest filtering) */
+    const auto internalFormat = srcTextureGL.QueryGLInternalFormat();
+
+    GLbitfield mask = 0;
+    auto attachment = GetBlitFramebufferAttachment(internalFormat, mask);
+
+    Format format = Format::Undefined;
+    GLTypes::Unmap(format, internalFormat);
+
+    if (mask != GL_COLOR_BUFFER_BIT || (IsIntegralFormat(format) && !IsNormalizedFormat(format)))
+        filter = GL_NEAREST;
+
+    /* Separate array layers from the 2D regions */
+    auto srcSubresource = MakeTextureSubresourceRegion(srcTextureGL.GetType(), srcRegion);
+    auto dstSubresource = MakeTextureSubresourceRegion(dstTextureGL.GetType(), dstRegion);
+
+    GLint srcFirstSlice = 0, srcNumSlices = 0;
+    GLint dstFirstSlice = 0, dstNumSlices = 0;
+
+    GetSubresourceSlices(srcTextureGL.GetType(), srcSubresource, srcFirstSlice, srcNumSlices);
+    GetSubresourceSlices(dstTextureGL.GetType(), dstSubresource, dstFirstSlice, dstNumSlices);
+
+    const Offset2D srcPos0 { srcSubresource.offset.x, srcSubresource.offset.y };
+    const Offset2D srcPos1 { srcPos0.x + static_cast<std::int32_t>(srcSubresource.extent.width), srcPos0.y + static_cast<std::int32_t>(srcSubresource.extent.height) };
+    const Offset2D dstPos0 { dstSubresource.offset.x, dstSubresource.offset.y };
+    const Offset2D dstPos1 { dstPos0.x + static_cast<std::int32_t>(dstSubresource.extent.width), dstPos0.y + static_cast<std::int32_t>(dstSubresource.extent.height) };
+
+    const auto srcMipLevel = static_cast<GLint>(srcSubresource.mipLevel);
+    const auto dstMipLevel = static_cast<GLint>(dstSubresource.mipLevel);
+
+    /* Store framebuffer bindings and disable scissor test, which would otherwise affect the blit operation */
+    stateMngr_->PushBoundFramebuffer(GLFramebufferTarget::READ_FRAMEBUFFER);
+    stateMngr_->PushBoundFramebuffer(GLFramebufferTarget::DRAW_FRAMEBUFFER);
+    stateMngr_->PushState(GLState::SCISSOR_TEST);
+    stateMngr_->Disable(GLState::SCISSOR_TEST);
+
+    for (GLint i = 0, n = std::min(srcNumSlices, dstNumSlices); i < n; ++i)
+    {
+        /* Attach source and destination slices (attachments are always specified for the draw framebuffer target) */
+        blitReadFramebuffer_.Bind(GLFramebufferTarget::DRAW_FRAMEBUFFER);
+        AttachFramebufferSlice(attachment, srcTextureGL, srcMipLevel, srcFirstSlice + i);
+
+        blitDrawFramebuffer_.Bind(GLFramebufferTarget::DRAW_FRAMEBUFFER);
+        AttachFramebufferSlice(attachment, dstTextureGL, dstMipLevel, dstFirstSlice + i);
+
+        /* Blit source slice into destination slice */
+        blitReadFramebuffer_.Bind(GLFramebufferTarget::READ_FRAMEBUFFER);
+        GLFramebuffer::Blit(srcPos0, srcPos1, dstPos0, dstPos1, mask, filter);
+    }
+
+    /* Detach textures, so they are not kept alive by the intermediate framebuffers */
+    blitReadFramebuffer_.Bind(GLFramebufferTarget::DRAW_FRAMEBUFFER);
+    GLFramebuffer::AttachTexture2D(attachment, GL_TEXTURE_2D, 0, 0);
+
+    blitDrawFramebuffer_.Bind(GLFramebufferTarget::DRAW_FRAMEBUFFER);
+    GLFramebuffer::AttachTexture2D(attachment, GL_TEXTURE_2D, 0, 0);
+
+    /* Restore previous states */
+    stateMngr_->PopState();
+    stateMngr_->PopBoundFramebuffer();
+    stateMngr_->PopBoundFramebuffer();
+}
+
 
 } // /namespace LLGL
 
@@ -11,6 +11,9 @@
 
 #include <LLGL/CommandBufferExt.h>
 #include "RenderState/GLState.h"
+#include "Texture/GLFramebuffer.h"
+#include "RenderState/GLPipelineLayout.h"
+#include "../InlineConstantsBlock.h"
 #include "OpenGL.h"
 
 
@@ -22,6 +25,7 @@ class GLRenderTarget;
 class GLRenderContext;
 class GLStateManager;
 class GLRenderPass;
+class GLTexture;
 
 class GLCommandBuffer final : public CommandBufferExt
 {
@@ -31,6 +35,7 @@ class GLCommandBuffer final : public CommandBufferExt
         /* ----- Common ----- */
 
         GLCommandBuffer(const std::shared_ptr<GLStateManager>& stateManager);
+        ~GLCommandBuffer();
 
         /* ----- Encoding ----- */
 
@@ -39,6 +44,22 @@ class GLCommandBuffer final : public CommandBufferExt
 
         void UpdateBuffer(Buffer& dstBuffer, std::uint64_t dstOffset, const void* data, std::uint16_t dataSize) override;
         void CopyBuffer(Buffer& dstBuffer, std::uint64_t dstOffset, Buffer& srcBuffer, std::uint64_t srcOffset, std::uint64_t size) override;
+        void FillBuffer(Buffer& dstBuffer, std::uint64_t dstOffset, std::uint32_t value, std::uint64_t fillSize) override;
+
+        void CopyTexture(
+            Texture&                dstTexture,
+            const TextureLocation&  dstLocation,
+            Texture&                srcTexture,
+            const TextureRegion&    srcRegion
+        ) override;
+
+        void BlitTexture(
+            Texture&                dstTexture,
+            const TextureRegion&    dstRegion,
+            Texture&                srcTexture,
+            const TextureRegion&    srcRegion,
+            const SamplerFilter     filter      = SamplerFilter::Linear
+        ) override;
 
         /* ----- Configuration ----- */
 
@@ -94,8 +115,12 @@ class GLCommandBuffer final : public CommandBufferExt
 
         /* ----- Resource Heaps ----- */
 
-        void SetGraphicsResourceHeap(ResourceHeap& resourceHeap, std::uint32_t startSlot) override;
-        void SetComputeResourceHeap(ResourceHeap& resourceHeap, std::uint32_t startSlot) override;
+        void SetGraphicsResourceHeap(ResourceHeap& resourceHeap, std::uint32_t startSlot = 0, std::uint32_t numDynamicOffsets = 0, const std::uint32_t* dynamicOffsets = nullptr) override;
+        void SetComputeResourceHeap(ResourceHeap& resourceHeap, std::uint32_t startSlot = 0, std::uint32_t numDynamicOffsets = 0, const std::uint32_t* dynamicOffsets = nullptr) override;
+
+        /* ----- Inline Constants ----- */
+
+        void SetInlineConstants(long stageFlags, std::uint32_t offset, const void* data, std::uint32_t dataSize) override;
 
         /* ----- Render Passes ----- */
 
@@ -121,7 +146,10 @@ class GLCommandBuffer final : public CommandBufferExt
         bool QueryResult(Query& query, std::uint64_t& result) override;
         bool QueryPipelineStatisticsResult(Query& query, QueryPipelineStatistics& result) override;
 
+        void CopyQueryResults(std::uint32_t numQueries, Query* const * queries, Buffer& dstBuffer, std::uint64_t dstOffset) override;
+
         void BeginRenderCondition(Query& query, const RenderConditionMode mode) override;
+        void BeginRenderCondition(Buffer& buffer, std::uint64_t offset, const RenderConditionMode mode) override;
         void EndRenderCondition() override;
 
         /* ----- Drawing ----- */
@@ -161,7 +189,10 @@ class GLCommandBuffer final : public CommandBufferExt
         void SetGenericBuffer(const GLBufferTarget bufferTarget, Buffer& buffer, std::uint32_t slot);
         void SetGenericBufferArray(const GLBufferTarget bufferTarget, BufferArray& bufferArray, std::uint32_t startSlot);
 
-        void SetResourceHeap(ResourceHeap& resourceHeap);
+        void SetResourceHeap(ResourceHeap& resourceHeap, std::uint32_t numDynamicOffsets, const std::uint32_t* dynamicOffsets);
+
+        // Writes the specified range of inline constants into the ring buffer and binds it to the uniform buffer slot of that range.
+        void WriteInlineConstantsRange(const InlineConstantsDescriptor& range, const void* rangeData);
 
         // Blits the currently bound render target
         void BlitBoundRenderTarget();
@@ -169,6 +200,9 @@ class GLCommandBuffer final : public CommandBufferExt
         void BindRenderTarget(GLRenderTarget& renderTargetGL);
         void BindRenderContext(GLRenderContext& renderContextGL);
 
+        // Invalidates the specified attachments of the bound framebuffer (see AttachmentLoadOp::Undefined and AttachmentStoreOp::Undefined).
+        void InvalidateAttachments(GLsizei numAttachments, const GLenum* attachments);
+
         void ClearAttachmentsWithRenderPass(
             const GLRenderPass& renderPassGL,
             std::uint32_t       numClearValues,
@@ -182,13 +216,32 @@ class GLCommandBuffer final : public CommandBufferExt
             std::uint32_t&      idx
         );
 
+        // Blits the texture regions slice by slice with the intermediate read and draw framebuffers.
+        void BlitTextureWithFramebuffers(
+            GLTexture&              dstTextureGL,
+            const TextureRegion&    dstRegion,
+            GLTexture&              srcTextureGL,
+            const TextureRegion&    srcRegion,
+            GLenum                  filter
+        );
+
         std::shared_ptr<GLStateManager> stateMngr_;
         RenderState                     renderState_;
 
         GLRenderTarget*                 boundRenderTarget_  = nullptr;
+        const GLRenderPass*             boundRenderPass_    = nullptr;
 
         GLClearValue                    clearValue_;
 
+        GLFramebuffer                   blitReadFramebuffer_;
+        GLFramebuffer                   blitDrawFramebuffer_;
+
+        const GLPipelineLayout*         boundPipelineLayout_        = nullptr;
+        InlineConstantsBlock            inlineConstants_;
+        GLuint                          inlineConstantsBuffer_      = 0;        // Ring buffer for all inline constant ranges
+        GLintptr                        inlineConstantsOffset_      = 0;
+        GLintptr                        inlineConstantsAlignment_   = 0;        // GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT
+
 };
 
 
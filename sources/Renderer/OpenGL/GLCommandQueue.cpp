@@ -8,6 +8,12 @@
 #include "GLCommandQueue.h"
 #include "../CheckedCast.h"
 #include "RenderState/GLFence.h"
+#include "RenderState/GLStateManager.h"
+#include "Buffer/GLBuffer.h"
+#include "Texture/GLTexture.h"
+#include "Ext/GLExtensions.h"
+#include "../GLCommon/GLTypes.h"
+#include "../GLCommon/GLCore.h"
 
 
 namespace LLGL
@@ -21,6 +27,23 @@ void GLCommandQueue::Submit(CommandBuffer& /*commandBuffer*/)
     // dummy
 }
 
+void GLCommandQueue::Submit(std::uint32_t numCommandBuffers, CommandBuffer* const * /*commandBuffers*/)
+{
+    /* GL commands have already been issued while they were encoded, so flush them to the GPU as a single batch */
+    if (numCommandBuffers > 0)
+        glFlush();
+}
+
+void GLCommandQueue::Submit(const SubmitDescriptor& desc)
+{
+    /*
+    GL commands are executed in the order they are encoded on a single context,
+    so all dependencies between batches are already satisfied and the batches only need to be flushed to the GPU
+    */
+    if (!desc.batches.empty())
+        glFlush();
+}
+
 /* ----- Fences ----- */
 
 void GLCommandQueue::Submit(Fence& fence)
@@ -40,6 +63,70 @@ void GLCommandQueue::WaitIdle()
     glFinish();
 }
 
+/* ----- Sparse Resources ----- */
+
+void GLCommandQueue::UpdateTileMappings(Buffer& buffer, std::uint32_t numMappings, const BufferTileMapping* mappings)
+{
+    #ifdef GL_ARB_sparse_buffer
+
+    auto& bufferGL = LLGL_CAST(GLBuffer&, buffer);
+
+    /*
+    Commit or decommit pages of the buffer (executed in command stream order).
+    The buffer is bound to GL_COPY_WRITE_BUFFER, since binding an index buffer to GL_ELEMENT_ARRAY_BUFFER would modify the bound VAO.
+    */
+    GLStateManager::active->BindBuffer(GLBufferTarget::COPY_WRITE_BUFFER, bufferGL.GetID());
+
+    for (std::uint32_t i = 0; i < numMappings; ++i)
+    {
+        glBufferPageCommitmentARB(
+            GL_COPY_WRITE_BUFFER,
+            static_cast<GLintptr>(mappings[i].offset),
+            static_cast<GLsizeiptr>(mappings[i].size),
+            GLBoolean(mappings[i].commit)
+        );
+    }
+
+    #else
+
+    CommandQueue::UpdateTileMappings(buffer, numMappings, mappings);
+
+    #endif // /GL_ARB_sparse_buffer
+}
+
+void GLCommandQueue::UpdateTileMappings(Texture& texture, std::uint32_t numMappings, const TextureTileMapping* mappings)
+{
+    #ifdef GL_ARB_sparse_texture
+
+    auto& textureGL = LLGL_CAST(GLTexture&, texture);
+
+    /* Commit or decommit tiles of the bound texture; array layers and cube faces are specified by the Y or Z coordinates like in 'glTexSubImage' */
+    GLStateManager::active->BindTexture(textureGL);
+    auto target = GLTypes::Map(textureGL.GetType());
+
+    for (std::uint32_t i = 0; i < numMappings; ++i)
+    {
+        const auto& region = mappings[i].region;
+        glTexPageCommitmentARB(
+            target,
+            static_cast<GLint>(region.mipLevel),
+            region.offset.x,
+            region.offset.y,
+            region.offset.z,
+            static_cast<GLsizei>(region.extent.width),
+            static_cast<GLsizei>(region.extent.height),
+            static_cast<GLsizei>(region.extent.depth),
+            GLBoolean(mappings[i].commit)
+        );
+    }
+
+    #else
+
+    CommandQueue::UpdateTileMappings(texture, numMappings, mappings);
+
+    #endif // /GL_ARB_sparse_texture
+}
+
 
 } // /namespace LLGL
 
@@ -24,6 +24,8 @@ class GLCommandQueue final : public CommandQueue
         /* ----- Command Buffers ----- */
 
         void Submit(CommandBuffer& commandBuffer) override;
+        void Submit(std::uint32_t numCommandBuffers, CommandBuffer* const * commandBuffers) override;
+        void Submit(const SubmitDescriptor& desc) override;
 
         /* ----- Fences ----- */
 
@@ -32,6 +34,11 @@ class GLCommandQueue final : public CommandQueue
         bool WaitFence(Fence& fence, std::uint64_t timeout) override;
         void WaitIdle() override;
 
+        /* ----- Sparse Resources ----- */
+
+        void UpdateTileMappings(Buffer& buffer, std::uint32_t numMappings, const BufferTileMapping* mappings) override;
+        void UpdateTileMappings(Texture& texture, std::uint32_t numMappings, const TextureTileMapping* mappings) override;
+
 };
 
 
@@ -12,6 +12,8 @@
 #include <LLGL/RenderSystem.h>
 #include "Ext/GLExtensionLoader.h"
 #include "../ContainerTypes.h"
+#include "../PipelineCache.h"
+#include "../SamplerCache.h"
 
 #include "GLCommandQueue.h"
 #include "GLCommandBuffer.h"
@@ -19,6 +21,7 @@
 
 #include "Buffer/GLBuffer.h"
 #include "Buffer/GLBufferArray.h"
+#include "Buffer/GLAsyncReadback.h"
 
 #include "Shader/GLShader.h"
 #include "Shader/GLShaderProgram.h"
@@ -35,10 +38,13 @@
 #include "RenderState/GLComputePipeline.h"
 #include "RenderState/GLResourceHeap.h"
 
+#include "Platform/GLUploadContextPool.h"
+
 #include <string>
 #include <memory>
 #include <vector>
 #include <set>
+#include <mutex>
 
 
 namespace LLGL
@@ -55,6 +61,8 @@ class GLRenderSystem final : public RenderSystem
 
         /* ----- Common ----- */
 
+        GLRenderSystem(const RenderSystemDescriptor& renderSystemDesc);
+
         void SetConfiguration(const RenderSystemConfiguration& config) override;
 
         /* ----- Render Context ----- */
@@ -105,6 +113,8 @@ class GLRenderSystem final : public RenderSystem
 
         void Release(Sampler& sampler) override;
 
+        SamplerCacheStatistics GetSamplerCacheStatistics() const override;
+
         /* ----- Resource Heaps ----- */
 
         ResourceHeap* CreateResourceHeap(const ResourceHeapDescriptor& desc) override;
@@ -145,6 +155,8 @@ class GLRenderSystem final : public RenderSystem
         void Release(GraphicsPipeline& graphicsPipeline) override;
         void Release(ComputePipeline& computePipeline) override;
 
+        PipelineCacheStatistics GetPipelineCacheStatistics() const override;
+
         /* ----- Queries ----- */
 
         Query* CreateQuery(const QueryDescriptor& desc) override;
@@ -157,6 +169,13 @@ class GLRenderSystem final : public RenderSystem
 
         void Release(Fence& fence) override;
 
+        /* ----- Asynchronous Readbacks ----- */
+
+        AsyncReadback* ReadTextureAsync(const Texture& texture, std::uint32_t mipLevel) override;
+        AsyncReadback* ReadBufferAsync(const Buffer& buffer, std::uint64_t offset, std::uint64_t size) override;
+
+        void Release(AsyncReadback& readback) override;
+
     protected:
 
         RenderContext* AddRenderContext(std::unique_ptr<GLRenderContext>&& renderContext, const RenderContextDescriptor& desc);
@@ -171,6 +190,11 @@ class GLRenderSystem final : public RenderSystem
 
         GLRenderContext* GetSharedRenderContext() const;
 
+        GLBuffer* TakeBufferOwnership(std::unique_ptr<GLBuffer>&& buffer);
+        GLTexture* TakeTextureOwnership(std::unique_ptr<GLTexture>&& texture);
+
+        void ReadTextureDecompressed(const GLTexture& textureGL, const Format format, std::uint32_t mipLevel, const DstImageDescriptor& imageDesc);
+
         void GenerateMipsPrimary(GLuint texID, const TextureType texType);
         void GenerateSubMipsWithFBO(GLTexture& textureGL, const Extent3D& extent, GLint baseMipLevel, GLint numMipLevels, GLint baseArrayLayer, GLint numArrayLayers);
         void GenerateSubMipsWithTextureView(GLTexture& textureGL, GLuint baseMipLevel, GLuint numMipLevels, GLuint baseArrayLayer, GLuint numArrayLayers);
@@ -196,6 +220,7 @@ class GLRenderSystem final : public RenderSystem
         HWObjectContainer<GLBufferArray>        bufferArrays_;
         HWObjectContainer<GLTexture>            textures_;
         HWObjectContainer<GLSampler>            samplers_;
+        SamplerCache                            samplerCache_;
         HWObjectContainer<GLRenderPass>         renderPasses_;
         HWObjectContainer<GLRenderTarget>       renderTargets_;
         HWObjectContainer<GLShader>             shaders_;
@@ -203,12 +228,22 @@ class GLRenderSystem final : public RenderSystem
         HWObjectContainer<GLPipelineLayout>     pipelineLayouts_;
         HWObjectContainer<GLGraphicsPipeline>   graphicsPipelines_;
         HWObjectContainer<GLComputePipeline>    computePipelines_;
+        PipelineCache                           pipelineCache_;
         HWObjectContainer<GLResourceHeap>       resourceHeaps_;
         HWObjectContainer<GLQuery>              queries_;
         HWObjectContainer<GLFence>              fences_;
+        HWObjectContainer<GLAsyncReadback>      readbacks_;
 
         DebugCallback                           debugCallback_;
 
+        bool                                    lazyExtensionLoading_   = false;
+
+        /* ----- Upload contexts for worker threads ----- */
+
+        bool                                    uploadContextsEnabled_  = false;
+        GLUploadContextPool                     uploadContextPool_;
+        std::mutex                              resourceMutex_;         // Guards the buffer and texture containers, which can be modified by worker threads
+
         #ifdef LLGL_ENABLE_CUSTOM_SUB_MIPGEN
         MipGenerationFBOPair                    mipGenerationFBOPair_;
         #endif // /LLGL_ENABLE_CUSTOM_SUB_MIPGEN
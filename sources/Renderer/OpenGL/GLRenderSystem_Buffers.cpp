@@ -35,6 +35,11 @@ static GLbitfield GetGLBufferFlags(long flags)
     if ((flags & BufferFlags::MapWriteAccess) != 0)
         flagsGL |= GL_MAP_WRITE_BIT;
 
+    #ifdef GL_ARB_sparse_buffer
+    if ((flags & BufferFlags::Sparse) != 0)
+        flagsGL |= GL_SPARSE_STORAGE_BIT_ARB;
+    #endif
+
     return flagsGL;
 
     #else
@@ -51,6 +56,10 @@ static GLenum GetGLBufferUsage(long flags)
 
 static void GLBufferStorage(GLBuffer& bufferGL, const BufferDescriptor& desc, const void* initialData)
 {
+    /* Initial data is ignored for sparse buffers, since none of their pages is committed yet */
+    if ((desc.flags & BufferFlags::Sparse) != 0)
+        initialData = nullptr;
+
     bufferGL.BufferStorage(
         static_cast<GLsizeiptr>(desc.size),
         initialData,
@@ -63,18 +72,21 @@ Buffer* GLRenderSystem::CreateBuffer(const BufferDescriptor& desc, const void* i
 {
     AssertCreateBuffer(desc, static_cast<std::uint64_t>(std::numeric_limits<GLsizeiptr>::max()));
 
+    /* Make an upload context current if this is called from a worker thread */
+    GLUploadContextScope uploadScope { uploadContextPool_ };
+
     /* Create either base of sub-class GLBuffer object */
     switch (desc.type)
     {
         case BufferType::Vertex:
         {
-            /* Create vertex buffer and build vertex array */
+            /* Create vertex buffer and build vertex array (VAO must be built on the render thread if this is an upload context) */
             auto bufferGL = MakeUnique<GLVertexBuffer>();
             {
                 GLBufferStorage(*bufferGL, desc, initialData);
-                bufferGL->BuildVertexArray(desc.vertexBuffer.format);
+                bufferGL->BuildVertexArray(desc.vertexBuffer.format, uploadScope.IsUploadContext());
             }
-            return TakeOwnership(buffers_, std::move(bufferGL));
+            return TakeBufferOwnership(std::move(bufferGL));
         }
         break;
 
@@ -85,7 +97,7 @@ Buffer* GLRenderSystem::CreateBuffer(const BufferDescriptor& desc, const void* i
             {
                 GLBufferStorage(*bufferGL, desc, initialData);
             }
-            return TakeOwnership(buffers_, std::move(bufferGL));
+            return TakeBufferOwnership(std::move(bufferGL));
         }
         break;
 
@@ -96,7 +108,7 @@ Buffer* GLRenderSystem::CreateBuffer(const BufferDescriptor& desc, const void* i
             {
                 GLBufferStorage(*bufferGL, desc, initialData);
             }
-            return TakeOwnership(buffers_, std::move(bufferGL));
+            return TakeBufferOwnership(std::move(bufferGL));
         }
     }
 }
@@ -119,6 +131,7 @@ BufferArray* GLRenderSystem::CreateBufferArray(std::uint32_t numBuffers, Buffer*
 
 void GLRenderSystem::Release(Buffer& buffer)
 {
+    std::lock_guard<std::mutex> guard { resourceMutex_ };
     RemoveFromUniqueSet(buffers_, &buffer);
 }
 
@@ -146,6 +159,18 @@ void GLRenderSystem::UnmapBuffer(Buffer& buffer)
 }
 
 
+/*
+ * ======= Private: =======
+ */
+
+GLBuffer* GLRenderSystem::TakeBufferOwnership(std::unique_ptr<GLBuffer>&& buffer)
+{
+    /* Buffers can also be created by worker threads (see OpenGLRendererConfiguration::enableUploadContexts) */
+    std::lock_guard<std::mutex> guard { resourceMutex_ };
+    return TakeOwnership(buffers_, std::move(buffer));
+}
+
+
 } // /namespace LLGL
 
 
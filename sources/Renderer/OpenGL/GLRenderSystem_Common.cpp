@@ -14,6 +14,7 @@
 #include "../../Core/Helper.h"
 #include "../../Core/Assertion.h"
 #include "GLRenderingCaps.h"
+#include <limits>
 
 
 namespace LLGL
@@ -22,6 +23,22 @@ namespace LLGL
 
 /* ----- Render System ----- */
 
+GLRenderSystem::GLRenderSystem(const RenderSystemDescriptor& renderSystemDesc)
+{
+    /* Extract optional renderer configuartion */
+    if (renderSystemDesc.rendererConfig != nullptr && renderSystemDesc.rendererConfigSize > 0)
+    {
+        if (renderSystemDesc.rendererConfigSize == sizeof(OpenGLRendererConfiguration))
+        {
+            auto rendererConfigGL = reinterpret_cast<const OpenGLRendererConfiguration*>(renderSystemDesc.rendererConfig);
+            uploadContextsEnabled_  = rendererConfigGL->enableUploadContexts;
+            lazyExtensionLoading_   = rendererConfigGL->enableLazyExtensionLoading;
+        }
+        else
+            throw std::invalid_argument("invalid renderer configuration structure (expected size of 'OpenGLRendererConfiguration' structure)");
+    }
+}
+
 void GLRenderSystem::SetConfiguration(const RenderSystemConfiguration& config)
 {
     RenderSystem::SetConfiguration(config);
@@ -87,14 +104,26 @@ void GLRenderSystem::Release(CommandBuffer& commandBuffer)
 Sampler* GLRenderSystem::CreateSampler(const SamplerDescriptor& desc)
 {
     LLGL_ASSERT_FEATURE_SUPPORT(hasSamplers);
-    auto sampler = MakeUnique<GLSampler>();
-    sampler->SetDesc(desc);
-    return TakeOwnership(samplers_, std::move(sampler));
+    return samplerCache_.GetOrCreate(
+        desc,
+        [&]()
+        {
+            auto sampler = MakeUnique<GLSampler>();
+            sampler->SetDesc(desc);
+            return TakeOwnership(samplers_, std::move(sampler));
+        }
+    );
 }
 
 void GLRenderSystem::Release(Sampler& sampler)
 {
-    RemoveFromUniqueSet(samplers_, &sampler);
+    if (samplerCache_.Release(sampler))
+        RemoveFromUniqueSet(samplers_, &sampler);
+}
+
+SamplerCacheStatistics GLRenderSystem::GetSamplerCacheStatistics() const
+{
+    return samplerCache_.GetStatistics();
 }
 
 /* ----- Resource Heaps ----- */
@@ -119,6 +148,7 @@ RenderPass* GLRenderSystem::CreateRenderPass(const RenderPassDescriptor& desc)
 
 void GLRenderSystem::Release(RenderPass& renderPass)
 {
+    pipelineCache_.Evict(renderPass);
     RemoveFromUniqueSet(renderPasses_, &renderPass);
 }
 
@@ -176,6 +206,7 @@ void GLRenderSystem::Release(Shader& shader)
 
 void GLRenderSystem::Release(ShaderProgram& shaderProgram)
 {
+    pipelineCache_.Evict(shaderProgram);
     RemoveFromUniqueSet(shaderPrograms_, &shaderProgram);
 }
 
@@ -188,6 +219,7 @@ PipelineLayout* GLRenderSystem::CreatePipelineLayout(const PipelineLayoutDescrip
 
 void GLRenderSystem::Release(PipelineLayout& pipelineLayout)
 {
+    pipelineCache_.Evict(pipelineLayout);
     RemoveFromUniqueSet(pipelineLayouts_, &pipelineLayout);
 }
 
@@ -195,22 +227,41 @@ void GLRenderSystem::Release(PipelineLayout& pipelineLayout)
 
 GraphicsPipeline* GLRenderSystem::CreateGraphicsPipeline(const GraphicsPipelineDescriptor& desc)
 {
-    return TakeOwnership(graphicsPipelines_, MakeUnique<GLGraphicsPipeline>(desc, GetRenderingCaps().limits));
+    return pipelineCache_.GetOrCreate(
+        desc,
+        [&]()
+        {
+            return TakeOwnership(graphicsPipelines_, MakeUnique<GLGraphicsPipeline>(desc, GetRenderingCaps().limits));
+        }
+    );
 }
 
 ComputePipeline* GLRenderSystem::CreateComputePipeline(const ComputePipelineDescriptor& desc)
 {
-    return TakeOwnership(computePipelines_, MakeUnique<GLComputePipeline>(desc));
+    return pipelineCache_.GetOrCreate(
+        desc,
+        [&]()
+        {
+            return TakeOwnership(computePipelines_, MakeUnique<GLComputePipeline>(desc));
+        }
+    );
 }
 
 void GLRenderSystem::Release(GraphicsPipeline& graphicsPipeline)
 {
-    RemoveFromUniqueSet(graphicsPipelines_, &graphicsPipeline);
+    if (pipelineCache_.Release(graphicsPipeline))
+        RemoveFromUniqueSet(graphicsPipelines_, &graphicsPipeline);
 }
 
 void GLRenderSystem::Release(ComputePipeline& computePipeline)
 {
-    RemoveFromUniqueSet(computePipelines_, &computePipeline);
+    if (pipelineCache_.Release(computePipeline))
+        RemoveFromUniqueSet(computePipelines_, &computePipeline);
+}
+
+PipelineCacheStatistics GLRenderSystem::GetPipelineCacheStatistics() const
+{
+    return pipelineCache_.GetStatistics();
 }
 
 /* ----- Queries ----- */
@@ -237,6 +288,51 @@ void GLRenderSystem::Release(Fence& fence)
     RemoveFromUniqueSet(fences_, &fence);
 }
 
+/* ----- Asynchronous Readbacks ----- */
+
+AsyncReadback* GLRenderSystem::ReadTextureAsync(const Texture& texture, std::uint32_t mipLevel)
+{
+    auto& textureGL = LLGL_CAST(const GLTexture&, texture);
+
+    /* Determine image format that matches the hardware format, so the driver does not need to convert the image data */
+    ImageFormat imageFormat = ImageFormat::RGBA;
+    DataType    dataType    = DataType::UInt8;
+
+    if (!FindSuitableImageFormat(textureGL.QueryDesc().format, imageFormat, dataType))
+        throw std::runtime_error("cannot read texture asynchronously due to unsupported texture format");
+
+    /* Create readback buffer for the entire MIP-map level (size is computed in 64-bit to avoid overflow for large textures) */
+    const auto extent   = textureGL.QueryMipExtent(mipLevel);
+    const auto dataSize =
+    (
+        static_cast<std::uint64_t>(extent.width) * extent.height * extent.depth *
+        ImageFormatSize(imageFormat) * DataTypeSize(dataType)
+    );
+
+    if (dataSize > static_cast<std::uint64_t>(std::numeric_limits<GLsizeiptr>::max()))
+        throw std::runtime_error("cannot read texture asynchronously due to exceeding buffer size limit");
+
+    auto readback = MakeUnique<GLAsyncReadback>(static_cast<GLsizeiptr>(dataSize));
+    readback->ReadTexture(textureGL, static_cast<GLint>(mipLevel), GLTypes::Map(imageFormat), GLTypes::Map(dataType));
+
+    return TakeOwnership(readbacks_, std::move(readback));
+}
+
+AsyncReadback* GLRenderSystem::ReadBufferAsync(const Buffer& buffer, std::uint64_t offset, std::uint64_t size)
+{
+    auto& bufferGL = LLGL_CAST(const GLBuffer&, buffer);
+
+    auto readback = MakeUnique<GLAsyncReadback>(static_cast<GLsizeiptr>(size));
+    readback->ReadBuffer(bufferGL, static_cast<GLintptr>(offset));
+
+    return TakeOwnership(readbacks_, std::move(readback));
+}
+
+void GLRenderSystem::Release(AsyncReadback& readback)
+{
+    RemoveFromUniqueSet(readbacks_, &readback);
+}
+
 
 /*
  * ======= Protected: =======
@@ -250,6 +346,10 @@ RenderContext* GLRenderSystem::AddRenderContext(std::unique_ptr<GLRenderContext>
         LoadGLExtensions(desc.profileOpenGL);
         SetDebugCallback(desc.debugCallback);
         commandQueue_ = MakeUnique<GLCommandQueue>();
+
+        /* Share GL objects of the first render context with the upload contexts for worker threads */
+        if (uploadContextsEnabled_)
+            uploadContextPool_.Enable(desc, renderContext->GetSurface(), renderContext->GetGLContext());
     }
 
     /* Use uniform clipping space */
@@ -274,7 +374,7 @@ void GLRenderSystem::LoadGLExtensions(const ProfileOpenGLDescriptor& profileDesc
 
         /* Query extensions and load all of them */
         auto extensions = QueryExtensions(coreProfile);
-        LoadAllExtensions(extensions, coreProfile);
+        LoadAllExtensions(extensions, coreProfile, lazyExtensionLoading_);
 
         /* Query and store all renderer information and capabilities */
         QueryRendererInfo();
@@ -13,6 +13,8 @@
 #include "../CheckedCast.h"
 #include "../../Core/Helper.h"
 #include "../../Core/Assertion.h"
+#include "../../Core/BCDecompressor.h"
+#include <string.h>
 
 
 namespace LLGL
@@ -31,6 +33,17 @@ static GLint GetGlTextureMinFilter(const TextureDescriptor& textureDesc)
 
 Texture* GLRenderSystem::CreateTexture(const TextureDescriptor& textureDesc, const SrcImageDescriptor* imageDesc)
 {
+    /* Create texture with decompressed image data if the block-compressed format is not supported by the GL implementation */
+    TextureDescriptor   decompressedTextureDesc;
+    SrcImageDescriptor  decompressedImageDesc;
+    ByteBuffer          decompressedImage;
+
+    if (DecompressUnsupportedTexture(textureDesc, imageDesc, decompressedTextureDesc, decompressedImageDesc, decompressedImage))
+        return CreateTexture(decompressedTextureDesc, (imageDesc != nullptr ? &decompressedImageDesc : nullptr));
+
+    /* Make an upload context current if this is called from a worker thread */
+    GLUploadContextScope uploadScope { uploadContextPool_ };
+
     auto texture = MakeUnique<GLTexture>(textureDesc.type);
 
     /* Bind texture */
@@ -42,6 +55,18 @@ Texture* GLRenderSystem::CreateTexture(const TextureDescriptor& textureDesc, con
     glTexParameteri(target, GL_TEXTURE_MIN_FILTER, GetGlTextureMinFilter(textureDesc));
     glTexParameteri(target, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
 
+    /* Sparse textures must be declared before the immutable texture storage is allocated; initial data is ignored since no tile is committed yet */
+    const bool isSparse = ((textureDesc.flags & TextureFlags::Sparse) != 0);
+
+    #ifdef GL_ARB_sparse_texture
+    if (isSparse)
+    {
+        glTexParameteri(target, GL_TEXTURE_SPARSE_ARB, GL_TRUE);
+        glTexParameteri(target, GL_VIRTUAL_PAGE_SIZE_INDEX_ARB, 0);
+        imageDesc = nullptr;
+    }
+    #endif // /GL_ARB_sparse_texture
+
     /* Build texture storage and upload image dataa */
     switch (textureDesc.type)
     {
@@ -93,11 +118,16 @@ Texture* GLRenderSystem::CreateTexture(const TextureDescriptor& textureDesc, con
             break;
     }
 
-    return TakeOwnership(textures_, std::move(texture));
+    /* Initialize texture with default value if no initial image data is specified */
+    if (imageDesc == nullptr && !isSparse)
+        GLTexImageInitialize(texture->GetID(), textureDesc);
+
+    return TakeTextureOwnership(std::move(texture));
 }
 
 void GLRenderSystem::Release(Texture& texture)
 {
+    std::lock_guard<std::mutex> guard { resourceMutex_ };
     RemoveFromUniqueSet(textures_, &texture);
 }
 
@@ -105,6 +135,9 @@ void GLRenderSystem::Release(Texture& texture)
 
 void GLRenderSystem::WriteTexture(Texture& texture, const TextureRegion& textureRegion, const SrcImageDescriptor& imageDesc)
 {
+    /* Make an upload context current if this is called from a worker thread */
+    GLUploadContextScope uploadScope { uploadContextPool_ };
+
     /* Bind texture and write texture sub data */
     auto& textureGL = LLGL_CAST(GLTexture&, texture);
     GLStateManager::active->BindTexture(textureGL);
@@ -156,6 +189,19 @@ void GLRenderSystem::ReadTexture(const Texture& texture, std::uint32_t mipLevel,
 
     auto& textureGL = LLGL_CAST(const GLTexture&, texture);
 
+    /* Decompress BC textures on the CPU if an uncompressed image format is requested */
+    if (!IsCompressedFormat(imageDesc.format))
+    {
+        Format format = Format::Undefined;
+        GLTypes::Unmap(format, textureGL.QueryGLInternalFormat());
+
+        if (GetBCDecompressedFormat(format) != Format::Undefined)
+        {
+            ReadTextureDecompressed(textureGL, format, mipLevel, imageDesc);
+            return;
+        }
+    }
+
     /* Read image data from texture */
     #if defined GL_ARB_direct_state_access && defined LLGL_GL_ENABLE_DSA_EXT
     if (HasExtension(GLExt::ARB_direct_state_access))
@@ -249,6 +295,62 @@ void GLRenderSystem::GenerateMips(Texture& texture, std::uint32_t baseMipLevel,
  * ======= Private: =======
  */
 
+GLTexture* GLRenderSystem::TakeTextureOwnership(std::unique_ptr<GLTexture>&& texture)
+{
+    /* Textures can also be created by worker threads (see OpenGLRendererConfiguration::enableUploadContexts) */
+    std::lock_guard<std::mutex> guard { resourceMutex_ };
+    return TakeOwnership(textures_, std::move(texture));
+}
+
+void GLRenderSystem::ReadTextureDecompressed(const GLTexture& textureGL, const Format format, std::uint32_t mipLevel, const DstImageDescriptor& imageDesc)
+{
+    /* Determine size of compressed image data */
+    const auto extent           = textureGL.QueryMipExtent(mipLevel);
+    const auto numBlocks        = static_cast<std::size_t>((extent.width + 3) / 4) * ((extent.height + 3) / 4) * extent.depth;
+    const auto compressedSize   = numBlocks * FormatBitSize(format) * 2;
+
+    auto compressedData = MakeUniqueArray<char>(compressedSize);
+
+    /* Read compressed image data from texture */
+    #if defined GL_ARB_direct_state_access && defined LLGL_GL_ENABLE_DSA_EXT
+    if (HasExtension(GLExt::ARB_direct_state_access))
+    {
+        glGetCompressedTextureImage(
+            textureGL.GetID(),
+            static_cast<GLint>(mipLevel),
+            static_cast<GLsizei>(compressedSize),
+            compressedData.get()
+        );
+    }
+    else
+    #endif
+    {
+        /* Bind texture and read compressed image data from texture */
+        GLStateManager::active->BindTexture(textureGL);
+        glGetCompressedTexImage(
+            GLTypes::Map(textureGL.GetType()),
+            static_cast<GLint>(mipLevel),
+            compressedData.get()
+        );
+    }
+
+    /* Decompress image data into the output image format */
+    const SrcImageDescriptor compressedImageDesc
+    {
+        ImageFormat::CompressedRGBA,
+        DataType::UInt8,
+        compressedData.get(),
+        compressedSize
+    };
+
+    auto image = DecompressImageBuffer(format, compressedImageDesc, extent, imageDesc.format, imageDesc.dataType, GetConfiguration().threadCount);
+
+    const auto imageSize = ImageDataSize(imageDesc.format, imageDesc.dataType, extent.width * extent.height * extent.depth);
+    AssertImageDataSize(imageDesc.dataSize, imageSize);
+
+    ::memcpy(imageDesc.data, image.get(), imageSize);
+}
+
 void GLRenderSystem::GenerateMipsPrimary(GLuint texID, const TextureType texType)
 {
     #if defined GL_ARB_direct_state_access && defined LLGL_GL_ENABLE_DSA_EXT
@@ -9,6 +9,7 @@
 #include "Ext/GLExtensions.h"
 #include "../GLCommon/GLExtensionRegistry.h"
 #include "../GLCommon/GLTypes.h"
+#include "../StaticLimits.h"
 #include "../../Core/Helper.h"
 #include <cstdint>
 #include <limits>
@@ -219,12 +220,43 @@ static void GLGetSupportedTextureFormats(std::vector<Format>& textureFormats)
             case GL_COMPRESSED_RGBA_S3TC_DXT5_EXT:
                 textureFormats.push_back(Format::BC3RGBA);
                 break;
+            #ifdef GL_ARB_ES3_compatibility
+            case GL_COMPRESSED_RGB8_ETC2:
+                textureFormats.push_back(Format::ETC2RGB8UNorm);
+                break;
+            case GL_COMPRESSED_RGB8_PUNCHTHROUGH_ALPHA1_ETC2:
+                textureFormats.push_back(Format::ETC2RGB8A1UNorm);
+                break;
+            case GL_COMPRESSED_RGBA8_ETC2_EAC:
+                textureFormats.push_back(Format::ETC2RGBA8UNorm);
+                break;
+            #endif
             default:
                 break;
         }
     }
 
     #endif
+
+    /* Add block compression formats that are not enumerated by GL_COMPRESSED_TEXTURE_FORMATS */
+    #ifdef GL_ARB_texture_compression_rgtc
+    if (HasExtension(GLExt::ARB_texture_compression_rgtc))
+    {
+        textureFormats.push_back(Format::BC4RUNorm);
+        textureFormats.push_back(Format::BC4RSNorm);
+        textureFormats.push_back(Format::BC5RGUNorm);
+        textureFormats.push_back(Format::BC5RGSNorm);
+    }
+    #endif
+
+    #ifdef GL_ARB_texture_compression_bptc
+    if (HasExtension(GLExt::ARB_texture_compression_bptc))
+    {
+        textureFormats.push_back(Format::BC6HRGBUFloat);
+        textureFormats.push_back(Format::BC6HRGBSFloat);
+        textureFormats.push_back(Format::BC7RGBAUNorm);
+    }
+    #endif
 }
 
 static void GLGetSupportedFeatures(RenderingFeatures& features)
@@ -250,6 +282,13 @@ static void GLGetSupportedFeatures(RenderingFeatures& features)
     features.hasConservativeRasterization   = ( HasExtension(GLExt::NV_conservative_raster) || HasExtension(GLExt::INTEL_conservative_rasterization) );
     features.hasStreamOutputs               = ( HasExtension(GLExt::EXT_transform_feedback) || HasExtension(GLExt::NV_transform_feedback) );
     features.hasLogicOp                     = true;
+    features.hasSparseBuffers               = ( HasExtension(GLExt::ARB_sparse_buffer) && HasExtension(GLExt::ARB_buffer_storage) );
+    features.hasSparseTextures              = ( HasExtension(GLExt::ARB_sparse_texture) && HasExtension(GLExt::ARB_texture_storage) && HasExtension(GLExt::ARB_internalformat_query) );
+    features.hasTextureViews                = ( HasExtension(GLExt::ARB_texture_view) && HasExtension(GLExt::ARB_texture_storage) );
+    features.hasTextureViewSwizzle          = ( features.hasTextureViews && HasExtension(GLExt::ARB_texture_swizzle) );
+    features.hasRenderConditionBuffers      = false;
+    features.hasQueryResultBuffers          = ( HasExtension(GLExt::ARB_query_buffer_object) && HasExtension(GLExt::ARB_timer_query) );
+    features.hasAsyncReadbacks              = true;
 }
 
 static void GLGetFeatureLimits(RenderingLimits& limits)
@@ -289,6 +328,18 @@ static void GLGetFeatureLimits(RenderingLimits& limits)
     /* Set maximum buffer size to maximum value for <GLsizei> (used in 'glBufferData') */
     limits.maxBufferSize          = static_cast<std::uint64_t>(std::numeric_limits<GLsizeiptr>::max());
     limits.maxConstantBufferSize  = static_cast<std::uint64_t>(GLGetUInt(GL_MAX_UNIFORM_BLOCK_SIZE));
+
+    /* Dynamic offsets are passed to 'glBindBufferRange' (see GLResourceHeap::Bind) */
+    limits.minConstantBufferOffsetAlignment = GLGetUInt(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT);
+
+    /* Inline constants are emulated with uniform buffer ranges (see GLCommandBuffer::SetInlineConstants) */
+    limits.maxInlineConstantsSize = LLGL_MAX_INLINE_CONSTANTS_SIZE;
+
+    /* Query page size of sparse buffers */
+    #ifdef GL_ARB_sparse_buffer
+    if (HasExtension(GLExt::ARB_sparse_buffer))
+        limits.sparsePageSize = GLGetUInt(GL_SPARSE_BUFFER_PAGE_SIZE_ARB);
+    #endif
 }
 
 static void GLGetTextureLimits(const RenderingFeatures& features, RenderingLimits& limits)
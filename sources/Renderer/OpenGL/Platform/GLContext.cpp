@@ -12,11 +12,12 @@ namespace LLGL
 {
 
 
-static GLContext* g_activeGLContext = nullptr;
+// GL contexts are current per thread, so is the active GLContext instance
+static thread_local GLContext* g_activeGLContext = nullptr;
 
-GLContext::GLContext(GLContext* sharedContext)
+GLContext::GLContext(GLContext* sharedContext, bool hidden)
 {
-    if (sharedContext)
+    if (sharedContext && !hidden)
         stateMngr_ = sharedContext->stateMngr_;
     else
         stateMngr_ = std::make_shared<GLStateManager>();
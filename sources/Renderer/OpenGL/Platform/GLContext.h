@@ -27,8 +27,9 @@ class GLContext
 
         virtual ~GLContext();
 
-        // Creates a platform specific GLContext instance.
-        static std::unique_ptr<GLContext> Create(const RenderContextDescriptor& desc, Surface& surface, GLContext* sharedContext);
+        // Creates a platform specific GLContext instance. If 'hidden' is true, the new context has its own hardware context and state manager,
+        // it never presents to the surface, and it only shares its GL objects with 'sharedContext' (used for upload contexts on worker threads).
+        static std::unique_ptr<GLContext> Create(const RenderContextDescriptor& desc, Surface& surface, GLContext* sharedContext, bool hidden = false);
 
         // Makes the specified GLContext current. If null, the current context will be deactivated.
         static bool MakeCurrent(GLContext* context);
@@ -52,7 +53,7 @@ class GLContext
 
     protected:
 
-        GLContext(GLContext* sharedContext);
+        GLContext(GLContext* sharedContext, bool hidden = false);
 
         // Activates or deactivates this GLContext (Win32: wglMakeCurrent, X11: glXMakeCurrent).
         virtual bool Activate(bool activate) = 0;
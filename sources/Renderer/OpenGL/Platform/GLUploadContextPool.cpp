@@ -0,0 +1,109 @@
+/*
+ * GLUploadContextPool.cpp
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "GLUploadContextPool.h"
+#include "../RenderState/GLFence.h"
+#include "../Ext/GLExtensions.h"
+#include <stdexcept>
+#include <limits>
+
+
+namespace LLGL
+{
+
+
+/*
+ * GLUploadContextPool class
+ */
+
+void GLUploadContextPool::Enable(const RenderContextDescriptor& desc, Surface& surface, GLContext& sharedContext)
+{
+    desc_           = desc;
+    surface_        = &surface;
+    sharedContext_  = &sharedContext;
+
+    /* Store actual GL version, since 'glGetIntegerv' can not be used on a worker thread before its context has been created */
+    auto& profileDesc = desc_.profileOpenGL;
+    if (profileDesc.contextProfile != OpenGLContextProfile::CompatibilityProfile && (profileDesc.majorVersion < 0 || profileDesc.minorVersion < 0))
+    {
+        glGetIntegerv(GL_MAJOR_VERSION, &(profileDesc.majorVersion));
+        glGetIntegerv(GL_MINOR_VERSION, &(profileDesc.minorVersion));
+    }
+}
+
+GLContext* GLUploadContextPool::Acquire()
+{
+    std::lock_guard<std::mutex> guard { mutex_ };
+
+    if (!freeContexts_.empty())
+    {
+        /* Make unused upload context current */
+        auto context = freeContexts_.back();
+        freeContexts_.pop_back();
+        GLContext::MakeCurrent(context);
+
+        /* Invalidate cached bindings, since objects might have been released and their names reused in the meantime */
+        context->GetStateManager()->InvalidateBindings();
+        return context;
+    }
+    else
+    {
+        /* Create new hidden context, which shares its GL objects with the primary context */
+        auto context = GLContext::Create(desc_, *surface_, sharedContext_, true);
+        GLContext::MakeCurrent(context.get());
+        context->GetStateManager()->DetermineExtensionsAndLimits();
+        contexts_.push_back(std::move(context));
+        return contexts_.back().get();
+    }
+}
+
+void GLUploadContextPool::Release(GLContext* context)
+{
+    /* Wait until all uploads are completed, so the GL objects can be used by the primary context right away */
+    {
+        GLFence fence;
+        fence.Submit();
+        fence.Wait(std::numeric_limits<GLuint64>::max());
+    }
+
+    /* Deactivate upload context and put it back into the pool */
+    GLContext::MakeCurrent(nullptr);
+
+    std::lock_guard<std::mutex> guard { mutex_ };
+    freeContexts_.push_back(context);
+}
+
+
+/*
+ * GLUploadContextScope class
+ */
+
+GLUploadContextScope::GLUploadContextScope(GLUploadContextPool& pool) :
+    pool_ { pool }
+{
+    /* Only make an upload context current if the calling thread has no active GL context, i.e. it is a worker thread */
+    if (!GLStateManager::active)
+    {
+        if (pool_.IsEnabled())
+            context_ = pool_.Acquire();
+        else
+            throw std::runtime_error("cannot create or write OpenGL resources on a thread without active GL context (see OpenGLRendererConfiguration::enableUploadContexts)");
+    }
+}
+
+GLUploadContextScope::~GLUploadContextScope()
+{
+    if (context_)
+        pool_.Release(context_);
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,93 @@
+/*
+ * GLUploadContextPool.h
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_GL_UPLOAD_CONTEXT_POOL_H
+#define LLGL_GL_UPLOAD_CONTEXT_POOL_H
+
+
+#include "GLContext.h"
+#include <vector>
+#include <memory>
+#include <mutex>
+
+
+namespace LLGL
+{
+
+
+// Pool of hidden GL contexts, which share their GL objects with the primary GL context (used to upload resources on worker threads).
+class GLUploadContextPool
+{
+
+    public:
+
+        GLUploadContextPool() = default;
+
+        GLUploadContextPool(const GLUploadContextPool&) = delete;
+        GLUploadContextPool& operator = (const GLUploadContextPool&) = delete;
+
+        // Enables the upload contexts for the specified primary context. This must be called on the thread where the primary context is current.
+        void Enable(const RenderContextDescriptor& desc, Surface& surface, GLContext& sharedContext);
+
+        // Returns true if the upload contexts have been enabled.
+        inline bool IsEnabled() const
+        {
+            return (sharedContext_ != nullptr);
+        }
+
+        // Makes an upload context current on the calling thread. A new upload context is created if there is no unused one.
+        GLContext* Acquire();
+
+        // Waits until all GL commands of the specified upload context have been completed, then deactivates it and puts it back into the pool.
+        void Release(GLContext* context);
+
+    private:
+
+        RenderContextDescriptor                 desc_;
+        Surface*                                surface_        = nullptr;
+        GLContext*                              sharedContext_  = nullptr;
+
+        std::mutex                              mutex_;
+        std::vector<std::unique_ptr<GLContext>> contexts_;
+        std::vector<GLContext*>                 freeContexts_;
+
+};
+
+// Scope guard that makes an upload context current, if the calling thread has no active GL context.
+class GLUploadContextScope
+{
+
+    public:
+
+        GLUploadContextScope(GLUploadContextPool& pool);
+        ~GLUploadContextScope();
+
+        GLUploadContextScope(const GLUploadContextScope&) = delete;
+        GLUploadContextScope& operator = (const GLUploadContextScope&) = delete;
+
+        // Returns true if an upload context is current within this scope.
+        inline bool IsUploadContext() const
+        {
+            return (context_ != nullptr);
+        }
+
+    private:
+
+        GLUploadContextPool&    pool_;
+        GLContext*              context_    = nullptr;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
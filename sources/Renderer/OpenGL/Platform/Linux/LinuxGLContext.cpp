@@ -33,10 +33,10 @@ typedef GLXContext (*GXLCREATECONTEXTATTRIBARBPROC)(Display*, GLXFBConfig, GLXCo
  * GLContext class
  */
 
-std::unique_ptr<GLContext> GLContext::Create(const RenderContextDescriptor& desc, Surface& surface, GLContext* sharedContext)
+std::unique_ptr<GLContext> GLContext::Create(const RenderContextDescriptor& desc, Surface& surface, GLContext* sharedContext, bool hidden)
 {
     LinuxGLContext* sharedContextGLX = (sharedContext != nullptr ? LLGL_CAST(LinuxGLContext*, sharedContext) : nullptr);
-    return MakeUnique<LinuxGLContext>(desc, surface, sharedContextGLX);
+    return MakeUnique<LinuxGLContext>(desc, surface, sharedContextGLX, hidden);
 }
 
 
@@ -44,8 +44,8 @@ std::unique_ptr<GLContext> GLContext::Create(const RenderContextDescriptor& desc
  * LinuxGLContext class
  */
 
-LinuxGLContext::LinuxGLContext(const RenderContextDescriptor& desc, Surface& surface, LinuxGLContext* sharedContext) :
-    GLContext { sharedContext }
+LinuxGLContext::LinuxGLContext(const RenderContextDescriptor& desc, Surface& surface, LinuxGLContext* sharedContext, bool hidden) :
+    GLContext { sharedContext, hidden }
 {
     NativeHandle nativeHandle;
     surface.GetNativeHandle(&nativeHandle);
@@ -181,7 +181,7 @@ GLXContext LinuxGLContext::CreateContextCoreProfile(GLXContext glcShared, int ma
                 None
             };
 
-            auto glc = glXCreateContextAttribsARB(display_, fbcList[0], nullptr, True, contextAttribs);
+            auto glc = glXCreateContextAttribsARB(display_, fbcList[0], glcShared, True, contextAttribs);
 
             XFree(fbcList);
 
@@ -24,7 +24,7 @@ class LinuxGLContext : public GLContext
 
     public:
 
-        LinuxGLContext(const RenderContextDescriptor& desc, Surface& surface, LinuxGLContext* sharedContext);
+        LinuxGLContext(const RenderContextDescriptor& desc, Surface& surface, LinuxGLContext* sharedContext, bool hidden);
         ~LinuxGLContext();
 
         bool SetSwapInterval(int interval) override;
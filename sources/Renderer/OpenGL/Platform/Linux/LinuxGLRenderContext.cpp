@@ -25,6 +25,9 @@ namespace LLGL
 void GLRenderContext::GetNativeContextHandle(
     NativeContextHandle& windowContext, const VideoModeDescriptor& videoModeDesc, const MultiSamplingDescriptor& multiSamplingDesc)
 {
+    /* Enable multi-threading for Xlib before the display is opened, since upload contexts make GLX calls on worker threads */
+    XInitThreads();
+
     /* Open X11 display */
     windowContext.display = XOpenDisplay(nullptr);
     if (!windowContext.display)
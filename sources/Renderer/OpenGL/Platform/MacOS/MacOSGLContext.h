@@ -25,7 +25,7 @@ class MacOSGLContext : public GLContext
 
     public:
 
-        MacOSGLContext(const RenderContextDescriptor& desc, Surface& surface, MacOSGLContext* sharedContext);
+        MacOSGLContext(const RenderContextDescriptor& desc, Surface& surface, MacOSGLContext* sharedContext, bool hidden);
         ~MacOSGLContext();
 
         bool SetSwapInterval(int interval) override;
@@ -44,6 +44,7 @@ class MacOSGLContext : public GLContext
         NSOpenGLPixelFormat*    pixelFormat_    = nullptr;
         NSOpenGLContext*        ctx_            = nullptr;
         NSWindow*               wnd_            = nullptr;
+        bool                    hidden_         = false;
 
 };
 
@@ -17,14 +17,15 @@ namespace LLGL
 {
 
 
-std::unique_ptr<GLContext> GLContext::Create(const RenderContextDescriptor& desc, Surface& surface, GLContext* sharedContext)
+std::unique_ptr<GLContext> GLContext::Create(const RenderContextDescriptor& desc, Surface& surface, GLContext* sharedContext, bool hidden)
 {
     MacOSGLContext* sharedContextGLNS = (sharedContext != nullptr ? LLGL_CAST(MacOSGLContext*, sharedContext) : nullptr);
-    return MakeUnique<MacOSGLContext>(desc, surface, sharedContextGLNS);
+    return MakeUnique<MacOSGLContext>(desc, surface, sharedContextGLNS, hidden);
 }
 
-MacOSGLContext::MacOSGLContext(const RenderContextDescriptor& desc, Surface& surface, MacOSGLContext* sharedContext) :
-    LLGL::GLContext { sharedContext }
+MacOSGLContext::MacOSGLContext(const RenderContextDescriptor& desc, Surface& surface, MacOSGLContext* sharedContext, bool hidden) :
+    LLGL::GLContext { sharedContext, hidden },
+    hidden_         { hidden                }
 {
     CreatePixelFormat(desc);
 
@@ -64,7 +65,8 @@ void MacOSGLContext::Resize(const Extent2D& resolution)
 bool MacOSGLContext::Activate(bool activate)
 {
     [ctx_ makeCurrentContext];
-    [ctx_ setView:[wnd_ contentView]];
+    if (!hidden_)
+        [ctx_ setView:[wnd_ contentView]];
     return true;
 }
 
@@ -118,7 +120,7 @@ void MacOSGLContext::CreateNSGLContext(const NativeHandle& nativeHandle, MacOSGL
     /* Get shared NS-OpenGL context */
     auto sharedNSGLCtx = (sharedContext != nullptr ? sharedContext->ctx_ : nullptr);
 
-    if (sharedNSGLCtx/* && if not create custom GL context */)
+    if (sharedNSGLCtx && !hidden_)
     {
         /* Share this NS-OpenGL context */
         ctx_ = sharedNSGLCtx;
@@ -23,10 +23,10 @@ namespace LLGL
  * GLContext class
  */
 
-std::unique_ptr<GLContext> GLContext::Create(const RenderContextDescriptor& desc, Surface& surface, GLContext* sharedContext)
+std::unique_ptr<GLContext> GLContext::Create(const RenderContextDescriptor& desc, Surface& surface, GLContext* sharedContext, bool hidden)
 {
     Win32GLContext* sharedContextWGL = (sharedContext != nullptr ? LLGL_CAST(Win32GLContext*, sharedContext) : nullptr);
-    return MakeUnique<Win32GLContext>(desc, surface, sharedContextWGL);
+    return MakeUnique<Win32GLContext>(desc, surface, sharedContextWGL, hidden);
 }
 
 
@@ -34,12 +34,14 @@ std::unique_ptr<GLContext> GLContext::Create(const RenderContextDescriptor& desc
  * Win32GLContext class
  */
 
-Win32GLContext::Win32GLContext(const RenderContextDescriptor& desc, Surface& surface, Win32GLContext* sharedContext) :
-    GLContext { sharedContext },
-    desc_     { desc          },
-    surface_  { surface       }
+Win32GLContext::Win32GLContext(const RenderContextDescriptor& desc, Surface& surface, Win32GLContext* sharedContext, bool hidden) :
+    GLContext { sharedContext, hidden },
+    desc_     { desc                  },
+    surface_  { surface               }
 {
-    if (sharedContext)
+    if (sharedContext && hidden)
+        CreateHiddenContext(*sharedContext);
+    else if (sharedContext)
     {
         auto sharedContextWGL = LLGL_CAST(Win32GLContext*, sharedContext);
         CreateContext(sharedContextWGL);
@@ -198,6 +200,32 @@ void Win32GLContext::CreateContext(Win32GLContext* sharedContext)
     //QueryGLVersion();
 }
 
+void Win32GLContext::CreateHiddenContext(Win32GLContext& sharedContext)
+{
+    /* Use device context and pixel format of the shared context (pixel format can be choosen only once for a Win32 window) */
+    hDC_            = sharedContext.hDC_;
+    pixelFormat_    = sharedContext.pixelFormat_;
+
+    /* Create own hardware context that shares all GL objects with the shared context */
+    if (desc_.profileOpenGL.contextProfile != OpenGLContextProfile::CompatibilityProfile && (wglCreateContextAttribsARB || LoadCreateContextProcs()))
+        hGLRC_ = CreateExtContextProfile(sharedContext.hGLRC_);
+    else
+    {
+        hGLRC_ = CreateStdContextProfile();
+        if (hGLRC_ && !wglShareLists(sharedContext.hGLRC_, hGLRC_))
+        {
+            DeleteGLContext(hGLRC_);
+            throw std::runtime_error("failed to share resources from OpenGL render context");
+        }
+    }
+
+    if (!hGLRC_)
+        throw std::runtime_error("failed to create hidden OpenGL render context");
+
+    if (wglMakeCurrent(hDC_, hGLRC_) != TRUE)
+        throw std::runtime_error("failed to activate hidden OpenGL render context");
+}
+
 void Win32GLContext::DeleteContext()
 {
     if (!hasSharedContext_)
@@ -24,7 +24,7 @@ class Win32GLContext : public GLContext
 
     public:
 
-        Win32GLContext(const RenderContextDescriptor& desc, Surface& surface, Win32GLContext* sharedContext);
+        Win32GLContext(const RenderContextDescriptor& desc, Surface& surface, Win32GLContext* sharedContext, bool hidden);
         ~Win32GLContext();
 
         bool SetSwapInterval(int interval) override;
@@ -36,6 +36,7 @@ class Win32GLContext : public GLContext
         bool Activate(bool activate) override;
 
         void CreateContext(Win32GLContext* sharedContext);
+        void CreateHiddenContext(Win32GLContext& sharedContext);
         void DeleteContext();
 
         void DeleteGLContext(HGLRC& renderContext);
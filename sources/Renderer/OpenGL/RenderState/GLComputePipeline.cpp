@@ -21,6 +21,9 @@ GLComputePipeline::GLComputePipeline(const ComputePipelineDescriptor& desc)
     shaderProgram_ = LLGL_CAST(GLShaderProgram*, desc.shaderProgram);
     if (!shaderProgram_)
         throw std::invalid_argument("failed to create compute pipeline due to missing shader program");
+
+    /* Store pipeline layout for inline constants */
+    pipelineLayout_ = LLGL_CAST(const GLPipelineLayout*, desc.pipelineLayout);
 }
 
 void GLComputePipeline::Bind(GLStateManager& stateMngr)
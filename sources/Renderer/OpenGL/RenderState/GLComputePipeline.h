@@ -10,6 +10,7 @@
 
 
 #include <LLGL/ComputePipeline.h>
+#include "GLPipelineLayout.h"
 
 
 namespace LLGL
@@ -28,9 +29,16 @@ class GLComputePipeline final : public ComputePipeline
 
         void Bind(GLStateManager& stateMngr);
 
+        // Returns the pipeline layout this compute pipeline was created with, or null if there is none.
+        inline const GLPipelineLayout* GetPipelineLayout() const
+        {
+            return pipelineLayout_;
+        }
+
     private:
 
-        GLShaderProgram* shaderProgram_ = nullptr;
+        GLShaderProgram*        shaderProgram_  = nullptr;
+        const GLPipelineLayout* pipelineLayout_ = nullptr;
 
 };
 
@@ -107,6 +107,9 @@ GLGraphicsPipeline::GLGraphicsPipeline(const GraphicsPipelineDescriptor& desc, c
     if (!shaderProgram_)
         throw std::invalid_argument("failed to create graphics pipeline due to missing shader program");
 
+    /* Store pipeline layout for inline constants */
+    pipelineLayout_ = LLGL_CAST(const GLPipelineLayout*, desc.pipelineLayout);
+
     /* Convert input-assembler state */
     drawMode_ = GLTypes::Map(desc.primitiveTopology);
 
@@ -176,8 +179,18 @@ GLGraphicsPipeline::GLGraphicsPipeline(const GraphicsPipelineDescriptor& desc, c
         BuildStaticStateBuffer(desc);
 }
 
+GLGraphicsPipeline::~GLGraphicsPipeline()
+{
+    if (GLStateManager::active)
+        GLStateManager::active->NotifyGraphicsPipelineRelease(this);
+}
+
 void GLGraphicsPipeline::Bind(GLStateManager& stateMngr)
 {
+    /* Skip redundant binding if this pipeline's states are still bound (pipelines are shared by the pipeline cache) */
+    if (stateMngr.GetBoundGraphicsPipeline() == this)
+        return;
+
     /* Bind shader program and discard rasterizer if there is no fragment shader */
     stateMngr.BindShaderProgram(shaderProgram_->GetID());
     stateMngr.Set(GLState::RASTERIZER_DISCARD, !shaderProgram_->HasFragmentShader());
@@ -270,6 +283,9 @@ void GLGraphicsPipeline::Bind(GLStateManager& stateMngr)
         if (numStaticScissors_ > 0)
             SetStaticScissors(stateMngr, rawBufferIter);
     }
+
+    /* Store this pipeline as bound after all states have been set */
+    stateMngr.NotifyGraphicsPipelineBind(this);
 }
 
 
@@ -11,6 +11,7 @@
 
 #include "../OpenGL.h"
 #include "GLStateManager.h"
+#include "GLPipelineLayout.h"
 #include "../Shader/GLShaderProgram.h"
 #include <LLGL/GraphicsPipeline.h>
 #include <LLGL/RenderSystemFlags.h>
@@ -30,6 +31,7 @@ class GLGraphicsPipeline final : public GraphicsPipeline
     public:
 
         GLGraphicsPipeline(const GraphicsPipelineDescriptor& desc, const RenderingLimits& limits);
+        ~GLGraphicsPipeline();
 
         // Binds this graphics pipeline state with the specified GL state manager.
         void Bind(GLStateManager& stateMngr);
@@ -40,6 +42,12 @@ class GLGraphicsPipeline final : public GraphicsPipeline
             return drawMode_;
         }
 
+        // Returns the pipeline layout this graphics pipeline was created with, or null if there is none.
+        inline const GLPipelineLayout* GetPipelineLayout() const
+        {
+            return pipelineLayout_;
+        }
+
     private:
 
         void BuildStaticStateBuffer(const GraphicsPipelineDescriptor& desc);
@@ -51,6 +59,7 @@ class GLGraphicsPipeline final : public GraphicsPipeline
 
         // shader state
         const GLShaderProgram*  shaderProgram_          = nullptr;
+        const GLPipelineLayout* pipelineLayout_         = nullptr;
 
         // input-assembler state
         GLenum                  drawMode_               = GL_TRIANGLES;
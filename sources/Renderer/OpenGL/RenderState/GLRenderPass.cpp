@@ -27,6 +27,37 @@ GLRenderPass::GLRenderPass(const RenderPassDescriptor& desc)
     /* Check if stencil attachment must be cleared */
     if (desc.stencilAttachment.loadOp == AttachmentLoadOp::Clear)
         clearMask_ |= GL_STENCIL_BUFFER_BIT;
+
+    /* Determine which attachments can be invalidated when the render pass begins and ends */
+    GLenum colorAttachment = GL_COLOR_ATTACHMENT0;
+    for (const auto& attachment : desc.colorAttachments)
+    {
+        AppendInvalidateAttachment(attachment, colorAttachment);
+        ++colorAttachment;
+    }
+
+    AppendInvalidateAttachment(desc.depthAttachment, GL_DEPTH_ATTACHMENT);
+    AppendInvalidateAttachment(desc.stencilAttachment, GL_STENCIL_ATTACHMENT);
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+void GLRenderPass::AppendInvalidateAttachment(const AttachmentFormatDescriptor& desc, GLenum attachment)
+{
+    /* Ignore unused attachments */
+    if (desc.format == Format::Undefined)
+        return;
+
+    /* Previous content is not required if it's neither loaded nor cleared */
+    if (desc.loadOp == AttachmentLoadOp::Undefined && numInvalidateOnBegin_ < static_cast<GLsizei>(maxNumInvalidateAttachments))
+        invalidateOnBegin_[numInvalidateOnBegin_++] = attachment;
+
+    /* Outcome is not required if it's not stored */
+    if (desc.storeOp == AttachmentStoreOp::Undefined && numInvalidateOnEnd_ < static_cast<GLsizei>(maxNumInvalidateAttachments))
+        invalidateOnEnd_[numInvalidateOnEnd_++] = attachment;
 }
 
 
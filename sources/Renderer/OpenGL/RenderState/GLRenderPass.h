@@ -39,11 +39,45 @@ class GLRenderPass final : public RenderPass
             return clearColorAttachments_;
         }
 
+        // Returns the number of attachments that are invalidated when a render pass begins (see AttachmentLoadOp::Undefined).
+        inline GLsizei GetNumInvalidateOnBegin() const
+        {
+            return numInvalidateOnBegin_;
+        }
+
+        // Returns the array of framebuffer attachments (e.g. GL_COLOR_ATTACHMENT0) that are invalidated when a render pass begins.
+        inline const GLenum* GetInvalidateOnBegin() const
+        {
+            return invalidateOnBegin_;
+        }
+
+        // Returns the number of attachments that are invalidated when a render pass ends (see AttachmentStoreOp::Undefined).
+        inline GLsizei GetNumInvalidateOnEnd() const
+        {
+            return numInvalidateOnEnd_;
+        }
+
+        // Returns the array of framebuffer attachments (e.g. GL_COLOR_ATTACHMENT0) that are invalidated when a render pass ends.
+        inline const GLenum* GetInvalidateOnEnd() const
+        {
+            return invalidateOnEnd_;
+        }
+
     private:
 
+        void AppendInvalidateAttachment(const AttachmentFormatDescriptor& desc, GLenum attachment);
+
+        // Maximal number of attachments that can be invalidated: all color attachments plus depth and stencil attachments.
+        static const std::size_t maxNumInvalidateAttachments = (LLGL_MAX_NUM_COLOR_ATTACHMENTS + 2);
+
         GLbitfield      clearMask_                                              = 0;
         std::uint8_t    clearColorAttachments_[LLGL_MAX_NUM_COLOR_ATTACHMENTS]  = {};
 
+        GLsizei         numInvalidateOnBegin_                                   = 0;
+        GLenum          invalidateOnBegin_[maxNumInvalidateAttachments]         = {};
+        GLsizei         numInvalidateOnEnd_                                     = 0;
+        GLenum          invalidateOnEnd_[maxNumInvalidateAttachments]           = {};
+
 };
 
 
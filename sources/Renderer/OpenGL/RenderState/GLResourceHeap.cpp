@@ -11,6 +11,8 @@
 #include "../Buffer/GLBuffer.h"
 #include "../Texture/GLSampler.h"
 #include "../Texture/GLTexture.h"
+#include "../Ext/GLExtensions.h"
+#include "../../GLCommon/GLTypes.h"
 #include "../../CheckedCast.h"
 #include "../../ResourceBindingIterator.h"
 
@@ -92,6 +94,16 @@ GLResourceHeap::GLResourceHeap(const ResourceHeapDescriptor& desc)
     BuildStorageBufferSegments(resourceIterator);
     BuildTextureSegments(resourceIterator);
     BuildSamplerSegments(resourceIterator);
+    BuildDynamicConstantBuffers(resourceIterator);
+}
+
+GLResourceHeap::~GLResourceHeap()
+{
+    for (const auto& textureView : textureViews_)
+    {
+        glDeleteTextures(1, &(textureView.texture));
+        GLStateManager::active->NotifyTextureRelease(textureView.texture, textureView.target);
+    }
 }
 
 static void BindBuffersBaseSegment(GLStateManager& stateMngr, std::int8_t*& byteAlignedBuffer, const GLBufferTarget bufferTarget)
@@ -135,7 +147,7 @@ static void BindSamplersSegment(GLStateManager& stateMngr, std::int8_t*& byteAli
     byteAlignedBuffer += segment->segmentSize;
 }
 
-void GLResourceHeap::Bind(GLStateManager& stateMngr)
+void GLResourceHeap::Bind(GLStateManager& stateMngr, std::uint32_t numDynamicOffsets, const std::uint32_t* dynamicOffsets)
 {
     auto byteAlignedBuffer = buffer_.data();
 
@@ -154,6 +166,19 @@ void GLResourceHeap::Bind(GLStateManager& stateMngr)
     /* Bind all samplers */
     for (std::uint8_t i = 0; i < segmentationHeader_.numSamplerSegments; ++i)
         BindSamplersSegment(stateMngr, byteAlignedBuffer);
+
+    /* Bind all constant buffers with dynamic offsets */
+    for (std::size_t i = 0; i < dynamicConstantBuffers_.size(); ++i)
+    {
+        const auto& cbuffer = dynamicConstantBuffers_[i];
+        if (cbuffer.size > 0)
+        {
+            const auto offset = (i < numDynamicOffsets ? dynamicOffsets[i] : 0u);
+            stateMngr.BindBufferRange(GLBufferTarget::UNIFORM_BUFFER, cbuffer.slot, cbuffer.buffer, static_cast<GLintptr>(offset), cbuffer.size);
+        }
+        else
+            stateMngr.BindBuffersBase(GLBufferTarget::UNIFORM_BUFFER, cbuffer.slot, 1, &(cbuffer.buffer));
+    }
 }
 
 
@@ -161,7 +186,7 @@ void GLResourceHeap::Bind(GLStateManager& stateMngr)
  * ======= Private: =======
  */
 
-using GLResourceBindingFunc = std::function<GLResourceBinding(Resource* resource, std::uint32_t slot)>;
+using GLResourceBindingFunc = std::function<GLResourceBinding(Resource* resource, const ResourceViewDescriptor& rsvDesc, std::uint32_t slot)>;
 
 static std::vector<GLResourceBinding> CollectGLResourceBindings(
     ResourceBindingIterator&        resourceIterator,
@@ -170,13 +195,14 @@ static std::vector<GLResourceBinding> CollectGLResourceBindings(
 {
     /* Collect all binding points of the specified resource type */
     BindingDescriptor bindingDesc;
+    ResourceViewDescriptor rsvDesc;
     resourceIterator.Reset(resourceType);
 
     std::vector<GLResourceBinding> resourceBindings;
     resourceBindings.reserve(resourceIterator.GetCount());
 
-    while (auto resource = resourceIterator.Next(bindingDesc))
-        resourceBindings.push_back(resourceFunc(resource, bindingDesc.slot));
+    while (auto resource = resourceIterator.Next(bindingDesc, &rsvDesc))
+        resourceBindings.push_back(resourceFunc(resource, rsvDesc, bindingDesc.slot));
 
     /* Sort resources by slot index */
     std::sort(
@@ -196,7 +222,7 @@ void GLResourceHeap::BuildBufferSegments(ResourceBindingIterator& resourceIterat
     auto resourceBindings = CollectGLResourceBindings(
         resourceIterator,
         resourceType,
-        [](Resource* resource, std::uint32_t slot) -> GLResourceBinding
+        [](Resource* resource, const ResourceViewDescriptor& /*rsvDesc*/, std::uint32_t slot) -> GLResourceBinding
         {
             auto bufferGL = LLGL_CAST(GLBuffer*, resource);
             return { slot, bufferGL->GetID(), GLTextureTarget::TEXTURE_1D };
@@ -221,16 +247,33 @@ void GLResourceHeap::BuildStorageBufferSegments(ResourceBindingIterator& resourc
     BuildBufferSegments(resourceIterator, ResourceType::StorageBuffer, segmentationHeader_.numStorageBufferSegments);
 }
 
+void GLResourceHeap::BuildDynamicConstantBuffers(ResourceBindingIterator& resourceIterator)
+{
+    /* Collect all constant buffers with dynamic offsets in the order of their bindings */
+    BindingDescriptor bindingDesc;
+    ResourceViewDescriptor rsvDesc;
+    resourceIterator.Reset(ResourceType::ConstantBuffer, StageFlags::AllStages, true);
+
+    while (auto resource = resourceIterator.Next(bindingDesc, &rsvDesc))
+    {
+        auto bufferGL = LLGL_CAST(GLBuffer*, resource);
+        dynamicConstantBuffers_.push_back({ bindingDesc.slot, bufferGL->GetID(), static_cast<GLsizeiptr>(rsvDesc.bufferRange) });
+    }
+}
+
 void GLResourceHeap::BuildTextureSegments(ResourceBindingIterator& resourceIterator)
 {
     /* Collect all textures */
     auto resourceBindings = CollectGLResourceBindings(
         resourceIterator,
         ResourceType::Texture,
-        [](Resource* resource, std::uint32_t slot) -> GLResourceBinding
+        [this](Resource* resource, const ResourceViewDescriptor& rsvDesc, std::uint32_t slot) -> GLResourceBinding
         {
             auto textureGL = LLGL_CAST(GLTexture*, resource);
-            return { slot, textureGL->GetID(), GLStateManager::GetTextureTarget(textureGL->GetType()) };
+            if (rsvDesc.textureView.format != Format::Undefined)
+                return CreateTextureView(*textureGL, rsvDesc.textureView, slot);
+            else
+                return { slot, textureGL->GetID(), GLStateManager::GetTextureTarget(textureGL->GetType()) };
         }
     );
 
@@ -248,7 +291,7 @@ void GLResourceHeap::BuildSamplerSegments(ResourceBindingIterator& resourceItera
     auto resourceBindings = CollectGLResourceBindings(
         resourceIterator,
         ResourceType::Sampler,
-        [](Resource* resource, std::uint32_t slot) -> GLResourceBinding
+        [](Resource* resource, const ResourceViewDescriptor& /*rsvDesc*/, std::uint32_t slot) -> GLResourceBinding
         {
             auto samplerGL = LLGL_CAST(GLSampler*, resource);
             return { slot, samplerGL->GetID(), GLTextureTarget::TEXTURE_1D };
@@ -351,6 +394,59 @@ void GLResourceHeap::BuildSegment2(GLResourceBindingIter it, GLsizei count)
         segmentIDs[i] = it->object;
 }
 
+#ifdef GL_ARB_texture_view
+
+GLResourceBinding GLResourceHeap::CreateTextureView(GLTexture& textureGL, const TextureViewDescriptor& textureViewDesc, GLuint slot)
+{
+    const auto& subresource = textureViewDesc.subresource;
+    const auto  target      = GLStateManager::GetTextureTarget(textureViewDesc.type);
+
+    /* Generate new texture to be used as view (due to immutable storage) */
+    GLuint texViewID = 0;
+    glGenTextures(1, &texViewID);
+
+    glTextureView(
+        texViewID,
+        GLTypes::Map(textureViewDesc.type),
+        textureGL.GetID(),
+        GLTypes::Map(textureViewDesc.format),
+        subresource.baseMipLevel,
+        subresource.numMipLevels,
+        subresource.baseArrayLayer,
+        subresource.numArrayLayers
+    );
+
+    /* Apply component swizzle to texture view (only if it differs from the identity mapping) */
+    const auto& swizzle = textureViewDesc.swizzle;
+    if (swizzle.r != TextureSwizzle::Red || swizzle.g != TextureSwizzle::Green || swizzle.b != TextureSwizzle::Blue || swizzle.a != TextureSwizzle::Alpha)
+    {
+        const auto targetGL = GLTypes::Map(textureViewDesc.type);
+        GLStateManager::active->PushBoundTexture(target);
+        {
+            GLStateManager::active->BindTexture(target, texViewID);
+            glTexParameteri(targetGL, GL_TEXTURE_SWIZZLE_R, static_cast<GLint>(GLTypes::Map(swizzle.r)));
+            glTexParameteri(targetGL, GL_TEXTURE_SWIZZLE_G, static_cast<GLint>(GLTypes::Map(swizzle.g)));
+            glTexParameteri(targetGL, GL_TEXTURE_SWIZZLE_B, static_cast<GLint>(GLTypes::Map(swizzle.b)));
+            glTexParameteri(targetGL, GL_TEXTURE_SWIZZLE_A, static_cast<GLint>(GLTypes::Map(swizzle.a)));
+        }
+        GLStateManager::active->PopBoundTexture();
+    }
+
+    textureViews_.push_back({ texViewID, target });
+
+    return { slot, texViewID, target };
+}
+
+#else
+
+GLResourceBinding GLResourceHeap::CreateTextureView(GLTexture& textureGL, const TextureViewDescriptor& /*textureViewDesc*/, GLuint slot)
+{
+    /* Fall back to binding the entire texture */
+    return { slot, textureGL.GetID(), GLStateManager::GetTextureTarget(textureGL.GetType()) };
+}
+
+#endif // /GL_ARB_texture_view
+
 
 } // /namespace LLGL
 
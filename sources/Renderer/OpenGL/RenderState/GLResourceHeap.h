@@ -11,6 +11,7 @@
 
 #include <LLGL/ResourceHeap.h>
 #include <LLGL/ResourceFlags.h>
+#include "GLState.h"
 #include "../OpenGL.h"
 #include <vector>
 #include <functional>
@@ -22,6 +23,7 @@ namespace LLGL
 
 class GLStateManager;
 class ResourceBindingIterator;
+class GLTexture;
 struct GLResourceBinding;
 
 /*
@@ -34,9 +36,13 @@ class GLResourceHeap final : public ResourceHeap
     public:
 
         GLResourceHeap(const ResourceHeapDescriptor& desc);
+        ~GLResourceHeap();
 
-        // Binds this resource heap with the specified GL state manager.
-        void Bind(GLStateManager& stateMngr);
+        /*
+        Binds this resource heap with the specified GL state manager.
+        Constant buffers with a dynamic offset are bound with 'glBindBufferRange' at the respective offset.
+        */
+        void Bind(GLStateManager& stateMngr, std::uint32_t numDynamicOffsets = 0, const std::uint32_t* dynamicOffsets = nullptr);
 
     private:
 
@@ -46,6 +52,7 @@ class GLResourceHeap final : public ResourceHeap
         void BuildBufferSegments(ResourceBindingIterator& resourceIterator, const ResourceType resourceType, std::uint8_t& numSegments);
         void BuildConstantBufferSegments(ResourceBindingIterator& resourceIterator);
         void BuildStorageBufferSegments(ResourceBindingIterator& resourceIterator);
+        void BuildDynamicConstantBuffers(ResourceBindingIterator& resourceIterator);
         void BuildTextureSegments(ResourceBindingIterator& resourceIterator);
         void BuildSamplerSegments(ResourceBindingIterator& resourceIterator);
 
@@ -58,6 +65,9 @@ class GLResourceHeap final : public ResourceHeap
         void BuildSegment1(GLResourceBindingIter it, GLsizei count);
         void BuildSegment2(GLResourceBindingIter it, GLsizei count);
 
+        // Creates a texture view (with 'glTextureView') for the specified texture and returns the binding for it.
+        GLResourceBinding CreateTextureView(GLTexture& textureGL, const TextureViewDescriptor& textureViewDesc, GLuint slot);
+
         // Header structure to describe all segments within the raw buffer.
         struct SegmentationHeader
         {
@@ -67,8 +77,25 @@ class GLResourceHeap final : public ResourceHeap
             std::uint8_t numSamplerSegments         = 0;
         };
 
-        SegmentationHeader          segmentationHeader_;
-        std::vector<std::int8_t>    buffer_;
+        // Texture view that is owned by this resource heap.
+        struct GLTextureView
+        {
+            GLuint          texture;
+            GLTextureTarget target;
+        };
+
+        // Constant buffer that is bound with a dynamic offset.
+        struct GLDynamicConstantBuffer
+        {
+            GLuint      slot;
+            GLuint      buffer;
+            GLsizeiptr  size;
+        };
+
+        SegmentationHeader                      segmentationHeader_;
+        std::vector<std::int8_t>                buffer_;
+        std::vector<GLDynamicConstantBuffer>    dynamicConstantBuffers_;
+        std::vector<GLTextureView>              textureViews_;
 
 };
 
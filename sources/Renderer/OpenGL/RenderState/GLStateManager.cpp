@@ -11,6 +11,8 @@
 #include "../../GLCommon/GLTypes.h"
 #include "../../../Core/Helper.h"
 #include "../../../Core/Assertion.h"
+#include <algorithm>
+#include <mutex>
 
 
 namespace LLGL
@@ -118,12 +120,20 @@ static void InvalidateBoundGLObject(GLuint& boundId, const GLuint releasedObject
         boundId = g_GLInvalidId;
 }
 
+// Returns the specified bound object or 0 if the binding has been invalidated, so it can be restored without generating a GL error
+static GLuint GetRestorableGLObject(const GLuint boundId)
+{
+    return (boundId != g_GLInvalidId ? boundId : 0);
+}
+
 
 /* ----- Common ----- */
 
+// State managers are also created and destroyed by upload contexts on worker threads
 static std::vector<GLStateManager*> g_GLStateManagerList;
+static std::mutex                   g_GLStateManagerListMutex;
 
-GLStateManager* GLStateManager::active = nullptr;
+thread_local GLStateManager* GLStateManager::active = nullptr;
 
 GLStateManager::GLStateManager()
 {
@@ -142,11 +152,13 @@ GLStateManager::GLStateManager()
     GLStateManager::active = this;
 
     /* Store state manager in global list */
+    std::lock_guard<std::mutex> guard { g_GLStateManagerListMutex };
     g_GLStateManagerList.push_back(this);
 }
 
 GLStateManager::~GLStateManager()
 {
+    std::lock_guard<std::mutex> guard { g_GLStateManagerListMutex };
     RemoveFromList(g_GLStateManagerList, this);
 }
 
@@ -158,10 +170,26 @@ void GLStateManager::DetermineExtensionsAndLimits()
     #endif
 }
 
+void GLStateManager::InvalidateBindings()
+{
+    /* Invalidate all cached object bindings, so the next bind commands are always forwarded to GL */
+    Fill(bufferState_.boundBuffers, g_GLInvalidId);
+    Fill(framebufferState_.boundFramebuffers, g_GLInvalidId);
+    Fill(samplerState_.boundSamplers, g_GLInvalidId);
+
+    for (auto& layer : textureState_.layers)
+        Fill(layer.boundTextures, g_GLInvalidId);
+
+    renderbufferState_.boundRenderbuffer    = g_GLInvalidId;
+    shaderState_.boundProgram               = g_GLInvalidId;
+    boundGraphicsPipeline_                  = nullptr;
+}
+
 void GLStateManager::NotifyRenderTargetHeight(GLint height)
 {
     /* Store new render-target height */
     renderTargetHeight_ = height;
+    boundGraphicsPipeline_ = nullptr;
 
     /* Update viewports */
     //TODO...
@@ -174,6 +202,7 @@ void GLStateManager::SetGraphicsAPIDependentState(const OpenGLDependentStateDesc
 
     /* Store new graphics state */
     apiDependentState_ = stateDesc;
+    boundGraphicsPipeline_ = nullptr;
 
     /* Update front face */
     if (updateFrontFace)
@@ -187,6 +216,7 @@ void GLStateManager::Reset()
     /* Query all states from OpenGL */
     for (std::size_t i = 0; i < numStates; ++i)
         renderState_.values[i] = (glIsEnabled(g_stateCapsEnum[i]) != GL_FALSE);
+    boundGraphicsPipeline_ = nullptr;
 }
 
 void GLStateManager::Set(GLState state, bool value)
@@ -309,6 +339,8 @@ void GLStateManager::AdjustViewport(GLViewport& viewport)
 
 void GLStateManager::SetViewport(GLViewport& viewport)
 {
+    boundGraphicsPipeline_ = nullptr;
+
     /* Adjust viewport for vertical-flipped screen space origin */
     if (emulateClipControl_ && !apiDependentState_.originLowerLeft)
         AdjustViewport(viewport);
@@ -336,6 +368,8 @@ void GLStateManager::SetViewportArray(GLuint first, GLsizei count, GLViewport* v
 {
     if (first + count > 1)
     {
+        boundGraphicsPipeline_ = nullptr;
+
         AssertViewportLimit(first, count);
         AssertExtViewportArray();
 
@@ -357,6 +391,7 @@ void GLStateManager::SetViewportArray(GLuint first, GLsizei count, GLViewport* v
 
 void GLStateManager::SetDepthRange(const GLDepthRange& depthRange)
 {
+    boundGraphicsPipeline_ = nullptr;
     glDepthRange(depthRange.minDepth, depthRange.maxDepth);
 }
 
@@ -364,6 +399,8 @@ void GLStateManager::SetDepthRangeArray(GLuint first, GLsizei count, const GLDep
 {
     if (first + count > 1)
     {
+        boundGraphicsPipeline_ = nullptr;
+
         AssertViewportLimit(first, count);
         AssertExtViewportArray();
 
@@ -384,6 +421,8 @@ void GLStateManager::AdjustScissor(GLScissor& scissor)
 
 void GLStateManager::SetScissor(GLScissor& scissor)
 {
+    boundGraphicsPipeline_ = nullptr;
+
     if (emulateClipControl_)
         AdjustScissor(scissor);
 
@@ -394,6 +433,8 @@ void GLStateManager::SetScissorArray(GLuint first, GLsizei count, GLScissor* sci
 {
     if (first + count > 1)
     {
+        boundGraphicsPipeline_ = nullptr;
+
         AssertViewportLimit(first, count);
         AssertExtViewportArray();
 
@@ -708,6 +749,14 @@ void GLStateManager::BindBufferBase(GLBufferTarget target, GLuint index, GLuint
     bufferState_.boundBuffers[targetIdx] = buffer;
 }
 
+void GLStateManager::BindBufferRange(GLBufferTarget target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size)
+{
+    /* Always bind buffer with a range, since the offset usually changes with each call */
+    auto targetIdx = static_cast<std::size_t>(target);
+    glBindBufferRange(g_bufferTargetsEnum[targetIdx], index, buffer, offset, size);
+    bufferState_.boundBuffers[targetIdx] = buffer;
+}
+
 void GLStateManager::BindBuffersBase(GLBufferTarget target, GLuint first, GLsizei count, const GLuint* buffers)
 {
     /* Always bind buffers with a base index */
@@ -794,7 +843,7 @@ void GLStateManager::PopBoundBuffer()
 {
     const auto& state = bufferState_.boundBufferStack.top();
     {
-        BindBuffer(state.target, state.buffer);
+        BindBuffer(state.target, GetRestorableGLObject(state.buffer));
     }
     bufferState_.boundBufferStack.pop();
 }
@@ -837,7 +886,7 @@ void GLStateManager::PopBoundFramebuffer()
 {
     const auto& state = framebufferState_.boundFramebufferStack.top();
     {
-        BindFramebuffer(state.target, state.framebuffer);
+        BindFramebuffer(state.target, GetRestorableGLObject(state.framebuffer));
     }
     framebufferState_.boundFramebufferStack.pop();
 }
@@ -968,7 +1017,7 @@ void GLStateManager::PopBoundTexture()
     const auto& state = textureState_.boundTextureStack.top();
     {
         ActiveTexture(state.layer);
-        BindTexture(state.target, state.texture);
+        BindTexture(state.target, GetRestorableGLObject(state.texture));
     }
     textureState_.boundTextureStack.pop();
 }
@@ -1005,12 +1054,16 @@ void GLStateManager::BindSamplers(GLuint first, GLsizei count, const GLuint* sam
     #ifdef GL_ARB_multi_bind
     if (count >= 2 && HasExtension(GLExt::ARB_multi_bind))
     {
+        /* Skip binding if all samplers are already bound (shared samplers are likely to be bound repeatedly) */
+        if (std::equal(samplers, samplers + count, samplerState_.boundSamplers.begin() + first))
+            return;
+
         /* Bind all samplers at once */
         glBindSamplers(first, count, samplers);
 
         /* Store bound samplers */
         for (GLsizei i = 0; i < count; ++i)
-            samplerState_.boundSamplers[i] = samplers[i];
+            samplerState_.boundSamplers[first + i] = samplers[i];
     }
     else
     #endif
@@ -1034,6 +1087,7 @@ void GLStateManager::BindShaderProgram(GLuint program)
     if (shaderState_.boundProgram != program)
     {
         shaderState_.boundProgram = program;
+        boundGraphicsPipeline_ = nullptr;
         glUseProgram(program);
     }
 }
@@ -1045,7 +1099,7 @@ void GLStateManager::PushShaderProgram()
 
 void GLStateManager::PopShaderProgram()
 {
-    BindShaderProgram(shaderState_.boundProgramStack.top());
+    BindShaderProgram(GetRestorableGLObject(shaderState_.boundProgramStack.top()));
     shaderState_.boundProgramStack.pop();
 }
 
@@ -1054,6 +1108,19 @@ void GLStateManager::NotifyShaderProgramRelease(GLuint program)
     InvalidateBoundGLObject(shaderState_.boundProgram, program);
 }
 
+/* ----- Graphics Pipeline ----- */
+
+void GLStateManager::NotifyGraphicsPipelineBind(const GLGraphicsPipeline* graphicsPipeline)
+{
+    boundGraphicsPipeline_ = graphicsPipeline;
+}
+
+void GLStateManager::NotifyGraphicsPipelineRelease(const GLGraphicsPipeline* graphicsPipeline)
+{
+    if (boundGraphicsPipeline_ == graphicsPipeline)
+        boundGraphicsPipeline_ = nullptr;
+}
+
 
 /*
  * ======= Private: =======
@@ -12,6 +12,7 @@
 #include "GLState.h"
 #include "../Buffer/GLBuffer.h"
 #include "../Texture/GLTexture.h"
+#include "../Buffer/GLVertexArrayCache.h"
 #include <LLGL/CommandBufferFlags.h>
 #include <array>
 #include <vector>
@@ -23,6 +24,8 @@ namespace LLGL
 {
 
 
+class GLGraphicsPipeline;
+
 // OpenGL state machine manager that tries to reduce GL state changes.
 class GLStateManager
 {
@@ -34,12 +37,15 @@ class GLStateManager
         GLStateManager();
         ~GLStateManager();
 
-        // Active state manager. Each GL context has its own states, thus its own state manager.
-        static GLStateManager* active;
+        // Active state manager of the calling thread. Each GL context has its own states, thus its own state manager.
+        static thread_local GLStateManager* active;
 
         // Queries all supported and available GL extensions and limitations, then stores it internally (must be called once a GL context has been created).
         void DetermineExtensionsAndLimits();
 
+        // Invalidates all cached bindings of shared GL objects, since their names might have been released and reused by another GL context.
+        void InvalidateBindings();
+
         //TODO: viewports and scissors must be updated!
         // Notifies the state manager about a new render-target height.
         void NotifyRenderTargetHeight(GLint height);
@@ -113,12 +119,19 @@ class GLStateManager
 
         void BindBuffer(GLBufferTarget target, GLuint buffer);
         void BindBufferBase(GLBufferTarget target, GLuint index, GLuint buffer);
+        void BindBufferRange(GLBufferTarget target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size);
         void BindBuffersBase(GLBufferTarget target, GLuint first, GLsizei count, const GLuint* buffers);
 
         void BindVertexArray(GLuint vertexArray);
 
         void NotifyVertexArrayRelease(GLuint vertexArray);
 
+        // Returns the cache of shared VAOs for the GL context of this state manager, since VAOs are not shared between GL contexts.
+        inline GLVertexArrayCache& GetVertexArrayCache()
+        {
+            return vertexArrayCache_;
+        }
+
         /**
         \brief Binds the specified GL_ELEMENT_ARRAY_BUFFER (i.e. index buffer) to the next VAO (or the current one).
         \see BindVertexArray
@@ -180,6 +193,17 @@ class GLStateManager
 
         void NotifyShaderProgramRelease(GLuint program);
 
+        /* ----- Graphics Pipeline ----- */
+
+        // Returns the graphics pipeline whose states are currently bound, or null if any of those states might have been changed since.
+        inline const GLGraphicsPipeline* GetBoundGraphicsPipeline() const
+        {
+            return boundGraphicsPipeline_;
+        }
+
+        void NotifyGraphicsPipelineBind(const GLGraphicsPipeline* graphicsPipeline);
+        void NotifyGraphicsPipelineRelease(const GLGraphicsPipeline* graphicsPipeline);
+
     private:
 
         /* ----- Functions ----- */
@@ -352,6 +376,7 @@ class GLStateManager
         GLRenderbufferState             renderbufferState_;
         GLTextureState                  textureState_;
         GLVertexArrayState              vertexArrayState_;
+        GLVertexArrayCache              vertexArrayCache_;
         GLShaderState                   shaderState_;
         GLSamplerState                  samplerState_;
 
@@ -361,6 +386,8 @@ class GLStateManager
 
         GLTextureLayer*                 activeTextureLayer_ = nullptr;
 
+        const GLGraphicsPipeline*       boundGraphicsPipeline_  = nullptr;
+
         bool                            emulateClipControl_ = false;
         GLint                           renderTargetHeight_ = 0;
 
@@ -125,6 +125,42 @@ TextureDescriptor GLTexture::QueryDesc() const
     return texDesc;
 }
 
+Extent3D GLTexture::QuerySparseTileExtent() const
+{
+    #ifdef GL_ARB_sparse_texture
+    if (HasExtension(GLExt::ARB_sparse_texture))
+    {
+        auto target = GLTypes::Map(GetType());
+
+        /* Query whether this texture has been created as sparse texture */
+        GLint sparse = GL_FALSE;
+        GLStateManager::active->PushBoundTexture(GLStateManager::GetTextureTarget(GetType()));
+        {
+            GLStateManager::active->BindTexture(*this);
+            glGetTexParameteriv(target, GL_TEXTURE_SPARSE_ARB, &sparse);
+        }
+        GLStateManager::active->PopBoundTexture();
+
+        if (sparse != GL_FALSE)
+        {
+            /* Query first virtual page size of the internal format (sparse textures are created with GL_VIRTUAL_PAGE_SIZE_INDEX_ARB = 0) */
+            auto internalFormat = QueryGLInternalFormat();
+            GLint pageSize[3] = { 0, 0, 0 };
+            glGetInternalformativ(target, internalFormat, GL_VIRTUAL_PAGE_SIZE_X_ARB, 1, &pageSize[0]);
+            glGetInternalformativ(target, internalFormat, GL_VIRTUAL_PAGE_SIZE_Y_ARB, 1, &pageSize[1]);
+            glGetInternalformativ(target, internalFormat, GL_VIRTUAL_PAGE_SIZE_Z_ARB, 1, &pageSize[2]);
+            return
+            {
+                static_cast<std::uint32_t>(pageSize[0]),
+                static_cast<std::uint32_t>(pageSize[1]),
+                static_cast<std::uint32_t>(pageSize[2])
+            };
+        }
+    }
+    #endif // /GL_ARB_sparse_texture
+    return { 0, 0, 0 };
+}
+
 GLenum GLTexture::QueryGLInternalFormat() const
 {
     /* Query hardware texture format */
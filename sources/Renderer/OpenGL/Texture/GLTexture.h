@@ -29,6 +29,8 @@ class GLTexture final : public Texture
 
         TextureDescriptor QueryDesc() const override;
 
+        Extent3D QuerySparseTileExtent() const override;
+
         // Queries the GL_TEXTURE_INTERNAL_FORMAT parameter of this texture.
         GLenum QueryGLInternalFormat() const;
 
@@ -0,0 +1,269 @@
+/*
+ * PipelineCache.cpp
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "PipelineCache.h"
+#include "../Core/Helper.h"
+
+
+namespace LLGL
+{
+
+
+/* ----- Internal functions ----- */
+
+static void AppendKey(std::string& key, const Viewport& viewport)
+{
+    AppendKey(key, viewport.x);
+    AppendKey(key, viewport.y);
+    AppendKey(key, viewport.width);
+    AppendKey(key, viewport.height);
+    AppendKey(key, viewport.minDepth);
+    AppendKey(key, viewport.maxDepth);
+}
+
+static void AppendKey(std::string& key, const Scissor& scissor)
+{
+    AppendKey(key, scissor.x);
+    AppendKey(key, scissor.y);
+    AppendKey(key, scissor.width);
+    AppendKey(key, scissor.height);
+}
+
+static void AppendKey(std::string& key, const DepthDescriptor& desc)
+{
+    AppendKey(key, desc.testEnabled);
+    AppendKey(key, desc.writeEnabled);
+    AppendKey(key, desc.compareOp);
+}
+
+static void AppendKey(std::string& key, const StencilFaceDescriptor& desc)
+{
+    AppendKey(key, desc.stencilFailOp);
+    AppendKey(key, desc.depthFailOp);
+    AppendKey(key, desc.depthPassOp);
+    AppendKey(key, desc.compareOp);
+    AppendKey(key, desc.readMask);
+    AppendKey(key, desc.writeMask);
+    AppendKey(key, desc.reference);
+}
+
+static void AppendKey(std::string& key, const StencilDescriptor& desc)
+{
+    AppendKey(key, desc.testEnabled);
+    AppendKey(key, desc.front);
+    AppendKey(key, desc.back);
+}
+
+static void AppendKey(std::string& key, const RasterizerDescriptor& desc)
+{
+    AppendKey(key, desc.polygonMode);
+    AppendKey(key, desc.cullMode);
+    AppendKey(key, desc.depthBias.constantFactor);
+    AppendKey(key, desc.depthBias.slopeFactor);
+    AppendKey(key, desc.depthBias.clamp);
+    AppendKey(key, desc.multiSampling.enabled);
+    AppendKey(key, desc.multiSampling.samples);
+    AppendKey(key, desc.multiSampling.sampleMask);
+    AppendKey(key, desc.frontCCW);
+    AppendKey(key, desc.depthClampEnabled);
+    AppendKey(key, desc.scissorTestEnabled);
+    AppendKey(key, desc.antiAliasedLineEnabled);
+    AppendKey(key, desc.conservativeRasterization);
+    AppendKey(key, desc.lineWidth);
+}
+
+static void AppendKey(std::string& key, const BlendTargetDescriptor& desc)
+{
+    AppendKey(key, desc.srcColor);
+    AppendKey(key, desc.dstColor);
+    AppendKey(key, desc.colorArithmetic);
+    AppendKey(key, desc.srcAlpha);
+    AppendKey(key, desc.dstAlpha);
+    AppendKey(key, desc.alphaArithmetic);
+    AppendKey(key, desc.colorMask.r);
+    AppendKey(key, desc.colorMask.g);
+    AppendKey(key, desc.colorMask.b);
+    AppendKey(key, desc.colorMask.a);
+}
+
+static void AppendKey(std::string& key, const BlendDescriptor& desc)
+{
+    AppendKey(key, desc.blendEnabled);
+    AppendKey(key, desc.blendFactor.r);
+    AppendKey(key, desc.blendFactor.g);
+    AppendKey(key, desc.blendFactor.b);
+    AppendKey(key, desc.blendFactor.a);
+    AppendKey(key, desc.alphaToCoverageEnabled);
+    AppendKey(key, desc.logicOp);
+    AppendKey(key, desc.targets.size());
+    for (const auto& target : desc.targets)
+        AppendKey(key, target);
+}
+
+// Key prefixes to distinguish between graphics and compute pipelines
+static const char g_graphicsPipelineKeyPrefix   = 'G';
+static const char g_computePipelineKeyPrefix    = 'C';
+
+
+/* ----- Pipeline cache ----- */
+
+bool PipelineCache::Release(const GraphicsPipeline& graphicsPipeline)
+{
+    return ReleaseEntry(&graphicsPipeline);
+}
+
+bool PipelineCache::Release(const ComputePipeline& computePipeline)
+{
+    return ReleaseEntry(&computePipeline);
+}
+
+void PipelineCache::Evict(const ShaderProgram& shaderProgram)
+{
+    EvictReferences(&shaderProgram);
+}
+
+void PipelineCache::Evict(const RenderPass& renderPass)
+{
+    EvictReferences(&renderPass);
+}
+
+void PipelineCache::Evict(const PipelineLayout& pipelineLayout)
+{
+    EvictReferences(&pipelineLayout);
+}
+
+PipelineCacheStatistics PipelineCache::GetStatistics() const
+{
+    PipelineCacheStatistics stats;
+    {
+        stats.numHits       = numHits_;
+        stats.numMisses     = numMisses_;
+        stats.numPipelines  = static_cast<std::uint32_t>(entries_.size());
+    }
+    return stats;
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+std::string PipelineCache::MakeKey(const GraphicsPipelineDescriptor& desc)
+{
+    std::string key;
+
+    AppendKey(key, g_graphicsPipelineKeyPrefix);
+    AppendKey(key, desc.shaderProgram);
+    AppendKey(key, desc.renderPass);
+    AppendKey(key, desc.pipelineLayout);
+    AppendKey(key, desc.primitiveTopology);
+
+    AppendKey(key, desc.viewports.size());
+    for (const auto& viewport : desc.viewports)
+        AppendKey(key, viewport);
+
+    AppendKey(key, desc.scissors.size());
+    for (const auto& scissor : desc.scissors)
+        AppendKey(key, scissor);
+
+    AppendKey(key, desc.depth);
+    AppendKey(key, desc.stencil);
+    AppendKey(key, desc.rasterizer);
+    AppendKey(key, desc.blend);
+
+    return key;
+}
+
+std::string PipelineCache::MakeKey(const ComputePipelineDescriptor& desc)
+{
+    std::string key;
+
+    AppendKey(key, g_computePipelineKeyPrefix);
+    AppendKey(key, desc.shaderProgram);
+    AppendKey(key, desc.pipelineLayout);
+
+    return key;
+}
+
+void* PipelineCache::Find(const std::string& key)
+{
+    auto it = pipelines_.find(key);
+    if (it != pipelines_.end())
+    {
+        /* Share cached pipeline and increment its reference counter */
+        ++numHits_;
+        ++(entries_[it->second].refCount);
+        return it->second;
+    }
+    return nullptr;
+}
+
+void* PipelineCache::Insert(const std::string& key, void* pipeline, const void* shaderProgram, const void* renderPass, const void* pipelineLayout)
+{
+    ++numMisses_;
+
+    /* Only cache valid pipelines (some renderers do not support all pipeline types) */
+    if (pipeline != nullptr)
+    {
+        pipelines_[key] = pipeline;
+        auto& entry = entries_[pipeline];
+        {
+            entry.key           = key;
+            entry.refCount      = 1;
+            entry.references[0] = shaderProgram;
+            entry.references[1] = renderPass;
+            entry.references[2] = pipelineLayout;
+        }
+    }
+
+    return pipeline;
+}
+
+bool PipelineCache::ReleaseEntry(const void* pipeline)
+{
+    auto it = entries_.find(pipeline);
+    if (it != entries_.end())
+    {
+        /* Decrement reference counter and remove pipeline from cache if it is no longer used */
+        if (--(it->second.refCount) > 0)
+            return false;
+
+        /* Only remove the lookup if it was not evicted and replaced by another pipeline */
+        auto lookupIt = pipelines_.find(it->second.key);
+        if (lookupIt != pipelines_.end() && lookupIt->second == pipeline)
+            pipelines_.erase(lookupIt);
+
+        entries_.erase(it);
+    }
+    return true;
+}
+
+void PipelineCache::EvictReferences(const void* object)
+{
+    for (const auto& it : entries_)
+    {
+        const auto& entry = it.second;
+        for (auto ref : entry.references)
+        {
+            if (ref == object)
+            {
+                /* Remove lookup only; the pipeline itself is still reference counted by its owners */
+                auto lookupIt = pipelines_.find(entry.key);
+                if (lookupIt != pipelines_.end() && lookupIt->second == it.first)
+                    pipelines_.erase(lookupIt);
+                break;
+            }
+        }
+    }
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
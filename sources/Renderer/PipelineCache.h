@@ -0,0 +1,127 @@
+/*
+ * PipelineCache.h
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_PIPELINE_CACHE_H
+#define LLGL_PIPELINE_CACHE_H
+
+
+#include <LLGL/Export.h>
+#include <LLGL/GraphicsPipelineFlags.h>
+#include <LLGL/ComputePipelineFlags.h>
+#include <LLGL/RenderSystemFlags.h>
+#include <unordered_map>
+#include <string>
+
+
+namespace LLGL
+{
+
+
+class GraphicsPipeline;
+class ComputePipeline;
+class ShaderProgram;
+class RenderPass;
+class PipelineLayout;
+
+/*
+Cache for reference counted pipeline state objects, which are identified by the contents of their descriptors.
+This is used by all render systems to share pipeline states that are created with equal descriptors.
+*/
+class LLGL_EXPORT PipelineCache
+{
+
+    public:
+
+        // Returns the shared graphics pipeline for the descriptor, or creates a new one with the specified function on a cache miss.
+        template <typename TCreateFunc>
+        GraphicsPipeline* GetOrCreate(const GraphicsPipelineDescriptor& desc, const TCreateFunc& createFunc);
+
+        // Returns the shared compute pipeline for the descriptor, or creates a new one with the specified function on a cache miss.
+        template <typename TCreateFunc>
+        ComputePipeline* GetOrCreate(const ComputePipelineDescriptor& desc, const TCreateFunc& createFunc);
+
+        // Decrements the reference counter of the specified pipeline, and returns true if the pipeline is no longer used and must be deleted.
+        bool Release(const GraphicsPipeline& graphicsPipeline);
+        bool Release(const ComputePipeline& computePipeline);
+
+        /*
+        Removes all pipelines that were created with the specified object from the lookup, so a new object at the same address never matches them.
+        This must be called before the object is deleted. Evicted pipelines stay valid until their last reference is released.
+        */
+        void Evict(const ShaderProgram& shaderProgram);
+        void Evict(const RenderPass& renderPass);
+        void Evict(const PipelineLayout& pipelineLayout);
+
+        // Returns the cache statistics.
+        PipelineCacheStatistics GetStatistics() const;
+
+    private:
+
+        // Number of objects a pipeline key refers to by address: shader program, render pass, and pipeline layout.
+        static const std::size_t numReferences = 3;
+
+        struct Entry
+        {
+            std::string     key;
+            std::uint32_t   refCount                    = 0;
+            const void*     references[numReferences]   = {};
+        };
+
+        static std::string MakeKey(const GraphicsPipelineDescriptor& desc);
+        static std::string MakeKey(const ComputePipelineDescriptor& desc);
+
+        void* Find(const std::string& key);
+        void* Insert(const std::string& key, void* pipeline, const void* shaderProgram, const void* renderPass, const void* pipelineLayout);
+        bool ReleaseEntry(const void* pipeline);
+        void EvictReferences(const void* object);
+
+        std::unordered_map<std::string, void*>          pipelines_;
+        std::unordered_map<const void*, Entry>          entries_;
+
+        std::uint32_t                                   numHits_    = 0;
+        std::uint32_t                                   numMisses_  = 0;
+
+};
+
+
+/* ----- Templates ----- */
+
+template <typename TCreateFunc>
+GraphicsPipeline* PipelineCache::GetOrCreate(const GraphicsPipelineDescriptor& desc, const TCreateFunc& createFunc)
+{
+    auto key = MakeKey(desc);
+    if (auto pipeline = Find(key))
+        return static_cast<GraphicsPipeline*>(pipeline);
+    else
+    {
+        GraphicsPipeline* newPipeline = createFunc();
+        return static_cast<GraphicsPipeline*>(Insert(key, newPipeline, desc.shaderProgram, desc.renderPass, desc.pipelineLayout));
+    }
+}
+
+template <typename TCreateFunc>
+ComputePipeline* PipelineCache::GetOrCreate(const ComputePipelineDescriptor& desc, const TCreateFunc& createFunc)
+{
+    auto key = MakeKey(desc);
+    if (auto pipeline = Find(key))
+        return static_cast<ComputePipeline*>(pipeline);
+    else
+    {
+        ComputePipeline* newPipeline = createFunc();
+        return static_cast<ComputePipeline*>(Insert(key, newPipeline, desc.shaderProgram, nullptr, desc.pipelineLayout));
+    }
+}
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -7,10 +7,12 @@
 
 #include "../Platform/Module.h"
 #include "../Core/Helper.h"
+#include "../Core/BCDecompressor.h"
 #include <LLGL/Platform/Platform.h>
 #include <LLGL/Log.h>
 #include "BuildID.h"
 #include "StaticLimits.h"
+#include "TransientResourcePool.h"
 
 #include <LLGL/RenderSystem.h>
 #include <array>
@@ -132,7 +134,7 @@ std::unique_ptr<RenderSystem> RenderSystem::Load(
         throw std::runtime_error("build ID mismatch in render system module");
 
     /* Allocate render system */
-    auto renderSystem   = std::unique_ptr<RenderSystem>(reinterpret_cast<RenderSystem*>(LLGL_RenderSystem_Alloc()));
+    auto renderSystem   = std::unique_ptr<RenderSystem>(reinterpret_cast<RenderSystem*>(LLGL_RenderSystem_Alloc(&renderSystemDesc)));
 
     if (profiler != nullptr || debugger != nullptr)
     {
@@ -210,16 +212,84 @@ void RenderSystem::Unload(std::unique_ptr<RenderSystem>&& renderSystem)
     auto it = g_renderSystemModules.find(renderSystem.get());
     if (it != g_renderSystemModules.end())
     {
-        renderSystem.release();
+        /* Delete render system before its module is unloaded */
+        renderSystem.reset();
         g_renderSystemModules.erase(it);
     }
 }
 
+RenderSystem::RenderSystem()
+{
+}
+
+RenderSystem::~RenderSystem()
+{
+    /* Transient resources have already been deleted with all other objects of the render system implementation */
+}
+
 void RenderSystem::SetConfiguration(const RenderSystemConfiguration& config)
 {
     config_ = config;
 }
 
+/* ----- Transient Resources ----- */
+
+Texture* RenderSystem::AcquireTransientTexture(const TextureDescriptor& desc)
+{
+    return GetTransientResourcePool().AcquireTexture(
+        desc,
+        [&]()
+        {
+            return CreateTexture(desc);
+        }
+    );
+}
+
+RenderTarget* RenderSystem::AcquireTransientRenderTarget(const RenderTargetDescriptor& desc)
+{
+    return GetTransientResourcePool().AcquireRenderTarget(
+        desc,
+        [&]()
+        {
+            return CreateRenderTarget(desc);
+        }
+    );
+}
+
+void RenderSystem::RecycleTransient(Texture& texture)
+{
+    if (!GetTransientResourcePool().Recycle(texture))
+        throw std::invalid_argument("cannot recycle texture that has not been acquired as transient resource");
+}
+
+void RenderSystem::RecycleTransient(RenderTarget& renderTarget)
+{
+    if (!GetTransientResourcePool().Recycle(renderTarget))
+        throw std::invalid_argument("cannot recycle render target that has not been acquired as transient resource");
+}
+
+void RenderSystem::NextTransientFrame(std::uint32_t maxUnusedFrames)
+{
+    if (transientResourcePool_)
+    {
+        std::vector<Texture*> evictedTextures;
+        std::vector<RenderTarget*> evictedRenderTargets;
+        transientResourcePool_->NextFrame(maxUnusedFrames, evictedTextures, evictedRenderTargets);
+        ReleaseTransientResources(evictedTextures, evictedRenderTargets);
+    }
+}
+
+void RenderSystem::PurgeTransientResources()
+{
+    if (transientResourcePool_)
+    {
+        std::vector<Texture*> evictedTextures;
+        std::vector<RenderTarget*> evictedRenderTargets;
+        transientResourcePool_->Clear(evictedTextures, evictedRenderTargets);
+        ReleaseTransientResources(evictedTextures, evictedRenderTargets);
+    }
+}
+
 
 /*
  * ======= Protected: =======
@@ -398,6 +468,77 @@ void RenderSystem::AssertImageDataSize(std::size_t dataSize, std::size_t require
     }
 }
 
+// Returns the extent of the first MIP-map level with all array layers as 2D slices.
+static Extent3D GetTextureSliceExtent(const TextureDescriptor& desc)
+{
+    const auto& extent = desc.extent;
+    switch (desc.type)
+    {
+        case TextureType::Texture1D:        return { extent.width, 1, 1 };
+        case TextureType::Texture1DArray:   return { extent.width, 1, desc.arrayLayers };
+        case TextureType::Texture2DArray:   return { extent.width, extent.height, desc.arrayLayers };
+        case TextureType::TextureCube:      return { extent.width, extent.height, 6 };
+        case TextureType::TextureCubeArray: return { extent.width, extent.height, 6 * desc.arrayLayers };
+        case TextureType::Texture3D:        return extent;
+        default:                            return { extent.width, extent.height, 1 };
+    }
+}
+
+bool RenderSystem::DecompressUnsupportedTexture(
+    const TextureDescriptor&    textureDesc,
+    const SrcImageDescriptor*   imageDesc,
+    TextureDescriptor&          decompressedTextureDesc,
+    SrcImageDescriptor&         decompressedImageDesc,
+    ByteBuffer&                 decompressedImage)
+{
+    /* Only decompress BC formats that are not supported by the hardware */
+    const auto decompressedFormat = GetBCDecompressedFormat(textureDesc.format);
+    if (decompressedFormat == Format::Undefined || Contains(GetRenderingCaps().textureFormats, textureDesc.format))
+        return false;
+
+    decompressedTextureDesc         = textureDesc;
+    decompressedTextureDesc.format  = decompressedFormat;
+
+    if (imageDesc)
+    {
+        /* Decompress all slices of the first MIP-map level */
+        ImageFormat dstFormat   = ImageFormat::RGBA;
+        DataType    dstDataType = DataType::UInt8;
+        FindSuitableImageFormat(decompressedFormat, dstFormat, dstDataType);
+
+        const auto extent = GetTextureSliceExtent(textureDesc);
+        decompressedImage = DecompressImageBuffer(textureDesc.format, *imageDesc, extent, dstFormat, dstDataType, GetConfiguration().threadCount);
+
+        decompressedImageDesc.format    = dstFormat;
+        decompressedImageDesc.dataType  = dstDataType;
+        decompressedImageDesc.data      = decompressedImage.get();
+        decompressedImageDesc.dataSize  = ImageDataSize(dstFormat, dstDataType, extent.width * extent.height * extent.depth);
+    }
+
+    return true;
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+TransientResourcePool& RenderSystem::GetTransientResourcePool()
+{
+    if (!transientResourcePool_)
+        transientResourcePool_ = MakeUnique<TransientResourcePool>();
+    return *transientResourcePool_;
+}
+
+void RenderSystem::ReleaseTransientResources(const std::vector<Texture*>& textures, const std::vector<RenderTarget*>& renderTargets)
+{
+    /* Release render targets first, since they refer to the textures */
+    for (auto renderTarget : renderTargets)
+        Release(*renderTarget);
+    for (auto texture : textures)
+        Release(*texture);
+}
+
 
 } // /namespace LLGL
 
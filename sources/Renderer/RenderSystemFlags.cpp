@@ -95,6 +95,13 @@ LLGL_EXPORT bool ValidateRenderingCaps(
     LLGL_VALIDATE_FEATURE( hasConservativeRasterization, "conservative rasterization" );
     LLGL_VALIDATE_FEATURE( hasStreamOutputs,             "stream outputs"             );
     LLGL_VALIDATE_FEATURE( hasLogicOp,                   "logic fragment operations"  );
+    LLGL_VALIDATE_FEATURE( hasSparseBuffers,             "sparse buffers"             );
+    LLGL_VALIDATE_FEATURE( hasSparseTextures,            "sparse textures"            );
+    LLGL_VALIDATE_FEATURE( hasTextureViews,              "texture views"              );
+    LLGL_VALIDATE_FEATURE( hasTextureViewSwizzle,        "texture view swizzle"       );
+    LLGL_VALIDATE_FEATURE( hasRenderConditionBuffers,    "render condition buffers"   );
+    LLGL_VALIDATE_FEATURE( hasQueryResultBuffers,        "query result buffers"       );
+    LLGL_VALIDATE_FEATURE( hasAsyncReadbacks,            "asynchronous readbacks"     );
 
     #undef LLGL_VALIDATE_FEATURE
 
@@ -159,6 +166,7 @@ LLGL_EXPORT bool ValidateRenderingCaps(
     LLGL_VALIDATE_LIMIT( maxViewportSize[1],                "viewport height"                           );
     LLGL_VALIDATE_LIMIT( maxBufferSize,                     "buffer size"                               );
     LLGL_VALIDATE_LIMIT( maxConstantBufferSize,             "constant buffer size"                      );
+    LLGL_VALIDATE_LIMIT( maxInlineConstantsSize,            "inline constants size"                     );
 
     #undef LLGL_VALIDATE_LIMIT
     #undef LLGL_CONTINUE_VALIDATION_IF
@@ -8,12 +8,20 @@
 #include <LLGL/RenderingDebugger.h>
 #include <LLGL/Strings.h>
 #include <LLGL/Log.h>
+#include <chrono>
 
 
 namespace LLGL
 {
 
 
+// Returns the current time point (in nanoseconds) to measure the validation time.
+static std::uint64_t GetValidationTimePoint()
+{
+    auto now = std::chrono::steady_clock::now().time_since_epoch();
+    return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(now).count());
+}
+
 RenderingDebugger::~RenderingDebugger()
 {
 }
@@ -25,14 +33,15 @@ void RenderingDebugger::SetSource(const char* source)
 
 void RenderingDebugger::PostError(const ErrorType type, const std::string& message)
 {
+    ++stats_.numErrors;
+
     auto it = errors_.find(message);
     if (it != errors_.end())
     {
+        /* Aggregate repeated messages, even if they have been blocked */
+        it->second.IncOccurrence();
         if (!it->second.IsBlocked())
-        {
-            it->second.IncOccurrence();
             OnError(type, it->second);
-        }
     }
     else
     {
@@ -43,14 +52,15 @@ void RenderingDebugger::PostError(const ErrorType type, const std::string& messa
 
 void RenderingDebugger::PostWarning(const WarningType type, const std::string& message)
 {
+    ++stats_.numWarnings;
+
     auto it = warnings_.find(message);
     if (it != warnings_.end())
     {
+        /* Aggregate repeated messages, even if they have been blocked */
+        it->second.IncOccurrence();
         if (!it->second.IsBlocked())
-        {
-            it->second.IncOccurrence();
             OnWarning(type, it->second);
-        }
     }
     else
     {
@@ -59,6 +69,55 @@ void RenderingDebugger::PostWarning(const WarningType type, const std::string& m
     }
 }
 
+void RenderingDebugger::SetValidationSampling(const ValidationSamplingDescriptor& samplingDesc)
+{
+    samplingDesc_ = samplingDesc;
+}
+
+void RenderingDebugger::NextFrame()
+{
+    /* Determine whether the new frame is sampled for full validation */
+    ++stats_.numFrames;
+    frameValidated_ = (samplingDesc_.frameInterval < 2 || stats_.numFrames % samplingDesc_.frameInterval == 0);
+
+    if (frameValidated_)
+        ++stats_.numValidatedFrames;
+
+    /* Reset per-frame sampling state */
+    commandCounter_         = 0;
+    frameValidationTime_    = 0;
+}
+
+bool RenderingDebugger::BeginValidation()
+{
+    ++stats_.numCommands;
+
+    if (!frameValidated_)
+        return false;
+
+    /* Only validate every N-th command */
+    if (samplingDesc_.commandInterval > 1 && (commandCounter_++ % samplingDesc_.commandInterval) != 0)
+        return false;
+
+    /* Only validate while the time budget of this frame is not exceeded */
+    if (samplingDesc_.frameTimeBudget > 0)
+    {
+        if (frameValidationTime_ >= samplingDesc_.frameTimeBudget)
+            return false;
+        validationStartTime_ = GetValidationTimePoint();
+    }
+
+    ++stats_.numValidatedCommands;
+
+    return true;
+}
+
+void RenderingDebugger::EndValidation()
+{
+    if (samplingDesc_.frameTimeBudget > 0)
+        frameValidationTime_ += (GetValidationTimePoint() - validationStartTime_);
+}
+
 
 /*
  * ====== Protected: =======
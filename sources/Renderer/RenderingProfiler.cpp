@@ -17,6 +17,9 @@ void RenderingProfiler::ResetCounters()
     writeBuffer.Reset();
     mapBuffer.Reset();
 
+    samplerCacheHits.Reset();
+    samplerCacheMisses.Reset();
+
     setVertexBuffer.Reset();
     setIndexBuffer.Reset();
     setConstantBuffer.Reset();
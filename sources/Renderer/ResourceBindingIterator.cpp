@@ -22,11 +22,12 @@ ResourceBindingIterator::ResourceBindingIterator(
 {
 }
 
-void ResourceBindingIterator::Reset(const ResourceType typesOfInterest, long stagesOfInterest)
+void ResourceBindingIterator::Reset(const ResourceType typesOfInterest, long stagesOfInterest, bool dynamicOffsets)
 {
     iterator_           = 0;
     typeOfInterest_     = typesOfInterest;
     stagesOfInterest_   = stagesOfInterest;
+    dynamicOffsets_     = dynamicOffsets;
 }
 
 // Returns the specified resource type as string
@@ -54,18 +55,22 @@ static void ErrNullPointerResource(const ResourceType t)
     );
 }
 
-Resource* ResourceBindingIterator::Next(BindingDescriptor& bindingDesc)
+Resource* ResourceBindingIterator::Next(BindingDescriptor& bindingDesc, ResourceViewDescriptor* rsvDesc)
 {
     while (iterator_ < count_)
     {
         /* Search for resource type of interest */
-        auto resourceType = bindings_[iterator_].type;
-        if (resourceType == typeOfInterest_ && (bindings_[iterator_].stageFlags & stagesOfInterest_) != 0)
+        const auto& binding = bindings_[iterator_];
+        const bool dynamicOffset = ((binding.flags & BindingFlags::DynamicOffset) != 0);
+        auto resourceType = binding.type;
+        if (resourceType == typeOfInterest_ && (binding.stageFlags & stagesOfInterest_) != 0 && dynamicOffset == dynamicOffsets_)
         {
             /* Check for null pointer exception */
             if (auto resource = resourceViews_[iterator_].resource)
             {
-                bindingDesc = bindings_[iterator_];
+                bindingDesc = binding;
+                if (rsvDesc != nullptr)
+                    *rsvDesc = resourceViews_[iterator_];
                 ++iterator_;
                 return resource;
             }
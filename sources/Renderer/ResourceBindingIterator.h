@@ -30,11 +30,20 @@ class LLGL_EXPORT ResourceBindingIterator
             const std::vector<BindingDescriptor>&       bindings
         );
 
-        // Resets the iteration process for the specified type of interest.
-        void Reset(const ResourceType typesOfInterest, long stagesOfInterest = StageFlags::AllStages);
+        /*
+        Resets the iteration process for the specified type of interest.
+        Bindings with the BindingFlags::DynamicOffset flag are only iterated if 'dynamicOffsets' is true, and all other bindings only if it is false.
+        */
+        void Reset(const ResourceType typesOfInterest, long stagesOfInterest = StageFlags::AllStages, bool dynamicOffsets = false);
 
         // Returns the next resource of the current type of interest, or null if there are no more resources of that type.
-        Resource* Next(BindingDescriptor& bindingDesc);
+        Resource* Next(BindingDescriptor& bindingDesc, ResourceViewDescriptor* rsvDesc = nullptr);
+
+        // Returns the index of the resource view that was returned by the last call to 'Next'.
+        inline std::size_t GetCurrentIndex() const
+        {
+            return (iterator_ - 1);
+        }
 
         // Returns the number of all resource.
         inline std::size_t GetCount() const
@@ -50,6 +59,7 @@ class LLGL_EXPORT ResourceBindingIterator
         std::size_t                                 count_              = 0;
         ResourceType                                typeOfInterest_     = ResourceType::Undefined;
         long                                        stagesOfInterest_   = StageFlags::AllStages;
+        bool                                        dynamicOffsets_     = false;
 
 };
 
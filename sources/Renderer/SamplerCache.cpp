@@ -0,0 +1,112 @@
+/*
+ * SamplerCache.cpp
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "SamplerCache.h"
+#include "../Core/Helper.h"
+
+
+namespace LLGL
+{
+
+
+/* ----- Sampler cache ----- */
+
+bool SamplerCache::Release(const Sampler& sampler)
+{
+    auto keyIt = keys_.find(&sampler);
+    if (keyIt != keys_.end())
+    {
+        auto entryIt = entries_.find(keyIt->second);
+        if (entryIt != entries_.end())
+        {
+            /* Decrement reference counter and remove sampler from cache if it is no longer used */
+            if (--(entryIt->second.refCount) > 0)
+                return false;
+            entries_.erase(entryIt);
+        }
+        keys_.erase(keyIt);
+    }
+    return true;
+}
+
+SamplerCacheStatistics SamplerCache::GetStatistics() const
+{
+    SamplerCacheStatistics stats;
+    {
+        stats.numHits       = numHits_;
+        stats.numMisses     = numMisses_;
+        stats.numSamplers   = static_cast<std::uint32_t>(entries_.size());
+    }
+    return stats;
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+std::string SamplerCache::MakeKey(const SamplerDescriptor& desc)
+{
+    std::string key;
+
+    AppendKey(key, desc.addressModeU);
+    AppendKey(key, desc.addressModeV);
+    AppendKey(key, desc.addressModeW);
+    AppendKey(key, desc.minFilter);
+    AppendKey(key, desc.magFilter);
+    AppendKey(key, desc.mipMapFilter);
+    AppendKey(key, desc.mipMapping);
+    AppendKey(key, desc.mipMapLODBias);
+    AppendKey(key, desc.minLOD);
+    AppendKey(key, desc.maxLOD);
+    AppendKey(key, desc.maxAnisotropy);
+    AppendKey(key, desc.compareEnabled);
+    AppendKey(key, desc.compareOp);
+    AppendKey(key, desc.borderColor.r);
+    AppendKey(key, desc.borderColor.g);
+    AppendKey(key, desc.borderColor.b);
+    AppendKey(key, desc.borderColor.a);
+
+    return key;
+}
+
+Sampler* SamplerCache::Find(const std::string& key)
+{
+    auto it = entries_.find(key);
+    if (it != entries_.end())
+    {
+        /* Share cached sampler and increment its reference counter */
+        ++numHits_;
+        ++(it->second.refCount);
+        return it->second.sampler;
+    }
+    return nullptr;
+}
+
+Sampler* SamplerCache::Insert(const std::string& key, Sampler* sampler)
+{
+    ++numMisses_;
+
+    if (sampler != nullptr)
+    {
+        auto& entry = entries_[key];
+        {
+            entry.sampler   = sampler;
+            entry.refCount  = 1;
+        }
+        keys_[sampler] = key;
+    }
+
+    return sampler;
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
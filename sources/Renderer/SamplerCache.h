@@ -0,0 +1,93 @@
+/*
+ * SamplerCache.h
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_SAMPLER_CACHE_H
+#define LLGL_SAMPLER_CACHE_H
+
+
+#include <LLGL/Export.h>
+#include <LLGL/SamplerFlags.h>
+#include <LLGL/RenderSystemFlags.h>
+#include <unordered_map>
+#include <string>
+
+
+namespace LLGL
+{
+
+
+class Sampler;
+
+/*
+Cache for reference counted sampler objects, which are identified by the contents of their descriptors.
+This is used by all render systems to share sampler objects that are created with equal descriptors.
+*/
+class LLGL_EXPORT SamplerCache
+{
+
+    public:
+
+        // Returns the shared sampler for the descriptor, or creates a new one with the specified function on a cache miss or if the descriptor is not shared.
+        template <typename TCreateFunc>
+        Sampler* GetOrCreate(const SamplerDescriptor& desc, const TCreateFunc& createFunc);
+
+        // Decrements the reference counter of the specified sampler, and returns true if the sampler is no longer used and must be deleted.
+        bool Release(const Sampler& sampler);
+
+        // Returns the cache statistics.
+        SamplerCacheStatistics GetStatistics() const;
+
+    private:
+
+        struct Entry
+        {
+            Sampler*        sampler     = nullptr;
+            std::uint32_t   refCount    = 0;
+        };
+
+        static std::string MakeKey(const SamplerDescriptor& desc);
+
+        Sampler* Find(const std::string& key);
+        Sampler* Insert(const std::string& key, Sampler* sampler);
+
+        std::unordered_map<std::string, Entry>          entries_;
+        std::unordered_map<const Sampler*, std::string> keys_;
+
+        std::uint32_t                                   numHits_    = 0;
+        std::uint32_t                                   numMisses_  = 0;
+
+};
+
+
+/* ----- Templates ----- */
+
+template <typename TCreateFunc>
+Sampler* SamplerCache::GetOrCreate(const SamplerDescriptor& desc, const TCreateFunc& createFunc)
+{
+    /* Bypass cache for samplers that must not be shared; Release still returns true for them, since they have no cache entry */
+    if (!desc.shared)
+    {
+        ++numMisses_;
+        return createFunc();
+    }
+
+    auto key = MakeKey(desc);
+    if (auto sampler = Find(key))
+        return sampler;
+    else
+        return Insert(key, createFunc());
+}
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
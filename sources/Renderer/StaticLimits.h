@@ -18,6 +18,9 @@
 // Maximum number of scissors and viewports.
 #define LLGL_MAX_NUM_VIEWPORTS_AND_SCISSORS (16u)
 
+// Maximum size (in bytes) of inline constants for renderers that emulate them with constant buffers.
+#define LLGL_MAX_INLINE_CONSTANTS_SIZE      (256u)
+
 
 #endif
 
@@ -22,6 +22,11 @@ ResourceType Texture::QueryResourceType() const
     return ResourceType::Texture;
 }
 
+Extent3D Texture::QuerySparseTileExtent() const
+{
+    return { 0, 0, 0 };
+}
+
 
 } // /namespace LLGL
 
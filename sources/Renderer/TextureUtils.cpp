@@ -0,0 +1,103 @@
+/*
+ * TextureUtils.cpp
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "TextureUtils.h"
+
+
+namespace LLGL
+{
+
+
+// Moves the array layer component out of the texel offset, and returns the base array layer.
+static std::uint32_t SplitArrayLayerOffset(const TextureType type, Offset3D& offset)
+{
+    std::uint32_t baseArrayLayer = 0;
+
+    switch (type)
+    {
+        case TextureType::Texture1DArray:
+            baseArrayLayer  = static_cast<std::uint32_t>(offset.y);
+            offset.y        = 0;
+            break;
+
+        case TextureType::Texture2DArray:
+        case TextureType::TextureCube:
+        case TextureType::TextureCubeArray:
+        case TextureType::Texture2DMSArray:
+            baseArrayLayer  = static_cast<std::uint32_t>(offset.z);
+            offset.z        = 0;
+            break;
+
+        default:
+            break;
+    }
+
+    return baseArrayLayer;
+}
+
+// Moves the array layer component out of the texel extent, and returns the number of array layers.
+static std::uint32_t SplitArrayLayerExtent(const TextureType type, Extent3D& extent)
+{
+    std::uint32_t numArrayLayers = 1;
+
+    switch (type)
+    {
+        case TextureType::Texture1DArray:
+            numArrayLayers  = extent.height;
+            extent.height   = 1;
+            break;
+
+        case TextureType::Texture2DArray:
+        case TextureType::TextureCube:
+        case TextureType::TextureCubeArray:
+        case TextureType::Texture2DMSArray:
+            numArrayLayers  = extent.depth;
+            extent.depth    = 1;
+            break;
+
+        default:
+            break;
+    }
+
+    return numArrayLayers;
+}
+
+LLGL_EXPORT TextureSubresourceRegion MakeTextureSubresourceRegion(const TextureType type, const TextureRegion& region)
+{
+    TextureSubresourceRegion subresourceRegion;
+    {
+        subresourceRegion.mipLevel          = region.mipLevel;
+        subresourceRegion.offset            = region.offset;
+        subresourceRegion.extent            = region.extent;
+        subresourceRegion.baseArrayLayer    = SplitArrayLayerOffset(type, subresourceRegion.offset);
+        subresourceRegion.numArrayLayers    = SplitArrayLayerExtent(type, subresourceRegion.extent);
+    }
+    return subresourceRegion;
+}
+
+LLGL_EXPORT TextureSubresourceRegion MakeTextureSubresourceRegion(
+    const TextureType               type,
+    const TextureLocation&          location,
+    const TextureSubresourceRegion& extentRegion)
+{
+    TextureSubresourceRegion subresourceRegion;
+    {
+        subresourceRegion.mipLevel          = location.mipLevel;
+        subresourceRegion.offset            = location.offset;
+        subresourceRegion.extent            = extentRegion.extent;
+        subresourceRegion.baseArrayLayer    = SplitArrayLayerOffset(type, subresourceRegion.offset);
+        subresourceRegion.numArrayLayers    = extentRegion.numArrayLayers;
+    }
+    return subresourceRegion;
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
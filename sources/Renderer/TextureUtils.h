@@ -0,0 +1,52 @@
+/*
+ * TextureUtils.h
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_TEXTURE_UTILS_H
+#define LLGL_TEXTURE_UTILS_H
+
+
+#include <LLGL/Export.h>
+#include <LLGL/TextureFlags.h>
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+// Texture region where the array layers are separated from the texel offset and extent.
+struct TextureSubresourceRegion
+{
+    std::uint32_t   mipLevel        = 0;
+    std::uint32_t   baseArrayLayer  = 0;
+    std::uint32_t   numArrayLayers  = 1;
+    Offset3D        offset          = { 0, 0, 0 };
+    Extent3D        extent          = { 1, 1, 1 };
+};
+
+
+/* ----- Functions ----- */
+
+// Returns the subresource region of the specified texture region for a texture of the specified type.
+LLGL_EXPORT TextureSubresourceRegion MakeTextureSubresourceRegion(const TextureType type, const TextureRegion& region);
+
+// Returns the subresource region at the specified texture location, with the texel extent and number of array layers of another subresource region.
+LLGL_EXPORT TextureSubresourceRegion MakeTextureSubresourceRegion(
+    const TextureType               type,
+    const TextureLocation&          location,
+    const TextureSubresourceRegion& extentRegion
+);
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -0,0 +1,187 @@
+/*
+ * TransientResourcePool.cpp
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "TransientResourcePool.h"
+#include "../Core/Helper.h"
+#include <algorithm>
+#include <set>
+
+
+namespace LLGL
+{
+
+
+/* ----- Transient resource pool ----- */
+
+bool TransientResourcePool::Recycle(const Texture& texture)
+{
+    return Recycle(textures_, &texture);
+}
+
+bool TransientResourcePool::Recycle(const RenderTarget& renderTarget)
+{
+    return Recycle(renderTargets_, &renderTarget);
+}
+
+void TransientResourcePool::NextFrame(
+    std::uint32_t maxUnusedFrames, std::vector<Texture*>& evictedTextures, std::vector<RenderTarget*>& evictedRenderTargets)
+{
+    /* Put all textures back into the free list and remove those that have not been used for too long */
+    std::set<const Texture*> evictedTextureSet;
+
+    for (auto it = textures_.entries.begin(); it != textures_.entries.end();)
+    {
+        auto texture    = const_cast<Texture*>(it->first);
+        auto& entry     = it->second;
+
+        if (entry.inUse)
+        {
+            entry.inUse = false;
+            textures_.freeList.emplace(entry.key, texture);
+        }
+
+        if (frame_ - entry.lastUsedFrame >= maxUnusedFrames)
+        {
+            RemoveFromFreeList(textures_, entry.key, texture);
+            evictedTextures.push_back(texture);
+            evictedTextureSet.insert(texture);
+            it = textures_.entries.erase(it);
+        }
+        else
+            ++it;
+    }
+
+    /* Put all render targets back into the free list and remove those that have not been used for too long or refer to a removed texture */
+    for (auto it = renderTargets_.entries.begin(); it != renderTargets_.entries.end();)
+    {
+        auto renderTarget   = const_cast<RenderTarget*>(it->first);
+        auto& entry         = it->second;
+
+        if (entry.inUse)
+        {
+            entry.inUse = false;
+            renderTargets_.freeList.emplace(entry.key, renderTarget);
+        }
+
+        const bool isAttachmentEvicted = std::any_of(
+            entry.attachments.begin(),
+            entry.attachments.end(),
+            [&evictedTextureSet](const Texture* texture)
+            {
+                return (evictedTextureSet.find(texture) != evictedTextureSet.end());
+            }
+        );
+
+        if (frame_ - entry.lastUsedFrame >= maxUnusedFrames || isAttachmentEvicted)
+        {
+            RemoveFromFreeList(renderTargets_, entry.key, renderTarget);
+            evictedRenderTargets.push_back(renderTarget);
+            it = renderTargets_.entries.erase(it);
+        }
+        else
+            ++it;
+    }
+
+    ++frame_;
+}
+
+void TransientResourcePool::Clear(std::vector<Texture*>& evictedTextures, std::vector<RenderTarget*>& evictedRenderTargets)
+{
+    for (const auto& entry : textures_.entries)
+        evictedTextures.push_back(const_cast<Texture*>(entry.first));
+    for (const auto& entry : renderTargets_.entries)
+        evictedRenderTargets.push_back(const_cast<RenderTarget*>(entry.first));
+
+    textures_.freeList.clear();
+    textures_.entries.clear();
+    renderTargets_.freeList.clear();
+    renderTargets_.entries.clear();
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+std::string TransientResourcePool::MakeKey(const TextureDescriptor& desc)
+{
+    std::string key;
+
+    AppendKey(key, desc.type);
+    AppendKey(key, desc.format);
+    AppendKey(key, desc.flags);
+    AppendKey(key, desc.extent.width);
+    AppendKey(key, desc.extent.height);
+    AppendKey(key, desc.extent.depth);
+    AppendKey(key, desc.arrayLayers);
+    AppendKey(key, desc.mipLevels);
+    AppendKey(key, desc.samples);
+
+    return key;
+}
+
+std::string TransientResourcePool::MakeKey(const RenderTargetDescriptor& desc)
+{
+    std::string key;
+
+    AppendKey(key, desc.renderPass);
+    AppendKey(key, desc.resolution.width);
+    AppendKey(key, desc.resolution.height);
+    AppendKey(key, desc.multiSampling.enabled);
+    AppendKey(key, desc.multiSampling.samples);
+    AppendKey(key, desc.multiSampling.sampleMask);
+    AppendKey(key, desc.customMultiSampling);
+
+    AppendKey(key, desc.attachments.size());
+    for (const auto& attachment : desc.attachments)
+    {
+        AppendKey(key, attachment.type);
+        AppendKey(key, attachment.texture);
+        AppendKey(key, attachment.mipLevel);
+        AppendKey(key, attachment.arrayLayer);
+    }
+
+    return key;
+}
+
+template <typename T>
+bool TransientResourcePool::Recycle(ResourceTable<T>& table, const T* resource)
+{
+    auto it = table.entries.find(resource);
+    if (it != table.entries.end())
+    {
+        auto& entry = it->second;
+        if (entry.inUse)
+        {
+            entry.inUse = false;
+            table.freeList.emplace(entry.key, const_cast<T*>(resource));
+        }
+        return true;
+    }
+    return false;
+}
+
+template <typename T>
+void TransientResourcePool::RemoveFromFreeList(ResourceTable<T>& table, const std::string& key, const T* resource)
+{
+    auto range = table.freeList.equal_range(key);
+    for (auto it = range.first; it != range.second; ++it)
+    {
+        if (it->second == resource)
+        {
+            table.freeList.erase(it);
+            return;
+        }
+    }
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,177 @@
+/*
+ * TransientResourcePool.h
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_TRANSIENT_RESOURCE_POOL_H
+#define LLGL_TRANSIENT_RESOURCE_POOL_H
+
+
+#include <LLGL/TextureFlags.h>
+#include <LLGL/RenderTargetFlags.h>
+#include <unordered_map>
+#include <vector>
+#include <string>
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+class Texture;
+class RenderTarget;
+
+/*
+Pool of textures and render targets that are only used for the duration of a frame.
+Resources are recycled across frames with a hashed free list, which is keyed by the contents of their descriptors.
+*/
+class TransientResourcePool
+{
+
+    public:
+
+        // Returns an unused texture for the descriptor from the free list, or creates a new one with the specified function.
+        template <typename TCreateFunc>
+        Texture* AcquireTexture(const TextureDescriptor& desc, const TCreateFunc& createFunc);
+
+        // Returns an unused render target for the descriptor from the free list, or creates a new one with the specified function.
+        template <typename TCreateFunc>
+        RenderTarget* AcquireRenderTarget(const RenderTargetDescriptor& desc, const TCreateFunc& createFunc);
+
+        // Puts the specified resource back into the free list before the end of the frame. Returns false if the resource is not a transient resource.
+        bool Recycle(const Texture& texture);
+        bool Recycle(const RenderTarget& renderTarget);
+
+        /*
+        Puts all resources back into the free list and starts a new frame.
+        All resources that have not been used for more than the specified number of frames are removed from the pool and must be released by the caller.
+        Render targets that refer to a removed texture are removed as well.
+        */
+        void NextFrame(std::uint32_t maxUnusedFrames, std::vector<Texture*>& evictedTextures, std::vector<RenderTarget*>& evictedRenderTargets);
+
+        // Removes all resources from the pool, which must be released by the caller.
+        void Clear(std::vector<Texture*>& evictedTextures, std::vector<RenderTarget*>& evictedRenderTargets);
+
+    private:
+
+        struct Entry
+        {
+            std::string                 key;
+            std::uint64_t               lastUsedFrame   = 0;
+            bool                        inUse           = false;
+            std::vector<const Texture*> attachments;            // Only used for render targets
+        };
+
+        template <typename T>
+        struct ResourceTable
+        {
+            std::unordered_multimap<std::string, T*>    freeList;
+            std::unordered_map<const T*, Entry>         entries;
+        };
+
+        static std::string MakeKey(const TextureDescriptor& desc);
+        static std::string MakeKey(const RenderTargetDescriptor& desc);
+
+        template <typename T>
+        T* FindFree(ResourceTable<T>& table, const std::string& key);
+
+        template <typename T>
+        Entry& Insert(ResourceTable<T>& table, const std::string& key, T* resource);
+
+        template <typename T>
+        bool Recycle(ResourceTable<T>& table, const T* resource);
+
+        template <typename T>
+        void RemoveFromFreeList(ResourceTable<T>& table, const std::string& key, const T* resource);
+
+        ResourceTable<Texture>      textures_;
+        ResourceTable<RenderTarget> renderTargets_;
+
+        std::uint64_t               frame_          = 0;
+
+};
+
+
+/* ----- Templates ----- */
+
+template <typename T>
+T* TransientResourcePool::FindFree(ResourceTable<T>& table, const std::string& key)
+{
+    auto it = table.freeList.find(key);
+    if (it != table.freeList.end())
+    {
+        /* Take resource from free list and mark it as used for the current frame */
+        auto resource = it->second;
+        table.freeList.erase(it);
+
+        auto& entry = table.entries[resource];
+        {
+            entry.lastUsedFrame = frame_;
+            entry.inUse         = true;
+        }
+
+        return resource;
+    }
+    return nullptr;
+}
+
+template <typename T>
+TransientResourcePool::Entry& TransientResourcePool::Insert(ResourceTable<T>& table, const std::string& key, T* resource)
+{
+    auto& entry = table.entries[resource];
+    {
+        entry.key           = key;
+        entry.lastUsedFrame = frame_;
+        entry.inUse         = true;
+    }
+    return entry;
+}
+
+template <typename TCreateFunc>
+Texture* TransientResourcePool::AcquireTexture(const TextureDescriptor& desc, const TCreateFunc& createFunc)
+{
+    auto key = MakeKey(desc);
+    if (auto texture = FindFree(textures_, key))
+        return texture;
+    else
+    {
+        Texture* newTexture = createFunc();
+        Insert(textures_, key, newTexture);
+        return newTexture;
+    }
+}
+
+template <typename TCreateFunc>
+RenderTarget* TransientResourcePool::AcquireRenderTarget(const RenderTargetDescriptor& desc, const TCreateFunc& createFunc)
+{
+    auto key = MakeKey(desc);
+    if (auto renderTarget = FindFree(renderTargets_, key))
+        return renderTarget;
+    else
+    {
+        RenderTarget* newRenderTarget = createFunc();
+        auto& entry = Insert(renderTargets_, key, newRenderTarget);
+
+        /* Store attached textures to remove this render target when one of its textures is removed */
+        for (const auto& attachment : desc.attachments)
+        {
+            if (attachment.texture != nullptr)
+                entry.attachments.push_back(attachment.texture);
+        }
+
+        return newRenderTarget;
+    }
+}
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
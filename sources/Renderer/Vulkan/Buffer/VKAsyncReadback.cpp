@@ -0,0 +1,90 @@
+/*
+ * VKAsyncReadback.cpp
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "VKAsyncReadback.h"
+#include "../VKDevice.h"
+#include <limits>
+
+
+namespace LLGL
+{
+
+
+VKAsyncReadback::VKAsyncReadback(VKDevice& device, VKDeviceBuffer&& stagingBuffer, VkDeviceSize size) :
+    device_         { device                   },
+    stagingBuffer_  { std::move(stagingBuffer) },
+    size_           { size                     },
+    fence_          { device.GetVkDevice()     }
+{
+}
+
+VKAsyncReadback::~VKAsyncReadback()
+{
+    /* Command buffer must not be released while it is still in use */
+    if (cmdBuffer_ != VK_NULL_HANDLE)
+    {
+        Wait(std::numeric_limits<std::uint64_t>::max());
+        device_.FreeCommandBuffer(cmdBuffer_);
+    }
+}
+
+bool VKAsyncReadback::Poll()
+{
+    /* Check if fence has been signaled without waiting */
+    if (!signaled_ && cmdBuffer_ != VK_NULL_HANDLE)
+        signaled_ = (vkGetFenceStatus(device_.GetVkDevice(), fence_.GetVkFence()) == VK_SUCCESS);
+    return signaled_;
+}
+
+bool VKAsyncReadback::Wait(std::uint64_t timeout)
+{
+    if (!signaled_ && cmdBuffer_ != VK_NULL_HANDLE)
+        signaled_ = fence_.Wait(device_.GetVkDevice(), timeout);
+    return signaled_;
+}
+
+const void* VKAsyncReadback::Map()
+{
+    /* Wait until the copy operation has been completed, then map staging buffer (memory is host-coherent) */
+    Wait(std::numeric_limits<std::uint64_t>::max());
+    return stagingBuffer_.Map(device_.GetVkDevice());
+}
+
+void VKAsyncReadback::Unmap()
+{
+    stagingBuffer_.Unmap(device_.GetVkDevice());
+}
+
+std::uint64_t VKAsyncReadback::GetSize() const
+{
+    return static_cast<std::uint64_t>(size_);
+}
+
+void VKAsyncReadback::Submit(VkCommandBuffer cmdBuffer)
+{
+    /* Make transfer writes into the staging buffer visible to host reads */
+    VkMemoryBarrier barrier;
+    {
+        barrier.sType           = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+        barrier.pNext           = nullptr;
+        barrier.srcAccessMask   = VK_ACCESS_TRANSFER_WRITE_BIT;
+        barrier.dstAccessMask   = VK_ACCESS_HOST_READ_BIT;
+    }
+    vkCmdPipelineBarrier(cmdBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_HOST_BIT, 0, 1, &barrier, 0, nullptr, 0, nullptr);
+
+    /* Submit command buffer without waiting for its completion */
+    cmdBuffer_  = cmdBuffer;
+    signaled_   = false;
+    device_.SubmitCommandBuffer(cmdBuffer, fence_.GetVkFence());
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
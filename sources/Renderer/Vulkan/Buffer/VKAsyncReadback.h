@@ -0,0 +1,68 @@
+/*
+ * VKAsyncReadback.h
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_VK_ASYNC_READBACK_H
+#define LLGL_VK_ASYNC_READBACK_H
+
+
+#include <LLGL/AsyncReadback.h>
+#include "VKDeviceBuffer.h"
+#include "../RenderState/VKFence.h"
+
+
+namespace LLGL
+{
+
+
+class VKDevice;
+
+// Asynchronous readback with a host-visible staging buffer, which is synchronized with a Vulkan fence.
+class VKAsyncReadback final : public AsyncReadback
+{
+
+    public:
+
+        VKAsyncReadback(VKDevice& device, VKDeviceBuffer&& stagingBuffer, VkDeviceSize size);
+        ~VKAsyncReadback();
+
+        bool Poll() override;
+        bool Wait(std::uint64_t timeout) override;
+
+        const void* Map() override;
+        void Unmap() override;
+
+        std::uint64_t GetSize() const override;
+
+        // Submits the specified command buffer, which copies the readback data into the staging buffer. This takes the ownership of the command buffer.
+        void Submit(VkCommandBuffer cmdBuffer);
+
+        // Returns the staging buffer the readback data is copied into.
+        inline VKDeviceBuffer& GetDeviceBuffer()
+        {
+            return stagingBuffer_;
+        }
+
+    private:
+
+        VKDevice&       device_;
+        VKDeviceBuffer  stagingBuffer_;
+        VkDeviceSize    size_           = 0;
+        VKFence         fence_;
+        VkCommandBuffer cmdBuffer_      = VK_NULL_HANDLE;
+        bool            signaled_       = false;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
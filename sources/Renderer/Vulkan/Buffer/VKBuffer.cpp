@@ -15,10 +15,12 @@ namespace LLGL
 
 
 VKBuffer::VKBuffer(const BufferType type, const VKPtr<VkDevice>& device, const VkBufferCreateInfo& createInfo) :
-    Buffer            { type            },
-    bufferObj_        { device          },
-    bufferObjStaging_ { device          },
-    size_             { createInfo.size }
+    Buffer            { type                                                                },
+    bufferObj_        { device                                                              },
+    bufferObjStaging_ { device                                                              },
+    size_             { createInfo.size                                                     },
+    usage_            { createInfo.usage                                                    },
+    sparse_           { ((createInfo.flags & VK_BUFFER_CREATE_SPARSE_BINDING_BIT) != 0)     }
 {
     bufferObj_.CreateVkBuffer(device, createInfo);
 }
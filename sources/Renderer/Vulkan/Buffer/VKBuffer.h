@@ -12,6 +12,7 @@
 #include <LLGL/Buffer.h>
 #include "VKDeviceBuffer.h"
 #include "../Memory/VKDeviceMemory.h"
+#include "../Memory/VKSparseResidency.h"
 
 
 namespace LLGL
@@ -67,13 +68,35 @@ class VKBuffer : public Buffer
             return mappingCPUAccess_;
         }
 
+        // Returns the usage flags this buffer was created with.
+        inline VkBufferUsageFlags GetUsageFlags() const
+        {
+            return usage_;
+        }
+
+        // Returns true if this buffer was created with sparse binding (see BufferFlags::Sparse).
+        inline bool IsSparse() const
+        {
+            return sparse_;
+        }
+
+        // Returns the committed pages of this sparse buffer.
+        inline VKSparseResidency& GetSparseResidency()
+        {
+            return sparseResidency_;
+        }
+
     private:
 
-        VKDeviceBuffer  bufferObj_;
-        VKDeviceBuffer  bufferObjStaging_;
+        VKDeviceBuffer      bufferObj_;
+        VKDeviceBuffer      bufferObjStaging_;
+
+        VkDeviceSize        size_               = 0;
+        VkBufferUsageFlags  usage_              = 0;
+        CPUAccess           mappingCPUAccess_   = CPUAccess::ReadOnly;
 
-        VkDeviceSize    size_               = 0;
-        CPUAccess       mappingCPUAccess_   = CPUAccess::ReadOnly;
+        bool                sparse_             = false;
+        VKSparseResidency   sparseResidency_;
 
 };
 
@@ -34,6 +34,22 @@ bool LoadVKProc(VkInstance instance, T& procAddr, const char* procName)
     return true;
 }
 
+template <typename T>
+bool LoadVKDeviceProc(VkDevice device, T& procAddr, const char* procName)
+{
+    /* Load Vulkan device procedure address */
+    procAddr = reinterpret_cast<T>(vkGetDeviceProcAddr(device, procName));
+
+    /* Check for errors */
+    if (!procAddr)
+    {
+        Log::StdErr() << "failed to load Vulkan device procedure: " << procName << std::endl;
+        return false;
+    }
+
+    return true;
+}
+
 /* --- Hardware buffer extensions --- */
 
 #define LOAD_VKPROC(NAME)                   \
@@ -50,15 +66,42 @@ static bool Load_VK_KHR_win32_surface(VkInstance instance)
 
 #endif // /LLGL_OS_WIN32
 
+#ifdef VK_EXT_headless_surface
+
+static bool Load_VK_EXT_headless_surface(VkInstance instance)
+{
+    LOAD_VKPROC( vkCreateHeadlessSurfaceEXT );
+    return true;
+}
+
+#endif // /VK_EXT_headless_surface
+
 #undef LOAD_VKPROC
 
+#define LOAD_VKDEVICEPROC(NAME)                 \
+    if (!LoadVKDeviceProc(device, NAME, #NAME)) \
+        return false
+
+#ifdef VK_EXT_conditional_rendering
+
+static bool Load_VK_EXT_conditional_rendering(VkDevice device)
+{
+    LOAD_VKDEVICEPROC( vkCmdBeginConditionalRenderingEXT );
+    LOAD_VKDEVICEPROC( vkCmdEndConditionalRenderingEXT   );
+    return true;
+}
+
+#endif // /VK_EXT_conditional_rendering
+
+#undef LOAD_VKDEVICEPROC
+
 
 /* --- Common extension loading functions --- */
 
 // Global member to store if the extension have already been loaded
 static bool g_extAlreadyLoaded = false;
 
-void LoadAllExtensions(VkInstance instance)
+void LoadAllExtensions(VkInstance instance, bool headlessSurface)
 {
     /* Only load GL extensions once */
     if (g_extAlreadyLoaded)
@@ -82,6 +125,12 @@ void LoadAllExtensions(VkInstance instance)
     LOAD_VKEXT( KHR_win32_surface );
     #endif // /LLGL_OS_WIN32
 
+    /* Load optional extensions that have been enabled for the instance */
+    #ifdef VK_EXT_headless_surface
+    if (headlessSurface)
+        LOAD_VKEXT( EXT_headless_surface );
+    #endif // /VK_EXT_headless_surface
+
     #undef LOAD_VKEXT
     
     g_extAlreadyLoaded = true;
@@ -92,6 +141,15 @@ bool AreExtensionsLoaded()
     return g_extAlreadyLoaded;
 }
 
+void LoadDeviceExtensions(VkDevice device, bool conditionalRendering)
+{
+    /* Load optional extensions that have been enabled for the device */
+    #ifdef VK_EXT_conditional_rendering
+    if (conditionalRendering && !Load_VK_EXT_conditional_rendering(device))
+        Log::StdErr() << "failed to load Vulkan extension: VK_EXT_conditional_rendering" << std::endl;
+    #endif // /VK_EXT_conditional_rendering
+}
+
 
 } // /namespace LLGL
 
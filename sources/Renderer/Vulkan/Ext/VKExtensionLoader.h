@@ -23,13 +23,20 @@ Loads all available extensions and prints errors if an extension is available,
 but their respective functions could not be loaded.
 \param[in,out] extensions Specifies the extension map. This can be queried by the "QueryExtensions" function.
 The respective entry will be set to true if all its functions have been loaded successfully.
+\param[in] headlessSurface Specifies whether the functions of the "VK_EXT_headless_surface" extension shall be loaded.
 \see QueryExtensions
 */
-void LoadAllExtensions(VkInstance instance);
+void LoadAllExtensions(VkInstance instance, bool headlessSurface = false);
 
 //! Returns true if all available extensions have been loaded.
 bool AreExtensionsLoaded();
 
+/**
+Loads the functions of all optional device extensions that have been enabled for the specified logical device.
+\param[in] conditionalRendering Specifies whether the functions of the "VK_EXT_conditional_rendering" extension shall be loaded.
+*/
+void LoadDeviceExtensions(VkDevice device, bool conditionalRendering);
+
 
 } // /namespace LLGL
 
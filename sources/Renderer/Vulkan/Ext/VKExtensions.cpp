@@ -24,6 +24,21 @@ PFN_vkCreateWin32SurfaceKHR vkCreateWin32SurfaceKHR = nullptr;
 
 #endif
 
+/* Platform independent VK extensions */
+
+#ifdef VK_EXT_headless_surface
+
+PFN_vkCreateHeadlessSurfaceEXT vkCreateHeadlessSurfaceEXT = nullptr;
+
+#endif
+
+#ifdef VK_EXT_conditional_rendering
+
+PFN_vkCmdBeginConditionalRenderingEXT vkCmdBeginConditionalRenderingEXT = nullptr;
+PFN_vkCmdEndConditionalRenderingEXT vkCmdEndConditionalRenderingEXT = nullptr;
+
+#endif
+
 
 } // /namespace LLGL
 
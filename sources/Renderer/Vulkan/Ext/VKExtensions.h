@@ -28,6 +28,21 @@ extern PFN_vkCreateWin32SurfaceKHR vkCreateWin32SurfaceKHR;
 
 #endif
 
+/* Platform independent VK extensions */
+
+#ifdef VK_EXT_headless_surface
+
+extern PFN_vkCreateHeadlessSurfaceEXT vkCreateHeadlessSurfaceEXT;
+
+#endif
+
+#ifdef VK_EXT_conditional_rendering
+
+extern PFN_vkCmdBeginConditionalRenderingEXT vkCmdBeginConditionalRenderingEXT;
+extern PFN_vkCmdEndConditionalRenderingEXT vkCmdEndConditionalRenderingEXT;
+
+#endif
+
 
 } // /namespace LLGL
 
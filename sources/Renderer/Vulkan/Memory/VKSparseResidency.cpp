@@ -0,0 +1,55 @@
+/*
+ * VKSparseResidency.cpp
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "VKSparseResidency.h"
+#include "VKDeviceMemoryManager.h"
+
+
+namespace LLGL
+{
+
+
+VKDeviceMemoryRegion* VKSparseResidency::CommitPage(
+    VKDeviceMemoryManager&      deviceMemoryMngr,
+    std::uint64_t               key,
+    const VkMemoryRequirements& pageRequirements)
+{
+    auto result = pages_.insert({ key, nullptr });
+    if (result.second)
+    {
+        /* Allocate device local memory for the new page */
+        result.first->second = deviceMemoryMngr.Allocate(pageRequirements, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+        return result.first->second;
+    }
+    return nullptr;
+}
+
+VKDeviceMemoryRegion* VKSparseResidency::DecommitPage(std::uint64_t key)
+{
+    auto it = pages_.find(key);
+    if (it != pages_.end())
+    {
+        auto region = it->second;
+        pages_.erase(it);
+        return region;
+    }
+    return nullptr;
+}
+
+void VKSparseResidency::ReleaseAllPages(VKDeviceMemoryManager& deviceMemoryMngr)
+{
+    for (const auto& page : pages_)
+        deviceMemoryMngr.Release(page.second);
+    pages_.clear();
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
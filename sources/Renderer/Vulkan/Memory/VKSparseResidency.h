@@ -0,0 +1,66 @@
+/*
+ * VKSparseResidency.h
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_VK_SPARSE_RESIDENCY_H
+#define LLGL_VK_SPARSE_RESIDENCY_H
+
+
+#include "../Vulkan.h"
+#include <map>
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+class VKDeviceMemoryRegion;
+class VKDeviceMemoryManager;
+
+/*
+Keeps track of the committed memory pages of a sparse buffer or sparse image.
+Each page is identified by a key (e.g. its byte offset for buffers) and has its own region in the device memory manager.
+*/
+class VKSparseResidency
+{
+
+    public:
+
+        // Allocates a memory region for the specified page, or returns null if the page is already committed.
+        VKDeviceMemoryRegion* CommitPage(
+            VKDeviceMemoryManager&      deviceMemoryMngr,
+            std::uint64_t               key,
+            const VkMemoryRequirements& pageRequirements
+        );
+
+        // Removes the specified page and returns its memory region, or returns null if the page is not committed.
+        VKDeviceMemoryRegion* DecommitPage(std::uint64_t key);
+
+        // Releases the memory regions of all committed pages.
+        void ReleaseAllPages(VKDeviceMemoryManager& deviceMemoryMngr);
+
+        // Returns the number of committed pages.
+        inline std::size_t GetNumCommittedPages() const
+        {
+            return pages_.size();
+        }
+
+    private:
+
+        std::map<std::uint64_t, VKDeviceMemoryRegion*> pages_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -42,6 +42,8 @@ VKGraphicsPipeline::VKGraphicsPipeline(
     else
         nativePipelineLayout = defaultPipelineLayout;
 
+    pipelineLayout_ = nativePipelineLayout;
+
     /* Get native render pass object */
     VkRenderPass nativeRenderPass = VK_NULL_HANDLE;
 
@@ -49,6 +49,12 @@ class VKGraphicsPipeline final : public GraphicsPipeline
             return pipeline_.Get();
         }
 
+        // Returns the native VkPipelineLayout object this graphics pipeline was created with.
+        inline VkPipelineLayout GetVkPipelineLayout() const
+        {
+            return pipelineLayout_;
+        }
+
         // Returns true if scissors are enabled.
         inline bool IsScissorEnabled() const
         {
@@ -72,6 +78,7 @@ class VKGraphicsPipeline final : public GraphicsPipeline
 
         VkDevice            device_             = VK_NULL_HANDLE;
         VKPtr<VkPipeline>   pipeline_;
+        VkPipelineLayout    pipelineLayout_     = VK_NULL_HANDLE;
 
         bool                scissorEnabled_     = false;
         bool                hasDynamicScissor_  = false;
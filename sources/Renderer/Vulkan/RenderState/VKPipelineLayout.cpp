@@ -8,14 +8,14 @@
 #include "VKPipelineLayout.h"
 #include "../VKTypes.h"
 #include "../VKCore.h"
+#include <algorithm>
 
 
 namespace LLGL
 {
 
 
-// Converts the bitmask of LLGL::StageFlags to VkShaderStageFlags
-static VkShaderStageFlags GetVkShaderStageFlags(long flags)
+VkShaderStageFlags VKPipelineLayout::GetVkShaderStageFlags(long flags)
 {
     VkShaderStageFlags bitmask = 0;
 
@@ -35,15 +35,24 @@ static VkShaderStageFlags GetVkShaderStageFlags(long flags)
     return bitmask;
 }
 
+// Returns the descriptor type for the specified binding; constant buffers with dynamic offsets use VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC.
+static VkDescriptorType GetVkDescriptorType(const BindingDescriptor& desc)
+{
+    if (desc.type == ResourceType::ConstantBuffer && (desc.flags & BindingFlags::DynamicOffset) != 0)
+        return VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC;
+    else
+        return VKTypes::Map(desc.type);
+}
+
 //TODO:
 // looks like 'VkDescriptorSetLayoutBinding::descriptorCount' can only be greater than 1
 // for arrays in a shader (e.g. array of uniform buffers), but not for multiple binding points.
 static void Convert(VkDescriptorSetLayoutBinding& dst, const BindingDescriptor& src)
 {
     dst.binding             = src.slot;
-    dst.descriptorType      = VKTypes::Map(src.type);
+    dst.descriptorType      = GetVkDescriptorType(src);
     dst.descriptorCount     = src.arraySize;
-    dst.stageFlags          = GetVkShaderStageFlags(src.stageFlags);
+    dst.stageFlags          = VKPipelineLayout::GetVkShaderStageFlags(src.stageFlags);
     dst.pImmutableSamplers  = nullptr;
 }
 
@@ -82,6 +91,13 @@ VKPipelineLayout::VKPipelineLayout(const VKPtr<VkDevice>& device, const Pipeline
     auto result = vkCreateDescriptorSetLayout(device, &descSetCreateInfo, nullptr, descriptorSetLayout_.ReleaseAndGetAddressOf());
     VKThrowIfFailed(result, "failed to create Vulkan descriptor set layout");
 
+    /* Initialize push constant ranges for inline constants */
+    std::vector<VkPushConstantRange> pushConstantRanges;
+    pushConstantRanges.reserve(desc.inlineConstants.size());
+
+    for (const auto& range : desc.inlineConstants)
+        pushConstantRanges.push_back({ GetVkShaderStageFlags(range.stageFlags), range.offset, range.size });
+
     /* Create pipeline layout */
     VkDescriptorSetLayout setLayouts[] = { descriptorSetLayout_.Get() };
 
@@ -92,8 +108,8 @@ VKPipelineLayout::VKPipelineLayout(const VKPtr<VkDevice>& device, const Pipeline
         layoutCreateInfo.flags                  = 0;
         layoutCreateInfo.setLayoutCount         = 1;
         layoutCreateInfo.pSetLayouts            = setLayouts;
-        layoutCreateInfo.pushConstantRangeCount = 0;
-        layoutCreateInfo.pPushConstantRanges    = nullptr;
+        layoutCreateInfo.pushConstantRangeCount = static_cast<std::uint32_t>(pushConstantRanges.size());
+        layoutCreateInfo.pPushConstantRanges    = pushConstantRanges.data();
     }
     result = vkCreatePipelineLayout(device, &layoutCreateInfo, nullptr, pipelineLayout_.ReleaseAndGetAddressOf());
     VKThrowIfFailed(result, "failed to create Vulkan pipeline layout");
@@ -101,7 +117,38 @@ VKPipelineLayout::VKPipelineLayout(const VKPtr<VkDevice>& device, const Pipeline
     /* Create list of binding points (for later pass to 'VkWriteDescriptorSet::dstBinding') */
     bindings_.reserve(numBindings);
     for (const auto& binding : desc.bindings)
-        bindings_.push_back({ binding.slot, VKTypes::Map(binding.type) });
+        bindings_.push_back({ binding.slot, GetVkDescriptorType(binding), GetVkShaderStageFlags(binding.stageFlags) });
+
+    BuildDynamicOffsetOrder(desc);
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+void VKPipelineLayout::BuildDynamicOffsetOrder(const PipelineLayoutDescriptor& desc)
+{
+    /* Collect binding slots of all dynamic offsets in the order they are specified by the client */
+    std::vector<std::uint32_t> slots;
+
+    for (const auto& binding : desc.bindings)
+    {
+        if (GetVkDescriptorType(binding) == VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC)
+        {
+            dynamicOffsetOrder_.push_back(static_cast<std::uint32_t>(slots.size()));
+            slots.push_back(binding.slot);
+        }
+    }
+
+    /* Vulkan expects dynamic offsets in the order of their binding slots */
+    std::stable_sort(
+        dynamicOffsetOrder_.begin(), dynamicOffsetOrder_.end(),
+        [&slots](std::uint32_t lhs, std::uint32_t rhs)
+        {
+            return (slots[lhs] < slots[rhs]);
+        }
+    );
 }
 
 
@@ -24,6 +24,7 @@ struct VKLayoutBinding
 {
     std::uint32_t       dstBinding;
     VkDescriptorType    descriptorType;
+    VkShaderStageFlags  stageFlags;
 };
 
 class VKPipelineLayout final : public PipelineLayout
@@ -49,13 +50,28 @@ class VKPipelineLayout final : public PipelineLayout
             return bindings_;
         }
 
+        /*
+        Returns the order in which dynamic offsets must be passed to 'vkCmdBindDescriptorSets',
+        i.e. indices into the list of dynamic offsets (ordered by bindings) sorted by their binding slots.
+        */
+        inline const std::vector<std::uint32_t>& GetDynamicOffsetOrder() const
+        {
+            return dynamicOffsetOrder_;
+        }
+
+        // Converts the bitmask of LLGL::StageFlags to VkShaderStageFlags.
+        static VkShaderStageFlags GetVkShaderStageFlags(long flags);
+
     private:
 
+        void BuildDynamicOffsetOrder(const PipelineLayoutDescriptor& desc);
+
         VkDevice                        device_                 = VK_NULL_HANDLE;
         VKPtr<VkPipelineLayout>         pipelineLayout_;
         VKPtr<VkDescriptorSetLayout>    descriptorSetLayout_;
 
         std::vector<VKLayoutBinding>    bindings_;
+        std::vector<std::uint32_t>      dynamicOffsetOrder_;
 
 };
 
@@ -36,7 +36,7 @@ static void Convert(VkAttachmentDescription& dst, const AttachmentFormatDescript
     dst.storeOp         = VKTypes::Map(src.storeOp);
     dst.stencilLoadOp   = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
     dst.stencilStoreOp  = VK_ATTACHMENT_STORE_OP_DONT_CARE;
-    dst.initialLayout   = VK_IMAGE_LAYOUT_UNDEFINED;
+    dst.initialLayout   = (src.loadOp == AttachmentLoadOp::Load ? VK_IMAGE_LAYOUT_PRESENT_SRC_KHR : VK_IMAGE_LAYOUT_UNDEFINED);
     dst.finalLayout     = VK_IMAGE_LAYOUT_PRESENT_SRC_KHR;
 }
 
@@ -74,8 +74,14 @@ static void Convert(VkAttachmentDescription& dst, const AttachmentFormatDescript
     dst.storeOp         = VKTypes::Map(srcDepth.storeOp);
     dst.stencilLoadOp   = VKTypes::Map(srcStencil.loadOp);
     dst.stencilStoreOp  = VKTypes::Map(srcStencil.storeOp);
-    dst.initialLayout   = VK_IMAGE_LAYOUT_UNDEFINED;
-    dst.finalLayout     = VK_IMAGE_LAYOUT_PRESENT_SRC_KHR;
+
+    /* Previous content is only preserved if the image layout is not undefined (like with the GL backend) */
+    if (srcDepth.loadOp == AttachmentLoadOp::Load || srcStencil.loadOp == AttachmentLoadOp::Load)
+        dst.initialLayout = VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL;
+    else
+        dst.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+
+    dst.finalLayout     = VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL;
 }
 
 void VKRenderPass::CreateVkRenderPass(VkDevice device, const RenderPassDescriptor& desc)
@@ -125,6 +131,11 @@ void VKRenderPass::CreateVkRenderPassWithDescriptors(
     /* Store number of color attachments (required for default blend states in VKGraphicsPipeline) */
     numColorAttachments_ = static_cast<std::uint8_t>(numColorAttachments);
 
+    /* Store initial and final image layouts (required for resource state tracking in VKCommandBuffer) */
+    attachmentLayouts_.resize(numAttachments);
+    for (std::uint32_t i = 0; i < numAttachments; ++i)
+        attachmentLayouts_[i] = { attachmentDescs[i].initialLayout, attachmentDescs[i].finalLayout };
+
     /* Build bitmask for clear values: least significant bit (LSB) is used for the first attachment */
     clearValuesMask_ = 0;
 
@@ -12,6 +12,7 @@
 #include <LLGL/RenderPass.h>
 #include <vulkan/vulkan.h>
 #include "../VKPtr.h"
+#include <vector>
 #include <cstdint>
 
 
@@ -75,14 +76,28 @@ class VKRenderPass final : public RenderPass
             return numColorAttachments_;
         }
 
+        // Returns the image layout the specified attachment is expected to be in when the render pass begins.
+        inline VkImageLayout GetInitialLayout(std::uint32_t attachment) const
+        {
+            return attachmentLayouts_[attachment].first;
+        }
+
+        // Returns the image layout the specified attachment is transitioned into when the render pass ends.
+        inline VkImageLayout GetFinalLayout(std::uint32_t attachment) const
+        {
+            return attachmentLayouts_[attachment].second;
+        }
+
     private:
 
-        VKPtr<VkRenderPass> renderPass_;
+        VKPtr<VkRenderPass>                                     renderPass_;
+
+        std::uint64_t                                           clearValuesMask_        = 0;
+        std::uint8_t                                            depthStencilIndex_      = ~0;
+        std::uint8_t                                            numClearValues_         = 0;
+        std::uint8_t                                            numColorAttachments_    = 0;
 
-        std::uint64_t       clearValuesMask_        = 0;
-        std::uint8_t        depthStencilIndex_      = ~0;
-        std::uint8_t        numClearValues_         = 0;
-        std::uint8_t        numColorAttachments_    = 0;
+        std::vector<std::pair<VkImageLayout, VkImageLayout>>    attachmentLayouts_;
 
 };
 
@@ -31,7 +31,8 @@ VKResourceHeap::VKResourceHeap(const VKPtr<VkDevice>& device, const ResourceHeap
     if (!pipelineLayoutVK)
         throw std::invalid_argument("failed to create resource view heap due to missing pipeline layout");
 
-    pipelineLayout_ = pipelineLayoutVK->GetVkPipelineLayout();
+    pipelineLayout_     = pipelineLayoutVK->GetVkPipelineLayout();
+    dynamicOffsetOrder_ = pipelineLayoutVK->GetDynamicOffsetOrder();
 
     /* Validate binding descriptors */
     const auto& bindings = pipelineLayoutVK->GetBindings();
@@ -51,6 +52,10 @@ VKResourceHeap::VKResourceHeap(const VKPtr<VkDevice>& device, const ResourceHeap
 
 VKResourceHeap::~VKResourceHeap()
 {
+    /* Release image views of texture subresources */
+    for (auto imageView : imageViews_)
+        vkDestroyImageView(device_, imageView, nullptr);
+
     //INFO: is automatically deleted when pool is deleted
     #if 0
     auto result = vkFreeDescriptorSets(device_, descriptorPool_, 1, &descriptorSet_);
@@ -166,6 +171,7 @@ void VKResourceHeap::UpdateDescriptorSets(const ResourceHeapDescriptor& desc, co
                 break;
 
             case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER:
+            case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC:
             case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER:
                 FillWriteDescriptorForBuffer(rvDesc, bindings[i], container);
                 break;
@@ -191,6 +197,26 @@ void VKResourceHeap::UpdateDescriptorSets(const ResourceHeapDescriptor& desc, co
     }
 }
 
+static VkPipelineStageFlags GetVkPipelineStageFlags(VkShaderStageFlags stageFlags)
+{
+    VkPipelineStageFlags bitmask = 0;
+
+    if ((stageFlags & VK_SHADER_STAGE_VERTEX_BIT) != 0)
+        bitmask |= VK_PIPELINE_STAGE_VERTEX_SHADER_BIT;
+    if ((stageFlags & VK_SHADER_STAGE_TESSELLATION_CONTROL_BIT) != 0)
+        bitmask |= VK_PIPELINE_STAGE_TESSELLATION_CONTROL_SHADER_BIT;
+    if ((stageFlags & VK_SHADER_STAGE_TESSELLATION_EVALUATION_BIT) != 0)
+        bitmask |= VK_PIPELINE_STAGE_TESSELLATION_EVALUATION_SHADER_BIT;
+    if ((stageFlags & VK_SHADER_STAGE_GEOMETRY_BIT) != 0)
+        bitmask |= VK_PIPELINE_STAGE_GEOMETRY_SHADER_BIT;
+    if ((stageFlags & VK_SHADER_STAGE_FRAGMENT_BIT) != 0)
+        bitmask |= VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT;
+    if ((stageFlags & VK_SHADER_STAGE_COMPUTE_BIT) != 0)
+        bitmask |= VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT;
+
+    return (bitmask != 0 ? bitmask : VK_PIPELINE_STAGE_ALL_COMMANDS_BIT);
+}
+
 void VKResourceHeap::FillWriteDescriptorForSampler(const ResourceViewDescriptor& resourceViewDesc, const VKLayoutBinding& binding, VKWriteDescriptorContainer& container)
 {
     auto samplerVK = LLGL_CAST(VKSampler*, resourceViewDesc.resource);
@@ -221,11 +247,23 @@ void VKResourceHeap::FillWriteDescriptorForTexture(const ResourceViewDescriptor&
 {
     auto textureVK = LLGL_CAST(VKTexture*, resourceViewDesc.resource);
 
+    /* Store texture for resource state tracking */
+    textures_.push_back({ textureVK, GetVkPipelineStageFlags(binding.stageFlags) });
+
+    /* Create image view for subresource of the texture, or use the internal image view of the entire texture */
+    auto imageView = textureVK->GetVkImageView();
+
+    if (resourceViewDesc.textureView.format != Format::Undefined)
+    {
+        textureVK->CreateImageView(device_, resourceViewDesc.textureView, &imageView);
+        imageViews_.push_back(imageView);
+    }
+
     /* Initialize image information */
     auto imageInfo = container.NextImageInfo();
     {
         imageInfo->sampler       = VK_NULL_HANDLE;
-        imageInfo->imageView     = textureVK->GetVkImageView();
+        imageInfo->imageView     = imageView;
         imageInfo->imageLayout   = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
     }
 
@@ -247,12 +285,22 @@ void VKResourceHeap::FillWriteDescriptorForBuffer(const ResourceViewDescriptor&
 {
     auto bufferVK = LLGL_CAST(VKBuffer*, resourceViewDesc.resource);
 
-    /* Initialize buffer information */
+    /* Store buffer for resource state tracking (storage buffers can also be written by shaders) */
+    VkAccessFlags accessMask = VK_ACCESS_UNIFORM_READ_BIT;
+    if (binding.descriptorType == VK_DESCRIPTOR_TYPE_STORAGE_BUFFER)
+        accessMask = (VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT);
+
+    buffers_.push_back({ bufferVK, accessMask, GetVkPipelineStageFlags(binding.stageFlags) });
+
+    /* Initialize buffer information (dynamic offsets only select the start of a smaller range within the buffer) */
     auto bufferInfo = container.NextBufferInfo();
     {
         bufferInfo->buffer    = bufferVK->GetVkBuffer();
         bufferInfo->offset    = 0;
-        bufferInfo->range     = bufferVK->GetSize();
+        if (binding.descriptorType == VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC && resourceViewDesc.bufferRange > 0)
+            bufferInfo->range = resourceViewDesc.bufferRange;
+        else
+            bufferInfo->range = bufferVK->GetSize();
     }
 
     /* Initialize write descriptor */
@@ -20,9 +20,25 @@ namespace LLGL
 
 
 class VKBuffer;
+class VKTexture;
 struct VKWriteDescriptorContainer;
 struct VKLayoutBinding;
 
+// Texture that is referenced by a resource heap, and the pipeline stages it is read in.
+struct VKResourceHeapTexture
+{
+    const VKTexture*        texture;
+    VkPipelineStageFlags    stageMask;
+};
+
+// Buffer that is referenced by a resource heap, and how it is accessed in the pipeline stages.
+struct VKResourceHeapBuffer
+{
+    const VKBuffer*         buffer;
+    VkAccessFlags           accessMask;
+    VkPipelineStageFlags    stageMask;
+};
+
 class VKResourceHeap final : public ResourceHeap
 {
 
@@ -46,6 +62,24 @@ class VKResourceHeap final : public ResourceHeap
             return descriptorSets_;
         }
 
+        // Returns the order of dynamic offsets for 'vkCmdBindDescriptorSets' (see VKPipelineLayout::GetDynamicOffsetOrder).
+        inline const std::vector<std::uint32_t>& GetDynamicOffsetOrder() const
+        {
+            return dynamicOffsetOrder_;
+        }
+
+        // Returns the list of all textures in this resource heap (used to track resource states in VKCommandBuffer).
+        inline const std::vector<VKResourceHeapTexture>& GetTextures() const
+        {
+            return textures_;
+        }
+
+        // Returns the list of all buffers in this resource heap (used to track resource states in VKCommandBuffer).
+        inline const std::vector<VKResourceHeapBuffer>& GetBuffers() const
+        {
+            return buffers_;
+        }
+
     private:
 
         void CreateDescriptorPool(const ResourceHeapDescriptor& desc, const std::vector<VKLayoutBinding>& bindings);
@@ -56,10 +90,16 @@ class VKResourceHeap final : public ResourceHeap
         void FillWriteDescriptorForTexture(const ResourceViewDescriptor& resourceViewDesc, const VKLayoutBinding& binding, VKWriteDescriptorContainer& container);
         void FillWriteDescriptorForBuffer(const ResourceViewDescriptor& resourceViewDesc, const VKLayoutBinding& binding, VKWriteDescriptorContainer& container);
 
-        VkDevice                        device_         = VK_NULL_HANDLE;
-        VkPipelineLayout                pipelineLayout_ = VK_NULL_HANDLE;
-        VKPtr<VkDescriptorPool>         descriptorPool_;
-        std::vector<VkDescriptorSet>    descriptorSets_;
+        VkDevice                            device_         = VK_NULL_HANDLE;
+        VkPipelineLayout                    pipelineLayout_ = VK_NULL_HANDLE;
+        VKPtr<VkDescriptorPool>             descriptorPool_;
+        std::vector<VkDescriptorSet>        descriptorSets_;
+        std::vector<std::uint32_t>          dynamicOffsetOrder_;
+
+        std::vector<VKResourceHeapTexture>  textures_;
+        std::vector<VKResourceHeapBuffer>   buffers_;
+
+        std::vector<VkImageView>            imageViews_;
 
 };
 
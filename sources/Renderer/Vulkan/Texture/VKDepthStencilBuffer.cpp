@@ -7,6 +7,7 @@
 
 #include "VKDepthStencilBuffer.h"
 #include "../Memory/VKDeviceMemoryManager.h"
+#include "../VKCore.h"
 
 
 namespace LLGL
@@ -19,27 +20,11 @@ VKDepthStencilBuffer::VKDepthStencilBuffer(const VKPtr<VkDevice>& device) :
 {
 }
 
-// see https://www.khronos.org/registry/vulkan/specs/1.1-extensions/man/html/VkFormat.html
-static VkImageAspectFlags GetVkImageAspectByFormat(VkFormat format)
-{
-    switch (format)
-    {
-        case VK_FORMAT_D16_UNORM:           return VK_IMAGE_ASPECT_DEPTH_BIT;
-        case VK_FORMAT_X8_D24_UNORM_PACK32: return VK_IMAGE_ASPECT_DEPTH_BIT;
-        case VK_FORMAT_D32_SFLOAT:          return VK_IMAGE_ASPECT_DEPTH_BIT;
-        case VK_FORMAT_S8_UINT:             return VK_IMAGE_ASPECT_STENCIL_BIT;
-        case VK_FORMAT_D16_UNORM_S8_UINT:   return VK_IMAGE_ASPECT_DEPTH_BIT | VK_IMAGE_ASPECT_STENCIL_BIT;
-        case VK_FORMAT_D24_UNORM_S8_UINT:   return VK_IMAGE_ASPECT_DEPTH_BIT | VK_IMAGE_ASPECT_STENCIL_BIT;
-        case VK_FORMAT_D32_SFLOAT_S8_UINT:  return VK_IMAGE_ASPECT_DEPTH_BIT | VK_IMAGE_ASPECT_STENCIL_BIT;
-        default:                            return 0;
-    }
-}
-
 void VKDepthStencilBuffer::CreateDepthStencil(
     VKDeviceMemoryManager& deviceMemoryMngr, const Extent2D& extent, VkFormat format, VkSampleCountFlagBits samplesFlags)
 {
     /* Determine image aspect */
-    auto imageAspect = GetVkImageAspectByFormat(format);
+    auto imageAspect = VKGetImageAspectByFormat(format);
     if (!imageAspect)
         throw std::invalid_argument("invalid format for Vulkan depth-stencil buffer");
 
@@ -72,8 +57,9 @@ void VKDepthStencilBuffer::CreateDepthStencil(
         imageView_.ReleaseAndGetAddressOf()
     );
 
-    /* Store parameters */
+    /* Store parameters; the new image content is undefined until its first render pass */
     format_ = format;
+    layout_ = VK_IMAGE_LAYOUT_UNDEFINED;
 }
 
 void VKDepthStencilBuffer::ReleaseDepthStencil(VKDeviceMemoryManager& deviceMemoryMngr)
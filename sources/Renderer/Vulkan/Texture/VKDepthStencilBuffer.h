@@ -50,10 +50,23 @@ class VKDepthStencilBuffer final : private VKDeviceImage
             return format_;
         }
 
+        // Returns the image layout the last recorded render pass left this depth-stencil buffer in, or VK_IMAGE_LAYOUT_UNDEFINED if it has not been used yet.
+        inline VkImageLayout GetVkImageLayout() const
+        {
+            return layout_;
+        }
+
+        // Stores the image layout the most recently recorded render pass leaves this depth-stencil buffer in.
+        inline void SetVkImageLayout(VkImageLayout layout)
+        {
+            layout_ = layout;
+        }
+
     private:
 
         VKPtr<VkImageView>  imageView_;
         VkFormat            format_     = VK_FORMAT_UNDEFINED;
+        VkImageLayout       layout_     = VK_IMAGE_LAYOUT_UNDEFINED;
 
 };
 
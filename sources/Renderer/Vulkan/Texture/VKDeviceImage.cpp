@@ -102,15 +102,16 @@ void VKDeviceImage::ReleaseVkImage()
 }
 
 void VKDeviceImage::CreateVkImageView(
-    VkDevice            device,
-    VkImageViewType     viewType,
-    VkFormat            format,
-    VkImageAspectFlags  aspectFlags,
-    std::uint32_t       baseMipLevel,
-    std::uint32_t       numMipLevels,
-    std::uint32_t       baseArrayLayer,
-    std::uint32_t       numArrayLayers,
-    VkImageView*        imageViewRef)
+    VkDevice                    device,
+    VkImageViewType             viewType,
+    VkFormat                    format,
+    VkImageAspectFlags          aspectFlags,
+    std::uint32_t               baseMipLevel,
+    std::uint32_t               numMipLevels,
+    std::uint32_t               baseArrayLayer,
+    std::uint32_t               numArrayLayers,
+    VkImageView*                imageViewRef,
+    const VkComponentMapping*   components)
 {
     /* Create image view object */
     VkImageViewCreateInfo createInfo;
@@ -121,10 +122,15 @@ void VKDeviceImage::CreateVkImageView(
         createInfo.image                            = image_;
         createInfo.viewType                         = viewType;
         createInfo.format                           = format;
-        createInfo.components.r                     = VK_COMPONENT_SWIZZLE_IDENTITY;
-        createInfo.components.g                     = VK_COMPONENT_SWIZZLE_IDENTITY;
-        createInfo.components.b                     = VK_COMPONENT_SWIZZLE_IDENTITY;
-        createInfo.components.a                     = VK_COMPONENT_SWIZZLE_IDENTITY;
+        if (components != nullptr)
+            createInfo.components                   = *components;
+        else
+        {
+            createInfo.components.r                 = VK_COMPONENT_SWIZZLE_IDENTITY;
+            createInfo.components.g                 = VK_COMPONENT_SWIZZLE_IDENTITY;
+            createInfo.components.b                 = VK_COMPONENT_SWIZZLE_IDENTITY;
+            createInfo.components.a                 = VK_COMPONENT_SWIZZLE_IDENTITY;
+        }
         createInfo.subresourceRange.aspectMask      = aspectFlags;
         createInfo.subresourceRange.baseMipLevel    = baseMipLevel;
         createInfo.subresourceRange.levelCount      = numMipLevels;
@@ -51,15 +51,16 @@ class VKDeviceImage
         void ReleaseVkImage();
 
         void CreateVkImageView(
-            VkDevice            device,
-            VkImageViewType     viewType,
-            VkFormat            format,
-            VkImageAspectFlags  aspectFlags,
-            std::uint32_t       baseMipLevel,
-            std::uint32_t       numMipLevels,
-            std::uint32_t       baseArrayLayer,
-            std::uint32_t       numArrayLayers,
-            VkImageView*        imageViewRef
+            VkDevice                    device,
+            VkImageViewType             viewType,
+            VkFormat                    format,
+            VkImageAspectFlags          aspectFlags,
+            std::uint32_t               baseMipLevel,
+            std::uint32_t               numMipLevels,
+            std::uint32_t               baseArrayLayer,
+            std::uint32_t               numArrayLayers,
+            VkImageView*                imageViewRef,
+            const VkComponentMapping*   components = nullptr
         );
 
         // Returns the native VkImage handle.
@@ -205,6 +205,7 @@ void VKRenderTarget::CreateFramebuffer(const VKPtr<VkDevice>& device, VKDeviceMe
                 imageViewRefs[numColorAttachments] = imageView;
             }
             imageViews_.emplace_back(std::move(imageView));
+            colorAttachments_.push_back(attachment);
 
             /* Validate texture resolution to render target (to validate correlation between attachments) */
             ValidateMipResolution(*textureVK, attachment.mipLevel);
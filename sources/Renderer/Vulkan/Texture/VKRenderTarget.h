@@ -57,6 +57,18 @@ class VKRenderTarget final : public RenderTarget
             return { resolution_.width, resolution_.height };
         }
 
+        // Returns the list of all color attachments with their texture subresources.
+        inline const std::vector<AttachmentDescriptor>& GetColorAttachments() const
+        {
+            return colorAttachments_;
+        }
+
+        // Returns the depth-stencil buffer of this render target. Its format is VK_FORMAT_UNDEFINED if there is no depth or stencil attachment.
+        inline VKDepthStencilBuffer& GetDepthStencilBuffer()
+        {
+            return depthStencilBuffer_;
+        }
+
     private:
 
         void CreateDepthStencilForAttachment(VKDeviceMemoryManager& deviceMemoryMngr, const AttachmentDescriptor& attachmentDesc);
@@ -65,17 +77,18 @@ class VKRenderTarget final : public RenderTarget
 
         VkSampleCountFlagBits GetSampleCountFlags() const;
 
-        Extent2D                        resolution_;
+        Extent2D                            resolution_;
 
-        VKPtr<VkFramebuffer>            framebuffer_;
-        VKRenderPass                    defaultRenderPass_;
-        const VKRenderPass*             renderPass_             = nullptr;
+        VKPtr<VkFramebuffer>                framebuffer_;
+        VKRenderPass                        defaultRenderPass_;
+        const VKRenderPass*                 renderPass_             = nullptr;
 
-        std::vector<VKPtr<VkImageView>> imageViews_;
+        std::vector<VKPtr<VkImageView>>     imageViews_;
+        std::vector<AttachmentDescriptor>   colorAttachments_;
 
-        VKDepthStencilBuffer            depthStencilBuffer_;
+        VKDepthStencilBuffer                depthStencilBuffer_;
 
-        std::uint32_t                   numColorAttachments_    = 0;
+        std::uint32_t                       numColorAttachments_    = 0;
 
 };
 
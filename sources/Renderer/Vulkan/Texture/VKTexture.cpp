@@ -10,6 +10,8 @@
 #include "../VKTypes.h"
 #include "../VKCore.h"
 #include <algorithm>
+#include <vector>
+#include <stdexcept>
 
 
 namespace LLGL
@@ -21,11 +23,15 @@ VKTexture::VKTexture(
         Texture       { desc.type                  },
         imageWrapper_ { device                     },
         imageView_    { device, vkDestroyImageView },
-        format_       { VKTypes::Map(desc.format)  }
+        format_       { VKTypes::Map(desc.format)  },
+        sparse_       { ((desc.flags & TextureFlags::Sparse) != 0) }
 {
-    /* Create Vulkan image and allocate memory region */
+    /* Create Vulkan image and allocate memory region (sparse images are bound to memory when their tiles are committed) */
     CreateImage(device, desc);
-    imageWrapper_.AllocateMemoryRegion(deviceMemoryMngr);
+    if (sparse_)
+        QuerySparseRequirements(device);
+    else
+        imageWrapper_.AllocateMemoryRegion(deviceMemoryMngr);
 }
 
 Extent3D VKTexture::QueryMipExtent(std::uint32_t mipLevel) const
@@ -63,6 +69,16 @@ Extent3D VKTexture::QueryMipExtent(std::uint32_t mipLevel) const
     return { 0u, 0u, 0u };
 }
 
+Extent3D VKTexture::QuerySparseTileExtent() const
+{
+    if (sparse_)
+    {
+        const auto& granularity = sparseImageRequirements_.formatProperties.imageGranularity;
+        return { granularity.width, granularity.height, granularity.depth };
+    }
+    return { 0u, 0u, 0u };
+}
+
 TextureDescriptor VKTexture::QueryDesc() const
 {
     TextureDescriptor texDesc;
@@ -124,7 +140,7 @@ void VKTexture::CreateImageView(
         device,
         VKTypes::Map(GetType()),
         format_,
-        VK_IMAGE_ASPECT_COLOR_BIT,
+        VKGetSingleImageAspectByFormat(format_),
         baseMipLevel,
         numMipLevels,
         baseArrayLayer,
@@ -133,6 +149,34 @@ void VKTexture::CreateImageView(
     );
 }
 
+void VKTexture::CreateImageView(VkDevice device, const TextureViewDescriptor& textureViewDesc, VkImageView* imageViewRef)
+{
+    const auto& subresource = textureViewDesc.subresource;
+
+    VkComponentMapping components;
+    {
+        components.r = VKTypes::Map(textureViewDesc.swizzle.r);
+        components.g = VKTypes::Map(textureViewDesc.swizzle.g);
+        components.b = VKTypes::Map(textureViewDesc.swizzle.b);
+        components.a = VKTypes::Map(textureViewDesc.swizzle.a);
+    }
+
+    const auto viewFormat = VKTypes::Map(textureViewDesc.format);
+
+    imageWrapper_.CreateVkImageView(
+        device,
+        VKTypes::Map(textureViewDesc.type),
+        viewFormat,
+        VKGetSingleImageAspectByFormat(viewFormat),
+        subresource.baseMipLevel,
+        subresource.numMipLevels,
+        subresource.baseArrayLayer,
+        subresource.numArrayLayers,
+        imageViewRef,
+        &components
+    );
+}
+
 void VKTexture::CreateInternalImageView(VkDevice device)
 {
     CreateImageView(device, 0, GetNumMipLevels(), 0, GetNumArrayLayers(), imageView_.ReleaseAndGetAddressOf());
@@ -151,6 +195,12 @@ static VkImageCreateFlags GetVkImageCreateFlags(const TextureDescriptor& desc)
         createFlags |= VK_IMAGE_CREATE_CUBE_COMPATIBLE_BIT;
     if (desc.type == TextureType::Texture2DArray || desc.type == TextureType::Texture2DMSArray)
         createFlags |= VK_IMAGE_CREATE_2D_ARRAY_COMPATIBLE_BIT_KHR;
+    if ((desc.flags & TextureFlags::Sparse) != 0)
+        createFlags |= (VK_IMAGE_CREATE_SPARSE_BINDING_BIT | VK_IMAGE_CREATE_SPARSE_RESIDENCY_BIT);
+
+    /* Allow texture views to reinterpret the format only on demand, since it might prevent optimizations such as color compression */
+    if ((desc.flags & TextureFlags::MutableFormat) != 0)
+        createFlags |= VK_IMAGE_CREATE_MUTABLE_FORMAT_BIT;
 
     return createFlags;
 }
@@ -238,11 +288,8 @@ static VkSampleCountFlagBits GetVkImageSampleCountFlags(const TextureDescriptor&
 
 static VkImageUsageFlags GetVkImageUsageFlags(const TextureDescriptor& desc)
 {
-    VkImageUsageFlags usageFlags = VK_IMAGE_USAGE_TRANSFER_DST_BIT;
-
-    /* Enable TRANSFER_SRC_BIT image usage when MIP-maps are enabled */
-    if (IsMipMappedTexture(desc))
-        usageFlags |= VK_IMAGE_USAGE_TRANSFER_SRC_BIT;
+    /* Images can always be the source of copy commands (e.g. for MIP-map generation, CommandBuffer::CopyTexture and RenderSystem::ReadTextureAsync) */
+    VkImageUsageFlags usageFlags = (VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_TRANSFER_SRC_BIT);
 
     /* Enable either color or depth-stencil ATTACHMENT_BIT image usage when attachment usage is enabled */
     if ((desc.flags & TextureFlags::AttachmentUsage) != 0)
@@ -287,6 +334,30 @@ void VKTexture::CreateImage(VkDevice device, const TextureDescriptor& desc)
     );
 }
 
+void VKTexture::QuerySparseRequirements(VkDevice device)
+{
+    /* Query memory requirements of entire image, whose alignment denotes the size of a single tile in device memory */
+    vkGetImageMemoryRequirements(device, GetVkImage(), &sparseMemoryRequirements_);
+
+    /* Query sparse memory requirements and select the ones for the color aspect */
+    std::uint32_t numRequirements = 0;
+    vkGetImageSparseMemoryRequirements(device, GetVkImage(), &numRequirements, nullptr);
+
+    std::vector<VkSparseImageMemoryRequirements> requirements(numRequirements);
+    vkGetImageSparseMemoryRequirements(device, GetVkImage(), &numRequirements, requirements.data());
+
+    for (const auto& req : requirements)
+    {
+        if ((req.formatProperties.aspectMask & VK_IMAGE_ASPECT_COLOR_BIT) != 0)
+        {
+            sparseImageRequirements_ = req;
+            return;
+        }
+    }
+
+    throw std::runtime_error("failed to query sparse memory requirements for Vulkan image");
+}
+
 
 } // /namespace LLGL
 
@@ -13,6 +13,7 @@
 #include "VKDeviceImage.h"
 #include <vulkan/vulkan.h>
 #include "../VKPtr.h"
+#include "../Memory/VKSparseResidency.h"
 #include <cstdint>
 
 
@@ -37,6 +38,8 @@ class VKTexture final : public Texture
         Extent3D QueryMipExtent(std::uint32_t mipLevel) const override;
         TextureDescriptor QueryDesc() const override;
 
+        Extent3D QuerySparseTileExtent() const override;
+
         void CreateImageView(
             VkDevice        device,
             std::uint32_t   baseMipLevel,
@@ -46,6 +49,9 @@ class VKTexture final : public Texture
             VkImageView*    imageViewRef
         );
 
+        // Creates an image view for the subresource, format, and component swizzle of the specified texture view.
+        void CreateImageView(VkDevice device, const TextureViewDescriptor& textureViewDesc, VkImageView* imageViewRef);
+
         void CreateInternalImageView(VkDevice device);
 
         // Returns the Vulkan image object.
@@ -90,9 +96,41 @@ class VKTexture final : public Texture
             return imageWrapper_.GetMemoryRegion();
         }
 
+        // Releases the region of the hardware device memory, and all committed pages if this is a sparse texture.
+        inline void ReleaseMemoryRegion(VKDeviceMemoryManager& deviceMemoryMngr)
+        {
+            imageWrapper_.ReleaseMemoryRegion(deviceMemoryMngr);
+            sparseResidency_.ReleaseAllPages(deviceMemoryMngr);
+        }
+
+        // Returns true if this texture was created as sparse image (see TextureFlags::Sparse).
+        inline bool IsSparse() const
+        {
+            return sparse_;
+        }
+
+        // Returns the committed pages of this sparse texture.
+        inline VKSparseResidency& GetSparseResidency()
+        {
+            return sparseResidency_;
+        }
+
+        // Returns the memory requirements of the entire sparse image.
+        inline const VkMemoryRequirements& GetSparseMemoryRequirements() const
+        {
+            return sparseMemoryRequirements_;
+        }
+
+        // Returns the sparse memory requirements of the color aspect, i.e. the tile granularity and the MIP-map tail.
+        inline const VkSparseImageMemoryRequirements& GetSparseImageRequirements() const
+        {
+            return sparseImageRequirements_;
+        }
+
     private:
 
         void CreateImage(VkDevice device, const TextureDescriptor& desc);
+        void QuerySparseRequirements(VkDevice device);
 
         VKDeviceImage          imageWrapper_;
         VKPtr<VkImageView>      imageView_;
@@ -102,6 +140,11 @@ class VKTexture final : public Texture
         std::uint32_t           numMipLevels_   = 0;
         std::uint32_t           numArrayLayers_ = 0;
 
+        bool                            sparse_                     = false;
+        VKSparseResidency               sparseResidency_;
+        VkMemoryRequirements            sparseMemoryRequirements_   = {};
+        VkSparseImageMemoryRequirements sparseImageRequirements_    = {};
+
 };
 
 
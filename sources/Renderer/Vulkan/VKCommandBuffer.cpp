@@ -8,18 +8,23 @@
 #include "VKCommandBuffer.h"
 #include "VKRenderContext.h"
 #include "VKTypes.h"
+#include "VKCore.h"
 #include "RenderState/VKRenderPass.h"
 #include "RenderState/VKGraphicsPipeline.h"
 #include "RenderState/VKComputePipeline.h"
 #include "RenderState/VKResourceHeap.h"
+#include "RenderState/VKPipelineLayout.h"
 #include "RenderState/VKQuery.h"
 #include "Texture/VKSampler.h"
+#include "Texture/VKTexture.h"
 #include "Texture/VKRenderTarget.h"
 #include "Buffer/VKBuffer.h"
 #include "Buffer/VKBufferArray.h"
 #include "Buffer/VKIndexBuffer.h"
+#include "Ext/VKExtensions.h"
 #include "../CheckedCast.h"
 #include "../StaticLimits.h"
+#include "../TextureUtils.h"
 #include <cstddef>
 
 
@@ -70,9 +75,18 @@ void VKCommandBuffer::Begin()
     /* Use next internal VkCommandBuffer object to reduce latency */
     AcquireNextBuffer();
 
-    /* Wait for fence before recording */
-    vkWaitForFences(device_, 1, &recordingFence_, VK_TRUE, UINT64_MAX);
+    /* Wait for fence of previous submission before recording (might be shared with other command buffers) */
+    auto& pendingSubmitFence = pendingSubmitFenceList_[commandBufferIndex_];
+    vkWaitForFences(device_, 1, &pendingSubmitFence, VK_TRUE, UINT64_MAX);
     vkResetFences(device_, 1, &recordingFence_);
+    pendingSubmitFence = recordingFence_;
+
+    /* Reset swap-chain reference and resource states from previous recording */
+    swapChainContext_       = nullptr;
+    renderTarget_           = nullptr;
+    computeResourceHeap_    = nullptr;
+    boundPipelineLayout_    = VK_NULL_HANDLE;
+    stateTracker_.Reset();
 
     /* Begin recording of current command buffer */
     VkCommandBufferBeginInfo beginInfo;
@@ -88,6 +102,10 @@ void VKCommandBuffer::Begin()
 
 void VKCommandBuffer::End()
 {
+    /* Leave all resources readable for subsequent command buffers */
+    stateTracker_.ResolveStates();
+    stateTracker_.FlushBarriers(commandBuffer_);
+
     /* End encoding of current command buffer */
     auto result = vkEndCommandBuffer(commandBuffer_);
     VKThrowIfFailed(result, "failed to end Vulkan command buffer");
@@ -100,6 +118,9 @@ void VKCommandBuffer::UpdateBuffer(Buffer& dstBuffer, std::uint64_t dstOffset, c
     auto size   = static_cast<VkDeviceSize>(dataSize);
     auto offset = static_cast<VkDeviceSize>(dstOffset);
 
+    stateTracker_.AccessBuffer(dstBufferVK, VK_ACCESS_TRANSFER_WRITE_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT);
+    stateTracker_.FlushBarriers(commandBuffer_);
+
     vkCmdUpdateBuffer(commandBuffer_, dstBufferVK.GetVkBuffer(), offset, size, data);
 }
 
@@ -114,9 +135,128 @@ void VKCommandBuffer::CopyBuffer(Buffer& dstBuffer, std::uint64_t dstOffset, Buf
         region.dstOffset    = static_cast<VkDeviceSize>(dstOffset);
         region.size         = static_cast<VkDeviceSize>(size);
     }
+
+    stateTracker_.AccessBuffer(srcBufferVK, VK_ACCESS_TRANSFER_READ_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT);
+    stateTracker_.AccessBuffer(dstBufferVK, VK_ACCESS_TRANSFER_WRITE_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT);
+    stateTracker_.FlushBarriers(commandBuffer_);
+
     vkCmdCopyBuffer(commandBuffer_, srcBufferVK.GetVkBuffer(), dstBufferVK.GetVkBuffer(), 1, &region);
 }
 
+void VKCommandBuffer::FillBuffer(Buffer& dstBuffer, std::uint64_t dstOffset, std::uint32_t value, std::uint64_t fillSize)
+{
+    auto& dstBufferVK = LLGL_CAST(VKBuffer&, dstBuffer);
+
+    auto size   = static_cast<VkDeviceSize>(fillSize);
+    auto offset = static_cast<VkDeviceSize>(dstOffset);
+
+    stateTracker_.AccessBuffer(dstBufferVK, VK_ACCESS_TRANSFER_WRITE_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT);
+    stateTracker_.FlushBarriers(commandBuffer_);
+
+    vkCmdFillBuffer(commandBuffer_, dstBufferVK.GetVkBuffer(), offset, size, value);
+}
+
+static VkImageSubresourceLayers MakeVkImageSubresourceLayers(const VKTexture& textureVK, const TextureSubresourceRegion& subresourceRegion)
+{
+    VkImageSubresourceLayers subresourceLayers;
+    {
+        subresourceLayers.aspectMask        = VKGetImageAspectByFormat(textureVK.GetVkFormat());
+        subresourceLayers.mipLevel          = subresourceRegion.mipLevel;
+        subresourceLayers.baseArrayLayer    = subresourceRegion.baseArrayLayer;
+        subresourceLayers.layerCount        = subresourceRegion.numArrayLayers;
+    }
+    return subresourceLayers;
+}
+
+static VkOffset3D MakeVkOffset3D(const Offset3D& offset)
+{
+    return VkOffset3D { offset.x, offset.y, offset.z };
+}
+
+static VkOffset3D MakeVkOffset3DEnd(const Offset3D& offset, const Extent3D& extent)
+{
+    return VkOffset3D
+    {
+        offset.x + static_cast<std::int32_t>(extent.width),
+        offset.y + static_cast<std::int32_t>(extent.height),
+        offset.z + static_cast<std::int32_t>(extent.depth)
+    };
+}
+
+void VKCommandBuffer::CopyTexture(
+    Texture&                dstTexture,
+    const TextureLocation&  dstLocation,
+    Texture&                srcTexture,
+    const TextureRegion&    srcRegion)
+{
+    auto& dstTextureVK = LLGL_CAST(VKTexture&, dstTexture);
+    auto& srcTextureVK = LLGL_CAST(VKTexture&, srcTexture);
+
+    auto srcSubresource = MakeTextureSubresourceRegion(srcTexture.GetType(), srcRegion);
+    auto dstSubresource = MakeTextureSubresourceRegion(dstTexture.GetType(), dstLocation, srcSubresource);
+
+    VkImageCopy region;
+    {
+        region.srcSubresource   = MakeVkImageSubresourceLayers(srcTextureVK, srcSubresource);
+        region.srcOffset        = MakeVkOffset3D(srcSubresource.offset);
+        region.dstSubresource   = MakeVkImageSubresourceLayers(dstTextureVK, dstSubresource);
+        region.dstOffset        = MakeVkOffset3D(dstSubresource.offset);
+        region.extent           = { srcSubresource.extent.width, srcSubresource.extent.height, srcSubresource.extent.depth };
+    }
+
+    /* Transition textures into transfer layouts; they are transitioned back lazily with the next access */
+    VkImageLayout srcLayout, dstLayout;
+    AccessTransferTextures(srcTextureVK, dstTextureVK, srcLayout, dstLayout);
+
+    vkCmdCopyImage(
+        commandBuffer_,
+        srcTextureVK.GetVkImage(), srcLayout,
+        dstTextureVK.GetVkImage(), dstLayout,
+        1, &region
+    );
+}
+
+static VkFilter GetVkFilter(const SamplerFilter filter)
+{
+    return (filter == SamplerFilter::Linear ? VK_FILTER_LINEAR : VK_FILTER_NEAREST);
+}
+
+void VKCommandBuffer::BlitTexture(
+    Texture&                dstTexture,
+    const TextureRegion&    dstRegion,
+    Texture&                srcTexture,
+    const TextureRegion&    srcRegion,
+    const SamplerFilter     filter)
+{
+    auto& dstTextureVK = LLGL_CAST(VKTexture&, dstTexture);
+    auto& srcTextureVK = LLGL_CAST(VKTexture&, srcTexture);
+
+    auto srcSubresource = MakeTextureSubresourceRegion(srcTexture.GetType(), srcRegion);
+    auto dstSubresource = MakeTextureSubresourceRegion(dstTexture.GetType(), dstRegion);
+
+    VkImageBlit region;
+    {
+        region.srcSubresource   = MakeVkImageSubresourceLayers(srcTextureVK, srcSubresource);
+        region.srcOffsets[0]    = MakeVkOffset3D(srcSubresource.offset);
+        region.srcOffsets[1]    = MakeVkOffset3DEnd(srcSubresource.offset, srcSubresource.extent);
+        region.dstSubresource   = MakeVkImageSubresourceLayers(dstTextureVK, dstSubresource);
+        region.dstOffsets[0]    = MakeVkOffset3D(dstSubresource.offset);
+        region.dstOffsets[1]    = MakeVkOffset3DEnd(dstSubresource.offset, dstSubresource.extent);
+    }
+
+    /* Transition textures into transfer layouts; they are transitioned back lazily with the next access */
+    VkImageLayout srcLayout, dstLayout;
+    AccessTransferTextures(srcTextureVK, dstTextureVK, srcLayout, dstLayout);
+
+    vkCmdBlitImage(
+        commandBuffer_,
+        srcTextureVK.GetVkImage(), srcLayout,
+        dstTextureVK.GetVkImage(), dstLayout,
+        1, &region,
+        GetVkFilter(filter)
+    );
+}
+
 /* ----- Configuration ----- */
 
 void VKCommandBuffer::SetGraphicsAPIDependentState(const void* stateDesc, std::size_t stateDescSize)
@@ -388,8 +528,26 @@ void VKCommandBuffer::EndStreamOutput()
 /* ----- Resource Heaps ----- */
 
 //private
-void VKCommandBuffer::BindResourceHeap(VKResourceHeap& resourceHeapVK, VkPipelineBindPoint bindingPoint, std::uint32_t firstSet)
+void VKCommandBuffer::BindResourceHeap(
+    VKResourceHeap&         resourceHeapVK,
+    VkPipelineBindPoint     bindingPoint,
+    std::uint32_t           firstSet,
+    std::uint32_t           numDynamicOffsets,
+    const std::uint32_t*    dynamicOffsets)
 {
+    /* Declare resource accesses; barriers are recorded with the next render pass or dispatch command */
+    AccessResourceHeap(resourceHeapVK);
+
+    /* Reorder dynamic offsets by their binding slots */
+    const auto& dynamicOffsetOrder = resourceHeapVK.GetDynamicOffsetOrder();
+    dynamicOffsets_.resize(dynamicOffsetOrder.size());
+
+    for (std::size_t i = 0; i < dynamicOffsetOrder.size(); ++i)
+    {
+        const auto index = dynamicOffsetOrder[i];
+        dynamicOffsets_[i] = (index < numDynamicOffsets ? dynamicOffsets[index] : 0u);
+    }
+
     vkCmdBindDescriptorSets(
         commandBuffer_,
         bindingPoint,
@@ -397,21 +555,31 @@ void VKCommandBuffer::BindResourceHeap(VKResourceHeap& resourceHeapVK, VkPipelin
         firstSet,
         static_cast<std::uint32_t>(resourceHeapVK.GetVkDescriptorSets().size()),
         resourceHeapVK.GetVkDescriptorSets().data(),
-        0,
-        nullptr
+        static_cast<std::uint32_t>(dynamicOffsets_.size()),
+        dynamicOffsets_.data()
     );
 }
 
-void VKCommandBuffer::SetGraphicsResourceHeap(ResourceHeap& resourceHeap, std::uint32_t firstSet)
+void VKCommandBuffer::SetGraphicsResourceHeap(ResourceHeap& resourceHeap, std::uint32_t firstSet, std::uint32_t numDynamicOffsets, const std::uint32_t* dynamicOffsets)
 {
     auto& resourceHeapVK = LLGL_CAST(VKResourceHeap&, resourceHeap);
-    BindResourceHeap(resourceHeapVK, VK_PIPELINE_BIND_POINT_GRAPHICS, firstSet);
+    BindResourceHeap(resourceHeapVK, VK_PIPELINE_BIND_POINT_GRAPHICS, firstSet, numDynamicOffsets, dynamicOffsets);
 }
 
-void VKCommandBuffer::SetComputeResourceHeap(ResourceHeap& resourceHeap, std::uint32_t firstSet)
+void VKCommandBuffer::SetComputeResourceHeap(ResourceHeap& resourceHeap, std::uint32_t firstSet, std::uint32_t numDynamicOffsets, const std::uint32_t* dynamicOffsets)
 {
     auto& resourceHeapVK = LLGL_CAST(VKResourceHeap&, resourceHeap);
-    BindResourceHeap(resourceHeapVK, VK_PIPELINE_BIND_POINT_COMPUTE, firstSet);
+    BindResourceHeap(resourceHeapVK, VK_PIPELINE_BIND_POINT_COMPUTE, firstSet, numDynamicOffsets, dynamicOffsets);
+    computeResourceHeap_ = (&resourceHeapVK);
+}
+
+/* ----- Inline Constants ----- */
+
+void VKCommandBuffer::SetInlineConstants(long stageFlags, std::uint32_t offset, const void* data, std::uint32_t dataSize)
+{
+    /* Push constants directly into the command buffer (can also be recorded within a render pass) */
+    if (boundPipelineLayout_ != VK_NULL_HANDLE)
+        vkCmdPushConstants(commandBuffer_, boundPipelineLayout_, VKPipelineLayout::GetVkShaderStageFlags(stageFlags), offset, dataSize, data);
 }
 
 /* ----- Render Passes ----- */
@@ -422,22 +590,33 @@ void VKCommandBuffer::BeginRenderPass(
     std::uint32_t       numClearValues,
     const ClearValue*   clearValues)
 {
+    const VKRenderPass*     renderPassVK            = nullptr;
+    VKDepthStencilBuffer*   depthStencilBufferVK    = nullptr;
+
     if (renderTarget.IsRenderContext())
     {
         /* Get Vulkan render context object */
         auto& renderContextVK = LLGL_CAST(VKRenderContext&, renderTarget);
 
+        /* Acquire swap-chain image lazily with the first render pass of the current frame */
+        renderContextVK.AcquireNextPresentImage();
+        swapChainContext_ = (&renderContextVK);
+
         /* Store information about framebuffer attachments */
         renderPass_             = renderContextVK.GetSwapChainRenderPass().GetVkRenderPass();
         framebuffer_            = renderContextVK.GetVkFramebuffer();
         framebufferExtent_      = renderContextVK.GetVkExtent();
         numColorAttachments_    = renderContextVK.GetNumColorAttachments();
         hasDSVAttachment_       = (renderContextVK.HasDepthAttachment() || renderContextVK.HasStencilAttachment());
+        renderPassVK            = (&renderContextVK.GetSwapChainRenderPass());
+        depthStencilBufferVK    = (&renderContextVK.GetDepthStencilBuffer());
     }
     else
     {
         /* Get Vulkan render target object and store its extent for subsequent commands */
         auto& renderTargetVK = LLGL_CAST(VKRenderTarget&, renderTarget);
+        renderTarget_       = (&renderTargetVK);
+        renderTargetPass_   = LLGL_CAST(const VKRenderPass*, renderTargetVK.GetRenderPass());
 
         /* Store information about framebuffer attachments */
         renderPass_             = renderTargetVK.GetVkRenderPass();
@@ -445,6 +624,8 @@ void VKCommandBuffer::BeginRenderPass(
         framebufferExtent_      = renderTargetVK.GetVkExtent();
         numColorAttachments_    = renderTargetVK.GetNumColorAttachments();
         hasDSVAttachment_       = (renderTargetVK.HasDepthAttachment() || renderTargetVK.HasStencilAttachment());
+        renderPassVK            = renderTargetPass_;
+        depthStencilBufferVK    = (&renderTargetVK.GetDepthStencilBuffer());
     }
 
     scissorRectInvalidated_ = true;
@@ -457,9 +638,12 @@ void VKCommandBuffer::BeginRenderPass(
     if (renderPass != nullptr)
     {
         /* Get native VkRenderPass object */
-        auto renderPassVK = LLGL_CAST(const VKRenderPass*, renderPass);
+        renderPassVK = LLGL_CAST(const VKRenderPass*, renderPass);
         renderPass_ = renderPassVK->GetVkRenderPass();
 
+        if (renderTarget_ != nullptr)
+            renderTargetPass_ = renderPassVK;
+
         /* Fill array of clear values */
         numClearValuesVK        = renderPassVK->GetNumClearValues();
         auto clearValuesMask    = renderPassVK->GetClearValuesMask();
@@ -499,6 +683,18 @@ void VKCommandBuffer::BeginRenderPass(
         }
     }
 
+    /* Record all pending barriers, since they can not be recorded within a render pass */
+    stateTracker_.ResolveStates();
+
+    if (renderTarget_ != nullptr)
+        AccessRenderTargetAttachments(*renderTarget_, *renderTargetPass_);
+
+    stateTracker_.FlushBarriers(commandBuffer_);
+    stateTracker_.SetRenderPassActive(true);
+
+    if (hasDSVAttachment_)
+        AccessDepthStencilBuffer(*depthStencilBufferVK, *renderPassVK);
+
     /* Record begin of render pass */
     VkRenderPassBeginInfo beginInfo;
     {
@@ -518,6 +714,16 @@ void VKCommandBuffer::EndRenderPass()
 {
     /* Record and of render pass */
     vkCmdEndRenderPass(commandBuffer_);
+    stateTracker_.SetRenderPassActive(false);
+
+    /* Restore layouts of render target attachments that were changed by the render pass */
+    if (renderTarget_ != nullptr)
+    {
+        RestoreRenderTargetAttachments(*renderTarget_, *renderTargetPass_);
+        stateTracker_.FlushBarriers(commandBuffer_);
+        renderTarget_       = nullptr;
+        renderTargetPass_   = nullptr;
+    }
 
     /* Reset render pass and framebuffer attributes */
     renderPass_     = VK_NULL_HANDLE;
@@ -533,6 +739,7 @@ void VKCommandBuffer::SetGraphicsPipeline(GraphicsPipeline& graphicsPipeline)
 
     /* Bind graphics pipeline */
     vkCmdBindPipeline(commandBuffer_, VK_PIPELINE_BIND_POINT_GRAPHICS, graphicsPipelineVK.GetVkPipeline());
+    boundPipelineLayout_ = graphicsPipelineVK.GetVkPipelineLayout();
 
     /* Scissor rectangle must be updated (if scissor test is disabled) */
     scissorEnabled_ = graphicsPipelineVK.IsScissorEnabled();
@@ -555,6 +762,7 @@ void VKCommandBuffer::SetComputePipeline(ComputePipeline& computePipeline)
 {
     auto& computePipelineVK = LLGL_CAST(VKComputePipeline&, computePipeline);
     vkCmdBindPipeline(commandBuffer_, VK_PIPELINE_BIND_POINT_COMPUTE, computePipelineVK.GetVkPipeline());
+    boundPipelineLayout_ = computePipelineVK.GetVkPipelineLayout();
 }
 
 /* ----- Queries ----- */
@@ -644,14 +852,69 @@ bool VKCommandBuffer::QueryPipelineStatisticsResult(Query& query, QueryPipelineS
     return true;
 }
 
+void VKCommandBuffer::CopyQueryResults(std::uint32_t numQueries, Query* const * queries, Buffer& dstBuffer, std::uint64_t dstOffset)
+{
+    auto& dstBufferVK = LLGL_CAST(VKBuffer&, dstBuffer);
+
+    stateTracker_.AccessBuffer(dstBufferVK, VK_ACCESS_TRANSFER_WRITE_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT);
+    stateTracker_.FlushBarriers(commandBuffer_);
+
+    /* Copy result of each query separately, since each query object has its own query pool */
+    for (std::uint32_t i = 0; i < numQueries; ++i)
+    {
+        auto& queryVK = LLGL_CAST(VKQuery&, *queries[i]);
+        vkCmdCopyQueryPoolResults(
+            commandBuffer_,
+            queryVK.GetVkQueryPool(),
+            0,
+            1,
+            dstBufferVK.GetVkBuffer(),
+            dstOffset + i * sizeof(std::uint64_t),
+            sizeof(std::uint64_t),
+            (VK_QUERY_RESULT_64_BIT | VK_QUERY_RESULT_WAIT_BIT)
+        );
+    }
+}
+
 void VKCommandBuffer::BeginRenderCondition(Query& query, const RenderConditionMode mode)
 {
     //todo
 }
 
+void VKCommandBuffer::BeginRenderCondition(Buffer& buffer, std::uint64_t offset, const RenderConditionMode mode)
+{
+    #ifdef VK_EXT_conditional_rendering
+
+    auto& bufferVK = LLGL_CAST(VKBuffer&, buffer);
+
+    /* Make predicate value visible; within a render pass, the buffer has already been resolved by BeginRenderPass */
+    stateTracker_.AccessBuffer(bufferVK, VK_ACCESS_CONDITIONAL_RENDERING_READ_BIT_EXT, VK_PIPELINE_STAGE_CONDITIONAL_RENDERING_BIT_EXT);
+    stateTracker_.FlushBarriers(commandBuffer_);
+
+    VkConditionalRenderingBeginInfoEXT beginInfo;
+    {
+        beginInfo.sType     = VK_STRUCTURE_TYPE_CONDITIONAL_RENDERING_BEGIN_INFO_EXT;
+        beginInfo.pNext     = nullptr;
+        beginInfo.buffer    = bufferVK.GetVkBuffer();
+        beginInfo.offset    = offset;
+        beginInfo.flags     = (mode >= RenderConditionMode::WaitInverted ? VK_CONDITIONAL_RENDERING_INVERTED_BIT_EXT : 0);
+    }
+    vkCmdBeginConditionalRenderingEXT(commandBuffer_, &beginInfo);
+
+    renderConditionActive_ = true;
+
+    #endif // /VK_EXT_conditional_rendering
+}
+
 void VKCommandBuffer::EndRenderCondition()
 {
-    //todo
+    #ifdef VK_EXT_conditional_rendering
+    if (renderConditionActive_)
+    {
+        vkCmdEndConditionalRenderingEXT(commandBuffer_);
+        renderConditionActive_ = false;
+    }
+    #endif // /VK_EXT_conditional_rendering
 }
 
 /* ----- Drawing ----- */
@@ -700,6 +963,12 @@ void VKCommandBuffer::DrawIndexedInstanced(std::uint32_t numIndices, std::uint32
 
 void VKCommandBuffer::Dispatch(std::uint32_t groupSizeX, std::uint32_t groupSizeY, std::uint32_t groupSizeZ)
 {
+    /* Declare resource accesses again, since storage buffers might have been written by a previous dispatch */
+    if (computeResourceHeap_ != nullptr)
+        AccessResourceHeap(*computeResourceHeap_);
+
+    stateTracker_.FlushBarriers(commandBuffer_);
+
     vkCmdDispatch(commandBuffer_, groupSizeX, groupSizeY, groupSizeZ);
 }
 
@@ -712,6 +981,11 @@ void VKCommandBuffer::AcquireNextBuffer()
     recordingFence_     = recordingFenceList_[commandBufferIndex_].Get();
 }
 
+void VKCommandBuffer::SetPendingSubmitFence(VkFence fence)
+{
+    pendingSubmitFenceList_[commandBufferIndex_] = fence;
+}
+
 
 /*
  * ======= Private: =======
@@ -751,6 +1025,7 @@ void VKCommandBuffer::CreateCommandBuffers(std::size_t bufferCount)
 void VKCommandBuffer::CreateRecordingFences(VkQueue graphicsQueue, std::size_t numFences)
 {
     recordingFenceList_.reserve(numFences);
+    pendingSubmitFenceList_.reserve(numFences);
 
     VkFenceCreateInfo createInfo;
     {
@@ -770,6 +1045,7 @@ void VKCommandBuffer::CreateRecordingFences(VkQueue graphicsQueue, std::size_t n
             /* Initial fence signal */
             vkQueueSubmit(graphicsQueue, 0, nullptr, fence);
         }
+        pendingSubmitFenceList_.push_back(fence.Get());
         recordingFenceList_.emplace_back(std::move(fence));
     }
 }
@@ -869,6 +1145,119 @@ void VKCommandBuffer::EndClearImage(VkImageMemoryBarrier& clearToPresentBarrier)
 
 #endif
 
+void VKCommandBuffer::AccessTransferTextures(
+    const VKTexture&    srcTextureVK,
+    const VKTexture&    dstTextureVK,
+    VkImageLayout&      srcLayout,
+    VkImageLayout&      dstLayout)
+{
+    if (&srcTextureVK == &dstTextureVK)
+    {
+        /* Copy within the same image requires the general layout, since the entire image is tracked */
+        srcLayout = VK_IMAGE_LAYOUT_GENERAL;
+        dstLayout = VK_IMAGE_LAYOUT_GENERAL;
+    }
+    else
+    {
+        srcLayout = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+        dstLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+    }
+
+    stateTracker_.AccessTexture(srcTextureVK, srcLayout, VK_ACCESS_TRANSFER_READ_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT);
+    stateTracker_.AccessTexture(dstTextureVK, dstLayout, VK_ACCESS_TRANSFER_WRITE_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT);
+    stateTracker_.FlushBarriers(commandBuffer_);
+}
+
+void VKCommandBuffer::AccessResourceHeap(const VKResourceHeap& resourceHeapVK)
+{
+    for (const auto& entry : resourceHeapVK.GetTextures())
+        stateTracker_.AccessTexture(*entry.texture, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, VK_ACCESS_SHADER_READ_BIT, entry.stageMask);
+    for (const auto& entry : resourceHeapVK.GetBuffers())
+        stateTracker_.AccessBuffer(*entry.buffer, entry.accessMask, entry.stageMask);
+}
+
+void VKCommandBuffer::AccessRenderTargetAttachments(const VKRenderTarget& renderTargetVK, const VKRenderPass& renderPassVK)
+{
+    const auto& attachments = renderTargetVK.GetColorAttachments();
+    const auto numAttachments = std::min(static_cast<std::uint32_t>(attachments.size()), static_cast<std::uint32_t>(renderPassVK.GetNumColorAttachments()));
+
+    for (std::uint32_t i = 0; i < numAttachments; ++i)
+    {
+        auto textureVK = LLGL_CAST(const VKTexture*, attachments[i].texture);
+
+        /* Keep current layout if the render pass discards the previous content, otherwise transition into its initial layout */
+        auto initialLayout = renderPassVK.GetInitialLayout(i);
+        if (initialLayout == VK_IMAGE_LAYOUT_UNDEFINED)
+            initialLayout = stateTracker_.GetTextureLayout(*textureVK);
+
+        stateTracker_.AccessTexture(
+            *textureVK,
+            initialLayout,
+            (VK_ACCESS_COLOR_ATTACHMENT_READ_BIT | VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT),
+            VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT
+        );
+    }
+}
+
+void VKCommandBuffer::AccessDepthStencilBuffer(VKDepthStencilBuffer& depthStencilBufferVK, const VKRenderPass& renderPassVK)
+{
+    const auto depthStencilIndex = renderPassVK.GetDepthStencilIndex();
+    if (depthStencilBufferVK.GetVkFormat() == VK_FORMAT_UNDEFINED || depthStencilIndex >= LLGL_MAX_NUM_ATTACHMENTS)
+        return;
+
+    /* Transition depth-stencil buffer if the render pass loads it from a layout it is not in, e.g. from its undefined content on first use */
+    const auto oldLayout        = depthStencilBufferVK.GetVkImageLayout();
+    const auto initialLayout    = renderPassVK.GetInitialLayout(depthStencilIndex);
+
+    if (initialLayout != VK_IMAGE_LAYOUT_UNDEFINED && initialLayout != oldLayout)
+    {
+        VkImageMemoryBarrier barrier;
+        {
+            barrier.sType                           = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+            barrier.pNext                           = nullptr;
+            barrier.srcAccessMask                   = (oldLayout == VK_IMAGE_LAYOUT_UNDEFINED ? 0 : VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT);
+            barrier.dstAccessMask                   = (VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_READ_BIT | VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT);
+            barrier.oldLayout                       = oldLayout;
+            barrier.newLayout                       = initialLayout;
+            barrier.srcQueueFamilyIndex             = VK_QUEUE_FAMILY_IGNORED;
+            barrier.dstQueueFamilyIndex             = VK_QUEUE_FAMILY_IGNORED;
+            barrier.image                           = depthStencilBufferVK.GetVkImage();
+            barrier.subresourceRange.aspectMask     = VKGetImageAspectByFormat(depthStencilBufferVK.GetVkFormat());
+            barrier.subresourceRange.baseMipLevel   = 0;
+            barrier.subresourceRange.levelCount     = 1;
+            barrier.subresourceRange.baseArrayLayer = 0;
+            barrier.subresourceRange.layerCount     = 1;
+        }
+        vkCmdPipelineBarrier(
+            commandBuffer_,
+            (oldLayout == VK_IMAGE_LAYOUT_UNDEFINED ? VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT : VK_PIPELINE_STAGE_LATE_FRAGMENT_TESTS_BIT),
+            VK_PIPELINE_STAGE_EARLY_FRAGMENT_TESTS_BIT,
+            0,
+            0, nullptr,
+            0, nullptr,
+            1, &barrier
+        );
+    }
+
+    /* Store layout the render pass leaves the depth-stencil buffer in for the next render pass that loads it */
+    depthStencilBufferVK.SetVkImageLayout(renderPassVK.GetFinalLayout(depthStencilIndex));
+}
+
+void VKCommandBuffer::RestoreRenderTargetAttachments(const VKRenderTarget& renderTargetVK, const VKRenderPass& renderPassVK)
+{
+    const auto& attachments = renderTargetVK.GetColorAttachments();
+    const auto numAttachments = std::min(static_cast<std::uint32_t>(attachments.size()), static_cast<std::uint32_t>(renderPassVK.GetNumColorAttachments()));
+
+    for (std::uint32_t i = 0; i < numAttachments; ++i)
+    {
+        auto textureVK = LLGL_CAST(const VKTexture*, attachments[i].texture);
+
+        /* Only the attachment subresource has been transitioned into the final layout by the render pass */
+        auto finalLayout = renderPassVK.GetFinalLayout(i);
+        if (finalLayout != stateTracker_.GetTextureLayout(*textureVK))
+            stateTracker_.RestoreTextureSubresource(*textureVK, attachments[i].mipLevel, attachments[i].arrayLayer, finalLayout);
+    }
+}
 
 } // /namespace LLGL
 
@@ -13,6 +13,7 @@
 #include "Vulkan.h"
 #include "VKPtr.h"
 #include "VKCore.h"
+#include "VKResourceStateTracker.h"
 
 #include <vector>
 
@@ -22,6 +23,11 @@ namespace LLGL
 
 
 class VKResourceHeap;
+class VKTexture;
+class VKRenderContext;
+class VKRenderTarget;
+class VKRenderPass;
+class VKDepthStencilBuffer;
 
 class VKCommandBuffer final : public CommandBuffer
 {
@@ -45,6 +51,22 @@ class VKCommandBuffer final : public CommandBuffer
 
         void UpdateBuffer(Buffer& dstBuffer, std::uint64_t dstOffset, const void* data, std::uint16_t dataSize) override;
         void CopyBuffer(Buffer& dstBuffer, std::uint64_t dstOffset, Buffer& srcBuffer, std::uint64_t srcOffset, std::uint64_t size) override;
+        void FillBuffer(Buffer& dstBuffer, std::uint64_t dstOffset, std::uint32_t value, std::uint64_t fillSize) override;
+
+        void CopyTexture(
+            Texture&                dstTexture,
+            const TextureLocation&  dstLocation,
+            Texture&                srcTexture,
+            const TextureRegion&    srcRegion
+        ) override;
+
+        void BlitTexture(
+            Texture&                dstTexture,
+            const TextureRegion&    dstRegion,
+            Texture&                srcTexture,
+            const TextureRegion&    srcRegion,
+            const SamplerFilter     filter      = SamplerFilter::Linear
+        ) override;
 
         /* ----- Configuration ----- */
 
@@ -84,8 +106,12 @@ class VKCommandBuffer final : public CommandBuffer
 
         /* ----- Resource Heaps ----- */
 
-        void SetGraphicsResourceHeap(ResourceHeap& resourceHeap, std::uint32_t firstSet = 0) override;
-        void SetComputeResourceHeap(ResourceHeap& resourceHeap, std::uint32_t firstSet = 0) override;
+        void SetGraphicsResourceHeap(ResourceHeap& resourceHeap, std::uint32_t firstSet = 0, std::uint32_t numDynamicOffsets = 0, const std::uint32_t* dynamicOffsets = nullptr) override;
+        void SetComputeResourceHeap(ResourceHeap& resourceHeap, std::uint32_t firstSet = 0, std::uint32_t numDynamicOffsets = 0, const std::uint32_t* dynamicOffsets = nullptr) override;
+
+        /* ----- Inline Constants ----- */
+
+        void SetInlineConstants(long stageFlags, std::uint32_t offset, const void* data, std::uint32_t dataSize) override;
 
         /* ----- Render Passes ----- */
 
@@ -111,7 +137,10 @@ class VKCommandBuffer final : public CommandBuffer
         bool QueryResult(Query& query, std::uint64_t& result) override;
         bool QueryPipelineStatisticsResult(Query& query, QueryPipelineStatistics& result) override;
 
+        void CopyQueryResults(std::uint32_t numQueries, Query* const * queries, Buffer& dstBuffer, std::uint64_t dstOffset) override;
+
         void BeginRenderCondition(Query& query, const RenderConditionMode mode) override;
+        void BeginRenderCondition(Buffer& buffer, std::uint64_t offset, const RenderConditionMode mode) override;
         void EndRenderCondition() override;
 
         /* ----- Drawing ----- */
@@ -149,6 +178,15 @@ class VKCommandBuffer final : public CommandBuffer
             return recordingFence_;
         }
 
+        // Sets the fence the current native command buffer has been submitted with, if it differs from the queue submit fence (e.g. for batched submissions).
+        void SetPendingSubmitFence(VkFence fence);
+
+        // Returns the render context whose swap-chain this command buffer renders into, or null if there is none.
+        inline VKRenderContext* GetSwapChainContext() const
+        {
+            return swapChainContext_;
+        }
+
     private:
 
         void CreateCommandPool(std::uint32_t queueFamilyIndex);
@@ -166,7 +204,31 @@ class VKCommandBuffer final : public CommandBuffer
         void EndClearImage(VkImageMemoryBarrier& clearToPresentBarrier);
         #endif
 
-        void BindResourceHeap(VKResourceHeap& resourceHeapVK, VkPipelineBindPoint bindingPoint, std::uint32_t firstSet);
+        void BindResourceHeap(
+            VKResourceHeap&         resourceHeapVK,
+            VkPipelineBindPoint     bindingPoint,
+            std::uint32_t           firstSet,
+            std::uint32_t           numDynamicOffsets,
+            const std::uint32_t*    dynamicOffsets
+        );
+
+        // Declares the transfer accesses of the source and destination textures, and returns the image layouts for the transfer command.
+        void AccessTransferTextures(
+            const VKTexture&    srcTextureVK,
+            const VKTexture&    dstTextureVK,
+            VkImageLayout&      srcLayout,
+            VkImageLayout&      dstLayout
+        );
+
+        // Declares the accesses of all resources in the specified heap to the resource state tracker.
+        void AccessResourceHeap(const VKResourceHeap& resourceHeapVK);
+
+        // Declares the accesses of all color attachments before the render pass begins, or restores their layouts after it ended.
+        void AccessRenderTargetAttachments(const VKRenderTarget& renderTargetVK, const VKRenderPass& renderPassVK);
+        void RestoreRenderTargetAttachments(const VKRenderTarget& renderTargetVK, const VKRenderPass& renderPassVK);
+
+        // Transitions the depth-stencil buffer into the initial layout of the render pass if it is loaded from a different layout, e.g. on its first use.
+        void AccessDepthStencilBuffer(VKDepthStencilBuffer& depthStencilBufferVK, const VKRenderPass& renderPassVK);
 
         const VKPtr<VkDevice>&          device_;
         VKPtr<VkCommandPool>            commandPool_;
@@ -177,6 +239,7 @@ class VKCommandBuffer final : public CommandBuffer
 
         std::vector<VKPtr<VkFence>>     recordingFenceList_;
         VkFence                         recordingFence_;
+        std::vector<VkFence>            pendingSubmitFenceList_;
 
         VkCommandBufferUsageFlags       usageFlags_                 = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
         VkClearColorValue               clearColor_                 = { 0.0f, 0.0f, 0.0f, 0.0f };
@@ -184,8 +247,12 @@ class VKCommandBuffer final : public CommandBuffer
 
         VkRenderPass                    renderPass_                 = VK_NULL_HANDLE;
         bool                            renderPassActive_           = false;
+        bool                            renderConditionActive_      = false;
         VkFramebuffer                   framebuffer_                = VK_NULL_HANDLE;
         VkExtent2D                      framebufferExtent_          = { 0, 0 };
+        VKRenderContext*                swapChainContext_           = nullptr;
+        const VKRenderTarget*           renderTarget_               = nullptr;
+        const VKRenderPass*             renderTargetPass_           = nullptr;
         std::uint32_t                   numColorAttachments_        = 0;
         bool                            hasDSVAttachment_           = false;
 
@@ -199,6 +266,11 @@ class VKCommandBuffer final : public CommandBuffer
         bool                            scissorEnabled_             = false;
         bool                            scissorRectInvalidated_     = true;
 
+        const VKResourceHeap*           computeResourceHeap_        = nullptr;
+        VkPipelineLayout                boundPipelineLayout_        = VK_NULL_HANDLE;   // Pipeline layout for push constants
+        std::vector<std::uint32_t>      dynamicOffsets_;                                // Dynamic offsets in the order of binding slots
+        VKResourceStateTracker          stateTracker_;
+
 };
 
 
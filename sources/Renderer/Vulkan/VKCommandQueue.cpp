@@ -7,18 +7,46 @@
 
 #include "VKCommandQueue.h"
 #include "VKCommandBuffer.h"
+#include "VKRenderContext.h"
 #include "RenderState/VKFence.h"
+#include "Buffer/VKBuffer.h"
+#include "Texture/VKTexture.h"
+#include "Memory/VKDeviceMemoryManager.h"
 #include "../CheckedCast.h"
+#include <algorithm>
+#include <stdexcept>
 
 
 namespace LLGL
 {
 
 
-VKCommandQueue::VKCommandQueue(const VKPtr<VkDevice>& device, VkQueue graphicsQueue) :
-    device_        { device        },
-    graphicsQueue_ { graphicsQueue }
+VKCommandQueue::VKCommandQueue(const VKPtr<VkDevice>& device, VkQueue graphicsQueue, VKDeviceMemoryManager& deviceMemoryMngr) :
+    device_              { device                     },
+    graphicsQueue_       { graphicsQueue              },
+    deviceMemoryMngr_    { deviceMemoryMngr           },
+    sparseBindSemaphore_ { device, vkDestroySemaphore },
+    sparseBindFence_     { device, vkDestroyFence     }
 {
+    /* Create semaphore to synchronize subsequent submissions with sparse binding operations */
+    VkSemaphoreCreateInfo semaphoreCreateInfo;
+    {
+        semaphoreCreateInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
+        semaphoreCreateInfo.pNext = nullptr;
+        semaphoreCreateInfo.flags = 0;
+    }
+    auto result = vkCreateSemaphore(device, &semaphoreCreateInfo, nullptr, sparseBindSemaphore_.ReleaseAndGetAddressOf());
+    VKThrowIfFailed(result, "failed to create Vulkan semaphore for sparse binding");
+
+    /* Create fence to determine when the memory of decommitted pages can be released */
+    VkFenceCreateInfo fenceCreateInfo;
+    {
+        fenceCreateInfo.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+        fenceCreateInfo.pNext = nullptr;
+        fenceCreateInfo.flags = 0;
+    }
+    result = vkCreateFence(device, &fenceCreateInfo, nullptr, sparseBindFence_.ReleaseAndGetAddressOf());
+    VKThrowIfFailed(result, "failed to create Vulkan fence for sparse binding");
 }
 
 /* ----- Command Buffers ----- */
@@ -29,23 +57,131 @@ void VKCommandQueue::Submit(CommandBuffer& commandBuffer)
 
     VkCommandBuffer commandBuffers[] = { commandBufferVK.GetVkCommandBuffer() };
 
+    /* Fold presentation semaphores into this submission if the command buffer renders into a swap-chain */
+    VkSemaphore waitSemaphores[3];
+    VkPipelineStageFlags waitStages[3] = { VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT, VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT };
+    VkSemaphore signalSemaphore = VK_NULL_HANDLE;
+    std::uint32_t numWaitSemaphores = 0;
+    VkFence fence = commandBufferVK.GetQueueSubmitFence();
+
+    if (auto swapChainContext = commandBufferVK.GetSwapChainContext())
+    {
+        /*
+        Signal a fence from the submit slots, since the render context waits for it with the next use of its current frame,
+        but the fence of the command buffer is already reset when the command buffer is recorded again
+        */
+        fence = AcquireSubmitSlot(0).fence;
+        commandBufferVK.SetPendingSubmitFence(fence);
+        numWaitSemaphores = swapChainContext->PrepareSwapChainSubmit(waitSemaphores, signalSemaphore, fence);
+    }
+
+    /* Wait for previous sparse binding operation */
+    if (sparseBindPending_)
+    {
+        waitStages[numWaitSemaphores]       = VK_PIPELINE_STAGE_ALL_COMMANDS_BIT;
+        waitSemaphores[numWaitSemaphores++] = sparseBindSemaphore_;
+        sparseBindPending_ = false;
+    }
+
     /* Submit command buffer to graphics queue */
     VkSubmitInfo submitInfo;
     {
         submitInfo.sType                = VK_STRUCTURE_TYPE_SUBMIT_INFO;
         submitInfo.pNext                = nullptr;
-        submitInfo.waitSemaphoreCount   = 0;
-        submitInfo.pWaitSemaphores      = nullptr;
-        submitInfo.pWaitDstStageMask    = 0;
+        submitInfo.waitSemaphoreCount   = numWaitSemaphores;
+        submitInfo.pWaitSemaphores      = waitSemaphores;
+        submitInfo.pWaitDstStageMask    = waitStages;
         submitInfo.commandBufferCount   = 1;
         submitInfo.pCommandBuffers      = commandBuffers;
-        submitInfo.signalSemaphoreCount = 0;
-        submitInfo.pSignalSemaphores    = nullptr;
+        submitInfo.signalSemaphoreCount = (signalSemaphore != VK_NULL_HANDLE ? 1 : 0);
+        submitInfo.pSignalSemaphores    = &signalSemaphore;
     }
-    auto result = vkQueueSubmit(graphicsQueue_, 1, &submitInfo, commandBufferVK.GetQueueSubmitFence());
+    auto result = vkQueueSubmit(graphicsQueue_, 1, &submitInfo, fence);
     VKThrowIfFailed(result, "failed to submit command buffer to Vulkan graphics queue");
 }
 
+void VKCommandQueue::Submit(std::uint32_t numCommandBuffers, CommandBuffer* const * commandBuffers)
+{
+    if (numCommandBuffers == 0)
+        return;
+
+    /* Submit all command buffers within a single batch */
+    auto& slot = AcquireSubmitSlot(0);
+
+    ReserveSubmitBatches(1, numCommandBuffers, 0);
+    {
+        auto& submitInfo = AppendSubmitBatch();
+        AppendSparseBindWaitSemaphore(submitInfo);
+        AppendCommandBuffers(submitInfo, slot.fence, numCommandBuffers, commandBuffers);
+    }
+    SubmitBatches(slot);
+}
+
+void VKCommandQueue::Submit(const SubmitDescriptor& desc)
+{
+    if (desc.batches.empty())
+        return;
+
+    /* Determine number of command buffers and dependencies, and validate that each batch only waits for previous batches */
+    const auto numBatches = desc.batches.size();
+
+    std::size_t numCommandBuffers   = 0;
+    std::size_t numDependencies     = 0;
+
+    for (std::size_t i = 0; i < numBatches; ++i)
+    {
+        const auto& batch = desc.batches[i];
+        for (auto waitBatch : batch.waitBatches)
+        {
+            if (waitBatch >= i)
+                throw std::invalid_argument("submit batch can only wait for previous batches");
+        }
+        numCommandBuffers   += batch.commandBuffers.size();
+        numDependencies     += batch.waitBatches.size();
+    }
+
+    /* Each dependency between two batches gets its own semaphore, since a semaphore can only be waited for once */
+    auto& slot = AcquireSubmitSlot(numDependencies);
+
+    ReserveSubmitBatches(numBatches, numCommandBuffers, numDependencies);
+
+    for (std::size_t i = 0, dependencyOffset = 0; i < numBatches; ++i)
+    {
+        const auto& batch = desc.batches[i];
+        auto& submitInfo = AppendSubmitBatch();
+
+        /* Wait for semaphores of previous batches, and let the first batch wait for the previous sparse binding operation */
+        if (i == 0)
+            AppendSparseBindWaitSemaphore(submitInfo);
+
+        for (std::size_t j = 0; j < batch.waitBatches.size(); ++j)
+            AppendWaitSemaphore(submitInfo, slot.semaphores[dependencyOffset + j], VK_PIPELINE_STAGE_ALL_COMMANDS_BIT);
+
+        AppendCommandBuffers(
+            submitInfo,
+            slot.fence,
+            static_cast<std::uint32_t>(batch.commandBuffers.size()),
+            batch.commandBuffers.data()
+        );
+
+        /* Signal semaphores of all subsequent batches that wait for this batch */
+        dependencyOffset += batch.waitBatches.size();
+
+        for (std::size_t k = i + 1, offset = dependencyOffset; k < numBatches; ++k)
+        {
+            const auto& waitBatches = desc.batches[k].waitBatches;
+            for (std::size_t j = 0; j < waitBatches.size(); ++j)
+            {
+                if (waitBatches[j] == i)
+                    AppendSignalSemaphore(submitInfo, slot.semaphores[offset + j]);
+            }
+            offset += waitBatches.size();
+        }
+    }
+
+    SubmitBatches(slot);
+}
+
 /* ----- Fences ----- */
 
 void VKCommandQueue::Submit(Fence& fence)
@@ -66,6 +202,466 @@ void VKCommandQueue::WaitIdle()
     vkQueueWaitIdle(graphicsQueue_);
 }
 
+/* ----- Sparse Resources ----- */
+
+void VKCommandQueue::UpdateTileMappings(Buffer& buffer, std::uint32_t numMappings, const BufferTileMapping* mappings)
+{
+    auto& bufferVK = LLGL_CAST(VKBuffer&, buffer);
+    auto& residency = bufferVK.GetSparseResidency();
+
+    /* Each page of a sparse buffer has the size of the memory alignment of the buffer */
+    auto pageRequirements = bufferVK.GetDeviceBuffer().GetRequirements();
+    pageRequirements.size = pageRequirements.alignment;
+
+    const auto pageSize = pageRequirements.alignment;
+
+    sparseMemoryBinds_.clear();
+
+    for (std::uint32_t i = 0; i < numMappings; ++i)
+    {
+        const auto& mapping = mappings[i];
+        for (auto offset = mapping.offset; offset < mapping.offset + mapping.size; offset += pageSize)
+        {
+            VkSparseMemoryBind bind;
+            {
+                bind.resourceOffset = offset;
+                bind.size           = pageSize;
+                bind.memory         = VK_NULL_HANDLE;
+                bind.memoryOffset   = 0;
+                bind.flags          = 0;
+            }
+
+            if (mapping.commit)
+            {
+                /* Bind memory of new page, and ignore pages that are already committed */
+                if (auto region = residency.CommitPage(deviceMemoryMngr_, offset, pageRequirements))
+                {
+                    bind.memory         = region->GetParentChunk()->GetVkDeviceMemory();
+                    bind.memoryOffset   = region->GetOffset();
+                    sparseMemoryBinds_.push_back(bind);
+                }
+            }
+            else if (auto region = residency.DecommitPage(offset))
+            {
+                /* Unbind memory of page, which is released after the binding operation has been completed */
+                sparseDecommittedRegions_.push_back(region);
+                sparseMemoryBinds_.push_back(bind);
+            }
+        }
+    }
+
+    if (sparseMemoryBinds_.empty())
+        return;
+
+    VkSparseBufferMemoryBindInfo bufferBindInfo;
+    {
+        bufferBindInfo.buffer       = bufferVK.GetVkBuffer();
+        bufferBindInfo.bindCount    = static_cast<std::uint32_t>(sparseMemoryBinds_.size());
+        bufferBindInfo.pBinds       = sparseMemoryBinds_.data();
+    }
+
+    VkBindSparseInfo bindInfo = {};
+    {
+        bindInfo.sType              = VK_STRUCTURE_TYPE_BIND_SPARSE_INFO;
+        bindInfo.bufferBindCount    = 1;
+        bindInfo.pBufferBinds       = &bufferBindInfo;
+    }
+    SubmitSparseBinding(bindInfo);
+}
+
+// Packs the tile coordinate of a sparse image into a single page key.
+static std::uint64_t MakeSparseImagePageKey(std::uint32_t mipLevel, std::uint32_t arrayLayer, std::uint32_t x, std::uint32_t y, std::uint32_t z)
+{
+    return
+    (
+        (static_cast<std::uint64_t>(mipLevel   & 0x1F  ) << 59) |
+        (static_cast<std::uint64_t>(arrayLayer & 0x7FF ) << 48) |
+        (static_cast<std::uint64_t>(z          & 0xFFFF) << 32) |
+        (static_cast<std::uint64_t>(y          & 0xFFFF) << 16) |
+        (static_cast<std::uint64_t>(x          & 0xFFFF)      )
+    );
+}
+
+// MIP-map level that is used in the page keys of the MIP-map tail.
+static const std::uint32_t g_sparseMipTailKeyLevel = 0x1F;
+
+void VKCommandQueue::UpdateTileMappings(Texture& texture, std::uint32_t numMappings, const TextureTileMapping* mappings)
+{
+    auto& textureVK = LLGL_CAST(VKTexture&, texture);
+    auto& residency = textureVK.GetSparseResidency();
+
+    const auto& sparseRequirements  = textureVK.GetSparseImageRequirements();
+    const auto& granularity         = sparseRequirements.formatProperties.imageGranularity;
+    const bool  singleMipTail       = ((sparseRequirements.formatProperties.flags & VK_SPARSE_IMAGE_FORMAT_SINGLE_MIPTAIL_BIT) != 0);
+
+    /* Each tile has the size of the memory alignment of the image; the MIP-map tail is bound as a whole */
+    auto pageRequirements = textureVK.GetSparseMemoryRequirements();
+    pageRequirements.size = pageRequirements.alignment;
+
+    auto mipTailRequirements = pageRequirements;
+    mipTailRequirements.size = sparseRequirements.imageMipTailSize;
+
+    sparseMemoryBinds_.clear();
+    sparseImageMemoryBinds_.clear();
+
+    for (std::uint32_t i = 0; i < numMappings; ++i)
+    {
+        const auto& mapping = mappings[i];
+        const auto& region  = mapping.region;
+
+        /* Determine texel volume and array layers (array layers are specified in the Y or Z component depending on the texture type) */
+        VkOffset3D      offset          { region.offset.x, region.offset.y, region.offset.z };
+        VkExtent3D      extent          { region.extent.width, region.extent.height, region.extent.depth };
+        std::uint32_t   baseArrayLayer  = 0;
+        std::uint32_t   numArrayLayers  = 1;
+
+        switch (textureVK.GetType())
+        {
+            case TextureType::Texture1DArray:
+                baseArrayLayer  = static_cast<std::uint32_t>(offset.y);
+                numArrayLayers  = extent.height;
+                offset.y        = 0;
+                extent.height   = 1;
+                break;
+
+            case TextureType::Texture2DArray:
+            case TextureType::TextureCube:
+            case TextureType::TextureCubeArray:
+                baseArrayLayer  = static_cast<std::uint32_t>(offset.z);
+                numArrayLayers  = extent.depth;
+                offset.z        = 0;
+                extent.depth    = 1;
+                break;
+
+            default:
+                break;
+        }
+
+        if (region.mipLevel >= sparseRequirements.imageMipTailFirstLod)
+        {
+            /* Bind MIP-map tail of each array layer as opaque memory (only once for all layers if the format has a single MIP-map tail) */
+            if (singleMipTail)
+            {
+                baseArrayLayer = 0;
+                numArrayLayers = 1;
+            }
+
+            for (auto arrayLayer = baseArrayLayer; arrayLayer < baseArrayLayer + numArrayLayers; ++arrayLayer)
+            {
+                const auto key = MakeSparseImagePageKey(g_sparseMipTailKeyLevel, arrayLayer, 0, 0, 0);
+
+                VkSparseMemoryBind bind;
+                {
+                    bind.resourceOffset = sparseRequirements.imageMipTailOffset + arrayLayer * sparseRequirements.imageMipTailStride;
+                    bind.size           = sparseRequirements.imageMipTailSize;
+                    bind.memory         = VK_NULL_HANDLE;
+                    bind.memoryOffset   = 0;
+                    bind.flags          = 0;
+                }
+
+                if (mapping.commit)
+                {
+                    if (auto memoryRegion = residency.CommitPage(deviceMemoryMngr_, key, mipTailRequirements))
+                    {
+                        bind.memory         = memoryRegion->GetParentChunk()->GetVkDeviceMemory();
+                        bind.memoryOffset   = memoryRegion->GetOffset();
+                        sparseMemoryBinds_.push_back(bind);
+                    }
+                }
+                else if (auto memoryRegion = residency.DecommitPage(key))
+                {
+                    sparseDecommittedRegions_.push_back(memoryRegion);
+                    sparseMemoryBinds_.push_back(bind);
+                }
+            }
+        }
+        else
+        {
+            /* Bind each tile within the region, clamped to the extent of the MIP-map level */
+            const auto& imageExtent = textureVK.GetVkExtent();
+
+            const VkExtent3D mipExtent
+            {
+                std::max(1u, imageExtent.width  >> region.mipLevel),
+                std::max(1u, imageExtent.height >> region.mipLevel),
+                std::max(1u, imageExtent.depth  >> region.mipLevel)
+            };
+
+            const auto beginX = static_cast<std::uint32_t>(offset.x) / granularity.width;
+            const auto beginY = static_cast<std::uint32_t>(offset.y) / granularity.height;
+            const auto beginZ = static_cast<std::uint32_t>(offset.z) / granularity.depth;
+
+            const auto endX = (std::min(static_cast<std::uint32_t>(offset.x) + extent.width,  mipExtent.width ) + granularity.width  - 1) / granularity.width;
+            const auto endY = (std::min(static_cast<std::uint32_t>(offset.y) + extent.height, mipExtent.height) + granularity.height - 1) / granularity.height;
+            const auto endZ = (std::min(static_cast<std::uint32_t>(offset.z) + extent.depth,  mipExtent.depth ) + granularity.depth  - 1) / granularity.depth;
+
+            for (auto arrayLayer = baseArrayLayer; arrayLayer < baseArrayLayer + numArrayLayers; ++arrayLayer)
+            {
+                for (auto z = beginZ; z < endZ; ++z)
+                {
+                    for (auto y = beginY; y < endY; ++y)
+                    {
+                        for (auto x = beginX; x < endX; ++x)
+                        {
+                            const auto key = MakeSparseImagePageKey(region.mipLevel, arrayLayer, x, y, z);
+
+                            VkSparseImageMemoryBind bind;
+                            {
+                                bind.subresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+                                bind.subresource.mipLevel   = region.mipLevel;
+                                bind.subresource.arrayLayer = arrayLayer;
+                                bind.offset.x               = static_cast<std::int32_t>(x * granularity.width);
+                                bind.offset.y               = static_cast<std::int32_t>(y * granularity.height);
+                                bind.offset.z               = static_cast<std::int32_t>(z * granularity.depth);
+                                bind.extent.width           = std::min(granularity.width,  mipExtent.width  - x * granularity.width );
+                                bind.extent.height          = std::min(granularity.height, mipExtent.height - y * granularity.height);
+                                bind.extent.depth           = std::min(granularity.depth,  mipExtent.depth  - z * granularity.depth );
+                                bind.memory                 = VK_NULL_HANDLE;
+                                bind.memoryOffset           = 0;
+                                bind.flags                  = 0;
+                            }
+
+                            if (mapping.commit)
+                            {
+                                if (auto memoryRegion = residency.CommitPage(deviceMemoryMngr_, key, pageRequirements))
+                                {
+                                    bind.memory         = memoryRegion->GetParentChunk()->GetVkDeviceMemory();
+                                    bind.memoryOffset   = memoryRegion->GetOffset();
+                                    sparseImageMemoryBinds_.push_back(bind);
+                                }
+                            }
+                            else if (auto memoryRegion = residency.DecommitPage(key))
+                            {
+                                sparseDecommittedRegions_.push_back(memoryRegion);
+                                sparseImageMemoryBinds_.push_back(bind);
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    if (sparseMemoryBinds_.empty() && sparseImageMemoryBinds_.empty())
+        return;
+
+    VkSparseImageOpaqueMemoryBindInfo opaqueBindInfo;
+    {
+        opaqueBindInfo.image        = textureVK.GetVkImage();
+        opaqueBindInfo.bindCount    = static_cast<std::uint32_t>(sparseMemoryBinds_.size());
+        opaqueBindInfo.pBinds       = sparseMemoryBinds_.data();
+    }
+
+    VkSparseImageMemoryBindInfo imageBindInfo;
+    {
+        imageBindInfo.image         = textureVK.GetVkImage();
+        imageBindInfo.bindCount     = static_cast<std::uint32_t>(sparseImageMemoryBinds_.size());
+        imageBindInfo.pBinds        = sparseImageMemoryBinds_.data();
+    }
+
+    VkBindSparseInfo bindInfo = {};
+    {
+        bindInfo.sType                  = VK_STRUCTURE_TYPE_BIND_SPARSE_INFO;
+        bindInfo.imageOpaqueBindCount   = (sparseMemoryBinds_.empty() ? 0 : 1);
+        bindInfo.pImageOpaqueBinds      = &opaqueBindInfo;
+        bindInfo.imageBindCount         = (sparseImageMemoryBinds_.empty() ? 0 : 1);
+        bindInfo.pImageBinds            = &imageBindInfo;
+    }
+    SubmitSparseBinding(bindInfo);
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+VKCommandQueue::SubmitSlot::SubmitSlot(const VKPtr<VkDevice>& device) :
+    fence { device, vkDestroyFence }
+{
+    VkFenceCreateInfo createInfo;
+    {
+        createInfo.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+        createInfo.pNext = nullptr;
+        createInfo.flags = 0;
+    }
+    auto result = vkCreateFence(device, &createInfo, nullptr, fence.ReleaseAndGetAddressOf());
+    VKThrowIfFailed(result, "failed to create Vulkan fence for batched submission");
+}
+
+VKCommandQueue::SubmitSlot& VKCommandQueue::AcquireSubmitSlot(std::size_t numSemaphores)
+{
+    /* Find submit slot whose previous submission has already been completed, or create a new one */
+    SubmitSlot* slot = nullptr;
+
+    for (auto& s : submitSlots_)
+    {
+        if (vkGetFenceStatus(device_, s.fence) == VK_SUCCESS)
+        {
+            vkResetFences(device_, 1, &(s.fence));
+            slot = &s;
+            break;
+        }
+    }
+
+    if (slot == nullptr)
+    {
+        submitSlots_.emplace_back(device_);
+        slot = &(submitSlots_.back());
+    }
+
+    /* Create additional semaphores for dependencies between batches */
+    while (slot->semaphores.size() < numSemaphores)
+    {
+        VKPtr<VkSemaphore> semaphore { device_, vkDestroySemaphore };
+        {
+            VkSemaphoreCreateInfo createInfo;
+            {
+                createInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
+                createInfo.pNext = nullptr;
+                createInfo.flags = 0;
+            }
+            auto result = vkCreateSemaphore(device_, &createInfo, nullptr, semaphore.ReleaseAndGetAddressOf());
+            VKThrowIfFailed(result, "failed to create Vulkan semaphore for batched submission");
+        }
+        slot->semaphores.emplace_back(std::move(semaphore));
+    }
+
+    return *slot;
+}
+
+void VKCommandQueue::ReserveSubmitBatches(std::size_t numBatches, std::size_t numCommandBuffers, std::size_t numDependencies)
+{
+    submitInfos_.clear();
+    submitCommandBuffers_.clear();
+    submitWaitSemaphores_.clear();
+    submitWaitStages_.clear();
+    submitSignalSemaphores_.clear();
+
+    /* Each command buffer can add up to two wait semaphores and one signal semaphore for its swap-chain, plus one wait semaphore for sparse binding */
+    submitInfos_.reserve(numBatches);
+    submitCommandBuffers_.reserve(numCommandBuffers);
+    submitWaitSemaphores_.reserve(numDependencies + numCommandBuffers * 2 + 1);
+    submitWaitStages_.reserve(numDependencies + numCommandBuffers * 2 + 1);
+    submitSignalSemaphores_.reserve(numDependencies + numCommandBuffers);
+}
+
+VkSubmitInfo& VKCommandQueue::AppendSubmitBatch()
+{
+    /* Pointers refer to the end of each array, which remains valid since the arrays have already been reserved */
+    VkSubmitInfo submitInfo;
+    {
+        submitInfo.sType                = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+        submitInfo.pNext                = nullptr;
+        submitInfo.waitSemaphoreCount   = 0;
+        submitInfo.pWaitSemaphores      = submitWaitSemaphores_.data() + submitWaitSemaphores_.size();
+        submitInfo.pWaitDstStageMask    = submitWaitStages_.data() + submitWaitStages_.size();
+        submitInfo.commandBufferCount   = 0;
+        submitInfo.pCommandBuffers      = submitCommandBuffers_.data() + submitCommandBuffers_.size();
+        submitInfo.signalSemaphoreCount = 0;
+        submitInfo.pSignalSemaphores    = submitSignalSemaphores_.data() + submitSignalSemaphores_.size();
+    }
+    submitInfos_.push_back(submitInfo);
+    return submitInfos_.back();
+}
+
+void VKCommandQueue::AppendCommandBuffers(VkSubmitInfo& submitInfo, VkFence fence, std::uint32_t numCommandBuffers, CommandBuffer* const * commandBuffers)
+{
+    submitSwapChainContexts_.clear();
+
+    for (std::uint32_t i = 0; i < numCommandBuffers; ++i)
+    {
+        auto& commandBufferVK = LLGL_CAST(VKCommandBuffer&, *commandBuffers[i]);
+
+        /* Append native command buffer and let it wait for the shared fence before it is recorded again */
+        submitCommandBuffers_.push_back(commandBufferVK.GetVkCommandBuffer());
+        ++submitInfo.commandBufferCount;
+        commandBufferVK.SetPendingSubmitFence(fence);
+
+        /* Fold presentation semaphores into this batch, but only once per swap-chain, since the batch signals them when all its command buffers are completed */
+        if (auto swapChainContext = commandBufferVK.GetSwapChainContext())
+        {
+            if (std::find(submitSwapChainContexts_.begin(), submitSwapChainContexts_.end(), swapChainContext) == submitSwapChainContexts_.end())
+            {
+                submitSwapChainContexts_.push_back(swapChainContext);
+
+                VkSemaphore waitSemaphores[2];
+                VkSemaphore signalSemaphore = VK_NULL_HANDLE;
+
+                auto numWaitSemaphores = swapChainContext->PrepareSwapChainSubmit(waitSemaphores, signalSemaphore, fence);
+
+                for (std::uint32_t j = 0; j < numWaitSemaphores; ++j)
+                    AppendWaitSemaphore(submitInfo, waitSemaphores[j], VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT);
+
+                AppendSignalSemaphore(submitInfo, signalSemaphore);
+            }
+        }
+    }
+}
+
+void VKCommandQueue::AppendWaitSemaphore(VkSubmitInfo& submitInfo, VkSemaphore semaphore, VkPipelineStageFlags stageMask)
+{
+    submitWaitSemaphores_.push_back(semaphore);
+    submitWaitStages_.push_back(stageMask);
+    ++submitInfo.waitSemaphoreCount;
+}
+
+void VKCommandQueue::AppendSignalSemaphore(VkSubmitInfo& submitInfo, VkSemaphore semaphore)
+{
+    submitSignalSemaphores_.push_back(semaphore);
+    ++submitInfo.signalSemaphoreCount;
+}
+
+void VKCommandQueue::SubmitBatches(SubmitSlot& slot)
+{
+    /* Submit all batches to graphics queue with a single fence */
+    auto result = vkQueueSubmit(graphicsQueue_, static_cast<std::uint32_t>(submitInfos_.size()), submitInfos_.data(), slot.fence);
+    VKThrowIfFailed(result, "failed to submit batched command buffers to Vulkan graphics queue");
+}
+
+void VKCommandQueue::AppendSparseBindWaitSemaphore(VkSubmitInfo& submitInfo)
+{
+    if (sparseBindPending_)
+    {
+        AppendWaitSemaphore(submitInfo, sparseBindSemaphore_, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT);
+        sparseBindPending_ = false;
+    }
+}
+
+void VKCommandQueue::SubmitSparseBinding(VkBindSparseInfo& bindInfo)
+{
+    /*
+    Signal semaphore for the next submission; if the previous binding operation has not been waited for yet,
+    this operation waits for it instead, which unsignals the semaphore before it is signaled again
+    */
+    VkSemaphore semaphore = sparseBindSemaphore_;
+    {
+        bindInfo.waitSemaphoreCount     = (sparseBindPending_ ? 1 : 0);
+        bindInfo.pWaitSemaphores        = &semaphore;
+        bindInfo.signalSemaphoreCount   = 1;
+        bindInfo.pSignalSemaphores      = &semaphore;
+    }
+
+    /* The fence is only required to release the memory of decommitted pages */
+    const bool releaseRegions = !sparseDecommittedRegions_.empty();
+
+    auto result = vkQueueBindSparse(graphicsQueue_, 1, &bindInfo, (releaseRegions ? sparseBindFence_.Get() : VK_NULL_HANDLE));
+    VKThrowIfFailed(result, "failed to bind sparse memory to Vulkan graphics queue");
+
+    sparseBindPending_ = true;
+
+    if (releaseRegions)
+    {
+        /* Wait until the pages have been unbound, then release their memory */
+        vkWaitForFences(device_, 1, &(sparseBindFence_), VK_TRUE, UINT64_MAX);
+        vkResetFences(device_, 1, &(sparseBindFence_));
+
+        for (auto region : sparseDecommittedRegions_)
+            deviceMemoryMngr_.Release(region);
+
+        sparseDecommittedRegions_.clear();
+    }
+}
+
 
 } // /namespace LLGL
 
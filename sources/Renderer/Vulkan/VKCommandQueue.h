@@ -14,12 +14,17 @@
 #include "VKPtr.h"
 #include "VKCore.h"
 #include "RenderState/VKFence.h"
+#include <vector>
 
 
 namespace LLGL
 {
 
 
+class VKRenderContext;
+class VKDeviceMemoryManager;
+class VKDeviceMemoryRegion;
+
 class VKCommandQueue final : public CommandQueue
 {
 
@@ -27,11 +32,13 @@ class VKCommandQueue final : public CommandQueue
 
         /* ----- Common ----- */
 
-        VKCommandQueue(const VKPtr<VkDevice>& device, VkQueue graphicsQueue);
+        VKCommandQueue(const VKPtr<VkDevice>& device, VkQueue graphicsQueue, VKDeviceMemoryManager& deviceMemoryMngr);
 
         /* ----- Command Buffers ----- */
 
         void Submit(CommandBuffer& commandBuffer) override;
+        void Submit(std::uint32_t numCommandBuffers, CommandBuffer* const * commandBuffers) override;
+        void Submit(const SubmitDescriptor& desc) override;
 
         /* ----- Fences ----- */
 
@@ -40,10 +47,66 @@ class VKCommandQueue final : public CommandQueue
         bool WaitFence(Fence& fence, std::uint64_t timeout) override;
         void WaitIdle() override;
 
+        /* ----- Sparse Resources ----- */
+
+        void UpdateTileMappings(Buffer& buffer, std::uint32_t numMappings, const BufferTileMapping* mappings) override;
+        void UpdateTileMappings(Texture& texture, std::uint32_t numMappings, const TextureTileMapping* mappings) override;
+
     private:
 
-        VkDevice    device_;
-        VkQueue     graphicsQueue_  = VK_NULL_HANDLE;
+        // Fence and semaphores of a batched submission. They can be reused once the fence has been signaled.
+        struct SubmitSlot
+        {
+            SubmitSlot(const VKPtr<VkDevice>& device);
+
+            VKPtr<VkFence>                  fence;
+            std::vector<VKPtr<VkSemaphore>> semaphores;
+        };
+
+        // Returns an unused submit slot with at least the specified number of semaphores.
+        SubmitSlot& AcquireSubmitSlot(std::size_t numSemaphores);
+
+        // Clears the submission arrays and reserves enough space, so their pointers remain valid until the submission.
+        void ReserveSubmitBatches(std::size_t numBatches, std::size_t numCommandBuffers, std::size_t numDependencies);
+
+        // Appends a new batch to the submission arrays.
+        VkSubmitInfo& AppendSubmitBatch();
+
+        // Appends the command buffers to the specified batch and folds the presentation semaphores of their swap-chains into it.
+        void AppendCommandBuffers(VkSubmitInfo& submitInfo, VkFence fence, std::uint32_t numCommandBuffers, CommandBuffer* const * commandBuffers);
+
+        void AppendWaitSemaphore(VkSubmitInfo& submitInfo, VkSemaphore semaphore, VkPipelineStageFlags stageMask);
+        void AppendSignalSemaphore(VkSubmitInfo& submitInfo, VkSemaphore semaphore);
+
+        // Submits all appended batches with the fence of the specified submit slot.
+        void SubmitBatches(SubmitSlot& slot);
+
+        // Appends the semaphore of the previous sparse binding operation to the specified batch, if it has not been waited for yet.
+        void AppendSparseBindWaitSemaphore(VkSubmitInfo& submitInfo);
+
+        // Submits the sparse binding operation and releases the memory of all decommitted pages once it has been completed.
+        void SubmitSparseBinding(VkBindSparseInfo& bindInfo);
+
+        const VKPtr<VkDevice>&              device_;
+        VkQueue                             graphicsQueue_  = VK_NULL_HANDLE;
+
+        std::vector<SubmitSlot>             submitSlots_;
+
+        std::vector<VkSubmitInfo>           submitInfos_;
+        std::vector<VkCommandBuffer>        submitCommandBuffers_;
+        std::vector<VkSemaphore>            submitWaitSemaphores_;
+        std::vector<VkPipelineStageFlags>   submitWaitStages_;
+        std::vector<VkSemaphore>            submitSignalSemaphores_;
+        std::vector<VKRenderContext*>       submitSwapChainContexts_;
+
+        VKDeviceMemoryManager&                          deviceMemoryMngr_;
+        VKPtr<VkSemaphore>                              sparseBindSemaphore_;
+        VKPtr<VkFence>                                  sparseBindFence_;
+        bool                                            sparseBindPending_      = false;   // Specifies whether the next submission must wait for the sparse bind semaphore
+
+        std::vector<VkSparseMemoryBind>                 sparseMemoryBinds_;
+        std::vector<VkSparseImageMemoryBind>            sparseImageMemoryBinds_;
+        std::vector<VKDeviceMemoryRegion*>              sparseDecommittedRegions_;
 
 };
 
@@ -98,6 +98,31 @@ VkBool32 VKBoolean(bool value)
     return (value ? VK_TRUE : VK_FALSE);
 }
 
+// see https://www.khronos.org/registry/vulkan/specs/1.1-extensions/man/html/VkFormat.html
+VkImageAspectFlags VKGetImageAspectByFormat(VkFormat format)
+{
+    switch (format)
+    {
+        case VK_FORMAT_D16_UNORM:           return VK_IMAGE_ASPECT_DEPTH_BIT;
+        case VK_FORMAT_X8_D24_UNORM_PACK32: return VK_IMAGE_ASPECT_DEPTH_BIT;
+        case VK_FORMAT_D32_SFLOAT:          return VK_IMAGE_ASPECT_DEPTH_BIT;
+        case VK_FORMAT_S8_UINT:             return VK_IMAGE_ASPECT_STENCIL_BIT;
+        case VK_FORMAT_D16_UNORM_S8_UINT:   return VK_IMAGE_ASPECT_DEPTH_BIT | VK_IMAGE_ASPECT_STENCIL_BIT;
+        case VK_FORMAT_D24_UNORM_S8_UINT:   return VK_IMAGE_ASPECT_DEPTH_BIT | VK_IMAGE_ASPECT_STENCIL_BIT;
+        case VK_FORMAT_D32_SFLOAT_S8_UINT:  return VK_IMAGE_ASPECT_DEPTH_BIT | VK_IMAGE_ASPECT_STENCIL_BIT;
+        default:                            return VK_IMAGE_ASPECT_COLOR_BIT;
+    }
+}
+
+VkImageAspectFlags VKGetSingleImageAspectByFormat(VkFormat format)
+{
+    auto aspectFlags = VKGetImageAspectByFormat(format);
+    if ((aspectFlags & VK_IMAGE_ASPECT_DEPTH_BIT) != 0)
+        return VK_IMAGE_ASPECT_DEPTH_BIT;
+    else
+        return aspectFlags;
+}
+
 
 /* ----- Query Functions ----- */
 
@@ -67,6 +67,12 @@ std::string VKApiVersionToString(std::uint32_t version);
 // Converts the boolean value into a VkBool322 value.
 VkBool32 VKBoolean(bool value);
 
+// Returns the image aspect flags for the specified format, i.e. depth and/or stencil aspect for depth-stencil formats and color aspect otherwise.
+VkImageAspectFlags VKGetImageAspectByFormat(VkFormat format);
+
+// Returns a single image aspect for the specified format, i.e. only the depth aspect for depth-stencil formats, as required for image views and buffer-image copies.
+VkImageAspectFlags VKGetSingleImageAspectByFormat(VkFormat format);
+
 
 
 /* ----- Query Functions ----- */
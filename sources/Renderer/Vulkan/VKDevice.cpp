@@ -48,16 +48,20 @@ void VKDevice::WaitIdle()
 
 // Device-only layers are deprecated -> set 'enabledLayerCount' and 'ppEnabledLayerNames' members to zero during device creation.
 // see https://www.khronos.org/registry/vulkan/specs/1.0/html/vkspec.html#extended-functionality-device-layer-deprecation
-void VKDevice::CreateLogicalDevice(VkPhysicalDevice physicalDevice, const VkPhysicalDeviceFeatures* features)
+void VKDevice::CreateLogicalDevice(
+    VkPhysicalDevice                    physicalDevice,
+    const VkPhysicalDeviceFeatures*     features,
+    const std::vector<const char*>&     optionalExtensions)
 {
-    const char* g_deviceExtensions[] =
+    std::vector<const char*> deviceExtensions
     {
         VK_KHR_SWAPCHAIN_EXTENSION_NAME,
         VK_KHR_MAINTENANCE1_EXTENSION_NAME,
     };
+    deviceExtensions.insert(deviceExtensions.end(), optionalExtensions.begin(), optionalExtensions.end());
 
     /* Initialize queue create description */
-    queueFamilyIndices_ = VKFindQueueFamilies(physicalDevice, (VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT | VK_QUEUE_TRANSFER_BIT));
+    queueFamilyIndices_ = VKFindQueueFamilies(physicalDevice, VKDevice::queueFlags);
 
     std::vector<VkDeviceQueueCreateInfo> queueCreateInfos;
     std::set<std::uint32_t> uniqueQueueFamilies = { queueFamilyIndices_.graphicsFamily, queueFamilyIndices_.presentFamily };
@@ -87,8 +91,8 @@ void VKDevice::CreateLogicalDevice(VkPhysicalDevice physicalDevice, const VkPhys
         createInfo.pQueueCreateInfos        = queueCreateInfos.data();
         createInfo.enabledLayerCount        = 0;
         createInfo.ppEnabledLayerNames      = nullptr;
-        createInfo.enabledExtensionCount    = (sizeof(g_deviceExtensions) / sizeof(g_deviceExtensions[0]));
-        createInfo.ppEnabledExtensionNames  = g_deviceExtensions;
+        createInfo.enabledExtensionCount    = static_cast<std::uint32_t>(deviceExtensions.size());
+        createInfo.ppEnabledExtensionNames  = deviceExtensions.data();
         createInfo.pEnabledFeatures         = features;
     }
     auto result = vkCreateDevice(physicalDevice, &createInfo, nullptr, device_.ReleaseAndGetAddressOf());
@@ -154,22 +158,12 @@ VkCommandBuffer VKDevice::AllocCommandBuffer(bool begin)
 
 void VKDevice::FlushCommandBuffer(VkCommandBuffer cmdBuffer, bool release)
 {
-    /* End command buffer record */
-    auto result = vkEndCommandBuffer(cmdBuffer);
-    VKThrowIfFailed(result, "failed to end recording Vulkan command buffer");
-
     /* Create fence to ensure the command buffer has finished execution */
     {
         VKFence fence { device_ };
 
         /* Submit command buffer to queue */
-        VkSubmitInfo submitInfo = {};
-        {
-            submitInfo.sType                = VK_STRUCTURE_TYPE_SUBMIT_INFO;
-            submitInfo.commandBufferCount   = 1;
-            submitInfo.pCommandBuffers      = (&cmdBuffer);
-        }
-        vkQueueSubmit(graphicsQueue_, 1, &submitInfo, fence.GetVkFence());
+        SubmitCommandBuffer(cmdBuffer, fence.GetVkFence());
 
         /* Wait for fence to be signaled */
         fence.Wait(device_, std::numeric_limits<std::uint64_t>::max());
@@ -177,13 +171,35 @@ void VKDevice::FlushCommandBuffer(VkCommandBuffer cmdBuffer, bool release)
 
     /* Release command buffer (if enabled) */
     if (release)
-        vkFreeCommandBuffers(device_, commandPool_, 1, &cmdBuffer);
+        FreeCommandBuffer(cmdBuffer);
+}
+
+void VKDevice::SubmitCommandBuffer(VkCommandBuffer cmdBuffer, VkFence fence)
+{
+    /* End command buffer record */
+    auto result = vkEndCommandBuffer(cmdBuffer);
+    VKThrowIfFailed(result, "failed to end recording Vulkan command buffer");
+
+    /* Submit command buffer to queue */
+    VkSubmitInfo submitInfo = {};
+    {
+        submitInfo.sType                = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+        submitInfo.commandBufferCount   = 1;
+        submitInfo.pCommandBuffers      = (&cmdBuffer);
+    }
+    result = vkQueueSubmit(graphicsQueue_, 1, &submitInfo, fence);
+    VKThrowIfFailed(result, "failed to submit Vulkan command buffer");
+}
+
+void VKDevice::FreeCommandBuffer(VkCommandBuffer cmdBuffer)
+{
+    vkFreeCommandBuffers(device_, commandPool_, 1, &cmdBuffer);
 }
 
 void VKDevice::TransitionImageLayout(
     VkCommandBuffer commandBuffer,
     VkImage         image,
-    VkFormat        /*format*/,
+    VkFormat        format,
     VkImageLayout   oldLayout,
     VkImageLayout   newLayout,
     std::uint32_t   numMipLevels,
@@ -201,7 +217,7 @@ void VKDevice::TransitionImageLayout(
         barrier.srcQueueFamilyIndex             = VK_QUEUE_FAMILY_IGNORED;
         barrier.dstQueueFamilyIndex             = VK_QUEUE_FAMILY_IGNORED;
         barrier.image                           = image;
-        barrier.subresourceRange.aspectMask     = VK_IMAGE_ASPECT_COLOR_BIT;
+        barrier.subresourceRange.aspectMask     = VKGetImageAspectByFormat(format);
         barrier.subresourceRange.baseMipLevel   = 0;
         barrier.subresourceRange.levelCount     = numMipLevels;
         barrier.subresourceRange.baseArrayLayer = 0;
@@ -226,6 +242,29 @@ void VKDevice::TransitionImageLayout(
         srcStageMask = VK_PIPELINE_STAGE_TRANSFER_BIT;
         dstStageMask = VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT;
     }
+    else if (oldLayout == VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL && newLayout == VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL)
+    {
+        /* Wait for all previous accesses to the image before it is overwritten */
+        barrier.srcAccessMask = VK_ACCESS_MEMORY_READ_BIT | VK_ACCESS_MEMORY_WRITE_BIT;
+        barrier.dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+        srcStageMask = VK_PIPELINE_STAGE_ALL_COMMANDS_BIT;
+        dstStageMask = VK_PIPELINE_STAGE_TRANSFER_BIT;
+    }
+    else if (oldLayout == VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL && newLayout == VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL)
+    {
+        /* Wait for all previous writes to the image, e.g. by render passes or compute shaders */
+        barrier.srcAccessMask = VK_ACCESS_MEMORY_WRITE_BIT;
+        barrier.dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
+        srcStageMask = VK_PIPELINE_STAGE_ALL_COMMANDS_BIT;
+        dstStageMask = VK_PIPELINE_STAGE_TRANSFER_BIT;
+    }
+    else if (oldLayout == VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL && newLayout == VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL)
+    {
+        barrier.srcAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
+        barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
+        srcStageMask = VK_PIPELINE_STAGE_TRANSFER_BIT;
+        dstStageMask = VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT;
+    }
 
     /* Record image barrier command */
     vkCmdPipelineBarrier(commandBuffer, srcStageMask, dstStageMask, 0, 0, nullptr, 0, nullptr, 1, &barrier);
@@ -268,20 +307,96 @@ void VKDevice::CopyBufferToImage(
     VkImage             dstImage,
     const VkExtent3D&   extent,
     std::uint32_t       numLayers)
+{
+    VkImageSubresourceLayers subresource;
+    {
+        subresource.aspectMask      = VK_IMAGE_ASPECT_COLOR_BIT;
+        subresource.mipLevel        = 0;
+        subresource.baseArrayLayer  = 0;
+        subresource.layerCount      = numLayers;
+    }
+    CopyBufferToImage(commandBuffer, srcBuffer, dstImage, subresource, { 0, 0, 0 }, extent);
+}
+
+void VKDevice::CopyBufferToImage(
+    VkCommandBuffer                 commandBuffer,
+    VkBuffer                        srcBuffer,
+    VkImage                         dstImage,
+    const VkImageSubresourceLayers& subresource,
+    const VkOffset3D&               offset,
+    const VkExtent3D&               extent)
+{
+    VkBufferImageCopy region;
+    {
+        region.bufferOffset         = 0;
+        region.bufferRowLength      = 0;
+        region.bufferImageHeight    = 0;
+        region.imageSubresource     = subresource;
+        region.imageOffset          = offset;
+        region.imageExtent          = extent;
+    }
+    vkCmdCopyBufferToImage(commandBuffer, srcBuffer, dstImage, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &region);
+}
+
+void VKDevice::CopyImageToBuffer(
+    VkCommandBuffer     commandBuffer,
+    VkImage             srcImage,
+    VkBuffer            dstBuffer,
+    VkImageAspectFlags  aspectMask,
+    const VkExtent3D&   extent,
+    std::uint32_t       mipLevel,
+    std::uint32_t       numLayers)
 {
     VkBufferImageCopy region;
     {
         region.bufferOffset                     = 0;
         region.bufferRowLength                  = 0;
         region.bufferImageHeight                = 0;
-        region.imageSubresource.aspectMask      = VK_IMAGE_ASPECT_COLOR_BIT;
-        region.imageSubresource.mipLevel        = 0;
+        region.imageSubresource.aspectMask      = aspectMask;
+        region.imageSubresource.mipLevel        = mipLevel;
         region.imageSubresource.baseArrayLayer  = 0;
         region.imageSubresource.layerCount      = numLayers;
         region.imageOffset                      = { 0, 0, 0 };
         region.imageExtent                      = extent;
     }
-    vkCmdCopyBufferToImage(commandBuffer, srcBuffer, dstImage, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &region);
+    vkCmdCopyImageToBuffer(commandBuffer, srcImage, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, dstBuffer, 1, &region);
+}
+
+void VKDevice::ClearColorImage(
+    VkCommandBuffer             commandBuffer,
+    VkImage                     image,
+    const VkClearColorValue&    clearColor,
+    std::uint32_t               numMipLevels,
+    std::uint32_t               numArrayLayers)
+{
+    VkImageSubresourceRange range;
+    {
+        range.aspectMask        = VK_IMAGE_ASPECT_COLOR_BIT;
+        range.baseMipLevel      = 0;
+        range.levelCount        = numMipLevels;
+        range.baseArrayLayer    = 0;
+        range.layerCount        = numArrayLayers;
+    }
+    vkCmdClearColorImage(commandBuffer, image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, &clearColor, 1, &range);
+}
+
+void VKDevice::ClearDepthStencilImage(
+    VkCommandBuffer                 commandBuffer,
+    VkImage                         image,
+    VkFormat                        format,
+    const VkClearDepthStencilValue& clearDepthStencil,
+    std::uint32_t                   numMipLevels,
+    std::uint32_t                   numArrayLayers)
+{
+    VkImageSubresourceRange range;
+    {
+        range.aspectMask        = VKGetImageAspectByFormat(format);
+        range.baseMipLevel      = 0;
+        range.levelCount        = numMipLevels;
+        range.baseArrayLayer    = 0;
+        range.layerCount        = numArrayLayers;
+    }
+    vkCmdClearDepthStencilImage(commandBuffer, image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, &clearDepthStencil, 1, &range);
 }
 
 void VKDevice::GenerateMips(
@@ -13,6 +13,7 @@
 #include "VKPtr.h"
 #include "VKCore.h"
 #include "Buffer/VKDeviceBuffer.h"
+#include <vector>
 
 
 namespace LLGL
@@ -24,6 +25,9 @@ class VKDevice
 
     public:
 
+        // Queue capabilities that are requested for the graphics queue family of the logical device.
+        static const VkQueueFlags queueFlags = (VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT | VK_QUEUE_TRANSFER_BIT);
+
         /* ----- Common ----- */
 
         VKDevice();
@@ -31,7 +35,11 @@ class VKDevice
 
         VKDevice& operator = (VKDevice&& device);
 
-        void CreateLogicalDevice(VkPhysicalDevice physicalDevice, const VkPhysicalDeviceFeatures* features);
+        void CreateLogicalDevice(
+            VkPhysicalDevice                    physicalDevice,
+            const VkPhysicalDeviceFeatures*     features,
+            const std::vector<const char*>&     optionalExtensions
+        );
 
         // Blocks until the VkDevice becomes idle.
         void WaitIdle();
@@ -45,6 +53,10 @@ class VKDevice
         VkCommandBuffer AllocCommandBuffer(bool begin = true);
         void FlushCommandBuffer(VkCommandBuffer cmdBuffer, bool release = true);
 
+        // Ends recording of the specified command buffer and submits it to the graphics queue without waiting for its completion.
+        void SubmitCommandBuffer(VkCommandBuffer cmdBuffer, VkFence fence);
+        void FreeCommandBuffer(VkCommandBuffer cmdBuffer);
+
         /* ----- Buffer/Image operatons ----- */
 
         void TransitionImageLayout(
@@ -82,6 +94,42 @@ class VKDevice
             std::uint32_t       numLayers
         );
 
+        void CopyBufferToImage(
+            VkCommandBuffer                 commandBuffer,
+            VkBuffer                        srcBuffer,
+            VkImage                         dstImage,
+            const VkImageSubresourceLayers& subresource,
+            const VkOffset3D&               offset,
+            const VkExtent3D&               extent
+        );
+
+        void CopyImageToBuffer(
+            VkCommandBuffer     commandBuffer,
+            VkImage             srcImage,
+            VkBuffer            dstBuffer,
+            VkImageAspectFlags  aspectMask,
+            const VkExtent3D&   extent,
+            std::uint32_t       mipLevel,
+            std::uint32_t       numLayers
+        );
+
+        void ClearColorImage(
+            VkCommandBuffer             commandBuffer,
+            VkImage                     image,
+            const VkClearColorValue&    clearColor,
+            std::uint32_t               numMipLevels,
+            std::uint32_t               numArrayLayers
+        );
+
+        void ClearDepthStencilImage(
+            VkCommandBuffer                 commandBuffer,
+            VkImage                         image,
+            VkFormat                        format,
+            const VkClearDepthStencilValue& clearDepthStencil,
+            std::uint32_t                   numMipLevels,
+            std::uint32_t                   numArrayLayers
+        );
+
         void GenerateMips(
             VkCommandBuffer     commandBuffer,
             VkImage             image,
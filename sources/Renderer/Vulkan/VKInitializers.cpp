@@ -12,11 +12,11 @@ namespace LLGL
 {
 
 
-void InitVkBufferCreateInfo(VkBufferCreateInfo& createInfo, VkDeviceSize size, VkBufferUsageFlags usage)
+void InitVkBufferCreateInfo(VkBufferCreateInfo& createInfo, VkDeviceSize size, VkBufferUsageFlags usage, VkBufferCreateFlags flags)
 {
     createInfo.sType                    = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
     createInfo.pNext                    = nullptr;
-    createInfo.flags                    = 0;
+    createInfo.flags                    = flags;
     createInfo.size                     = size;
     createInfo.usage                    = usage;
     createInfo.sharingMode              = VK_SHARING_MODE_EXCLUSIVE;
@@ -16,7 +16,7 @@ namespace LLGL
 {
 
 
-void InitVkBufferCreateInfo(VkBufferCreateInfo& createInfo, VkDeviceSize size, VkBufferUsageFlags usage);
+void InitVkBufferCreateInfo(VkBufferCreateInfo& createInfo, VkDeviceSize size, VkBufferUsageFlags usage, VkBufferCreateFlags flags = 0);
 VkBufferCreateInfo MakeVkBufferCreateInfo(VkDeviceSize size, VkBufferUsageFlags usage);
 
 
@@ -7,6 +7,7 @@
 
 #include "VKPhysicalDevice.h"
 #include "VKCore.h"
+#include "VKTypes.h"
 #include "RenderState/VKGraphicsPipeline.h"
 #include "../../Core/Vendor.h"
 #include <string>
@@ -47,6 +48,25 @@ static bool IsPhysicalDeviceSuitable(VkPhysicalDevice physicalDevice)
     return false;
 }
 
+static std::vector<Format> GetSupportedTextureFormats(VkPhysicalDevice physicalDevice)
+{
+    std::vector<Format> textureFormats;
+
+    /* Add all formats that can be sampled with optimal tiling (e.g. block-compressed formats are optional) */
+    for (auto i = static_cast<int>(Format::R8UNorm); i <= static_cast<int>(Format::ETC2RGBA8UNorm); ++i)
+    {
+        const auto format = static_cast<Format>(i);
+
+        VkFormatProperties formatProperties;
+        vkGetPhysicalDeviceFormatProperties(physicalDevice, VKTypes::Map(format), &formatProperties);
+
+        if ((formatProperties.optimalTilingFeatures & VK_FORMAT_FEATURE_SAMPLED_IMAGE_BIT) != 0)
+            textureFormats.push_back(format);
+    }
+
+    return textureFormats;
+}
+
 bool VKPhysicalDevice::PickPhysicalDevice(VkInstance instance)
 {
     /* Query all physical devices and pick suitable */
@@ -88,7 +108,7 @@ void VKPhysicalDevice::QueryDeviceProperties(
     caps.screenOrigin                               = ScreenOrigin::UpperLeft;
     caps.clippingRange                              = ClippingRange::ZeroToOne;
     caps.shadingLanguages                           = { ShadingLanguage::SPIRV, ShadingLanguage::SPIRV_100 };
-    //caps.textureFormats                             = ; //???
+    caps.textureFormats                             = GetSupportedTextureFormats(physicalDevice_);
 
     /* Query features */
     caps.features.hasRenderTargets                  = true;
@@ -110,6 +130,13 @@ void VKPhysicalDevice::QueryDeviceProperties(
     caps.features.hasConservativeRasterization      = false;
     caps.features.hasStreamOutputs                  = false;
     caps.features.hasLogicOp                        = true;
+    caps.features.hasSparseBuffers                  = (sparseBindingQueue_ && features_.sparseResidencyBuffer != VK_FALSE);
+    caps.features.hasSparseTextures                 = (sparseBindingQueue_ && features_.sparseResidencyImage2D != VK_FALSE);
+    caps.features.hasTextureViews                   = true;
+    caps.features.hasTextureViewSwizzle             = true;
+    caps.features.hasRenderConditionBuffers         = conditionalRendering_;
+    caps.features.hasQueryResultBuffers             = true;
+    caps.features.hasAsyncReadbacks                 = true;
 
     /* Query limits */
     caps.limits.lineWidthRange[0]                   = limits.lineWidthRange[0];
@@ -133,6 +160,9 @@ void VKPhysicalDevice::QueryDeviceProperties(
     caps.limits.maxViewportSize[1]                  = limits.maxViewportDimensions[1];
     caps.limits.maxBufferSize                       = std::numeric_limits<VkDeviceSize>::max();
     caps.limits.maxConstantBufferSize               = limits.maxUniformBufferRange;
+    caps.limits.minConstantBufferOffsetAlignment    = static_cast<std::uint32_t>(limits.minUniformBufferOffsetAlignment);
+    caps.limits.maxInlineConstantsSize              = limits.maxPushConstantsSize;
+    caps.limits.sparsePageSize                      = 0; // Queried with the logical device (see VKRenderSystem::QuerySparsePageSize)
 
     /* Store graphics pipeline spcific limitations */
     pipelineLimits.lineWidthRange[0]    = limits.lineWidthRange[0];
@@ -142,8 +172,16 @@ void VKPhysicalDevice::QueryDeviceProperties(
 
 VKDevice VKPhysicalDevice::CreateLogicalDevice()
 {
+    /* Enable optional extensions that are supported by the physical device */
+    std::vector<const char*> optionalExtensions;
+
+    #ifdef VK_EXT_conditional_rendering
+    if (conditionalRendering_)
+        optionalExtensions.push_back(VK_EXT_CONDITIONAL_RENDERING_EXTENSION_NAME);
+    #endif
+
     VKDevice device;
-    device.CreateLogicalDevice(physicalDevice_, &features_);
+    device.CreateLogicalDevice(physicalDevice_, &features_, optionalExtensions);
     return device;
 }
 
@@ -162,6 +200,23 @@ void VKPhysicalDevice::QueryDeviceProperties()
     /* Query physical device features and memory propertiers */
     vkGetPhysicalDeviceMemoryProperties(physicalDevice_, &memoryProperties_);
     vkGetPhysicalDeviceFeatures(physicalDevice_, &features_);
+
+    /* Query support of optional extensions */
+    #ifdef VK_EXT_conditional_rendering
+    conditionalRendering_ = CheckDeviceExtensionSupport(physicalDevice_, { VK_EXT_CONDITIONAL_RENDERING_EXTENSION_NAME });
+    #endif
+
+    /* Sparse bindings are submitted to the graphics queue, so its queue family must support them */
+    sparseBindingQueue_ = false;
+    if (features_.sparseBinding != VK_FALSE)
+    {
+        auto queueFamilyIndices = VKFindQueueFamilies(physicalDevice_, VKDevice::queueFlags);
+        if (queueFamilyIndices.graphicsFamily != QueueFamilyIndices::invalidIndex)
+        {
+            auto queueFamilies = VKQueryQueueFamilyProperties(physicalDevice_);
+            sparseBindingQueue_ = ((queueFamilies[queueFamilyIndices.graphicsFamily].queueFlags & VK_QUEUE_SPARSE_BINDING_BIT) != 0);
+        }
+    }
 }
 
 
@@ -65,6 +65,12 @@ class VKPhysicalDevice
             return features_;
         }
 
+        // Returns true if the physical device supports the "VK_EXT_conditional_rendering" extension.
+        inline bool SupportsConditionalRendering() const
+        {
+            return conditionalRendering_;
+        }
+
     private:
 
         void QueryDeviceProperties();
@@ -73,6 +79,8 @@ class VKPhysicalDevice
 
         VkPhysicalDeviceMemoryProperties    memoryProperties_;
         VkPhysicalDeviceFeatures            features_;
+        bool                                conditionalRendering_   = false;
+        bool                                sparseBindingQueue_     = false;
 
 };
 
@@ -8,6 +8,7 @@
 #include "VKRenderContext.h"
 #include "VKCore.h"
 #include "VKTypes.h"
+#include "Ext/VKExtensions.h"
 #include "Memory/VKDeviceMemoryManager.h"
 #include <LLGL/Platform/NativeHandle.h>
 #include "../../Core/Helper.h"
@@ -25,13 +26,17 @@ static const std::vector<const char*> g_deviceExtensions
     VK_KHR_SWAPCHAIN_EXTENSION_NAME
 };
 
+static const std::uint32_t g_maxNumFramesInFlight = 3;
+
 VKRenderContext::VKRenderContext(
     const VKPtr<VkInstance>& instance,
     VkPhysicalDevice physicalDevice,
     const VKPtr<VkDevice>& device,
     VKDeviceMemoryManager& deviceMemoryMngr,
     RenderContextDescriptor desc,
-    const std::shared_ptr<Surface>& surface) :
+    const std::shared_ptr<Surface>& surface,
+    std::uint32_t numFramesInFlight,
+    bool headlessSurface) :
         RenderContext        { desc.videoMode, desc.vsync    },
         instance_            { instance                      },
         physicalDevice_      { physicalDevice                },
@@ -40,12 +45,16 @@ VKRenderContext::VKRenderContext(
         surface_             { instance, vkDestroySurfaceKHR },
         swapChain_           { device, vkDestroySwapchainKHR },
         swapChainRenderPass_ { device                        },
-        depthStencilBuffer_  { device                        }
+        depthStencilBuffer_  { device                        },
+        headlessSurface_     { headlessSurface               }
 {
     SetOrCreateSurface(surface, desc.videoMode, nullptr);
     desc.videoMode = GetVideoMode();
 
-    CreatePresentSemaphores();
+    /* Clamp number of frames the CPU can record ahead of the GPU */
+    numFramesInFlight_ = std::max(1u, std::min(numFramesInFlight, g_maxNumFramesInFlight));
+
+    CreatePresentSyncObjects();
     CreateGpuSurface();
 
     if (desc.videoMode.depthBits > 0 || desc.videoMode.stencilBits > 0)
@@ -57,51 +66,51 @@ VKRenderContext::VKRenderContext(
 
 VKRenderContext::~VKRenderContext()
 {
+    /* Wait until all frames in flight have been completed before their semaphores and fences are destroyed */
+    if (graphicsQueue_ != VK_NULL_HANDLE)
+        vkQueueWaitIdle(graphicsQueue_);
     ReleaseDepthStencilBuffer();
 }
 
 void VKRenderContext::Present()
 {
-    /* Initialize semaphores */
-    VkSemaphore waitSemaphorse[] = { imageAvailableSemaphore_ };
-    VkPipelineStageFlags waitStages[] = { VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT };
-    VkSemaphore signalSemaphores[] = { renderFinishedSemaphore_ };
+    /* Acquire swap-chain image if nothing has been rendered into the swap-chain during this frame */
+    AcquireNextPresentImage();
 
-    /* Submit signal semaphore to graphics queue */
-    VkSubmitInfo submitInfo;
-    {
-        submitInfo.sType                = VK_STRUCTURE_TYPE_SUBMIT_INFO;
-        submitInfo.pNext                = nullptr;
-        submitInfo.waitSemaphoreCount   = 1;
-        submitInfo.pWaitSemaphores      = waitSemaphorse;
-        submitInfo.pWaitDstStageMask    = waitStages;
-        submitInfo.commandBufferCount   = 0;
-        submitInfo.pCommandBuffers      = nullptr;
-        submitInfo.signalSemaphoreCount = 1;
-        submitInfo.pSignalSemaphores    = signalSemaphores;
-    }
-    auto result = vkQueueSubmit(graphicsQueue_, 1, &submitInfo, VK_NULL_HANDLE);
-    VKThrowIfFailed(result, "failed to submit semaphore to Vulkan graphics queue");
+    /*
+    Only submit semaphores separately if no command buffer submission has already signaled them,
+    otherwise the fence of the last submission into the swap-chain already guards the current frame
+    */
+    if (!renderFinishedSignaled_)
+        SubmitPresentSemaphores();
 
     /* Present result on screen */
     VkSwapchainKHR swapChains[] = { swapChain_ };
+    VkSemaphore waitSemaphores[] = { renderFinishedSemaphores_[currentFrame_] };
 
     VkPresentInfoKHR presentInfo;
     {
         presentInfo.sType               = VK_STRUCTURE_TYPE_PRESENT_INFO_KHR;
         presentInfo.pNext               = nullptr;
         presentInfo.waitSemaphoreCount  = 1;
-        presentInfo.pWaitSemaphores     = signalSemaphores;
+        presentInfo.pWaitSemaphores     = waitSemaphores;
         presentInfo.swapchainCount      = 1;
         presentInfo.pSwapchains         = swapChains;
         presentInfo.pImageIndices       = &presentImageIndex_;
         presentInfo.pResults            = nullptr;
     }
-    result = vkQueuePresentKHR(presentQueue_, &presentInfo);
-    VKThrowIfFailed(result, "failed to present Vulkan graphics queue");
-
-    /* Get image index for next presentation */
-    AcquireNextPresentImage();
+    auto result = vkQueuePresentKHR(presentQueue_, &presentInfo);
+
+    /* Move on to next frame in flight; its swap-chain image is acquired lazily with the first render pass */
+    presentImageAcquired_   = false;
+    renderFinishedSignaled_ = false;
+    currentFrame_           = (currentFrame_ + 1) % numFramesInFlight_;
+
+    /* Recreate swap-chain if it no longer matches the surface (e.g. after the window has been resized) */
+    if (result == VK_ERROR_OUT_OF_DATE_KHR || result == VK_SUBOPTIMAL_KHR || swapChainSuboptimal_)
+        RecreateSwapChain();
+    else
+        VKThrowIfFailed(result, "failed to present Vulkan graphics queue");
 }
 
 Format VKRenderContext::QueryColorFormat() const
@@ -126,6 +135,79 @@ bool VKRenderContext::HasDepthStencilBuffer() const
     return (depthStencilBuffer_.GetVkFormat() != VK_FORMAT_UNDEFINED);
 }
 
+void VKRenderContext::AcquireNextPresentImage()
+{
+    if (!presentImageAcquired_)
+    {
+        /* Wait until the GPU has completed the frame that previously used the semaphores of the current frame */
+        if (frameSubmitFences_[currentFrame_] != VK_NULL_HANDLE)
+            vkWaitForFences(device_, 1, &frameSubmitFences_[currentFrame_], VK_TRUE, UINT64_MAX);
+
+        /* Get next image for presentation */
+        auto result = vkAcquireNextImageKHR(
+            device_,
+            swapChain_,
+            UINT64_MAX,
+            imageAvailableSemaphores_[currentFrame_],
+            VK_NULL_HANDLE,
+            &presentImageIndex_
+        );
+
+        if (result == VK_ERROR_OUT_OF_DATE_KHR)
+        {
+            /* Swap-chain can no longer be used for presentation, so recreate it and try once more */
+            RecreateSwapChain();
+            result = vkAcquireNextImageKHR(
+                device_,
+                swapChain_,
+                UINT64_MAX,
+                imageAvailableSemaphores_[currentFrame_],
+                VK_NULL_HANDLE,
+                &presentImageIndex_
+            );
+        }
+
+        /* A suboptimal swap-chain can still be presented to, so recreate it after the current frame has been presented */
+        if (result == VK_SUBOPTIMAL_KHR)
+            swapChainSuboptimal_ = true;
+        else
+            VKThrowIfFailed(result, "failed to acquire next Vulkan swap-chain image");
+
+        presentImageAcquired_   = true;
+        imageAvailablePending_  = true;
+    }
+}
+
+std::uint32_t VKRenderContext::PrepareSwapChainSubmit(VkSemaphore (&waitSemaphores)[2], VkSemaphore& signalSemaphore, VkFence fence)
+{
+    /* Command buffers might be submitted again in a later frame, so make sure the swap-chain image has been acquired */
+    AcquireNextPresentImage();
+
+    std::uint32_t numWaitSemaphores = 0;
+
+    /* Only the first submission of a frame waits until the swap-chain image is available */
+    if (imageAvailablePending_)
+    {
+        waitSemaphores[numWaitSemaphores++] = imageAvailableSemaphores_[currentFrame_];
+        imageAvailablePending_ = false;
+    }
+
+    /*
+    Subsequent submissions of the same frame must unsignal the semaphore before they can signal it again,
+    so the presentation always waits for the last submission that renders into the swap-chain
+    */
+    if (renderFinishedSignaled_)
+        waitSemaphores[numWaitSemaphores++] = renderFinishedSemaphores_[currentFrame_];
+
+    signalSemaphore         = renderFinishedSemaphores_[currentFrame_];
+    renderFinishedSignaled_ = true;
+
+    /* Fences are signaled in submission order, so the fence of the last submission guards the entire frame */
+    frameSubmitFences_[currentFrame_] = fence;
+
+    return numWaitSemaphores;
+}
+
 
 /*
  * ======= Private: =======
@@ -138,8 +220,8 @@ bool VKRenderContext::OnSetVideoMode(const VideoModeDescriptor& videoModeDesc)
     /* Wait until graphics queue is idle before resources are destroyed and recreated */
     vkQueueWaitIdle(graphicsQueue_);
 
-    /* Recreate presenting semaphores and Vulkan surface */
-    CreatePresentSemaphores();
+    /* Recreate presenting synchronization objects and Vulkan surface */
+    CreatePresentSyncObjects();
     CreateGpuSurface();
 
     /* Recreate (or just release) depth-stencil buffer */
@@ -159,6 +241,10 @@ bool VKRenderContext::OnSetVideoMode(const VideoModeDescriptor& videoModeDesc)
 
 bool VKRenderContext::OnSetVsync(const VsyncDescriptor& vsyncDesc)
 {
+    /* Wait until graphics queue is idle and recreate presenting synchronization objects, since an acquired image might be pending */
+    vkQueueWaitIdle(graphicsQueue_);
+    CreatePresentSyncObjects();
+
     /* Recreate swap-chain with new vsnyc settings */
     CreateSwapChain(GetVideoMode(), vsyncDesc);
     return true;
@@ -177,11 +263,50 @@ void VKRenderContext::CreateGpuSemaphore(VKPtr<VkSemaphore>& semaphore)
     VKThrowIfFailed(result, "failed to create Vulkan semaphore");
 }
 
-void VKRenderContext::CreatePresentSemaphores()
+void VKRenderContext::CreateGpuFence(VKPtr<VkFence>& fence)
 {
-    /* Create presentation semaphorse */
-    CreateGpuSemaphore(imageAvailableSemaphore_);
-    CreateGpuSemaphore(renderFinishedSemaphore_);
+    /* Create fence in signaled state, so the first frames do not wait for it */
+    VkFenceCreateInfo createInfo;
+    {
+        createInfo.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+        createInfo.pNext = nullptr;
+        createInfo.flags = VK_FENCE_CREATE_SIGNALED_BIT;
+    }
+    auto result = vkCreateFence(device_, &createInfo, nullptr, fence.ReleaseAndGetAddressOf());
+    VKThrowIfFailed(result, "failed to create Vulkan fence");
+}
+
+void VKRenderContext::CreatePresentSyncObjects()
+{
+    imageAvailableSemaphores_.clear();
+    renderFinishedSemaphores_.clear();
+    inFlightFences_.clear();
+    frameSubmitFences_.clear();
+
+    /* Create presentation semaphores and fence for each frame in flight */
+    for (std::uint32_t i = 0; i < numFramesInFlight_; ++i)
+    {
+        VKPtr<VkSemaphore> imageAvailableSemaphore { device_, vkDestroySemaphore };
+        VKPtr<VkSemaphore> renderFinishedSemaphore { device_, vkDestroySemaphore };
+        VKPtr<VkFence> inFlightFence { device_, vkDestroyFence };
+        {
+            CreateGpuSemaphore(imageAvailableSemaphore);
+            CreateGpuSemaphore(renderFinishedSemaphore);
+            CreateGpuFence(inFlightFence);
+        }
+        imageAvailableSemaphores_.emplace_back(std::move(imageAvailableSemaphore));
+        renderFinishedSemaphores_.emplace_back(std::move(renderFinishedSemaphore));
+        inFlightFences_.emplace_back(std::move(inFlightFence));
+    }
+
+    /* No frame in flight has been submitted yet */
+    frameSubmitFences_.resize(numFramesInFlight_, VK_NULL_HANDLE);
+
+    /* Reset frame state */
+    currentFrame_           = 0;
+    presentImageAcquired_   = false;
+    imageAvailablePending_  = false;
+    renderFinishedSignaled_ = false;
 }
 
 void VKRenderContext::CreateGpuSurface()
@@ -189,6 +314,28 @@ void VKRenderContext::CreateGpuSurface()
     /* All previous swap-chains must be destroyed before VkSurfaceKHR can be destroyed */
     swapChain_.Release();
 
+    #ifdef VK_EXT_headless_surface
+
+    if (headlessSurface_)
+    {
+        /* Create headless surface, e.g. for offscreen rendering with a software Vulkan driver */
+        VkHeadlessSurfaceCreateInfoEXT createInfo;
+        {
+            createInfo.sType    = VK_STRUCTURE_TYPE_HEADLESS_SURFACE_CREATE_INFO_EXT;
+            createInfo.pNext    = nullptr;
+            createInfo.flags    = 0;
+        }
+        auto result = vkCreateHeadlessSurfaceEXT(instance_, &createInfo, nullptr, surface_.ReleaseAndGetAddressOf());
+        VKThrowIfFailed(result, "failed to create headless surface for Vulkan render context");
+
+        /* Query surface support details and pick surface format */
+        surfaceSupportDetails_ = VKQuerySurfaceSupport(physicalDevice_, surface_);
+        swapChainFormat_ = PickSwapSurfaceFormat(surfaceSupportDetails_.formats);
+        return;
+    }
+
+    #endif // /VK_EXT_headless_surface
+
     /* Get hantive handle from context surface */
     NativeHandle nativeHandle;
     GetSurface().GetNativeHandle(&nativeHandle);
@@ -324,8 +471,8 @@ void VKRenderContext::CreateSwapChain(const VideoModeDescriptor& videoModeDesc,
     CreateSwapChainImageViews();
     CreateSwapChainFramebuffers();
 
-    /* Acquire first image for presentation */
-    AcquireNextPresentImage();
+    /* First image for presentation is acquired lazily with the first render pass */
+    presentImageAcquired_ = false;
 }
 
 void VKRenderContext::CreateSwapChainImageViews()
@@ -425,6 +572,31 @@ void VKRenderContext::ReleaseDepthStencilBuffer()
     depthStencilBuffer_.ReleaseDepthStencil(deviceMemoryMngr_);
 }
 
+void VKRenderContext::RecreateSwapChain()
+{
+    /* Wait until graphics queue is idle and recreate presenting synchronization objects, since an acquired image might be pending */
+    vkQueueWaitIdle(graphicsQueue_);
+    CreatePresentSyncObjects();
+
+    /* Query surface capabilities again, since the current extent of the surface might have changed */
+    surfaceSupportDetails_ = VKQuerySurfaceSupport(physicalDevice_, surface_);
+
+    /* Recreate depth-stencil buffer with the new extent of the swap-chain */
+    auto videoMode = GetVideoMode();
+
+    if (HasDepthStencilBuffer())
+    {
+        auto extent = PickSwapExtent(surfaceSupportDetails_.caps, videoMode.resolution.width, videoMode.resolution.height);
+        videoMode.resolution = { extent.width, extent.height };
+        ReleaseDepthStencilBuffer();
+        CreateDepthStencilBuffer(videoMode);
+    }
+
+    /* Recreate only swap-chain but keep render pass (independent of swap-chain object) */
+    CreateSwapChain(videoMode, GetVsync());
+    swapChainSuboptimal_ = false;
+}
+
 VkSurfaceFormatKHR VKRenderContext::PickSwapSurfaceFormat(const std::vector<VkSurfaceFormatKHR>& surfaceFormats) const
 {
     if (surfaceFormats.empty())
@@ -499,17 +671,36 @@ VkFormat VKRenderContext::PickDepthFormat() const
     );
 }
 
-void VKRenderContext::AcquireNextPresentImage()
+void VKRenderContext::SubmitPresentSemaphores()
 {
-    /* Get next image for presentation */
-    vkAcquireNextImageKHR(
-        device_,
-        swapChain_,
-        UINT64_MAX,
-        imageAvailableSemaphore_,
-        VK_NULL_HANDLE,
-        &presentImageIndex_
-    );
+    /* Get semaphores as if a command buffer had rendered into the swap-chain */
+    VkSemaphore waitSemaphores[2];
+    VkPipelineStageFlags waitStages[2] = { VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT, VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT };
+    VkSemaphore signalSemaphore = VK_NULL_HANDLE;
+
+    /* Use fence of the current frame in flight, since there was no other submission this frame */
+    VkFence fence = inFlightFences_[currentFrame_];
+
+    auto result = vkResetFences(device_, 1, &fence);
+    VKThrowIfFailed(result, "failed to reset Vulkan fence for frame in flight");
+
+    auto numWaitSemaphores = PrepareSwapChainSubmit(waitSemaphores, signalSemaphore, fence);
+
+    /* Submit semaphores to graphics queue without any command buffers */
+    VkSubmitInfo submitInfo;
+    {
+        submitInfo.sType                = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+        submitInfo.pNext                = nullptr;
+        submitInfo.waitSemaphoreCount   = numWaitSemaphores;
+        submitInfo.pWaitSemaphores      = waitSemaphores;
+        submitInfo.pWaitDstStageMask    = waitStages;
+        submitInfo.commandBufferCount   = 0;
+        submitInfo.pCommandBuffers      = nullptr;
+        submitInfo.signalSemaphoreCount = 1;
+        submitInfo.pSignalSemaphores    = &signalSemaphore;
+    }
+    result = vkQueueSubmit(graphicsQueue_, 1, &submitInfo, fence);
+    VKThrowIfFailed(result, "failed to submit semaphore to Vulkan graphics queue");
 }
 
 
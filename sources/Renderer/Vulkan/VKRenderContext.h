@@ -39,7 +39,9 @@ class VKRenderContext final : public RenderContext
             const VKPtr<VkDevice>& device,
             VKDeviceMemoryManager& deviceMemoryMngr,
             RenderContextDescriptor desc,
-            const std::shared_ptr<Surface>& surface
+            const std::shared_ptr<Surface>& surface,
+            std::uint32_t numFramesInFlight = 2,
+            bool headlessSurface = false
         );
 
         ~VKRenderContext();
@@ -71,16 +73,33 @@ class VKRenderContext final : public RenderContext
             return swapChainExtent_;
         }
 
+        // Returns the depth-stencil buffer of this render context. Its format is VK_FORMAT_UNDEFINED if there is no depth-stencil buffer.
+        inline VKDepthStencilBuffer& GetDepthStencilBuffer()
+        {
+            return depthStencilBuffer_;
+        }
+
         // Returns true if this render context has a depth-stencil buffer.
         bool HasDepthStencilBuffer() const;
 
+        // Acquires the next swap-chain image for presentation, unless it has already been acquired for the current frame.
+        void AcquireNextPresentImage();
+
+        /*
+        Returns the semaphores a queue submission must wait for (return value is the number of wait semaphores)
+        and the semaphore it must signal, if its command buffer renders into the swap-chain of this render context.
+        The specified fence must be signaled by that submission; the next use of the current frame in flight waits for it.
+        */
+        std::uint32_t PrepareSwapChainSubmit(VkSemaphore (&waitSemaphores)[2], VkSemaphore& signalSemaphore, VkFence fence);
+
     private:
 
         bool OnSetVideoMode(const VideoModeDescriptor& videoModeDesc) override;
         bool OnSetVsync(const VsyncDescriptor& vsyncDesc) override;
 
         void CreateGpuSemaphore(VKPtr<VkSemaphore>& semaphore);
-        void CreatePresentSemaphores();
+        void CreateGpuFence(VKPtr<VkFence>& fence);
+        void CreatePresentSyncObjects();
         void CreateGpuSurface();
 
         void CreateSwapChainRenderPass();
@@ -91,13 +110,15 @@ class VKRenderContext final : public RenderContext
         void CreateDepthStencilBuffer(const VideoModeDescriptor& videoModeDesc);
         void ReleaseDepthStencilBuffer();
 
+        void RecreateSwapChain();
+
         VkSurfaceFormatKHR PickSwapSurfaceFormat(const std::vector<VkSurfaceFormatKHR>& surfaceFormats) const;
         VkPresentModeKHR PickSwapPresentMode(const std::vector<VkPresentModeKHR>& presentModes, const VsyncDescriptor& vsyncDesc) const;
         VkExtent2D PickSwapExtent(const VkSurfaceCapabilitiesKHR& surfaceCaps, std::uint32_t width, std::uint32_t height) const;
         VkFormat PickDepthStencilFormat() const;
         VkFormat PickDepthFormat() const;
 
-        void AcquireNextPresentImage();
+        void SubmitPresentSemaphores();
 
         /* ----- Common objects ----- */
 
@@ -124,8 +145,19 @@ class VKRenderContext final : public RenderContext
         VkQueue                             graphicsQueue_              = VK_NULL_HANDLE;
         VkQueue                             presentQueue_               = VK_NULL_HANDLE;
 
-        VKPtr<VkSemaphore>                  imageAvailableSemaphore_;
-        VKPtr<VkSemaphore>                  renderFinishedSemaphore_;
+        std::uint32_t                       numFramesInFlight_          = 2;
+        std::uint32_t                       currentFrame_               = 0;
+        bool                                headlessSurface_            = false;
+
+        std::vector<VKPtr<VkSemaphore>>     imageAvailableSemaphores_;
+        std::vector<VKPtr<VkSemaphore>>     renderFinishedSemaphores_;
+        std::vector<VKPtr<VkFence>>         inFlightFences_;
+        std::vector<VkFence>                frameSubmitFences_;
+
+        bool                                presentImageAcquired_       = false;
+        bool                                imageAvailablePending_      = false;
+        bool                                renderFinishedSignaled_     = false;
+        bool                                swapChainSuboptimal_        = false;
 
 };
 
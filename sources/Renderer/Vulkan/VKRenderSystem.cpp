@@ -18,7 +18,9 @@
 #include "VKCore.h"
 #include "VKTypes.h"
 #include "VKInitializers.h"
+#include "VKResourceStateTracker.h"
 #include <LLGL/Log.h>
+#include <limits>
 
 
 namespace LLGL
@@ -45,10 +47,15 @@ static void DestroyDebugReportCallbackEXT(VkInstance instance, VkDebugReportCall
 
 static VkBufferUsageFlags GetVkBufferUsageFlags(long bufferFlags)
 {
-    if ((bufferFlags & BufferFlags::MapReadAccess) != 0)
-        return VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_TRANSFER_SRC_BIT;
-    else
-        return VK_BUFFER_USAGE_TRANSFER_DST_BIT;
+    /* Buffers can always be the source of copy commands (e.g. for CommandBuffer::CopyBuffer and RenderSystem::ReadBufferAsync) */
+    VkBufferUsageFlags usage = (VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_TRANSFER_SRC_BIT);
+
+    #ifdef VK_EXT_conditional_rendering
+    if ((bufferFlags & BufferFlags::RenderCondition) != 0)
+        usage |= VK_BUFFER_USAGE_CONDITIONAL_RENDERING_BIT_EXT;
+    #endif
+
+    return usage;
 }
 
 static VkBufferUsageFlags GetStagingVkBufferUsageFlags(long bufferFlags)
@@ -81,11 +88,18 @@ VKRenderSystem::VKRenderSystem(const RenderSystemDescriptor& renderSystemDesc) :
     debugLayerEnabled_ = true;
     #endif
 
+    if (rendererConfigVK != nullptr)
+    {
+        numFramesInFlight_      = rendererConfigVK->numFramesInFlight;
+        headlessSurfaceEnabled_ = rendererConfigVK->headlessSurface;
+    }
+
     /* Create Vulkan instance and device objects */
     CreateInstance(rendererConfigVK != nullptr ? &(rendererConfigVK->application) : nullptr);
     LoadExtensions();
     PickPhysicalDevice();
     CreateLogicalDevice();
+    QuerySparsePageSize();
 
     /* Create default resources */
     CreateDefaultPipelineLayout();
@@ -97,6 +111,9 @@ VKRenderSystem::VKRenderSystem(const RenderSystemDescriptor& renderSystemDesc) :
         (rendererConfigVK != nullptr ? rendererConfigVK->minDeviceMemoryAllocationSize : 1024*1024),
         (rendererConfigVK != nullptr ? rendererConfigVK->reduceDeviceMemoryFragmentation : false)
     );
+
+    /* Create command queue interface */
+    commandQueue_ = MakeUnique<VKCommandQueue>(device_, device_.GetVkQueue(), *deviceMemoryMngr_);
 }
 
 VKRenderSystem::~VKRenderSystem()
@@ -110,12 +127,16 @@ RenderContext* VKRenderSystem::CreateRenderContext(const RenderContextDescriptor
 {
     return TakeOwnership(
         renderContexts_,
-        MakeUnique<VKRenderContext>(instance_, physicalDevice_, device_, *deviceMemoryMngr_, desc, surface)
+        MakeUnique<VKRenderContext>(
+            instance_, physicalDevice_, device_, *deviceMemoryMngr_, desc, surface, numFramesInFlight_, headlessSurfaceEnabled_
+        )
     );
 }
 
 void VKRenderSystem::Release(RenderContext& renderContext)
 {
+    if (auto renderPass = renderContext.GetRenderPass())
+        pipelineCache_.Evict(*renderPass);
     RemoveFromUniqueSet(renderContexts_, &renderContext);
 }
 
@@ -155,6 +176,10 @@ Buffer* VKRenderSystem::CreateBuffer(const BufferDescriptor& desc, const void* i
 
     AssertCreateBuffer(desc, static_cast<uint64_t>(std::numeric_limits<VkDeviceSize>::max()));
 
+    /* Sparse buffers are created without memory and initial data, since their pages are committed with CommandQueue::UpdateTileMappings */
+    if ((desc.flags & BufferFlags::Sparse) != 0)
+        return CreateGpuBuffer(desc, GetVkBufferUsageFlags(desc.flags));
+
     /* Create staging buffer */
     auto stagingCreateInfo = MakeVkBufferCreateInfo(
         static_cast<VkDeviceSize>(desc.size),
@@ -199,10 +224,11 @@ BufferArray* VKRenderSystem::CreateBufferArray(std::uint32_t numBuffers, Buffer*
 
 void VKRenderSystem::Release(Buffer& buffer)
 {
-    /* Release device memory regions for primary buffer and internal staging buffer, then release buffer object */
+    /* Release device memory regions for primary buffer, internal staging buffer, and committed sparse pages, then release buffer object */
     auto& bufferVK = LLGL_CAST(VKBuffer&, buffer);
     bufferVK.GetDeviceBuffer().ReleaseMemoryRegion(*deviceMemoryMngr_);
     bufferVK.GetStagingDeviceBuffer().ReleaseMemoryRegion(*deviceMemoryMngr_);
+    bufferVK.GetSparseResidency().ReleaseAllPages(*deviceMemoryMngr_);
     RemoveFromUniqueSet(buffers_, &buffer);
 }
 
@@ -302,12 +328,32 @@ static std::uint32_t GetTextureLayertCount(const TextureDescriptor& desc)
 
 Texture* VKRenderSystem::CreateTexture(const TextureDescriptor& textureDesc, const SrcImageDescriptor* imageDesc)
 {
+    /* Create texture with decompressed image data if the block-compressed format is not supported by the physical device */
+    TextureDescriptor   decompressedTextureDesc;
+    SrcImageDescriptor  decompressedImageDesc;
+    ByteBuffer          decompressedImage;
+
+    if (DecompressUnsupportedTexture(textureDesc, imageDesc, decompressedTextureDesc, decompressedImageDesc, decompressedImage))
+        return CreateTexture(decompressedTextureDesc, (imageDesc != nullptr ? &decompressedImageDesc : nullptr));
+
+    /* Sparse textures have no memory until their tiles are committed, so they only need to be transferred into sampling-ready state */
+    if ((textureDesc.flags & TextureFlags::Sparse) != 0)
+        return CreateSparseTexture(textureDesc);
+
     const auto& cfg = GetConfiguration();
 
     /* Determine size of image for staging buffer */
     const auto imageSize        = TextureSize(textureDesc);
     const auto initialDataSize  = static_cast<VkDeviceSize>(TextureBufferSize(textureDesc.format, imageSize));
 
+    /* Color and depth-stencil textures without initial data are cleared on the GPU for all MIP-map levels and array layers */
+    const bool clearWithDefault =
+    (
+        imageDesc == nullptr                        &&
+        cfg.imageInitialization.enabled             &&
+        !IsCompressedFormat(textureDesc.format)
+    );
+
     /* Set up initial image data */
     const void* initialData = nullptr;
     ByteBuffer tempImageBuffer;
@@ -318,7 +364,7 @@ Texture* VKRenderSystem::CreateTexture(const TextureDescriptor& textureDesc, con
         ImageFormat dstFormat   = ImageFormat::RGBA;
         DataType    dstDataType = DataType::Int8;
 
-        if (FindSuitableImageFormat(textureDesc.format, dstFormat, dstDataType))
+        if (!IsCompressedFormat(textureDesc.format) && FindSuitableImageFormat(textureDesc.format, dstFormat, dstDataType))
         {
             /* Convert image format (will be null if no conversion is necessary) */
             tempImageBuffer = ConvertImageBuffer(*imageDesc, dstFormat, dstDataType, cfg.threadCount);
@@ -344,31 +390,13 @@ Texture* VKRenderSystem::CreateTexture(const TextureDescriptor& textureDesc, con
             initialData = imageDesc->data;
         }
     }
-    else if (cfg.imageInitialization.enabled)
+    else if (cfg.imageInitialization.enabled && !clearWithDefault)
     {
-        /* Allocate default image data */
-        ImageFormat imageFormat = ImageFormat::RGBA;
-        DataType imageDataType = DataType::Float64;
-
-        if (FindSuitableImageFormat(textureDesc.format, imageFormat, imageDataType))
-        {
-            const ColorRGBAd fillColor { cfg.imageInitialization.clearValue.color.Cast<double>() };
-            tempImageBuffer = GenerateImageBuffer(imageFormat, imageDataType, imageSize, fillColor);
-        }
-        else
-            tempImageBuffer = GenerateEmptyByteBuffer(static_cast<std::size_t>(initialDataSize));
-
+        /* Allocate default image data for compressed formats, which can not be cleared with <vkCmdClearColorImage> */
+        tempImageBuffer = GenerateEmptyByteBuffer(static_cast<std::size_t>(initialDataSize));
         initialData = tempImageBuffer.get();
     }
 
-    /* Create staging buffer */
-    auto stagingCreateInfo = MakeVkBufferCreateInfo(
-        initialDataSize,
-        VK_BUFFER_USAGE_TRANSFER_SRC_BIT  // <-- TODO: support read/write mapping //GetStagingVkBufferUsageFlags(desc.flags)
-    );
-
-    auto stagingBuffer = CreateStagingBuffer(stagingCreateInfo, initialData, initialDataSize);
-
     /* Create device texture */
     auto textureVK      = MakeUnique<VKTexture>(device_, *deviceMemoryMngr_, textureDesc);
 
@@ -376,44 +404,132 @@ Texture* VKRenderSystem::CreateTexture(const TextureDescriptor& textureDesc, con
     auto mipLevels      = textureVK->GetNumMipLevels();
     auto arrayLayers    = textureVK->GetNumArrayLayers();
 
-    /* Copy staging buffer into hardware texture, then transfer image into sampling-ready state */
-    auto formatVK = VKTypes::Map(textureDesc.format);
+    auto formatVK       = VKTypes::Map(textureDesc.format);
 
-    auto cmdBuffer = device_.AllocCommandBuffer();
+    if (clearWithDefault)
     {
-        device_.TransitionImageLayout(
-            cmdBuffer,
-            image,
-            formatVK,
-            VK_IMAGE_LAYOUT_UNDEFINED,
-            VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
-            mipLevels,
-            arrayLayers
-        );
+        /* Clear hardware texture with default value, then transfer image into sampling-ready state */
+        const auto& clearValue = cfg.imageInitialization.clearValue;
+        const auto& clearColor = clearValue.color;
 
-        device_.CopyBufferToImage(
-            cmdBuffer,
-            stagingBuffer.GetVkBuffer(),
-            image,
-            GetTextureVkExtent(textureDesc),
-            GetTextureLayertCount(textureDesc)
+        VkClearColorValue clearColorVK;
+        {
+            if (IsIntegralFormat(textureDesc.format) && !IsNormalizedFormat(textureDesc.format))
+            {
+                /* Integer formats interpret the clear value as integers */
+                for (int i = 0; i < 4; ++i)
+                    clearColorVK.int32[i] = static_cast<std::int32_t>(clearColor[i]);
+            }
+            else
+            {
+                for (int i = 0; i < 4; ++i)
+                    clearColorVK.float32[i] = clearColor[i];
+            }
+        }
+
+        auto cmdBuffer = device_.AllocCommandBuffer();
+        {
+            device_.TransitionImageLayout(
+                cmdBuffer,
+                image,
+                formatVK,
+                VK_IMAGE_LAYOUT_UNDEFINED,
+                VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+                mipLevels,
+                arrayLayers
+            );
+
+            if (IsDepthStencilFormat(textureDesc.format))
+            {
+                const VkClearDepthStencilValue clearDepthStencilVK { clearValue.depth, clearValue.stencil };
+                device_.ClearDepthStencilImage(cmdBuffer, image, formatVK, clearDepthStencilVK, mipLevels, arrayLayers);
+            }
+            else
+                device_.ClearColorImage(cmdBuffer, image, clearColorVK, mipLevels, arrayLayers);
+
+            device_.TransitionImageLayout(
+                cmdBuffer,
+                image,
+                formatVK,
+                VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+                VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
+                mipLevels,
+                arrayLayers
+            );
+        }
+        device_.FlushCommandBuffer(cmdBuffer);
+    }
+    else
+    {
+        /* Create staging buffer */
+        auto stagingCreateInfo = MakeVkBufferCreateInfo(
+            initialDataSize,
+            VK_BUFFER_USAGE_TRANSFER_SRC_BIT  // <-- TODO: support read/write mapping //GetStagingVkBufferUsageFlags(desc.flags)
         );
 
+        auto stagingBuffer = CreateStagingBuffer(stagingCreateInfo, initialData, initialDataSize);
+
+        /* Copy staging buffer into hardware texture, then transfer image into sampling-ready state */
+        auto cmdBuffer = device_.AllocCommandBuffer();
+        {
+            device_.TransitionImageLayout(
+                cmdBuffer,
+                image,
+                formatVK,
+                VK_IMAGE_LAYOUT_UNDEFINED,
+                VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+                mipLevels,
+                arrayLayers
+            );
+
+            device_.CopyBufferToImage(
+                cmdBuffer,
+                stagingBuffer.GetVkBuffer(),
+                image,
+                GetTextureVkExtent(textureDesc),
+                GetTextureLayertCount(textureDesc)
+            );
+
+            device_.TransitionImageLayout(
+                cmdBuffer,
+                image,
+                formatVK,
+                VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+                VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
+                mipLevels,
+                arrayLayers
+            );
+        }
+        device_.FlushCommandBuffer(cmdBuffer);
+
+        /* Release staging buffer */
+        stagingBuffer.ReleaseMemoryRegion(*deviceMemoryMngr_);
+    }
+
+    /* Create image view for texture */
+    textureVK->CreateInternalImageView(device_);
+
+    return TakeOwnership(textures_, std::move(textureVK));
+}
+
+Texture* VKRenderSystem::CreateSparseTexture(const TextureDescriptor& textureDesc)
+{
+    auto textureVK = MakeUnique<VKTexture>(device_, *deviceMemoryMngr_, textureDesc);
+
+    auto cmdBuffer = device_.AllocCommandBuffer();
+    {
         device_.TransitionImageLayout(
             cmdBuffer,
-            image,
-            formatVK,
-            VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+            textureVK->GetVkImage(),
+            textureVK->GetVkFormat(),
+            VK_IMAGE_LAYOUT_UNDEFINED,
             VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
-            mipLevels,
-            arrayLayers
+            textureVK->GetNumMipLevels(),
+            textureVK->GetNumArrayLayers()
         );
     }
     device_.FlushCommandBuffer(cmdBuffer);
 
-    /* Release staging buffer */
-    stagingBuffer.ReleaseMemoryRegion(*deviceMemoryMngr_);
-
     /* Create image view for texture */
     textureVK->CreateInternalImageView(device_);
 
@@ -424,13 +540,120 @@ void VKRenderSystem::Release(Texture& texture)
 {
     /* Release device memory region, then release texture object */
     auto& textureVK = LLGL_CAST(VKTexture&, texture);
-    deviceMemoryMngr_->Release(textureVK.GetMemoryRegion());
+    textureVK.ReleaseMemoryRegion(*deviceMemoryMngr_);
     RemoveFromUniqueSet(textures_, &texture);
 }
 
 void VKRenderSystem::WriteTexture(Texture& texture, const TextureRegion& textureRegion, const SrcImageDescriptor& imageDesc)
 {
-    //todo
+    auto& textureVK = LLGL_CAST(VKTexture&, texture);
+
+    const auto& cfg     = GetConfiguration();
+    const auto  format  = textureVK.QueryDesc().format;
+
+    /* Determine subresource region (array layers are specified in the Y or Z component depending on the texture type) */
+    VkImageSubresourceLayers subresource;
+    {
+        subresource.aspectMask      = VK_IMAGE_ASPECT_COLOR_BIT;
+        subresource.mipLevel        = textureRegion.mipLevel;
+        subresource.baseArrayLayer  = 0;
+        subresource.layerCount      = 1;
+    }
+
+    VkOffset3D offset { textureRegion.offset.x, textureRegion.offset.y, textureRegion.offset.z };
+    VkExtent3D extent { textureRegion.extent.width, textureRegion.extent.height, textureRegion.extent.depth };
+
+    switch (textureVK.GetType())
+    {
+        case TextureType::Texture1DArray:
+            subresource.baseArrayLayer  = static_cast<std::uint32_t>(offset.y);
+            subresource.layerCount      = extent.height;
+            offset.y                    = 0;
+            extent.height               = 1;
+            break;
+
+        case TextureType::Texture2DArray:
+        case TextureType::TextureCube:
+        case TextureType::TextureCubeArray:
+            subresource.baseArrayLayer  = static_cast<std::uint32_t>(offset.z);
+            subresource.layerCount      = extent.depth;
+            offset.z                    = 0;
+            extent.depth                = 1;
+            break;
+
+        default:
+            break;
+    }
+
+    /* Determine size of image data for staging buffer */
+    const auto numTexels    = (extent.width * extent.height * extent.depth * subresource.layerCount);
+    auto       dataSize     = static_cast<std::size_t>(TextureBufferSize(format, numTexels));
+    const void* data        = imageDesc.data;
+
+    ByteBuffer tempImageBuffer;
+
+    if (IsCompressedFormat(format))
+    {
+        /* Compressed image data is copied as is (the size of incomplete 4x4 blocks is only known by the source image) */
+        AssertImageDataSize(imageDesc.dataSize, dataSize);
+        dataSize = imageDesc.dataSize;
+    }
+    else
+    {
+        /* Convert image format if necessary */
+        ImageFormat dstFormat   = ImageFormat::RGBA;
+        DataType    dstDataType = DataType::Int8;
+
+        if (FindSuitableImageFormat(format, dstFormat, dstDataType))
+            tempImageBuffer = ConvertImageBuffer(imageDesc, dstFormat, dstDataType, cfg.threadCount);
+
+        if (tempImageBuffer)
+        {
+            AssertImageDataSize(imageDesc.dataSize, numTexels * ImageFormatSize(imageDesc.format) * DataTypeSize(imageDesc.dataType));
+            data = tempImageBuffer.get();
+        }
+        else
+            AssertImageDataSize(imageDesc.dataSize, dataSize);
+    }
+
+    /* Create staging buffer with image data */
+    auto stagingCreateInfo  = MakeVkBufferCreateInfo(static_cast<VkDeviceSize>(dataSize), VK_BUFFER_USAGE_TRANSFER_SRC_BIT);
+    auto stagingBuffer      = CreateStagingBuffer(stagingCreateInfo, data, static_cast<VkDeviceSize>(dataSize));
+
+    /* Copy staging buffer into texture region, then transfer image back into sampling-ready state */
+    auto image          = textureVK.GetVkImage();
+    auto formatVK       = textureVK.GetVkFormat();
+    auto mipLevels      = textureVK.GetNumMipLevels();
+    auto arrayLayers    = textureVK.GetNumArrayLayers();
+
+    auto cmdBuffer = device_.AllocCommandBuffer();
+    {
+        device_.TransitionImageLayout(
+            cmdBuffer,
+            image,
+            formatVK,
+            VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
+            VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+            mipLevels,
+            arrayLayers
+        );
+
+        device_.CopyBufferToImage(cmdBuffer, stagingBuffer.GetVkBuffer(), image, subresource, offset, extent);
+
+        device_.TransitionImageLayout(
+            cmdBuffer,
+            image,
+            formatVK,
+            VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+            VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
+            mipLevels,
+            arrayLayers
+        );
+    }
+    device_.FlushCommandBuffer(cmdBuffer);
+
+    /* Release staging buffer */
+    stagingBuffer.ReleaseMemoryRegion(*deviceMemoryMngr_);
 }
 
 void VKRenderSystem::ReadTexture(const Texture& texture, std::uint32_t mipLevel, const DstImageDescriptor& imageDesc)
@@ -485,12 +708,24 @@ void VKRenderSystem::GenerateMips(Texture& texture, std::uint32_t baseMipLevel,
 
 Sampler* VKRenderSystem::CreateSampler(const SamplerDescriptor& desc)
 {
-    return TakeOwnership(samplers_, MakeUnique<VKSampler>(device_, desc));
+    return samplerCache_.GetOrCreate(
+        desc,
+        [&]()
+        {
+            return TakeOwnership(samplers_, MakeUnique<VKSampler>(device_, desc));
+        }
+    );
 }
 
 void VKRenderSystem::Release(Sampler& sampler)
 {
-    RemoveFromUniqueSet(samplers_, &sampler);
+    if (samplerCache_.Release(sampler))
+        RemoveFromUniqueSet(samplers_, &sampler);
+}
+
+SamplerCacheStatistics VKRenderSystem::GetSamplerCacheStatistics() const
+{
+    return samplerCache_.GetStatistics();
 }
 
 /* ----- Resource Heaps ----- */
@@ -515,6 +750,7 @@ RenderPass* VKRenderSystem::CreateRenderPass(const RenderPassDescriptor& desc)
 
 void VKRenderSystem::Release(RenderPass& renderPass)
 {
+    pipelineCache_.Evict(renderPass);
     RemoveFromUniqueSet(renderPasses_, &renderPass);
 }
 
@@ -555,6 +791,7 @@ void VKRenderSystem::Release(Shader& shader)
 
 void VKRenderSystem::Release(ShaderProgram& shaderProgram)
 {
+    pipelineCache_.Evict(shaderProgram);
     RemoveFromUniqueSet(shaderPrograms_, &shaderProgram);
 }
 
@@ -567,6 +804,7 @@ PipelineLayout* VKRenderSystem::CreatePipelineLayout(const PipelineLayoutDescrip
 
 void VKRenderSystem::Release(PipelineLayout& pipelineLayout)
 {
+    pipelineCache_.Evict(pipelineLayout);
     RemoveFromUniqueSet(pipelineLayouts_, &pipelineLayout);
 }
 
@@ -574,31 +812,55 @@ void VKRenderSystem::Release(PipelineLayout& pipelineLayout)
 
 GraphicsPipeline* VKRenderSystem::CreateGraphicsPipeline(const GraphicsPipelineDescriptor& desc)
 {
-    return TakeOwnership(
-        graphicsPipelines_,
-        MakeUnique<VKGraphicsPipeline>(
-            device_,
-            defaultPipelineLayout_,
-            (!renderContexts_.empty() ? (*renderContexts_.begin())->GetRenderPass() : nullptr),
-            desc,
-            gfxPipelineLimits_
-        )
+    /* Resolve default render pass, so it is part of the cache key */
+    auto resolvedDesc = desc;
+    if (resolvedDesc.renderPass == nullptr && !renderContexts_.empty())
+        resolvedDesc.renderPass = (*renderContexts_.begin())->GetRenderPass();
+
+    return pipelineCache_.GetOrCreate(
+        resolvedDesc,
+        [&]()
+        {
+            return TakeOwnership(
+                graphicsPipelines_,
+                MakeUnique<VKGraphicsPipeline>(
+                    device_,
+                    defaultPipelineLayout_,
+                    nullptr,
+                    resolvedDesc,
+                    gfxPipelineLimits_
+                )
+            );
+        }
     );
 }
 
 ComputePipeline* VKRenderSystem::CreateComputePipeline(const ComputePipelineDescriptor& desc)
 {
-    return TakeOwnership(computePipelines_, MakeUnique<VKComputePipeline>(device_, desc, defaultPipelineLayout_));
+    return pipelineCache_.GetOrCreate(
+        desc,
+        [&]()
+        {
+            return TakeOwnership(computePipelines_, MakeUnique<VKComputePipeline>(device_, desc, defaultPipelineLayout_));
+        }
+    );
 }
 
 void VKRenderSystem::Release(GraphicsPipeline& graphicsPipeline)
 {
-    RemoveFromUniqueSet(graphicsPipelines_, &graphicsPipeline);
+    if (pipelineCache_.Release(graphicsPipeline))
+        RemoveFromUniqueSet(graphicsPipelines_, &graphicsPipeline);
 }
 
 void VKRenderSystem::Release(ComputePipeline& computePipeline)
 {
-    RemoveFromUniqueSet(computePipelines_, &computePipeline);
+    if (pipelineCache_.Release(computePipeline))
+        RemoveFromUniqueSet(computePipelines_, &computePipeline);
+}
+
+PipelineCacheStatistics VKRenderSystem::GetPipelineCacheStatistics() const
+{
+    return pipelineCache_.GetStatistics();
 }
 
 /* ----- Queries ----- */
@@ -625,6 +887,120 @@ void VKRenderSystem::Release(Fence& fence)
     RemoveFromUniqueSet(fences_, &fence);
 }
 
+/* ----- Asynchronous Readbacks ----- */
+
+AsyncReadback* VKRenderSystem::ReadTextureAsync(const Texture& texture, std::uint32_t mipLevel)
+{
+    auto& textureVK = LLGL_CAST(const VKTexture&, texture);
+
+    /* Determine size of the entire MIP-map level including all array layers (image data is tightly packed) */
+    const auto mipExtent    = textureVK.QueryMipExtent(mipLevel);
+    const auto dataSize     = static_cast<VkDeviceSize>(
+        TextureBufferSize(textureVK.QueryDesc().format, mipExtent.width * mipExtent.height * mipExtent.depth)
+    );
+
+    /* Create host-visible staging buffer for readback */
+    auto stagingCreateInfo  = MakeVkBufferCreateInfo(dataSize, VK_BUFFER_USAGE_TRANSFER_DST_BIT);
+    auto readback           = MakeUnique<VKAsyncReadback>(device_, CreateStagingBuffer(stagingCreateInfo), dataSize);
+
+    /* Copy MIP-map level into staging buffer, then transfer image back into the layout it rests in between command buffers */
+    const auto& extent = textureVK.GetVkExtent();
+
+    const VkExtent3D mipExtentVK
+    {
+        std::max(1u, extent.width  >> mipLevel),
+        std::max(1u, extent.height >> mipLevel),
+        std::max(1u, extent.depth  >> mipLevel)
+    };
+
+    auto image          = textureVK.GetVkImage();
+    auto formatVK       = textureVK.GetVkFormat();
+    auto mipLevels      = textureVK.GetNumMipLevels();
+    auto arrayLayers    = textureVK.GetNumArrayLayers();
+
+    auto imageLayout    = VKResourceStateTracker::GetDefaultTextureLayout();
+
+    auto cmdBuffer = device_.AllocCommandBuffer();
+    {
+        device_.TransitionImageLayout(
+            cmdBuffer,
+            image,
+            formatVK,
+            imageLayout,
+            VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+            mipLevels,
+            arrayLayers
+        );
+
+        device_.CopyImageToBuffer(
+            cmdBuffer,
+            image,
+            readback->GetDeviceBuffer().GetVkBuffer(),
+            VKGetSingleImageAspectByFormat(formatVK),
+            mipExtentVK,
+            mipLevel,
+            arrayLayers
+        );
+
+        device_.TransitionImageLayout(
+            cmdBuffer,
+            image,
+            formatVK,
+            VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+            imageLayout,
+            mipLevels,
+            arrayLayers
+        );
+    }
+    readback->Submit(cmdBuffer);
+
+    return TakeOwnership(readbacks_, std::move(readback));
+}
+
+AsyncReadback* VKRenderSystem::ReadBufferAsync(const Buffer& buffer, std::uint64_t offset, std::uint64_t size)
+{
+    auto& bufferVK = LLGL_CAST(const VKBuffer&, buffer);
+
+    /* Create host-visible staging buffer for readback */
+    const auto dataSize     = static_cast<VkDeviceSize>(size);
+    auto stagingCreateInfo  = MakeVkBufferCreateInfo(dataSize, VK_BUFFER_USAGE_TRANSFER_DST_BIT);
+    auto readback           = MakeUnique<VKAsyncReadback>(device_, CreateStagingBuffer(stagingCreateInfo), dataSize);
+
+    auto cmdBuffer = device_.AllocCommandBuffer();
+    {
+        /* Wait for all previous writes to the buffer, e.g. by compute shaders */
+        VkMemoryBarrier barrier;
+        {
+            barrier.sType           = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+            barrier.pNext           = nullptr;
+            barrier.srcAccessMask   = VK_ACCESS_MEMORY_WRITE_BIT;
+            barrier.dstAccessMask   = VK_ACCESS_TRANSFER_READ_BIT;
+        }
+        vkCmdPipelineBarrier(cmdBuffer, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 1, &barrier, 0, nullptr, 0, nullptr);
+
+        /* Copy buffer range into staging buffer */
+        device_.CopyBuffer(
+            cmdBuffer,
+            bufferVK.GetVkBuffer(),
+            readback->GetDeviceBuffer().GetVkBuffer(),
+            dataSize,
+            static_cast<VkDeviceSize>(offset)
+        );
+    }
+    readback->Submit(cmdBuffer);
+
+    return TakeOwnership(readbacks_, std::move(readback));
+}
+
+void VKRenderSystem::Release(AsyncReadback& readback)
+{
+    /* Wait until the staging buffer is no longer in use, then release device memory region and readback object */
+    auto& readbackVK = LLGL_CAST(VKAsyncReadback&, readback);
+    readbackVK.Wait(std::numeric_limits<std::uint64_t>::max());
+    readbackVK.GetDeviceBuffer().ReleaseMemoryRegion(*deviceMemoryMngr_);
+    RemoveFromUniqueSet(readbacks_, &readback);
+}
+
 
 /*
  * ======= Private: =======
@@ -754,7 +1130,7 @@ void VKRenderSystem::CreateDebugReportCallback()
 
 void VKRenderSystem::LoadExtensions()
 {
-    LoadAllExtensions(instance_);
+    LoadAllExtensions(instance_, headlessSurfaceEnabled_);
 }
 
 void VKRenderSystem::PickPhysicalDevice()
@@ -778,8 +1154,28 @@ void VKRenderSystem::CreateLogicalDevice()
     /* Create logical device with all supported physical device feature */
     device_ = physicalDevice_.CreateLogicalDevice();
 
-    /* Create command queue interface */
-    commandQueue_ = MakeUnique<VKCommandQueue>(device_, device_.GetVkQueue());
+    /* Load functions of optional device extensions */
+    LoadDeviceExtensions(device_, physicalDevice_.SupportsConditionalRendering());
+}
+
+void VKRenderSystem::QuerySparsePageSize()
+{
+    if (!GetRenderingCaps().features.hasSparseBuffers)
+        return;
+
+    /* Sparse buffer pages are aligned to the memory alignment of a sparse buffer, which can only be queried with a logical device */
+    VkBufferCreateInfo createInfo;
+    InitVkBufferCreateInfo(
+        createInfo,
+        1,
+        VK_BUFFER_USAGE_STORAGE_BUFFER_BIT,
+        (VK_BUFFER_CREATE_SPARSE_BINDING_BIT | VK_BUFFER_CREATE_SPARSE_RESIDENCY_BIT)
+    );
+    VKDeviceBuffer sparseBuffer { device_, createInfo };
+
+    auto caps = GetRenderingCaps();
+    caps.limits.sparsePageSize = static_cast<std::uint32_t>(sparseBuffer.GetRequirements().alignment);
+    SetRenderingCaps(caps);
 }
 
 void VKRenderSystem::CreateDefaultPipelineLayout()
@@ -814,6 +1210,9 @@ bool VKRenderSystem::IsExtensionRequired(const std::string& name) const
         || name == VK_KHR_XLIB_SURFACE_EXTENSION_NAME
         #endif
         || (debugLayerEnabled_ && name == VK_EXT_DEBUG_REPORT_EXTENSION_NAME)
+        #ifdef VK_EXT_headless_surface
+        || (headlessSurfaceEnabled_ && name == VK_EXT_HEADLESS_SURFACE_EXTENSION_NAME)
+        #endif
     );
 }
 
@@ -821,33 +1220,37 @@ VKBuffer* VKRenderSystem::CreateGpuBuffer(const BufferDescriptor& desc, VkBuffer
 {
     /* Create hardware buffer */
     VkBufferCreateInfo createInfo;
+    VkBufferCreateFlags createFlags = 0;
+
+    if ((desc.flags & BufferFlags::Sparse) != 0)
+        createFlags |= (VK_BUFFER_CREATE_SPARSE_BINDING_BIT | VK_BUFFER_CREATE_SPARSE_RESIDENCY_BIT);
 
     switch (desc.type)
     {
         case BufferType::Vertex:
         {
-            InitVkBufferCreateInfo(createInfo, static_cast<VkDeviceSize>(desc.size), (usage | VK_BUFFER_USAGE_VERTEX_BUFFER_BIT));
+            InitVkBufferCreateInfo(createInfo, static_cast<VkDeviceSize>(desc.size), (usage | VK_BUFFER_USAGE_VERTEX_BUFFER_BIT), createFlags);
             return TakeOwnership(buffers_, MakeUnique<VKBuffer>(BufferType::Vertex, device_, createInfo));
         }
         break;
 
         case BufferType::Index:
         {
-            InitVkBufferCreateInfo(createInfo, static_cast<VkDeviceSize>(desc.size), (usage | VK_BUFFER_USAGE_INDEX_BUFFER_BIT));
+            InitVkBufferCreateInfo(createInfo, static_cast<VkDeviceSize>(desc.size), (usage | VK_BUFFER_USAGE_INDEX_BUFFER_BIT), createFlags);
             return TakeOwnership(buffers_, MakeUnique<VKIndexBuffer>(device_, createInfo, desc.indexBuffer.format));
         }
         break;
 
         case BufferType::Constant:
         {
-            InitVkBufferCreateInfo(createInfo, static_cast<VkDeviceSize>(desc.size), (usage | VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT));
+            InitVkBufferCreateInfo(createInfo, static_cast<VkDeviceSize>(desc.size), (usage | VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT), createFlags);
             return TakeOwnership(buffers_, MakeUnique<VKBuffer>(BufferType::Constant, device_, createInfo));
         }
         break;
 
         case BufferType::Storage:
         {
-            InitVkBufferCreateInfo(createInfo, static_cast<VkDeviceSize>(desc.size), (usage | VK_BUFFER_USAGE_STORAGE_BUFFER_BIT));
+            InitVkBufferCreateInfo(createInfo, static_cast<VkDeviceSize>(desc.size), (usage | VK_BUFFER_USAGE_STORAGE_BUFFER_BIT), createFlags);
             return TakeOwnership(buffers_, MakeUnique<VKBuffer>(BufferType::Storage, device_, createInfo));
         }
         break;
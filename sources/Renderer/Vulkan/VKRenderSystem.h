@@ -13,6 +13,8 @@
 #include "VKPhysicalDevice.h"
 #include "VKDevice.h"
 #include "../ContainerTypes.h"
+#include "../PipelineCache.h"
+#include "../SamplerCache.h"
 #include "Memory/VKDeviceMemoryManager.h"
 
 #include "VKCommandQueue.h"
@@ -21,6 +23,7 @@
 
 #include "Buffer/VKBuffer.h"
 #include "Buffer/VKBufferArray.h"
+#include "Buffer/VKAsyncReadback.h"
 
 #include "Shader/VKShader.h"
 #include "Shader/VKShaderProgram.h"
@@ -106,6 +109,8 @@ class VKRenderSystem final : public RenderSystem
 
         void Release(Sampler& sampler) override;
 
+        SamplerCacheStatistics GetSamplerCacheStatistics() const override;
+
         /* ----- Resource Heaps ----- */
 
         ResourceHeap* CreateResourceHeap(const ResourceHeapDescriptor& desc) override;
@@ -146,6 +151,8 @@ class VKRenderSystem final : public RenderSystem
         void Release(GraphicsPipeline& graphicsPipeline) override;
         void Release(ComputePipeline& computePipeline) override;
 
+        PipelineCacheStatistics GetPipelineCacheStatistics() const override;
+
         /* ----- Queries ----- */
 
         Query* CreateQuery(const QueryDescriptor& desc) override;
@@ -158,6 +165,13 @@ class VKRenderSystem final : public RenderSystem
 
         void Release(Fence& fence) override;
 
+        /* ----- Asynchronous Readbacks ----- */
+
+        AsyncReadback* ReadTextureAsync(const Texture& texture, std::uint32_t mipLevel) override;
+        AsyncReadback* ReadBufferAsync(const Buffer& buffer, std::uint64_t offset, std::uint64_t size) override;
+
+        void Release(AsyncReadback& readback) override;
+
     private:
 
         void CreateInstance(const ApplicationDescriptor* applicationDesc);
@@ -165,6 +179,7 @@ class VKRenderSystem final : public RenderSystem
         void LoadExtensions();
         void PickPhysicalDevice();
         void CreateLogicalDevice();
+        void QuerySparsePageSize();
         void CreateDefaultPipelineLayout();
 
         bool IsLayerRequired(const std::string& name) const;
@@ -172,6 +187,8 @@ class VKRenderSystem final : public RenderSystem
 
         VKBuffer* CreateGpuBuffer(const BufferDescriptor& desc, VkBufferUsageFlags usage = 0);
 
+        Texture* CreateSparseTexture(const TextureDescriptor& textureDesc);
+
         VKDeviceBuffer CreateStagingBuffer(const VkBufferCreateInfo& createInfo);
 
         VKDeviceBuffer CreateStagingBuffer(
@@ -191,6 +208,8 @@ class VKRenderSystem final : public RenderSystem
         VKPtr<VkPipelineLayout>                 defaultPipelineLayout_;
 
         bool                                    debugLayerEnabled_      = false;
+        bool                                    headlessSurfaceEnabled_ = false;
+        std::uint32_t                           numFramesInFlight_      = 2;
 
         std::unique_ptr<VKDeviceMemoryManager>  deviceMemoryMngr_;
 
@@ -205,6 +224,7 @@ class VKRenderSystem final : public RenderSystem
         HWObjectContainer<VKBufferArray>        bufferArrays_;
         HWObjectContainer<VKTexture>            textures_;
         HWObjectContainer<VKSampler>            samplers_;
+        SamplerCache                            samplerCache_;
         HWObjectContainer<VKRenderPass>         renderPasses_;
         HWObjectContainer<VKRenderTarget>       renderTargets_;
         HWObjectContainer<VKShader>             shaders_;
@@ -212,9 +232,11 @@ class VKRenderSystem final : public RenderSystem
         HWObjectContainer<VKPipelineLayout>     pipelineLayouts_;
         HWObjectContainer<VKGraphicsPipeline>   graphicsPipelines_;
         HWObjectContainer<VKComputePipeline>    computePipelines_;
+        PipelineCache                           pipelineCache_;
         HWObjectContainer<VKResourceHeap>       resourceHeaps_;
         HWObjectContainer<VKQuery>              queries_;
         HWObjectContainer<VKFence>              fences_;
+        HWObjectContainer<VKAsyncReadback>      readbacks_;
 
 };
 
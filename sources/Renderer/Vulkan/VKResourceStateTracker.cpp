@@ -0,0 +1,315 @@
+/*
+ * VKResourceStateTracker.cpp
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "VKResourceStateTracker.h"
+#include "Texture/VKTexture.h"
+#include "Buffer/VKBuffer.h"
+#include "VKCore.h"
+
+
+namespace LLGL
+{
+
+
+// Image layout all textures rest in between command buffers (see VKRenderSystem::CreateTexture and VKResourceHeap).
+static const VkImageLayout g_defaultImageLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+
+// Access and stage flags of the default state, i.e. resources can be read by any subsequent command.
+static const VkAccessFlags g_defaultAccessMask =
+(
+    VK_ACCESS_INDIRECT_COMMAND_READ_BIT     |
+    VK_ACCESS_INDEX_READ_BIT                |
+    VK_ACCESS_VERTEX_ATTRIBUTE_READ_BIT     |
+    VK_ACCESS_UNIFORM_READ_BIT              |
+    VK_ACCESS_SHADER_READ_BIT               |
+    VK_ACCESS_TRANSFER_READ_BIT
+);
+
+// All stages, including VK_PIPELINE_STAGE_CONDITIONAL_RENDERING_BIT_EXT for buffers with a render condition (see GetDefaultBufferAccessMask).
+static const VkPipelineStageFlags g_defaultStageMask = VK_PIPELINE_STAGE_ALL_COMMANDS_BIT;
+
+// Access flags that make a barrier necessary before any subsequent access.
+static const VkAccessFlags g_writeAccessMask =
+(
+    VK_ACCESS_SHADER_WRITE_BIT                  |
+    VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT        |
+    VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT|
+    VK_ACCESS_TRANSFER_WRITE_BIT                |
+    VK_ACCESS_HOST_WRITE_BIT                    |
+    VK_ACCESS_MEMORY_WRITE_BIT
+);
+
+static const std::size_t g_invalidBarrierIndex = ~0u;
+
+// Returns the access flags of the default state for the specified buffer, which includes all reads the buffer was created for.
+static VkAccessFlags GetDefaultBufferAccessMask(const VKBuffer& bufferVK)
+{
+    VkAccessFlags accessMask = g_defaultAccessMask;
+
+    #ifdef VK_EXT_conditional_rendering
+    /* Predicates are read before the render condition begins, which might be within a render pass where no barrier can be recorded */
+    if ((bufferVK.GetUsageFlags() & VK_BUFFER_USAGE_CONDITIONAL_RENDERING_BIT_EXT) != 0)
+        accessMask |= VK_ACCESS_CONDITIONAL_RENDERING_READ_BIT_EXT;
+    #endif
+
+    return accessMask;
+}
+
+void VKResourceStateTracker::Reset()
+{
+    textureStates_.clear();
+    textureStateMap_.clear();
+    bufferStates_.clear();
+    bufferStateMap_.clear();
+    imageBarriers_.clear();
+    bufferBarriers_.clear();
+    srcStageMask_       = 0;
+    dstStageMask_       = 0;
+    renderPassActive_   = false;
+}
+
+void VKResourceStateTracker::AccessTexture(const VKTexture& textureVK, VkImageLayout layout, VkAccessFlags accessMask, VkPipelineStageFlags stageMask)
+{
+    AccessTextureState(FetchTextureState(textureVK), layout, accessMask, stageMask);
+}
+
+void VKResourceStateTracker::AccessBuffer(const VKBuffer& bufferVK, VkAccessFlags accessMask, VkPipelineStageFlags stageMask)
+{
+    AccessBufferState(FetchBufferState(bufferVK), accessMask, stageMask);
+}
+
+void VKResourceStateTracker::RestoreTextureSubresource(const VKTexture& textureVK, std::uint32_t mipLevel, std::uint32_t arrayLayer, VkImageLayout oldLayout)
+{
+    auto& state = FetchTextureState(textureVK);
+
+    /* Transition subresource back into the layout of the entire image; other accesses wait for this barrier via the tracked state */
+    VkImageMemoryBarrier barrier;
+    {
+        barrier.sType                           = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+        barrier.pNext                           = nullptr;
+        barrier.srcAccessMask                   = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT;
+        barrier.dstAccessMask                   = 0;
+        barrier.oldLayout                       = oldLayout;
+        barrier.newLayout                       = state.layout;
+        barrier.srcQueueFamilyIndex             = VK_QUEUE_FAMILY_IGNORED;
+        barrier.dstQueueFamilyIndex             = VK_QUEUE_FAMILY_IGNORED;
+        barrier.image                           = textureVK.GetVkImage();
+        barrier.subresourceRange.aspectMask     = VKGetImageAspectByFormat(textureVK.GetVkFormat());
+        barrier.subresourceRange.baseMipLevel   = mipLevel;
+        barrier.subresourceRange.levelCount     = 1;
+        barrier.subresourceRange.baseArrayLayer = arrayLayer;
+        barrier.subresourceRange.layerCount     = 1;
+    }
+    imageBarriers_.push_back(barrier);
+
+    srcStageMask_ |= VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
+    dstStageMask_ |= VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
+}
+
+void VKResourceStateTracker::ResolveStates()
+{
+    for (auto& state : textureStates_)
+    {
+        if (state.layout != g_defaultImageLayout || (state.accessMask & g_writeAccessMask) != 0)
+            AccessTextureState(state, g_defaultImageLayout, g_defaultAccessMask, g_defaultStageMask);
+    }
+
+    for (auto& state : bufferStates_)
+    {
+        if ((state.accessMask & g_writeAccessMask) != 0)
+            AccessBufferState(state, GetDefaultBufferAccessMask(*(state.buffer)), g_defaultStageMask);
+    }
+}
+
+void VKResourceStateTracker::FlushBarriers(VkCommandBuffer commandBuffer)
+{
+    if (!imageBarriers_.empty() || !bufferBarriers_.empty())
+    {
+        /* Record all collected barriers at once */
+        vkCmdPipelineBarrier(
+            commandBuffer,
+            srcStageMask_,
+            dstStageMask_,
+            0,
+            0, nullptr,
+            static_cast<std::uint32_t>(bufferBarriers_.size()), bufferBarriers_.data(),
+            static_cast<std::uint32_t>(imageBarriers_.size()), imageBarriers_.data()
+        );
+
+        /* Reset pending barriers */
+        for (const auto& barrier : imageBarriers_)
+            textureStates_[textureStateMap_[barrier.image]].barrierIndex = g_invalidBarrierIndex;
+        for (const auto& barrier : bufferBarriers_)
+            bufferStates_[bufferStateMap_[barrier.buffer]].barrierIndex = g_invalidBarrierIndex;
+
+        imageBarriers_.clear();
+        bufferBarriers_.clear();
+        srcStageMask_ = 0;
+        dstStageMask_ = 0;
+    }
+}
+
+VkImageLayout VKResourceStateTracker::GetTextureLayout(const VKTexture& textureVK) const
+{
+    auto it = textureStateMap_.find(textureVK.GetVkImage());
+    if (it != textureStateMap_.end())
+        return textureStates_[it->second].layout;
+    else
+        return g_defaultImageLayout;
+}
+
+VkImageLayout VKResourceStateTracker::GetDefaultTextureLayout()
+{
+    return g_defaultImageLayout;
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+VKResourceStateTracker::TextureState& VKResourceStateTracker::FetchTextureState(const VKTexture& textureVK)
+{
+    auto result = textureStateMap_.insert({ textureVK.GetVkImage(), textureStates_.size() });
+    if (result.second)
+    {
+        /* Start with default state; previous command buffers have left the texture readable for all subsequent commands */
+        textureStates_.push_back({ &textureVK, g_defaultImageLayout, g_defaultAccessMask, g_defaultStageMask, g_invalidBarrierIndex });
+    }
+    return textureStates_[result.first->second];
+}
+
+VKResourceStateTracker::BufferState& VKResourceStateTracker::FetchBufferState(const VKBuffer& bufferVK)
+{
+    auto result = bufferStateMap_.insert({ bufferVK.GetVkBuffer(), bufferStates_.size() });
+    if (result.second)
+    {
+        /* Start with default state; previous command buffers have left the buffer readable for all subsequent commands */
+        bufferStates_.push_back({ &bufferVK, GetDefaultBufferAccessMask(bufferVK), g_defaultStageMask, g_invalidBarrierIndex });
+    }
+    return bufferStates_[result.first->second];
+}
+
+void VKResourceStateTracker::AccessTextureState(TextureState& state, VkImageLayout layout, VkAccessFlags accessMask, VkPipelineStageFlags stageMask)
+{
+    if (renderPassActive_)
+    {
+        /* Only merge access into state; all textures have been resolved before the render pass began */
+        state.accessMask    |= accessMask;
+        state.stageMask     |= stageMask;
+    }
+    else if (state.barrierIndex != g_invalidBarrierIndex)
+    {
+        /* Merge access into pending barrier of the same image, since no command was recorded in between */
+        auto& barrier = imageBarriers_[state.barrierIndex];
+        {
+            barrier.newLayout       = layout;
+            barrier.dstAccessMask   |= accessMask;
+        }
+        dstStageMask_ |= stageMask;
+
+        state.layout        = layout;
+        state.accessMask    |= accessMask;
+        state.stageMask     |= stageMask;
+    }
+    else if (state.layout != layout || ((state.accessMask | accessMask) & g_writeAccessMask) != 0)
+    {
+        /* Collect barrier for layout transition, or for a hazard with a previous or upcoming write access */
+        state.barrierIndex = imageBarriers_.size();
+
+        const auto& textureVK = *(state.texture);
+
+        VkImageMemoryBarrier barrier;
+        {
+            barrier.sType                           = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+            barrier.pNext                           = nullptr;
+            barrier.srcAccessMask                   = (state.accessMask & g_writeAccessMask);
+            barrier.dstAccessMask                   = accessMask;
+            barrier.oldLayout                       = state.layout;
+            barrier.newLayout                       = layout;
+            barrier.srcQueueFamilyIndex             = VK_QUEUE_FAMILY_IGNORED;
+            barrier.dstQueueFamilyIndex             = VK_QUEUE_FAMILY_IGNORED;
+            barrier.image                           = textureVK.GetVkImage();
+            barrier.subresourceRange.aspectMask     = VKGetImageAspectByFormat(textureVK.GetVkFormat());
+            barrier.subresourceRange.baseMipLevel   = 0;
+            barrier.subresourceRange.levelCount     = textureVK.GetNumMipLevels();
+            barrier.subresourceRange.baseArrayLayer = 0;
+            barrier.subresourceRange.layerCount     = textureVK.GetNumArrayLayers();
+        }
+        imageBarriers_.push_back(barrier);
+
+        srcStageMask_ |= state.stageMask;
+        dstStageMask_ |= stageMask;
+
+        state.layout        = layout;
+        state.accessMask    = accessMask;
+        state.stageMask     = stageMask;
+    }
+    else
+    {
+        /* Read-after-read in the same layout does not require a barrier */
+        state.accessMask    |= accessMask;
+        state.stageMask     |= stageMask;
+    }
+}
+
+void VKResourceStateTracker::AccessBufferState(BufferState& state, VkAccessFlags accessMask, VkPipelineStageFlags stageMask)
+{
+    if (renderPassActive_)
+    {
+        /* Only merge access into state; all buffers have been resolved before the render pass began */
+        state.accessMask    |= accessMask;
+        state.stageMask     |= stageMask;
+    }
+    else if (state.barrierIndex != g_invalidBarrierIndex)
+    {
+        /* Merge access into pending barrier of the same buffer, since no command was recorded in between */
+        bufferBarriers_[state.barrierIndex].dstAccessMask |= accessMask;
+        dstStageMask_ |= stageMask;
+
+        state.accessMask    |= accessMask;
+        state.stageMask     |= stageMask;
+    }
+    else if (((state.accessMask | accessMask) & g_writeAccessMask) != 0)
+    {
+        /* Collect barrier for a hazard with a previous or upcoming write access */
+        state.barrierIndex = bufferBarriers_.size();
+
+        VkBufferMemoryBarrier barrier;
+        {
+            barrier.sType               = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER;
+            barrier.pNext               = nullptr;
+            barrier.srcAccessMask       = (state.accessMask & g_writeAccessMask);
+            barrier.dstAccessMask       = accessMask;
+            barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+            barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+            barrier.buffer              = state.buffer->GetVkBuffer();
+            barrier.offset              = 0;
+            barrier.size                = VK_WHOLE_SIZE;
+        }
+        bufferBarriers_.push_back(barrier);
+
+        srcStageMask_ |= state.stageMask;
+        dstStageMask_ |= stageMask;
+
+        state.accessMask    = accessMask;
+        state.stageMask     = stageMask;
+    }
+    else
+    {
+        /* Read-after-read does not require a barrier */
+        state.accessMask    |= accessMask;
+        state.stageMask     |= stageMask;
+    }
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,118 @@
+/*
+ * VKResourceStateTracker.h
+ * 
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_VK_RESOURCE_STATE_TRACKER_H
+#define LLGL_VK_RESOURCE_STATE_TRACKER_H
+
+
+#include "Vulkan.h"
+#include <unordered_map>
+#include <vector>
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+class VKTexture;
+class VKBuffer;
+
+/*
+Tracks the last access and image layout of all textures and buffers that are used within a command buffer recording,
+and records the minimal set of pipeline barriers that is required between these accesses.
+Barriers are not recorded immediately, but collected until the next command that depends on them (see FlushBarriers),
+so all barriers for a single command are recorded with one 'vkCmdPipelineBarrier' and multiple barriers for the same resource are merged.
+Textures rest in VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL between command buffers (see ResolveStates).
+*/
+class VKResourceStateTracker
+{
+
+    public:
+
+        // Resets all tracked resource states for a new command buffer recording.
+        void Reset();
+
+        // Declares the next access to the entire texture in the specified image layout, and collects a barrier if required.
+        void AccessTexture(const VKTexture& textureVK, VkImageLayout layout, VkAccessFlags accessMask, VkPipelineStageFlags stageMask);
+
+        // Declares the next access to the entire buffer, and collects a barrier if required.
+        void AccessBuffer(const VKBuffer& bufferVK, VkAccessFlags accessMask, VkPipelineStageFlags stageMask);
+
+        // Collects a layout transition for a single texture subresource that was left in a different layout by a render pass.
+        void RestoreTextureSubresource(const VKTexture& textureVK, std::uint32_t mipLevel, std::uint32_t arrayLayer, VkImageLayout oldLayout);
+
+        // Collects barriers for all resources that were written or left in a non-default layout, so they can be read anywhere afterwards.
+        void ResolveStates();
+
+        // Records all collected barriers with a single pipeline barrier command.
+        void FlushBarriers(VkCommandBuffer commandBuffer);
+
+        /*
+        Specifies whether a render pass is active. Barriers can not be recorded within a render pass,
+        so accesses are only merged into the tracked states while a render pass is active (see ResolveStates).
+        */
+        inline void SetRenderPassActive(bool active)
+        {
+            renderPassActive_ = active;
+        }
+
+        // Returns the image layout the specified texture is currently tracked in.
+        VkImageLayout GetTextureLayout(const VKTexture& textureVK) const;
+
+        // Returns the image layout all textures rest in between command buffers.
+        static VkImageLayout GetDefaultTextureLayout();
+
+    private:
+
+        struct TextureState
+        {
+            const VKTexture*        texture;
+            VkImageLayout           layout;
+            VkAccessFlags           accessMask;
+            VkPipelineStageFlags    stageMask;
+            std::size_t             barrierIndex;
+        };
+
+        struct BufferState
+        {
+            const VKBuffer*         buffer;
+            VkAccessFlags           accessMask;
+            VkPipelineStageFlags    stageMask;
+            std::size_t             barrierIndex;
+        };
+
+        TextureState& FetchTextureState(const VKTexture& textureVK);
+        BufferState& FetchBufferState(const VKBuffer& bufferVK);
+
+        void AccessTextureState(TextureState& state, VkImageLayout layout, VkAccessFlags accessMask, VkPipelineStageFlags stageMask);
+        void AccessBufferState(BufferState& state, VkAccessFlags accessMask, VkPipelineStageFlags stageMask);
+
+        std::vector<TextureState>                   textureStates_;
+        std::unordered_map<VkImage, std::size_t>    textureStateMap_;
+
+        std::vector<BufferState>                    bufferStates_;
+        std::unordered_map<VkBuffer, std::size_t>   bufferStateMap_;
+
+        std::vector<VkImageMemoryBarrier>           imageBarriers_;
+        std::vector<VkBufferMemoryBarrier>          bufferBarriers_;
+        VkPipelineStageFlags                        srcStageMask_       = 0;
+        VkPipelineStageFlags                        dstStageMask_       = 0;
+
+        bool                                        renderPassActive_   = false;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
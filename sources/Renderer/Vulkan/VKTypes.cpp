@@ -130,6 +130,16 @@ VkFormat Map(const Format format)
         case Format::BC1RGBA:           return VK_FORMAT_BC1_RGBA_UNORM_BLOCK;
         case Format::BC2RGBA:           return VK_FORMAT_BC2_UNORM_BLOCK;
         case Format::BC3RGBA:           return VK_FORMAT_BC3_UNORM_BLOCK;
+        case Format::BC4RUNorm:         return VK_FORMAT_BC4_UNORM_BLOCK;
+        case Format::BC4RSNorm:         return VK_FORMAT_BC4_SNORM_BLOCK;
+        case Format::BC5RGUNorm:        return VK_FORMAT_BC5_UNORM_BLOCK;
+        case Format::BC5RGSNorm:        return VK_FORMAT_BC5_SNORM_BLOCK;
+        case Format::BC6HRGBUFloat:     return VK_FORMAT_BC6H_UFLOAT_BLOCK;
+        case Format::BC6HRGBSFloat:     return VK_FORMAT_BC6H_SFLOAT_BLOCK;
+        case Format::BC7RGBAUNorm:      return VK_FORMAT_BC7_UNORM_BLOCK;
+        case Format::ETC2RGB8UNorm:     return VK_FORMAT_ETC2_R8G8B8_UNORM_BLOCK;
+        case Format::ETC2RGB8A1UNorm:   return VK_FORMAT_ETC2_R8G8B8A1_UNORM_BLOCK;
+        case Format::ETC2RGBA8UNorm:    return VK_FORMAT_ETC2_R8G8B8A8_UNORM_BLOCK;
     }
     MapFailed("Format", "VkFormat");
 }
@@ -352,6 +362,20 @@ VkAttachmentStoreOp Map(const AttachmentStoreOp storeOp)
     MapFailed("AttachmentStoreOp", "VkAttachmentStoreOp");
 }
 
+VkComponentSwizzle Map(const TextureSwizzle textureSwizzle)
+{
+    switch (textureSwizzle)
+    {
+        case TextureSwizzle::Zero:  return VK_COMPONENT_SWIZZLE_ZERO;
+        case TextureSwizzle::One:   return VK_COMPONENT_SWIZZLE_ONE;
+        case TextureSwizzle::Red:   return VK_COMPONENT_SWIZZLE_R;
+        case TextureSwizzle::Green: return VK_COMPONENT_SWIZZLE_G;
+        case TextureSwizzle::Blue:  return VK_COMPONENT_SWIZZLE_B;
+        case TextureSwizzle::Alpha: return VK_COMPONENT_SWIZZLE_A;
+    }
+    MapFailed("TextureSwizzle", "VkComponentSwizzle");
+}
+
 Format Unmap(const VkFormat format)
 {
     switch (format)
@@ -441,6 +465,16 @@ Format Unmap(const VkFormat format)
         case VK_FORMAT_BC1_RGBA_UNORM_BLOCK:    return Format::BC1RGBA;
         case VK_FORMAT_BC2_UNORM_BLOCK:         return Format::BC2RGBA;
         case VK_FORMAT_BC3_UNORM_BLOCK:         return Format::BC3RGBA;
+        case VK_FORMAT_BC4_UNORM_BLOCK:         return Format::BC4RUNorm;
+        case VK_FORMAT_BC4_SNORM_BLOCK:         return Format::BC4RSNorm;
+        case VK_FORMAT_BC5_UNORM_BLOCK:         return Format::BC5RGUNorm;
+        case VK_FORMAT_BC5_SNORM_BLOCK:         return Format::BC5RGSNorm;
+        case VK_FORMAT_BC6H_UFLOAT_BLOCK:       return Format::BC6HRGBUFloat;
+        case VK_FORMAT_BC6H_SFLOAT_BLOCK:       return Format::BC6HRGBSFloat;
+        case VK_FORMAT_BC7_UNORM_BLOCK:         return Format::BC7RGBAUNorm;
+        case VK_FORMAT_ETC2_R8G8B8_UNORM_BLOCK:     return Format::ETC2RGB8UNorm;
+        case VK_FORMAT_ETC2_R8G8B8A1_UNORM_BLOCK:   return Format::ETC2RGB8A1UNorm;
+        case VK_FORMAT_ETC2_R8G8B8A8_UNORM_BLOCK:   return Format::ETC2RGBA8UNorm;
 
         default:                                return Format::Undefined;
     }
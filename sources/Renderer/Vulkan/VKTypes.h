@@ -48,6 +48,7 @@ VkDescriptorType        Map( const ResourceType         resourceViewType  );
 VkQueryType             Map( const QueryType            queryType         );
 VkAttachmentLoadOp      Map( const AttachmentLoadOp     loadOp            );
 VkAttachmentStoreOp     Map( const AttachmentStoreOp    storeOp           );
+VkComponentSwizzle      Map( const TextureSwizzle       textureSwizzle    );
 
 Format                  Unmap( const VkFormat format );
 
@@ -0,0 +1,132 @@
+/*
+ * Test10_DebugLayer.cpp
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "TestFixture.h"
+#include <chrono>
+
+
+struct TestConfig
+{
+    std::uint32_t numFrames         = 200;
+    std::uint32_t numDrawsPerFrame  = 5000;
+};
+
+class DebugLayerTest : public TestFixture
+{
+
+    public:
+
+        DebugLayerTest(const TestConfig& config) :
+            config_ { config }
+        {
+        }
+
+        // Returns the average CPU time (in microseconds) to record and submit a frame.
+        double Run()
+        {
+            auto startTime = std::chrono::steady_clock::now();
+
+            for (std::uint32_t frame = 0; frame < config_.numFrames; ++frame)
+            {
+                commands->Begin();
+                {
+                    commands->BeginRenderPass(*context);
+                    {
+                        commands->SetViewport(LLGL::Viewport{ { 0, 0 }, context->GetVideoMode().resolution });
+                        BindResources(*commands);
+
+                        for (std::uint32_t i = 0; i < config_.numDrawsPerFrame; ++i)
+                            commands->Draw(3, 0);
+                    }
+                    commands->EndRenderPass();
+                }
+                commands->End();
+                queue->Submit(*commands);
+
+                context->Present();
+            }
+
+            queue->WaitIdle();
+
+            auto duration = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - startTime);
+            return static_cast<double>(duration.count()) / static_cast<double>(config_.numFrames);
+        }
+
+    private:
+
+        TestConfig config_;
+
+};
+
+static double MeasureFrameTime(const TestConfig& testConfig, LLGL::RenderingDebugger* debugger)
+{
+    DebugLayerTest test { testConfig };
+    test.Load(debugger);
+    auto frameTime = test.Run();
+    test.Unload();
+    return frameTime;
+}
+
+static void PrintFrameTime(const std::string& title, double frameTime, double baseFrameTime)
+{
+    std::cout << title << std::endl;
+    std::cout << "\tframe time: " << frameTime << "us (overhead: " << (frameTime / baseFrameTime - 1.0) * 100.0 << "%)" << "\n\n";
+}
+
+int main()
+{
+    return RunTest(
+        []()
+        {
+            TestConfig testConfig;
+
+            std::cout << "run debug layer tests with " << testConfig.numFrames << " frames and " << testConfig.numDrawsPerFrame << " draw calls per frame ..." << std::endl << std::endl;
+
+            // Measure plain backend
+            auto plainFrameTime = MeasureFrameTime(testConfig, nullptr);
+            PrintFrameTime("plain backend", plainFrameTime, plainFrameTime);
+
+            // Measure debug layer with full validation
+            {
+                LLGL::RenderingDebugger debugger;
+                auto frameTime = MeasureFrameTime(testConfig, &debugger);
+                PrintFrameTime("debug layer with full validation", frameTime, plainFrameTime);
+            }
+
+            // Measure debug layer with sampled validation
+            {
+                LLGL::ValidationSamplingDescriptor samplingDesc;
+                {
+                    samplingDesc.frameInterval      = 10;
+                    samplingDesc.commandInterval    = 100;
+                }
+                LLGL::RenderingDebugger debugger;
+                debugger.SetValidationSampling(samplingDesc);
+
+                auto frameTime = MeasureFrameTime(testConfig, &debugger);
+                PrintFrameTime("debug layer with sampled validation (every 10th frame, every 100th draw)", frameTime, plainFrameTime);
+
+                const auto& stats = debugger.GetValidationStatistics();
+                std::cout << "\tvalidated frames: " << stats.numValidatedFrames << '/' << stats.numFrames << std::endl;
+                std::cout << "\tvalidated draws: " << stats.numValidatedCommands << '/' << stats.numCommands << "\n\n";
+            }
+
+            // Measure debug layer with time budget
+            {
+                LLGL::ValidationSamplingDescriptor samplingDesc;
+                {
+                    samplingDesc.frameTimeBudget = 100000; // 0.1 ms
+                }
+                LLGL::RenderingDebugger debugger;
+                debugger.SetValidationSampling(samplingDesc);
+
+                auto frameTime = MeasureFrameTime(testConfig, &debugger);
+                PrintFrameTime("debug layer with validation time budget of 0.1ms per frame", frameTime, plainFrameTime);
+            }
+        }
+    );
+}
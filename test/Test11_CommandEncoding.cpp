@@ -0,0 +1,111 @@
+/*
+ * Test11_CommandEncoding.cpp
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "TestFixture.h"
+#include <chrono>
+
+
+struct TestConfig
+{
+    std::uint32_t numIterations = 20;
+    std::uint32_t numCalls      = 100000;
+};
+
+class CommandEncodingTest : public TestFixture
+{
+
+    public:
+
+        CommandEncodingTest(const TestConfig& config) :
+            config_ { config }
+        {
+        }
+
+        void Run(const std::string& mode)
+        {
+            auto setVertexBufferTime = MeasureEncoding(
+                [this]() { commands->SetVertexBuffer(*vertexBuffer); }
+            );
+
+            auto setResourceHeapTime = MeasureEncoding(
+                [this]() { commands->SetGraphicsResourceHeap(*resourceHeap); }
+            );
+
+            auto drawIndexedTime = MeasureEncoding(
+                [this]() { commands->DrawIndexed(3, 0); }
+            );
+
+            std::cout << mode << std::endl;
+            std::cout << "\tSetVertexBuffer:         " << setVertexBufferTime << "ns per call" << std::endl;
+            std::cout << "\tSetGraphicsResourceHeap: " << setResourceHeapTime << "ns per call" << std::endl;
+            std::cout << "\tDrawIndexed:             " << drawIndexedTime << "ns per call" << "\n\n";
+        }
+
+    private:
+
+        // Returns the average CPU time (in nanoseconds) per call of the specified encoding function.
+        template <typename TEncodeFunc>
+        double MeasureEncoding(const TEncodeFunc& encodeFunc)
+        {
+            std::chrono::steady_clock::duration duration { 0 };
+
+            for (std::uint32_t i = 0; i < config_.numIterations; ++i)
+            {
+                commands->Begin();
+                commands->BeginRenderPass(*context);
+                BindResources(*commands);
+
+                auto startTime = std::chrono::steady_clock::now();
+                {
+                    for (std::uint32_t j = 0; j < config_.numCalls; ++j)
+                        encodeFunc();
+                }
+                duration += std::chrono::steady_clock::now() - startTime;
+
+                commands->EndRenderPass();
+                commands->End();
+
+                queue->Submit(*commands);
+                queue->WaitIdle();
+            }
+
+            auto numCalls = static_cast<double>(config_.numIterations) * static_cast<double>(config_.numCalls);
+            return static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count()) / numCalls;
+        }
+
+    private:
+
+        TestConfig config_;
+
+};
+
+static void MeasureEncoding(const TestConfig& testConfig, LLGL::RenderingDebugger* debugger, const std::string& mode)
+{
+    CommandEncodingTest test { testConfig };
+    test.Load(debugger);
+    test.Run(mode);
+    test.Unload();
+}
+
+int main()
+{
+    return RunTest(
+        []()
+        {
+            TestConfig testConfig;
+
+            std::cout << "run command encoding tests with " << testConfig.numCalls << " calls per iteration ..." << std::endl << std::endl;
+
+            // Measure calls into the backend command buffer
+            MeasureEncoding(testConfig, nullptr, "backend command buffer");
+
+            // Measure calls through the debug layer, which adds another virtual call per command
+            LLGL::RenderingDebugger debugger;
+            MeasureEncoding(testConfig, &debugger, "debug layer command buffer");
+        }
+    );
+}
@@ -0,0 +1,97 @@
+/*
+ * Test12_VulkanHeadless.cpp
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include <LLGL/LLGL.h>
+#include <iostream>
+#include <cstdlib>
+
+
+// Renders and presents frames into a headless surface, e.g. with a software Vulkan driver, to test presentation with multiple frames in flight
+int main()
+{
+    try
+    {
+        // Load Vulkan render system with headless surface
+        LLGL::VulkanRendererConfiguration config;
+        {
+            config.numFramesInFlight    = 3;
+            config.headlessSurface      = true;
+        }
+        LLGL::RenderSystemDescriptor rendererDesc;
+        {
+            rendererDesc.moduleName         = "Vulkan";
+            rendererDesc.rendererConfig     = &config;
+            rendererDesc.rendererConfigSize = sizeof(config);
+        }
+        auto renderer = LLGL::RenderSystem::Load(rendererDesc);
+
+        std::cout << "Renderer: " << renderer->GetRendererInfo().rendererName << std::endl;
+        std::cout << "Device:   " << renderer->GetRendererInfo().deviceName << std::endl;
+
+        // Create render context; the headless surface ignores the window of the context
+        LLGL::RenderContextDescriptor contextDesc;
+        {
+            contextDesc.videoMode.resolution    = { 320, 240 };
+            contextDesc.videoMode.swapChainSize = 3;
+        }
+        auto context = renderer->CreateRenderContext(contextDesc);
+
+        auto queue = renderer->GetCommandQueue();
+
+        // Create two command buffers, so a frame can be recorded while the other one is still in flight
+        LLGL::CommandBuffer* commandBuffers[] = { renderer->CreateCommandBuffer(), renderer->CreateCommandBuffer() };
+
+        const std::uint32_t numFrames = 120;
+
+        for (std::uint32_t frame = 0; frame < numFrames; ++frame)
+        {
+            auto commands = commandBuffers[frame % 2];
+
+            // Skip rendering every 10th frame, so the presentation semaphores are submitted separately
+            if (frame % 10 != 9)
+            {
+                commands->Begin();
+                {
+                    commands->SetClearColor({ static_cast<float>(frame % 60) / 60.0f, 0.2f, 0.4f, 1.0f });
+                    commands->BeginRenderPass(*context);
+                    {
+                        commands->Clear(LLGL::ClearFlags::Color);
+                    }
+                    commands->EndRenderPass();
+                }
+                commands->End();
+
+                // Alternate between single and batched submissions
+                if (frame % 2 == 0)
+                    queue->Submit(*commands);
+                else
+                    queue->Submit(1, &commands);
+            }
+
+            context->Present();
+
+            // Change resolution in between to recreate the swap-chain while frames are in flight
+            if (frame == numFrames / 2)
+            {
+                auto videoMode = context->GetVideoMode();
+                videoMode.resolution = { 640, 480 };
+                context->SetVideoMode(videoMode);
+            }
+        }
+
+        queue->WaitIdle();
+
+        std::cout << "Presented " << numFrames << " frames to headless surface" << std::endl;
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << e.what() << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
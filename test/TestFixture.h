@@ -0,0 +1,214 @@
+/*
+ * TestFixture.h
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_TEST_FIXTURE_H
+#define LLGL_TEST_FIXTURE_H
+
+
+#include <LLGL/LLGL.h>
+#include <memory>
+#include <iostream>
+#include <string>
+#include <cstdlib>
+
+
+// Render system, render context, and resources to draw a single triangle, which are shared by the CPU overhead tests.
+// The OpenGL renderer is always used, since the shaders are written in GLSL.
+class TestFixture
+{
+
+    public:
+
+        // Loads the OpenGL render system with an optional debugger and creates all resources.
+        void Load(LLGL::RenderingDebugger* debugger = nullptr)
+        {
+            // Load renderer with optional debugger, which wraps the backend objects
+            renderer = LLGL::RenderSystem::Load("OpenGL", nullptr, debugger);
+
+            // Create render context
+            LLGL::RenderContextDescriptor contextDesc;
+            {
+                contextDesc.videoMode.resolution = { 640, 480 };
+            }
+            context = renderer->CreateRenderContext(contextDesc);
+
+            // Create command queue and command buffer
+            queue       = renderer->GetCommandQueue();
+            commands    = renderer->CreateCommandBuffer();
+
+            // Create resources
+            CreateResources();
+        }
+
+        // Unloads the render system and all its objects.
+        void Unload()
+        {
+            LLGL::RenderSystem::Unload(std::move(renderer));
+        }
+
+    protected:
+
+        // Binds the pipeline and all resources to draw the triangle. This must be called within a render pass.
+        void BindResources(LLGL::CommandBuffer& cmdBuffer)
+        {
+            cmdBuffer.SetGraphicsPipeline(*pipeline);
+            cmdBuffer.SetVertexBuffer(*vertexBuffer);
+            cmdBuffer.SetIndexBuffer(*indexBuffer);
+            cmdBuffer.SetGraphicsResourceHeap(*resourceHeap);
+        }
+
+    private:
+
+        LLGL::Shader* CreateShader(LLGL::ShaderType type, const char* source)
+        {
+            LLGL::ShaderDescriptor shaderDesc;
+            {
+                shaderDesc.type         = type;
+                shaderDesc.source       = source;
+                shaderDesc.sourceType   = LLGL::ShaderSourceType::CodeString;
+            }
+            auto shader = renderer->CreateShader(shaderDesc);
+
+            if (shader->HasErrors())
+                std::cerr << shader->QueryInfoLog() << std::endl;
+
+            return shader;
+        }
+
+        void CreateResources()
+        {
+            // Create vertex buffer
+            LLGL::VertexFormat vertexFormat;
+            vertexFormat.AppendAttribute({ "position", LLGL::Format::RG32Float });
+
+            const float vertices[] = { 0.0f, 0.5f, 0.5f, -0.5f, -0.5f, -0.5f };
+
+            LLGL::BufferDescriptor vertexBufferDesc;
+            {
+                vertexBufferDesc.type                   = LLGL::BufferType::Vertex;
+                vertexBufferDesc.size                   = sizeof(vertices);
+                vertexBufferDesc.vertexBuffer.format    = vertexFormat;
+            }
+            vertexBuffer = renderer->CreateBuffer(vertexBufferDesc, vertices);
+
+            // Create index buffer
+            const std::uint32_t indices[] = { 0, 1, 2 };
+
+            LLGL::BufferDescriptor indexBufferDesc;
+            {
+                indexBufferDesc.type                = LLGL::BufferType::Index;
+                indexBufferDesc.size                = sizeof(indices);
+                indexBufferDesc.indexBuffer.format  = LLGL::IndexFormat(LLGL::DataType::UInt32);
+            }
+            indexBuffer = renderer->CreateBuffer(indexBufferDesc, indices);
+
+            // Create constant buffer
+            const float color[4] = { 1.0f, 1.0f, 1.0f, 1.0f };
+
+            LLGL::BufferDescriptor constantBufferDesc;
+            {
+                constantBufferDesc.type = LLGL::BufferType::Constant;
+                constantBufferDesc.size = sizeof(color);
+            }
+            constantBuffer = renderer->CreateBuffer(constantBufferDesc, color);
+
+            // Create pipeline layout and resource heap
+            LLGL::PipelineLayoutDescriptor layoutDesc;
+            {
+                layoutDesc.bindings = { LLGL::BindingDescriptor{ LLGL::ResourceType::ConstantBuffer, LLGL::StageFlags::FragmentStage, 0 } };
+            }
+            auto pipelineLayout = renderer->CreatePipelineLayout(layoutDesc);
+
+            LLGL::ResourceHeapDescriptor resourceHeapDesc;
+            {
+                resourceHeapDesc.pipelineLayout = pipelineLayout;
+                resourceHeapDesc.resourceViews  = { constantBuffer };
+            }
+            resourceHeap = renderer->CreateResourceHeap(resourceHeapDesc);
+
+            // Create shader program
+            auto vertShader = CreateShader(
+                LLGL::ShaderType::Vertex,
+                "#version 140\n"
+                "in vec2 position;\n"
+                "void main() {\n"
+                "    gl_Position = vec4(position, 0.0, 1.0);\n"
+                "}\n"
+            );
+
+            auto fragShader = CreateShader(
+                LLGL::ShaderType::Fragment,
+                "#version 140\n"
+                "layout(std140) uniform Settings {\n"
+                "    vec4 color;\n"
+                "};\n"
+                "out vec4 fragColor;\n"
+                "void main() {\n"
+                "    fragColor = color;\n"
+                "}\n"
+            );
+
+            LLGL::ShaderProgramDescriptor shaderProgramDesc;
+            {
+                shaderProgramDesc.vertexFormats     = { vertexFormat };
+                shaderProgramDesc.vertexShader      = vertShader;
+                shaderProgramDesc.fragmentShader    = fragShader;
+            }
+            auto shaderProgram = renderer->CreateShaderProgram(shaderProgramDesc);
+
+            if (shaderProgram->HasErrors())
+                std::cerr << shaderProgram->QueryInfoLog() << std::endl;
+
+            // Create graphics pipeline
+            LLGL::GraphicsPipelineDescriptor pipelineDesc;
+            {
+                pipelineDesc.shaderProgram  = shaderProgram;
+                pipelineDesc.pipelineLayout = pipelineLayout;
+            }
+            pipeline = renderer->CreateGraphicsPipeline(pipelineDesc);
+        }
+
+    protected:
+
+        std::unique_ptr<LLGL::RenderSystem> renderer;
+        LLGL::RenderContext*                context         = nullptr;
+        LLGL::CommandQueue*                 queue           = nullptr;
+        LLGL::CommandBuffer*                commands        = nullptr;
+        LLGL::Buffer*                       vertexBuffer    = nullptr;
+        LLGL::Buffer*                       indexBuffer     = nullptr;
+        LLGL::Buffer*                       constantBuffer  = nullptr;
+        LLGL::ResourceHeap*                 resourceHeap    = nullptr;
+        LLGL::GraphicsPipeline*             pipeline        = nullptr;
+
+};
+
+// Runs the specified test procedure, prints all exceptions, and keeps the console open on Windows.
+template <typename TTestProc>
+int RunTest(const TTestProc& testProc)
+{
+    int result = EXIT_SUCCESS;
+
+    try
+    {
+        testProc();
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << e.what() << std::endl;
+        result = EXIT_FAILURE;
+    }
+
+    #ifdef _WIN32
+    system("pause");
+    #endif
+
+    return result;
+}
+
+
+#endif
+